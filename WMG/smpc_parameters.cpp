@@ -11,14 +11,53 @@ smpc_parameters::smpc_parameters(
         const unsigned int N,
         const double hCoM_,
         const double gravity_)
+{
+    const size_t mem_size = get_mem_size (N);
+
+    own_mem = new double[(mem_size + sizeof(double) - 1) / sizeof(double)];
+    smpc::arena mem (own_mem, mem_size);
+
+    init (mem, N, hCoM_, gravity_);
+}
+
+
+smpc_parameters::smpc_parameters(
+        smpc::arena &mem,
+        const unsigned int N,
+        const double hCoM_,
+        const double gravity_)
+{
+    const size_t mem_size = get_mem_size (N);
+    void *chunk = mem.alloc<char>(mem_size);
+
+    if (chunk == NULL)
+    {
+        own_mem = new double[(mem_size + sizeof(double) - 1) / sizeof(double)];
+        chunk = own_mem;
+    }
+    else
+    {
+        own_mem = NULL;
+    }
+    smpc::arena chunk_mem (chunk, mem_size);
+
+    init (chunk_mem, N, hCoM_, gravity_);
+}
+
+
+void smpc_parameters::init(
+        smpc::arena &mem,
+        const unsigned int N,
+        const double hCoM_,
+        const double gravity_)
 {
     hCoM = hCoM_;
     gravity = gravity_;
 
-    X = new double[SMPC_NUM_VAR*N];
+    X = mem.alloc<double>(SMPC_NUM_VAR*N);
 
-    T = new double[N];
-    h = new double[N];
+    T = mem.alloc<double>(N);
+    h = mem.alloc<double>(N);
 
     h0 = hCoM/gravity;
     for (unsigned int i = 0; i < N; i++)
@@ -26,60 +65,29 @@ smpc_parameters::smpc_parameters(
         h[i] = h0;
     }
 
-    angle = new double[N];
-    zref_x = new double[N];
-    zref_y = new double[N];
-    fp_x = new double[N];
-    fp_y = new double[N];
-    lb = new double[2*N];
-    ub = new double[2*N];
+    angle = mem.alloc<double>(N);
+    zref_x = mem.alloc<double>(N);
+    zref_y = mem.alloc<double>(N);
+    fp_x = mem.alloc<double>(N);
+    fp_y = mem.alloc<double>(N);
+    lb = mem.alloc<double>(2*N);
+    ub = mem.alloc<double>(2*N);
 }
 
 
-
-smpc_parameters::~smpc_parameters()
+size_t smpc_parameters::get_mem_size (const unsigned int N)
 {
-    if (X != NULL)
-    {
-        delete [] X;
-        X = NULL;
-    }
+    return (smpc::arena::get_size<double>(SMPC_NUM_VAR*N)
+            + 7*smpc::arena::get_size<double>(N)
+            + 2*smpc::arena::get_size<double>(2*N));
+}
 
-    if (T != NULL)
-    {
-        delete T;
-    }
-    if (h != NULL)
-    {
-        delete h;
-    }
 
-    if (angle != NULL)
-    {
-        delete angle;
-    }
-    if (zref_x != NULL)
-    {
-        delete zref_x;
-    }
-    if (zref_y != NULL)
-    {
-        delete zref_y;
-    }
-    if (fp_x != NULL)
-    {
-        delete fp_x;
-    }
-    if (fp_y != NULL)
-    {
-        delete fp_y;
-    }
-    if (lb != NULL)
-    {
-        delete lb;
-    }
-    if (ub != NULL)
+
+smpc_parameters::~smpc_parameters()
+{
+    if (own_mem != NULL)
     {
-        delete ub;
+        delete [] own_mem;
     }
 }
@@ -67,12 +67,38 @@ class smpc_parameters
                 const double, 
                 const double gravity_ = 9.81);
 
+        /**
+         * @brief Initialize some of the parameters, the arrays are placed 
+         * in the given arena. If the arena does not have enough memory 
+         * (see #get_mem_size), the memory is allocated on the heap.
+         *
+         * @param[in,out] mem memory arena
+         * @param[in] N preview window length
+         * @param[in] hCoM_ Height of the Center of Mass [meter]
+         * @param[in] gravity_ gravity [m/s^2]
+         */
+        smpc_parameters (
+                smpc::arena &,
+                const unsigned int, 
+                const double, 
+                const double gravity_ = 9.81);
+
         /**
          * @brief Default destructor
          */
         ~smpc_parameters();
 
 
+        /**
+         * @brief Returns the amount of memory required for the arrays.
+         *
+         * @param[in] N preview window length
+         *
+         * @return the amount of memory [bytes].
+         */
+        static size_t get_mem_size (const unsigned int);
+
+
 
 // variables
         double hCoM;    /// Height of the CoM.
@@ -111,6 +137,13 @@ class smpc_parameters
 
         /// A chunk of memory allocated for solution.
         double *X;
+
+
+    private:
+        void init (smpc::arena &, const unsigned int, const double, const double);
+
+        /// Memory allocated on the heap, NULL if an arena is used.
+        double *own_mem;
 };
 
 
@@ -0,0 +1,158 @@
+/**
+ * @file
+ * @brief A memory arena, which can be used to place the solvers and
+ *  their parameters in one contiguous block of memory.
+ *
+ * @author Alexander Sherikov
+ * @date 17.10.2026 14:00:00 MSD
+ */
+
+
+#ifndef SMPC_ARENA_H
+#define SMPC_ARENA_H
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include <cstddef> // size_t
+#include <cstring> // memset
+
+
+/****************************************
+ * DEFINES
+ ****************************************/
+
+/// Alignment of the arrays allocated in smpc#arena [bytes], the size of
+/// a cache line.
+#define SMPC_ARENA_ALIGNMENT 64
+
+/// The size of a huge page [bytes], see smpc#arena#arena.
+#define SMPC_HUGE_PAGE_SIZE (2*1024*1024)
+
+
+/****************************************
+ * TYPEDEFS
+ ****************************************/
+
+/// @addtogroup gAPI
+/// @{
+
+namespace smpc
+{
+    /**
+     * @brief A trivial allocator, which places arrays one after another
+     * in a given chunk of memory. All internal buffers of a solver are
+     * allocated in one arena, the memory is not released until the arena
+     * is discarded.
+     *
+     * An arena can be passed to the constructors of smpc#solver_as,
+     * smpc#solver_ip and smpc_parameters, in this case all of them are
+     * placed in the same block of memory.
+     */
+    class arena
+    {
+        public:
+            /**
+             * @brief Constructor, which uses memory provided by the caller.
+             *
+             * @param[in] mem_ a chunk of memory.
+             * @param[in] size_ the size of the chunk [bytes].
+             */
+            arena (void *mem_, const size_t size_)
+            {
+                mem = static_cast<char *>(mem_);
+                size = size_;
+                used = 0;
+                own_mem = NULL;
+                mapped_size = 0;
+            }
+
+
+            arena (const size_t, const bool huge_pages = false);
+            ~arena();
+
+            bool lock ();
+
+
+            /**
+             * @brief Allocates zero-initialized memory for an array.
+             *
+             * @param[in] num the number of elements.
+             *
+             * @return a pointer to the array, NULL if there is not enough memory.
+             *
+             * @attention Constructors are not called, use placement new for
+             * the types, which have them.
+             */
+            template <class t_data>
+                t_data *alloc (const size_t num)
+            {
+                const size_t padding = (SMPC_ARENA_ALIGNMENT
+                        - reinterpret_cast<size_t>(mem + used) % SMPC_ARENA_ALIGNMENT)
+                    % SMPC_ARENA_ALIGNMENT;
+                const size_t num_bytes = num * sizeof(t_data);
+
+                if (used + padding + num_bytes > size)
+                {
+                    return (NULL);
+                }
+
+                char *ptr = mem + used + padding;
+                used += padding + num_bytes;
+                memset (ptr, 0, num_bytes);
+
+                return (reinterpret_cast<t_data *>(ptr));
+            }
+
+
+            /**
+             * @brief Returns the amount of memory, which is necessary to
+             * allocate an array in an arena.
+             *
+             * @param[in] num the number of elements.
+             *
+             * @return the upper bound of the required memory [bytes].
+             */
+            template <class t_data>
+                static size_t get_size (const size_t num)
+            {
+                return (num * sizeof(t_data) + SMPC_ARENA_ALIGNMENT - 1);
+            }
+
+
+            /**
+             * @return true if the memory of the arena is backed by huge pages.
+             */
+            bool huge_pages_on () const
+            {
+                return (mapped_size > 0);
+            }
+
+
+            /// The amount of used memory [bytes].
+            size_t used;
+
+
+        private:
+            // copying is not allowed
+            arena (const arena &);
+            arena & operator= (const arena &);
+
+
+            /// A chunk of memory.
+            char *mem;
+
+            /// The size of the chunk [bytes].
+            size_t size;
+
+            /// Memory allocated on the heap by the arena itself, NULL otherwise.
+            char *own_mem;
+
+            /// The size of the mapped huge pages [bytes], 0 if they are not used.
+            size_t mapped_size;
+    };
+}
+/// @}
+
+#endif /*SMPC_ARENA_H*/
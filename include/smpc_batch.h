@@ -0,0 +1,248 @@
+/**
+ * @file
+ * @brief Solution of many independent problems using a pool of threads.
+ *
+ * @author Alexander Sherikov
+ * @date 17.10.2026 23:00:00 MSD
+ */
+
+
+#ifndef SMPC_BATCH_H
+#define SMPC_BATCH_H
+
+#include <cstddef> // size_t
+#include <vector>
+
+#include "smpc_solver.h"
+
+
+/// @addtogroup gAPI
+/// @{
+
+namespace smpc
+{
+    class batch_pool;
+
+
+    /**
+     * @brief Status of a problem in smpc#solver_batch.
+     */
+    enum batchStatusType
+    {
+        /// The problem was not solved: it is disabled or
+        /// smpc#solver_batch#solve_all was not called yet.
+        SMPC_BATCH_NOT_SOLVED = 0,
+        /// The problem was solved.
+        SMPC_BATCH_SOLVED = 1,
+        /// The solver has thrown an exception.
+        SMPC_BATCH_FAILED = 2
+    };
+
+
+
+    /**
+     * @brief A problem solved by smpc#solver_batch: a solver and the
+     * buffers for its inputs and outputs.
+     *
+     * The arrays have the same meaning as the parameters of
+     * smpc#solver#set_parameters and smpc#solver#form_init_fp, they are
+     * allocated in one block of memory on construction and must be
+     * filled by the caller before smpc#solver_batch#solve_all.
+     */
+    class batch_problem
+    {
+        public:
+            batch_problem (solver *, const int);
+            ~batch_problem();
+
+
+            /// The solver, owned by the problem.
+            solver *sol;
+
+            /// Number of sampling times in a preview window
+            int N;
+
+
+            ///@{
+            /// Parameters of the problem, see smpc#solver#set_parameters.
+            double *T;
+            double *h;
+            double h_initial;
+            double *angle;
+            double *zref_x;
+            double *zref_y;
+            /// 2*N values.
+            double *lb;
+            /// 2*N values.
+            double *ub;
+            ///@}
+
+            ///@{
+            /// Initial feasible point, see smpc#solver#form_init_fp.
+            double *fp_x;
+            double *fp_y;
+            ///@}
+
+            /// The initial state.
+            state init_state;
+            /// If true, #init_state is in the @ref pX_tilde "tilde" form
+            /// (smpc#state_zmp), otherwise it is smpc#state_com.
+            bool init_state_zmp;
+
+            /// The solution (N*#SMPC_NUM_VAR values), used as a buffer
+            /// for the initial feasible point.
+            double *X;
+
+            /// The problem is skipped, if false.
+            bool enabled;
+
+
+            /// Status of the problem after the last call of
+            /// smpc#solver_batch#solve_all.
+            batchStatusType status;
+
+            /// The index of the thread, which solved the problem.
+            unsigned int thread;
+
+            /// True, if the problem was taken from the queue of another thread.
+            bool stolen;
+
+            /**
+             * @brief Time spent in the solution [ticks of the monotonic
+             * counter used by smpc#solver_stats].
+             *
+             * @note The time is measured only if the library is built with
+             * SMPC_INSTRUMENTATION option, otherwise it is zero. The timing
+             * of the phases is stored in solver#stats of #sol.
+             */
+            double ticks;
+
+
+        private:
+            batch_problem (const batch_problem &);
+            batch_problem& operator= (const batch_problem &);
+
+            /// Memory of the arrays.
+            double *mem;
+    };
+
+
+
+    /**
+     * @brief Solves many independent problems (e.g. a number of simulated
+     * robots) using a pool of threads.
+     *
+     * The threads are created on construction and reused by all calls of
+     * #solve_all. Each problem has a home thread (problem i is assigned
+     * to thread i % #get_threads_num), so that on each call it is solved
+     * in the same thread and its data stays in the caches of the same
+     * core. A thread, which has finished its own problems, steals the
+     * problems from the other threads.
+     *
+     * A call of #solve_all performs smpc#solver#set_parameters,
+     * smpc#solver#form_init_fp and smpc#solver#solve for each enabled
+     * problem and waits until all of them are solved.
+     *
+     * @attention The problems must not be accessed by the caller during
+     * #solve_all. The solvers must not share data, the problems are
+     * solved concurrently.
+     */
+    class solver_batch
+    {
+        public:
+            /**
+             * @brief Constructor: starts the threads.
+             *
+             * @param[in] threads_num the number of threads, the number of
+             * online processors is used if set to 0.
+             * @param[in] pin_threads_on pin the threads to the processors
+             * (thread i is pinned to processor i modulo the number of
+             * processors). Ignored if pthread_setaffinity_np() is not
+             * present on the system.
+             *
+             * @note If a thread cannot be created, fewer threads are used
+             * (see #get_threads_num); if none can be created, the problems
+             * are solved in the thread calling #solve_all.
+             */
+            solver_batch (
+                    const unsigned int threads_num = 0,
+                    const bool pin_threads_on = false);
+
+            /**
+             * @brief Stops the threads and destroys the problems and the
+             * solvers.
+             */
+            ~solver_batch();
+
+
+            /**
+             * @brief Adds a problem.
+             *
+             * @param[in] sol a solver allocated with new, the batch takes
+             * the ownership.
+             * @param[in] N the length of the preview window of the solver.
+             *
+             * @return index of the problem.
+             */
+            unsigned int add (solver *sol, const int N);
+
+
+            /**
+             * @param[in] ind index of the problem
+             * @return the problem with the given index.
+             */
+            batch_problem & problem (const unsigned int ind)
+            {
+                return (*problems[ind]);
+            }
+            const batch_problem & problem (const unsigned int ind) const
+            {
+                return (*problems[ind]);
+            }
+
+            /// @return the number of problems.
+            unsigned int size () const
+            {
+                return (problems.size());
+            }
+
+            /// @return the number of threads.
+            unsigned int get_threads_num () const;
+
+
+            /**
+             * @brief Solves all enabled problems and updates their status.
+             *
+             * @return the number of problems with status #SMPC_BATCH_SOLVED.
+             */
+            unsigned int solve_all ();
+
+
+            /**
+             * @brief The number of problems, which were solved by a thread
+             * other than their home thread.
+             *
+             * @note Updated by #solve_all function.
+             */
+            unsigned int stolen_num;
+
+
+        private:
+            solver_batch (const solver_batch &);
+            solver_batch& operator= (const solver_batch &);
+
+            void solve_problem (const unsigned int, const unsigned int, const bool);
+
+
+            /// Problems.
+            std::vector<batch_problem *> problems;
+
+            /// The threads and their queues.
+            batch_pool *pool;
+
+        friend class batch_pool;
+    };
+}
+///@}
+
+#endif /*SMPC_BATCH_H*/
@@ -0,0 +1,348 @@
+/**
+ * @file
+ * @brief Recording and replaying of the inputs of the solvers.
+ *
+ * @author Alexander Sherikov
+ * @date 17.10.2026 21:00:00 MSD
+ */
+
+
+#ifndef SMPC_INPUT_LOG_H
+#define SMPC_INPUT_LOG_H
+
+#include <cstdio>
+
+#include "smpc_solver.h"
+
+
+/// @addtogroup gAPI
+/// @{
+
+/// Default size of the output buffer of smpc#input_recorder [bytes].
+#define SMPC_INPUT_LOG_BUFFER_SIZE (1 << 20)
+
+namespace smpc
+{
+    /**
+     * @brief Type of the solver, see smpc#input_log_config.
+     */
+    enum inputLogSolverType
+    {
+        /// smpc#solver_as
+        SMPC_INPUT_LOG_SOLVER_AS = 0,
+        /// smpc#solver_ip
+        SMPC_INPUT_LOG_SOLVER_IP = 1
+    };
+
+
+    /**
+     * @brief Parameters of the solver, whose inputs are recorded by
+     * smpc#input_recorder. The parameters are stored in the header of the
+     * log, so that the log is replayed by the same solver, see
+     * smpc#input_log_reader#config.
+     *
+     * The parameters are set by #set_as or #set_ip, the arguments are the
+     * same as the arguments of the constructors of smpc#solver_as and
+     * smpc#solver_ip. The default constructor calls #set_as with the
+     * default arguments.
+     */
+    class input_log_config
+    {
+        public:
+            input_log_config();
+
+
+            /**
+             * @brief Sets the parameters of smpc#solver_as, see the
+             * constructor of smpc#solver_as.
+             */
+            void set_as (
+                    const double gain_position = 2000.0,
+                    const double gain_velocity = 150.0,
+                    const double gain_acceleration = 0.02,
+                    const double gain_jerk = 1.0,
+                    const double tol = 1e-7,
+                    const unsigned int max_added_constraints_num = 0,
+                    const bool constraint_removal_on = true,
+                    const bool obj_computation_on = false,
+                    const bool warm_start_on = false,
+                    const unsigned int ecL_cache_size = 1,
+                    const kktSolverType kkt_solver = SMPC_KKT_CHOLESKY);
+
+
+            /**
+             * @brief Sets the parameters of smpc#solver_ip, see the
+             * constructor of smpc#solver_ip.
+             */
+            void set_ip (
+                    const double gain_position = 2000.0,
+                    const double gain_velocity = 150.0,
+                    const double gain_acceleration = 0.01,
+                    const double gain_jerk = 1.0,
+                    const double tol = 1e-3,
+                    const double tol_out = 1e-2,
+                    const double t = 100,
+                    const double mu = 15,
+                    const double bs_alpha = 0.01,
+                    const double bs_beta = 0.5,
+                    const int unsigned max_iter = 0,
+                    const backtrackingSearchType bs_type = SMPC_IP_BS_LOGBAR,
+                    const bool obj_computation_on = false,
+                    const solver_ip_parameters &ip_par = solver_ip_parameters());
+
+
+            /**
+             * @brief Creates a solver with these parameters.
+             *
+             * @param[in] N size of the preview window
+             *
+             * @return a new solver, which must be deleted by the caller.
+             */
+            solver * create_solver (const int N) const;
+
+
+            /// Type of the solver.
+            inputLogSolverType solver_type;
+
+            ///@{
+            /// Parameters of both solvers.
+            double gain_position;
+            double gain_velocity;
+            double gain_acceleration;
+            double gain_jerk;
+            double tol;
+            bool obj_computation_on;
+            ///@}
+
+            ///@{
+            /// Parameters of smpc#solver_as.
+            unsigned int max_added_constraints_num;
+            bool constraint_removal_on;
+            bool warm_start_on;
+            unsigned int ecL_cache_size;
+            kktSolverType kkt_solver;
+            ///@}
+
+            ///@{
+            /// Parameters of smpc#solver_ip.
+            double tol_out;
+            double t;
+            double mu;
+            double bs_alpha;
+            double bs_beta;
+            unsigned int max_iter;
+            backtrackingSearchType bs_type;
+            solver_ip_parameters ip_par;
+            ///@}
+    };
+
+
+
+    /**
+     * @brief Appends the inputs of a solver (the arguments of
+     * smpc#solver#set_parameters and smpc#solver#form_init_fp) to a
+     * binary file, one record per control tick. The records can be fed
+     * back to a solver using smpc#input_log_reader.
+     *
+     * The file starts with a header: 8 bytes "SMPCLOG", format version
+     * and N (unsigned int each), followed by the parameters of the solver
+     * (smpc#input_log_config): the type of the solver, the integer and
+     * boolean parameters, and the enumerations as unsigned ints, then the
+     * real parameters as doubles. A record consists of the type of the
+     * initial state (unsigned int, 0 -- state_com, 1 -- state_zmp),
+     * h_initial, the initial state (6 values), T, h, angle, zref_x,
+     * zref_y, fp_x, fp_y (N values each), lb and ub (2*N values each).
+     * The values are stored as doubles in the native byte order.
+     *
+     * The output is buffered: a record is copied to a buffer allocated
+     * in #open, and the data is written to the file only when the buffer
+     * is full, or when the recorder is closed.
+     */
+    class input_recorder
+    {
+        public:
+            input_recorder();
+            ~input_recorder();
+
+
+            /**
+             * @brief Creates a log file and writes the header.
+             *
+             * @param[in] filename name of the file
+             * @param[in] N size of the preview window
+             * @param[in] config parameters of the solver
+             * @param[in] buffer_size size of the output buffer [bytes]
+             *
+             * @return true on success.
+             */
+            bool open (
+                    const char *filename,
+                    const int N,
+                    const input_log_config &config,
+                    const size_t buffer_size = SMPC_INPUT_LOG_BUFFER_SIZE);
+
+
+            /**
+             * @brief Flushes the buffer and closes the file.
+             */
+            void close();
+
+
+            ///@{
+            /**
+             * @brief Appends a record to the log, see smpc#solver#set_parameters
+             * and smpc#solver#form_init_fp for the description of parameters.
+             *
+             * @return true on success.
+             */
+            bool record (
+                    const double* T,
+                    const double* h,
+                    const double h_initial,
+                    const double* angle,
+                    const double* zref_x,
+                    const double* zref_y,
+                    const double* lb,
+                    const double* ub,
+                    const double *x_coord,
+                    const double *y_coord,
+                    const state_com &init_state);
+
+            bool record (
+                    const double* T,
+                    const double* h,
+                    const double h_initial,
+                    const double* angle,
+                    const double* zref_x,
+                    const double* zref_y,
+                    const double* lb,
+                    const double* ub,
+                    const double *x_coord,
+                    const double *y_coord,
+                    const state_zmp &init_state);
+            ///@}
+
+
+        private:
+            // the recorder owns the file
+            input_recorder (const input_recorder &);
+            input_recorder & operator= (const input_recorder &);
+
+            bool write_record (
+                    const double* T,
+                    const double* h,
+                    const double h_initial,
+                    const double* angle,
+                    const double* zref_x,
+                    const double* zref_y,
+                    const double* lb,
+                    const double* ub,
+                    const double *x_coord,
+                    const double *y_coord,
+                    const unsigned int state_type,
+                    const state &init_state);
+
+
+            /// Output file.
+            FILE *file;
+
+            /// Output buffer.
+            char *buffer;
+
+            /// Size of the preview window.
+            int N;
+    };
+
+
+
+    /**
+     * @brief Reads the logs written by smpc#input_recorder.
+     */
+    class input_log_reader
+    {
+        public:
+            input_log_reader();
+            ~input_log_reader();
+
+
+            /**
+             * @brief Opens a log file, reads the header and allocates
+             * memory for the inputs.
+             *
+             * @param[in] filename name of the file
+             *
+             * @return true on success.
+             */
+            bool open (const char *filename);
+
+
+            /**
+             * @brief Closes the file.
+             */
+            void close();
+
+
+            /**
+             * @brief Reads the next record.
+             *
+             * @return false if there are no more records or the file is corrupted.
+             */
+            bool read();
+
+
+            /**
+             * @brief Passes the last read record to the solver, i.e. calls
+             * smpc#solver#set_parameters and smpc#solver#form_init_fp.
+             *
+             * @param[in,out] sol solver
+             * @param[in,out] X solution of optimization problem (N*#SMPC_NUM_VAR)
+             */
+            void apply (solver &sol, double *X) const;
+
+
+            /// Size of the preview window, 0 if the log is not opened.
+            int N;
+
+            /// Parameters of the solver, which was used during recording.
+            input_log_config config;
+
+            ///@{
+            /// The inputs of the solver, see smpc#solver#set_parameters.
+            double *T;
+            double *h;
+            double h_initial;
+            double *angle;
+            double *zref_x;
+            double *zref_y;
+            double *lb;
+            double *ub;
+            ///@}
+
+            ///@{
+            /// The inputs of the solver, see smpc#solver#form_init_fp.
+            double *fp_x;
+            double *fp_y;
+            state_com init_state_com;
+            state_zmp init_state_zmp;
+            ///@}
+
+            /// true if the initial state is given in the form of smpc#state_zmp.
+            bool init_state_is_zmp;
+
+
+        private:
+            // the reader owns the file
+            input_log_reader (const input_log_reader &);
+            input_log_reader & operator= (const input_log_reader &);
+
+
+            /// Input file.
+            FILE *file;
+
+            /// Memory for the inputs.
+            double *mem;
+    };
+}
+/// @}
+
+#endif /*SMPC_INPUT_LOG_H*/
@@ -0,0 +1,163 @@
+/**
+ * @file
+ * @brief Solution of several problems of the same size at once, each of
+ *  them occupies one SIMD lane.
+ *
+ * @author Alexander Sherikov
+ * @date 17.10.2026 09:18:10 MSD
+ */
+
+
+#ifndef SMPC_LOCKSTEP_H
+#define SMPC_LOCKSTEP_H
+
+#include <cstddef> // size_t
+
+#include "smpc_solver.h"
+
+
+template <int t_num> class qp_ip_lockstep;
+
+
+/// @addtogroup gAPI
+/// @{
+
+namespace smpc
+{
+    /**
+     * @brief Interior-point solver, which solves t_lanes independent
+     * problems with the same length of the preview window and the same
+     * parameters of the method at once.
+     *
+     * The problems are processed in lockstep: the arithmetic operations
+     * of the method are applied to all of them, hence the operations
+     * are vectorized across the problems. The iterations of each problem
+     * are the same as in smpc#solver_ip with the logarithmic barrier
+     * method (smpc#SMPC_IP_METHOD_BARRIER) and smpc#SMPC_IP_BS_LOGBAR
+     * search; the problems, which converge earlier, wait for the others.
+     *
+     * @tparam t_lanes the number of problems, 4 or 8.
+     *
+     * @attention All problems must be initialized with #set_parameters and
+     * #form_init_fp before each call of #solve. Warm start is not supported.
+     */
+    template <int t_lanes>
+        class solver_ip_lockstep
+    {
+        public:
+            /** @brief Constructor, the parameters are the same as in
+             * solver_ip#solver_ip.
+             *
+             * @param[in] N Number of sampling times in a preview window
+             * @param[in] gain_position Position gain (Alpha)
+             * @param[in] gain_velocity Velocity gain (Beta)
+             * @param[in] gain_acceleration Acceleration gain (Gamma)
+             * @param[in] gain_jerk Jerk gain (Eta)
+             * @param[in] tol tolerance (internal loop)
+             * @param[in] tol_out tolerance of the outer loop
+             * @param[in] t logarithmic barrier parameter
+             * @param[in] mu multiplier of t, >1.
+             * @param[in] bs_alpha backtracking search parameter 0 < alpha < 0.5
+             * @param[in] bs_beta  backtracking search parameter 0 < beta < 1
+             * @param[in] max_iter maximum number of internal loop iterations (0 = no limit)
+             */
+            solver_ip_lockstep (
+                    const int N,
+                    const double gain_position = 2000.0,
+                    const double gain_velocity = 150.0,
+                    const double gain_acceleration = 0.01,
+                    const double gain_jerk = 1.0,
+                    const double tol = 1e-3,
+                    const double tol_out = 1e-2,
+                    const double t = 100,
+                    const double mu = 15,
+                    const double bs_alpha = 0.01,
+                    const double bs_beta = 0.5,
+                    const int unsigned max_iter = 0);
+
+            ~solver_ip_lockstep();
+
+
+            /**
+             * @brief Returns the amount of memory required by the solver.
+             *
+             * @param[in] N Number of sampling times in a preview window
+             *
+             * @return the amount of memory [bytes].
+             */
+            static size_t get_mem_size (const int N);
+
+
+            // -------------------------------
+
+
+            ///@{
+            /// These functions are the same as in smpc#solver, the first
+            /// parameter is the index of the problem: 0 <= lane < t_lanes.
+            void set_parameters (
+                    const int,
+                    const double*, const double*, const double, const double*,
+                    const double*, const double*, const double*, const double*);
+            void form_init_fp (const int, const double *, const double *, const state_com &, double*);
+            void form_init_fp (const int, const double *, const double *, const state_zmp &, double*);
+            void get_next_state (const int, state_com &) const;
+            void get_next_state (const int, state_zmp &) const;
+            void get_state (const int, state_com &, const int) const;
+            void get_state (const int, state_zmp &, const int) const;
+            void get_first_controls (const int, control &) const;
+            void get_controls (const int, control &, const int) const;
+            ///@}
+
+
+            /**
+             * @brief Solves all problems, the solutions are written to the
+             * arrays passed to #form_init_fp.
+             */
+            void solve ();
+
+
+            // -------------------------------
+
+
+            ///@{
+            /// The number of iterations of each problem, see
+            /// smpc#solver_ip#ext_loop_iterations,
+            /// smpc#solver_ip#int_loop_iterations and
+            /// smpc#solver_ip#bt_search_iterations.
+            ///
+            /// @note Updated by #solve function.
+            unsigned int ext_loop_iterations[t_lanes];
+            unsigned int int_loop_iterations[t_lanes];
+            unsigned int bt_search_iterations[t_lanes];
+            ///@}
+
+            /**
+             * @brief The number of iterations performed in lockstep, i.e.
+             * the maximum of #int_loop_iterations.
+             *
+             * @note Updated by #solve function.
+             */
+            unsigned int lockstep_iterations;
+
+            /// Instrumentation data, see smpc#solver#stats.
+            solver_stats stats;
+
+
+            /**
+             * @brief Internal representation.
+             */
+            qp_ip_lockstep<t_lanes> *qp_sol;
+
+
+        private:
+            /// Not copyable.
+            solver_ip_lockstep (const solver_ip_lockstep &);
+            solver_ip_lockstep & operator= (const solver_ip_lockstep &);
+
+            /// Memory allocated by the solver.
+            double *own_mem;
+    };
+}
+/// @}
+
+#endif /*SMPC_LOCKSTEP_H*/
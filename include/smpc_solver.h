@@ -10,8 +10,11 @@
 #ifndef SMPC_SOLVER_H
 #define SMPC_SOLVER_H
 
+#include <cstddef> // size_t
 #include <vector>
 
+#include "smpc_arena.h"
+
 
 class qp_as;
 class qp_ip;
@@ -27,6 +30,31 @@ class qp_ip;
 /// Total number of variables.
 #define SMPC_NUM_VAR 8
 
+/**
+ * The largest length of the preview window, for which smpc#SMPC_KKT_AUTO
+ * selects the condensed formulation in smpc#solver_as.
+ */
+#define SMPC_AS_CONDENSED_MAX_N 20
+
+/**
+ * Upper bound of the amount of memory [bytes] required by smpc#solver_as
+ * with preview window of length N and K cached Cholesky factors,
+ * see smpc#solver_as#get_mem_size.
+ */
+#define SMPC_AS_MEM_SIZE(N, K) (80*(N)*(N) + 700*(N) + ((K) > 0 ? (K) : 1)*(176*(N) + 512) + 2688)
+
+/**
+ * The number of values of the objective function, which can be kept in
+ * smpc#solver_ip#objective_log, when the number of iterations is not limited.
+ */
+#define SMPC_IP_OBJ_LOG_SIZE 1024
+
+/**
+ * Upper bound of the amount of memory [bytes] required by smpc#solver_ip
+ * with preview window of length N, see smpc#solver_ip#get_mem_size.
+ */
+#define SMPC_IP_MEM_SIZE(N) (968*(N) + 2048)
+
 namespace smpc
 {
     // -------------------------------
@@ -195,6 +223,84 @@ namespace smpc
 
 
 
+    /**
+     * @brief Phases of the solution process, which are timed by the
+     * instrumentation, see smpc#solver_stats.
+     */
+    enum solverPhaseType
+    {
+        /// The whole call of smpc#solver#solve.
+        SMPC_PHASE_SOLVE = 0,
+        /// Formation of the Cholesky factor of equality constraints (or of
+        /// the Riccati recursion or of the condensed hessian, see
+        /// #kktSolverType).
+        SMPC_PHASE_ECL_FORM = 1,
+        /// Multiplication of the matrix of equality constraints by a vector.
+        SMPC_PHASE_FORM_EX = 2,
+        /// Forward substitution with the factor of equality constraints
+        /// (or of the condensed hessian).
+        SMPC_PHASE_SOLVE_FORWARD = 3,
+        /// Backward substitution with the factor of equality constraints
+        /// (or of the condensed hessian, or both passes of the Riccati
+        /// recursion).
+        SMPC_PHASE_SOLVE_BACKWARD = 4,
+        /// Addition of a constraint to the working set (AS only).
+        SMPC_PHASE_UP_RESOLVE = 5,
+        /// Removal of a constraint from the working set (AS only).
+        SMPC_PHASE_DOWN_RESOLVE = 6,
+        /// Computation of Lagrange multipliers (AS only).
+        SMPC_PHASE_GET_LAMBDA = 7,
+        /// Search for blocking constraints (AS only).
+        SMPC_PHASE_CHECK_BLOCKING = 8,
+        /// Backtracking search (IP only).
+        SMPC_PHASE_BT_SEARCH = 9,
+        /// The number of phases.
+        SMPC_PHASE_NUM = 10
+    };
+
+
+    /**
+     * @brief Time spent in the phases of the solution process and the number
+     * of times each phase was entered during the last call of smpc#solver#solve.
+     *
+     * @note The values are collected only if the library is built with 
+     * SMPC_INSTRUMENTATION option, otherwise they are zero.
+     *
+     * @note The time is measured in ticks of a monotonic counter: CPU cycles
+     * (time stamp counter) on x86, nanoseconds on other platforms. Some of 
+     * the phases are nested, e.g. #SMPC_PHASE_UP_RESOLVE includes forward and
+     * backward substitutions.
+     */
+    class solver_stats
+    {
+        public:
+            /// Constructor
+            solver_stats()
+            {
+                reset();
+            }
+
+            /// Sets all values to zero.
+            void reset()
+            {
+                for (int i = 0; i < SMPC_PHASE_NUM; ++i)
+                {
+                    ticks[i] = 0.0;
+                    calls[i] = 0;
+                }
+            }
+
+            static const char *get_phase_name (const solverPhaseType);
+
+
+            /// The number of ticks spent in each phase.
+            double ticks[SMPC_PHASE_NUM];
+
+            /// The number of times each phase was entered.
+            unsigned int calls[SMPC_PHASE_NUM];
+    };
+
+
     /**
      * @brief Abstract class providing common interface functions.
      */
@@ -256,6 +362,38 @@ namespace smpc
             virtual void solve () = 0;
 
 
+            /**
+             * @brief Solves M problems, which share all parameters passed
+             * to #set_parameters except the reference ZMP positions, i.e.
+             * the problems differ only in the reference ZMP positions and
+             * the initial states. smpc#solver_as factorizes the matrices,
+             * which depend only on the shared parameters, once. The
+             * factorization in smpc#solver_ip depends on the current point,
+             * so it solves the problems one after another as #solve does;
+             * the function is provided for convenience.
+             *
+             * @param[in] M the number of problems
+             * @param[in] zref_x M arrays of reference values of x coordinate of ZMP
+             * @param[in] zref_y M arrays of reference values of y coordinate of ZMP
+             * @param[in,out] X M initial feasible points formed by
+             *  #form_init_fp, the solutions are written to the same arrays.
+             *
+             * @note #set_parameters must be called first, the reference
+             * ZMP positions passed to it are ignored; the arrays passed to
+             * #set_parameters must not be freed before this call. After
+             * this call the functions, which return the states and the
+             * controls, refer to the last problem; the counters of
+             * iterations are summed over all problems. The working set of
+             * the last problem is not used by the warm start of
+             * smpc#solver_as on the next call of #set_parameters.
+             */
+            virtual void solve_multi (
+                    const int M,
+                    const double * const *zref_x,
+                    const double * const *zref_y,
+                    double * const *X) = 0;
+
+
             // -------------------------------
 
 
@@ -302,11 +440,52 @@ namespace smpc
              * @param[in] ind index of control inputs [0 : N-1].
              */
             virtual void get_controls (control &c, const int ind) const = 0;
+
+
+            // -------------------------------
+
+
+            /**
+             * @brief Timing of the phases of the solution process.
+             *
+             * @note Updated by #solve function.
+             */
+            solver_stats stats;
     };
 
 
 
 
+    /**
+     * @brief Method used to solve the KKT systems of the equality
+     * constrained subproblems, see smpc#solver_as and smpc#solver_ip.
+     */
+    enum kktSolverType
+    {
+        /// Cholesky factorization of E*inv(H)*E', where E is the matrix of
+        /// equality constraints (the dynamics) and H is the hessian.
+        SMPC_KKT_CHOLESKY = 0,
+        /// Backward Riccati recursion over the states of the preview
+        /// window, the dynamics are eliminated stage by stage. Only the
+        /// unconstrained step of smpc#solver_as is computed in this way,
+        /// the Cholesky factor is formed on demand, when the first
+        /// inequality constraint is added to the working set.
+        SMPC_KKT_RICCATI = 1,
+        /// Condensed formulation (smpc#solver_as only): the states are
+        /// eliminated, the variables are 2*N jerks with a dense hessian,
+        /// whose Cholesky factor is reused while the sampling times and the
+        /// heights of CoM are not changed. Suitable for short preview
+        /// windows. The constructors of smpc#solver_ip throw
+        /// std::invalid_argument.
+        SMPC_KKT_CONDENSED = 2,
+        /// #SMPC_KKT_CONDENSED if N <= #SMPC_AS_CONDENSED_MAX_N,
+        /// #SMPC_KKT_CHOLESKY otherwise (smpc#solver_as only, the
+        /// constructors of smpc#solver_ip throw std::invalid_argument).
+        SMPC_KKT_AUTO = 3
+    };
+
+
+
     /**
      * @brief API of the sparse MPC solver.
      */
@@ -326,13 +505,58 @@ namespace smpc
                         (NOT the size of active set), no limit if set to 0.
                 @param[in] constraint_removal_on enable/disable removal of activated constraints.
                 @param[in] obj_computation_on compute and keep values of the objective function
+                @param[in] warm_start_on use the active set from the previous call of #solve
+                        (shifted by one step) as the initial guess of the active set.
+                @param[in] ecL_cache_size the number of cached Cholesky factors of the
+                        equality constraints. A factor depends only on the sequences of
+                        sampling times and heights of CoM, and is reused if these sequences
+                        are repeated. The least recently used factor is replaced, when a
+                        new sequence is encountered, in this case only the blocks following
+                        the longest common prefix with a cached factor are recomputed.
+                        Caching is disabled if set to 0.
+                @param[in] kkt_solver method used to solve the KKT systems,
+                        see #kktSolverType.
 
               @note smpc#max_added_constraints_num and smpc#constraint_removal_on affect the time required 
               for solution. If the number of added constraints is less than (length of preview window)*2 
               or constraint removal is disabled, the solution is approximate. How good is this 
               approximation depends on the problem.
+
+              @note Warm start assumes, that the preview window is shifted by one
+              step between subsequent calls. If the guessed active set leads to
+              infeasible step, it is discarded and the problem is solved from
+              scratch. The constraints from the guessed active set are not counted
+              in #added_constraints_num. The guess may include constraints, which 
+              must be removed, hence warm start should not be used, when constraint
+              removal is disabled.
+             */
+            solver_as (
+                    const int N, 
+                    const double gain_position = 2000.0, 
+                    const double gain_velocity = 150.0, 
+                    const double gain_acceleration = 0.02,
+                    const double gain_jerk = 1.0,
+                    const double tol = 1e-7,
+                    const unsigned int max_added_constraints_num = 0,
+                    const bool constraint_removal_on = true,
+                    const bool obj_computation_on = false,
+                    const bool warm_start_on = false,
+                    const unsigned int ecL_cache_size = 1,
+                    const kktSolverType kkt_solver = SMPC_KKT_CHOLESKY);
+
+
+            /**
+             * @brief Constructor, which places the internal representation
+             * of the solver in the given arena. If the arena does not have 
+             * enough memory (see #get_mem_size), the memory is allocated on
+             * the heap.
+             *
+             * @param[in,out] mem memory arena
+             *
+             * Other parameters are the same as in the constructor above.
              */
             solver_as (
+                    arena &mem,
                     const int N, 
                     const double gain_position = 2000.0, 
                     const double gain_velocity = 150.0, 
@@ -341,12 +565,44 @@ namespace smpc
                     const double tol = 1e-7,
                     const unsigned int max_added_constraints_num = 0,
                     const bool constraint_removal_on = true,
-                    const bool obj_computation_on = false);
+                    const bool obj_computation_on = false,
+                    const bool warm_start_on = false,
+                    const unsigned int ecL_cache_size = 1,
+                    const kktSolverType kkt_solver = SMPC_KKT_CHOLESKY);
 
 
             ~solver_as();
 
 
+            /**
+             * @brief Returns the amount of memory required by the solver.
+             *
+             * @param[in] N Number of sampling times in a preview window
+             * @param[in] ecL_cache_size the number of cached Cholesky factors
+             * @param[in] kkt_solver method used to solve the KKT systems
+             *
+             * @return the amount of memory [bytes].
+             */
+            static size_t get_mem_size (
+                    const int N,
+                    const unsigned int ecL_cache_size = 1,
+                    const kktSolverType kkt_solver = SMPC_KKT_CHOLESKY);
+
+
+            /**
+             * @brief Allocates the buffer used by #solve_multi for M
+             * problems, should be called after construction, so that
+             * #solve_multi does not allocate memory. If more than M
+             * problems are passed to #solve_multi, they are solved in
+             * groups of at most M problems (the shared work is repeated for
+             * each group). If this function is not called, the buffer is
+             * allocated on the first call of #solve_multi.
+             *
+             * @param[in] M the maximal number of problems in a group
+             */
+            void reserve_multi (const int M);
+
+
             // -------------------------------
 
 
@@ -359,6 +615,7 @@ namespace smpc
             void form_init_fp (const double *, const double *, const state_com &, double*);
             void form_init_fp (const double *, const double *, const state_zmp &, double*);
             void solve ();
+            void solve_multi (const int, const double * const *, const double * const *, double * const *);
             void get_next_state (state_com &) const;
             void get_next_state (state_zmp &) const;
             void get_state (state_com &, const int) const;
@@ -400,6 +657,11 @@ namespace smpc
              *
              * @note Updated by #solve function (only if the respective flag is
              * set on initialization).
+             *
+             * @note The memory is reserved on initialization and #solve never
+             * reallocates it. The capacity is sufficient to log all iterations,
+             * unless the limit on the number of added constraints exceeds 
+             * 4*N, the values that do not fit are dropped.
              */
             std::vector<double> objective_log;
 
@@ -411,6 +673,50 @@ namespace smpc
              * @brief Internal representation.
              */
             qp_as *qp_sol;
+
+
+        protected:
+            /**
+             * @brief Constructor, which places the internal representation
+             * of the solver in the given chunk of memory.
+             *
+             * @param[in] mem a chunk of memory, the memory is allocated on
+             * the heap if it is NULL. std::bad_alloc is thrown if the chunk
+             * is smaller than #get_mem_size.
+             * @param[in] mem_size the size of the chunk [bytes], see #get_mem_size
+             *
+             * Other parameters are the same as in the public constructor.
+             */
+            solver_as (
+                    void *mem,
+                    const size_t mem_size,
+                    const int N, 
+                    const double gain_position, 
+                    const double gain_velocity, 
+                    const double gain_acceleration,
+                    const double gain_jerk,
+                    const double tol,
+                    const unsigned int max_added_constraints_num,
+                    const bool constraint_removal_on,
+                    const bool obj_computation_on,
+                    const bool warm_start_on,
+                    const unsigned int ecL_cache_size,
+                    const kktSolverType kkt_solver);
+
+
+        private:
+            void init (
+                    void *, const size_t,
+                    const int, const double, const double, const double, const double,
+                    const double, const unsigned int, const bool, const bool, const bool,
+                    const unsigned int, const kktSolverType);
+
+            /// Memory allocated by the solver, NULL if the memory is provided
+            /// by a derived class.
+            double *own_mem;
+
+            /// Buffer used by #solve_multi, see #reserve_multi.
+            std::vector<double> multi_mem;
     };
 
 
@@ -424,7 +730,90 @@ namespace smpc
         /// Use objective function, which includes logarithmic barrier term.
         SMPC_IP_BS_LOGBAR = 1,
         /// Use original objective function (no logarithmic barrier term).
-        SMPC_IP_BS_ORIGINAL = 2
+        SMPC_IP_BS_ORIGINAL = 2,
+        /// Minimize the objective function with logarithmic barrier term
+        /// along the descent direction using safeguarded Newton method
+        /// instead of halving the step (bs_alpha and bs_beta are not used
+        /// in the search).
+        SMPC_IP_BS_LOGBAR_NEWTON = 3
+    };
+
+
+    /**
+     * @brief Interior-point method used by smpc#solver_ip.
+     */
+    enum ipMethodType
+    {
+        /// Primal logarithmic barrier method: the barrier parameter is
+        /// decreased in the external loop, the Newton steps are made in
+        /// the internal loop, see #backtrackingSearchType.
+        SMPC_IP_METHOD_BARRIER = 0,
+        /// Primal-dual method with Mehrotra predictor-corrector steps:
+        /// one factorization per iteration, no line search. The iterations
+        /// stop, when the duality gap is less than tol_out and the Newton
+        /// decrement is less than tol, or when the gap or the step becomes
+        /// negligible. If the initial point is far from the optimum (e.g.
+        /// in long preview windows), it is centered first by the barrier
+        /// method with fixed parameter 1/t, in this case bs_alpha, bs_beta
+        /// and bs_type are used; mu is not used. The number of iterations
+        /// (including the centering steps) is reported as the number of
+        /// internal loop iterations.
+        SMPC_IP_METHOD_PRIMAL_DUAL = 1
+    };
+
+
+    /**
+     * @brief Optional parameters of smpc#solver_ip. The constructor sets
+     * the default values, which can be changed selectively:
+     * @code
+     * smpc::solver_ip_parameters ip_par;
+     * ip_par.method = smpc::SMPC_IP_METHOD_PRIMAL_DUAL;
+     * smpc::solver_ip solver (N, 2000.0, 150.0, 0.01, 1.0, 1e-3, 1e-2,
+     *          100, 15, 0.01, 0.5, 0, smpc::SMPC_IP_BS_LOGBAR, false, ip_par);
+     * @endcode
+     */
+    class solver_ip_parameters
+    {
+        public:
+            solver_ip_parameters() :
+                warm_start_on (false),
+                method (SMPC_IP_METHOD_BARRIER),
+                refactor_tol (0.0),
+                kkt_solver (SMPC_KKT_CHOLESKY)
+            {};
+
+
+            /**
+             * Enable warm start: the solution found on the previous call of
+             * solver_ip#solve is shifted by one step and used as the initial
+             * point, the barrier parameter is started from the final value
+             * of the previous call. The points passed to solver_ip#form_init_fp
+             * are used to keep the initial point strictly feasible and as a
+             * fallback on the first call.
+             */
+            bool warm_start_on;
+
+            /// Interior-point method, see #ipMethodType.
+            ipMethodType method;
+
+            /**
+             * If positive, the Cholesky factor is not formed from scratch on
+             * each iteration: the block rows preceding the first block, where
+             * an element of the inverted hessian has changed by more than
+             * refactor_tol (relative), are kept. The steps are computed using
+             * the lagged hessian, they are feasible, but differ from the
+             * Newton steps. 0 -- the factor is always formed from scratch.
+             * Ignored by smpc#SMPC_IP_METHOD_PRIMAL_DUAL, which needs the
+             * exact Newton steps.
+             */
+            double refactor_tol;
+
+            /**
+             * Method used to solve the KKT system: #SMPC_KKT_CHOLESKY or
+             * #SMPC_KKT_RICCATI, see #kktSolverType. refactor_tol is
+             * not used with smpc#SMPC_KKT_RICCATI.
+             */
+            kktSolverType kkt_solver;
     };
 
 
@@ -454,8 +843,40 @@ namespace smpc
              *          note that even when it is disabled, the 'bs_beta' parameter is still used.
              * @param[in] obj_computation_on enable computation of the objective function 
              *          (the results are kept in #objective_log)
+             * @param[in] ip_par optional parameters (warm start,
+             *          method, reuse of the factor, KKT solver), see
+             *          smpc#solver_ip_parameters
+             */
+            solver_ip (
+                    const int N, 
+                    const double gain_position = 2000.0, 
+                    const double gain_velocity = 150.0, 
+                    const double gain_acceleration = 0.01,
+                    const double gain_jerk = 1.0,
+                    const double tol = 1e-3,
+                    const double tol_out = 1e-2,
+                    const double t = 100,
+                    const double mu = 15,
+                    const double bs_alpha = 0.01,
+                    const double bs_beta = 0.5,
+                    const int unsigned max_iter = 0,
+                    const backtrackingSearchType bs_type = SMPC_IP_BS_LOGBAR,
+                    const bool obj_computation_on = false,
+                    const solver_ip_parameters &ip_par = solver_ip_parameters());
+
+
+            /**
+             * @brief Constructor, which places the internal representation
+             * of the solver in the given arena. If the arena does not have 
+             * enough memory (see #get_mem_size), the memory is allocated on
+             * the heap.
+             *
+             * @param[in,out] mem memory arena
+             *
+             * Other parameters are the same as in the constructor above.
              */
             solver_ip (
+                    arena &mem,
                     const int N, 
                     const double gain_position = 2000.0, 
                     const double gain_velocity = 150.0, 
@@ -469,11 +890,25 @@ namespace smpc
                     const double bs_beta = 0.5,
                     const int unsigned max_iter = 0,
                     const backtrackingSearchType bs_type = SMPC_IP_BS_LOGBAR,
-                    const bool obj_computation_on = false);
+                    const bool obj_computation_on = false,
+                    const solver_ip_parameters &ip_par = solver_ip_parameters());
 
             ~solver_ip();
 
 
+            /**
+             * @brief Returns the amount of memory required by the solver.
+             *
+             * @param[in] N Number of sampling times in a preview window
+             * @param[in] kkt_solver method used to solve the KKT system
+             *
+             * @return the amount of memory [bytes].
+             */
+            static size_t get_mem_size (
+                    const int N, 
+                    const kktSolverType kkt_solver = SMPC_KKT_CHOLESKY);
+
+
             // -------------------------------
 
 
@@ -486,6 +921,7 @@ namespace smpc
             void form_init_fp (const double *, const double *, const state_com &, double*);
             void form_init_fp (const double *, const double *, const state_zmp &, double*);
             void solve ();
+            void solve_multi (const int, const double * const *, const double * const *, double * const *);
             void get_next_state (state_com &) const;
             void get_next_state (state_zmp &) const;
             void get_state (state_com &, const int) const;
@@ -526,6 +962,11 @@ namespace smpc
              *
              * @note Updated by #solve function (only if the respective flag is
              * set on initialization).
+             *
+             * @note The memory is reserved on initialization and #solve never
+             * reallocates it. At most max_iter+1 values are kept, or 
+             * #SMPC_IP_OBJ_LOG_SIZE+1 values if the number of iterations is 
+             * not limited, the values that do not fit are dropped.
              */
             std::vector<double> objective_log;
 
@@ -537,6 +978,152 @@ namespace smpc
              * @brief Internal representation.
              */
             qp_ip *qp_sol;
+
+
+        protected:
+            /**
+             * @brief Constructor, which places the internal representation
+             * of the solver in the given chunk of memory.
+             *
+             * @param[in] mem a chunk of memory, the memory is allocated on
+             * the heap if it is NULL. std::bad_alloc is thrown if the chunk
+             * is smaller than #get_mem_size.
+             * @param[in] mem_size the size of the chunk [bytes], see #get_mem_size
+             *
+             * Other parameters are the same as in the public constructor.
+             */
+            solver_ip (
+                    void *mem,
+                    const size_t mem_size,
+                    const int N, 
+                    const double gain_position, 
+                    const double gain_velocity, 
+                    const double gain_acceleration,
+                    const double gain_jerk,
+                    const double tol,
+                    const double tol_out,
+                    const double t,
+                    const double mu,
+                    const double bs_alpha,
+                    const double bs_beta,
+                    const int unsigned max_iter,
+                    const backtrackingSearchType bs_type,
+                    const bool obj_computation_on,
+                    const solver_ip_parameters &ip_par);
+
+
+        private:
+            void init (
+                    void *, const size_t,
+                    const int, const double, const double, const double, const double,
+                    const double, const double, const double, const double,
+                    const double, const double, const unsigned int,
+                    const backtrackingSearchType, const bool, const solver_ip_parameters &);
+
+            /// Memory allocated by the solver, NULL if the memory is provided
+            /// by a derived class.
+            double *own_mem;
+    };
+
+
+
+    /**
+     * @brief A chunk of memory of a fixed size, which is embedded in an object.
+     */
+    template <size_t t_mem_size>
+        class fixed_memory
+    {
+        protected:
+            /// The memory, doubles are used to ensure proper alignment.
+            double mem[(t_mem_size + sizeof(double) - 1) / sizeof(double)];
+    };
+
+
+
+    /**
+     * @brief Active set solver with a fixed length of the preview window,
+     * all buffers are stored in the object itself, no memory is allocated
+     * on the heap on construction.
+     *
+     * @tparam t_N Number of sampling times in a preview window
+     * @tparam t_ecL_cache_size the number of cached Cholesky factors.
+     *
+     * @attention The object is large (see #SMPC_AS_MEM_SIZE), avoid 
+     * placing it on the stack.
+     */
+    template <int t_N, unsigned int t_ecL_cache_size = 1>
+        class solver_as_fixed : 
+            private fixed_memory<SMPC_AS_MEM_SIZE(t_N, t_ecL_cache_size)>,
+            public solver_as
+    {
+        public:
+            /** 
+             * @brief Constructor, the parameters are the same as in 
+             * solver_as#solver_as.
+             */
+            solver_as_fixed (
+                    const double gain_position = 2000.0, 
+                    const double gain_velocity = 150.0, 
+                    const double gain_acceleration = 0.02,
+                    const double gain_jerk = 1.0,
+                    const double tol = 1e-7,
+                    const unsigned int max_added_constraints_num = 0,
+                    const bool constraint_removal_on = true,
+                    const bool obj_computation_on = false,
+                    const bool warm_start_on = false,
+                    const kktSolverType kkt_solver = SMPC_KKT_CHOLESKY) :
+                solver_as (
+                        fixed_memory<SMPC_AS_MEM_SIZE(t_N, t_ecL_cache_size)>::mem,
+                        sizeof(fixed_memory<SMPC_AS_MEM_SIZE(t_N, t_ecL_cache_size)>::mem),
+                        t_N,
+                        gain_position, gain_velocity, gain_acceleration, gain_jerk,
+                        tol, max_added_constraints_num, constraint_removal_on, 
+                        obj_computation_on, warm_start_on, t_ecL_cache_size, kkt_solver)
+            {};
+    };
+
+
+
+    /**
+     * @brief Interior-point solver with a fixed length of the preview window,
+     * all buffers are stored in the object itself, no memory is allocated
+     * on the heap on construction.
+     *
+     * @tparam t_N Number of sampling times in a preview window
+     */
+    template <int t_N>
+        class solver_ip_fixed : 
+            private fixed_memory<SMPC_IP_MEM_SIZE(t_N)>,
+            public solver_ip
+    {
+        public:
+            /** 
+             * @brief Constructor, the parameters are the same as in 
+             * solver_ip#solver_ip.
+             */
+            solver_ip_fixed (
+                    const double gain_position = 2000.0, 
+                    const double gain_velocity = 150.0, 
+                    const double gain_acceleration = 0.01,
+                    const double gain_jerk = 1.0,
+                    const double tol = 1e-3,
+                    const double tol_out = 1e-2,
+                    const double t = 100,
+                    const double mu = 15,
+                    const double bs_alpha = 0.01,
+                    const double bs_beta = 0.5,
+                    const int unsigned max_iter = 0,
+                    const backtrackingSearchType bs_type = SMPC_IP_BS_LOGBAR,
+                    const bool obj_computation_on = false,
+                    const solver_ip_parameters &ip_par = solver_ip_parameters()) :
+                solver_ip (
+                        fixed_memory<SMPC_IP_MEM_SIZE(t_N)>::mem,
+                        sizeof(fixed_memory<SMPC_IP_MEM_SIZE(t_N)>::mem),
+                        t_N,
+                        gain_position, gain_velocity, gain_acceleration, gain_jerk,
+                        tol, tol_out, t, mu, bs_alpha, bs_beta, max_iter, 
+                        bs_type, obj_computation_on, ip_par)
+            {};
     };
 }
 /// @}
@@ -14,6 +14,7 @@
 
 #include <cmath> // sqrt
 #include <cstring> // memset, memmove
+#include <new> // placement new
 
 
 /****************************************
@@ -27,18 +28,61 @@ namespace AS
     /**
      * @brief Constructor
      *
+     * @param[in,out] mem memory arena
      * @param[in] N size of the preview window.
+     * @param[in] ecL_cache_size_ the number of cached matrices ecL, 0 = 
+     *  no caching, the matrix is formed on each call to #solve.
+     * @param[in] kkt_solver method used to compute the unconstrained step.
+     * @param[in,out] instr_ instrumentation
      */
-    chol_solve::chol_solve (const int N) : ecL(N)
+    chol_solve::chol_solve (
+            smpc::arena &mem, 
+            const int N, 
+            const unsigned int ecL_cache_size_,
+            const smpc::kktSolverType kkt_solver,
+            smpc::instrumentation &instr_)
     {
-        nu = new double[SMPC_NUM_VAR*N];
-        z = new double[SMPC_NUM_VAR*N];
+        instr = &instr_;
+        ecL_cache_size = ecL_cache_size_;
+        z_ready = false;
+
+        ric = NULL;
+        ric_hess_pos = NULL;
+        ric_Th = NULL;
+        ric_formed = false;
+        if (kkt_solver == smpc::SMPC_KKT_RICCATI)
+        {
+            ric = new (mem.alloc<smpc::riccati>(1)) smpc::riccati(mem, N);
+            ric_hess_pos = mem.alloc<double>(3*N);
+            ric_Th = mem.alloc<double>(2*N);
+        }
+
+        const unsigned int num_ecL = (ecL_cache_size == 0) ? 1 : ecL_cache_size;
+        ecL_cache = mem.alloc<matrix_ecL *>(num_ecL);
+        for (unsigned int i = 0; i < num_ecL; ++i)
+        {
+            ecL_cache[i] = new (mem.alloc<matrix_ecL>(1)) matrix_ecL(mem, N);
+        }
+        ecL = ecL_cache[0];
 
-        icL = new double*[N*2];
-        icL_mem = new double[SMPC_NUM_VAR*N*N*2];
+        nu = mem.alloc<double>(SMPC_NUM_VAR*N);
+        z = mem.alloc<double>(SMPC_NUM_VAR*N);
+
+        icL = mem.alloc<double *>(N*2);
+        icL_first_ind = mem.alloc<int>(N*2);
+
+        // A row of icL starts at the state of the corresponding constraint,
+        // all preceding elements are zeros and are not stored. Each constraint
+        // can be added to the active set only once, hence a chunk of memory
+        // is reserved for each constraint.
+        icL_mem = mem.alloc<double>(get_icL_mem_size(N));
+
+        icL_cmem = mem.alloc<double *>(N*2);
+        int icL_mem_size = 0;
         for(int i = 0; i < N*2; ++i)
         {
-            icL[i] = &icL_mem[i * SMPC_NUM_VAR*N];
+            icL_cmem[i] = &icL_mem[icL_mem_size];
+            icL_mem_size += SMPC_NUM_STATE_VAR*(N - i/2) + N*2;
         }
     }
 
@@ -48,19 +92,60 @@ namespace AS
      */
     chol_solve::~chol_solve()
     {
-        if (icL != NULL)
+        const unsigned int num_ecL = (ecL_cache_size == 0) ? 1 : ecL_cache_size;
+        for (unsigned int i = 0; i < num_ecL; ++i)
         {
-            delete icL_mem;
-            delete icL;
+            ecL_cache[i]->~matrix_ecL();
         }
-        if (z != NULL)
+    }
+
+
+    /**
+     * @param[in] N size of the preview window.
+     * @return the number of elements in #icL_mem.
+     */
+    int chol_solve::get_icL_mem_size (const int N)
+    {
+        int icL_mem_size = 0;
+        for(int i = 0; i < N*2; ++i)
         {
-            delete z;
+            icL_mem_size += SMPC_NUM_STATE_VAR*(N - i/2) + N*2;
         }
-        if (nu != NULL)
+        return (icL_mem_size);
+    }
+
+
+    /**
+     * @param[in] N size of the preview window.
+     * @param[in] ecL_cache_size_ the number of cached matrices ecL.
+     * @param[in] kkt_solver method used to compute the unconstrained step.
+     * @return the amount of memory, which must be available in the arena
+     *  passed to the constructor [bytes].
+     */
+    size_t chol_solve::get_mem_size (
+            const int N,
+            const unsigned int ecL_cache_size_,
+            const smpc::kktSolverType kkt_solver)
+    {
+        const unsigned int num_ecL = (ecL_cache_size_ == 0) ? 1 : ecL_cache_size_;
+        size_t ric_mem_size = 0;
+
+        if (kkt_solver == smpc::SMPC_KKT_RICCATI)
         {
-            delete nu;
+            ric_mem_size = smpc::arena::get_size<smpc::riccati>(1)
+                + smpc::riccati::get_mem_size(N)
+                + smpc::arena::get_size<double>(3*N)
+                + smpc::arena::get_size<double>(2*N);
         }
+
+        return (ric_mem_size
+                + smpc::arena::get_size<matrix_ecL *>(num_ecL)
+                + num_ecL * (smpc::arena::get_size<matrix_ecL>(1) + matrix_ecL::get_mem_size(N))
+                + 2*smpc::arena::get_size<double>(SMPC_NUM_VAR*N)
+                + smpc::arena::get_size<double *>(N*2)
+                + smpc::arena::get_size<int>(N*2)
+                + smpc::arena::get_size<double>(get_icL_mem_size(N))
+                + smpc::arena::get_size<double *>(N*2));
     }
     //==============================================
 
@@ -70,8 +155,9 @@ namespace AS
      *
      * @param[in] ppar parameters
      * @param[in] c activated constraint
-     * @param[in] ic_len the length of new row in L
-     * @param[out] row 's_a' row
+     * @param[in] ic_len the length of new row in L (starting from the
+     *  first nonzero element)
+     * @param[out] row 's_a' row (starting from the first nonzero element)
      */
     void chol_solve::form_sa_row(
             const problem_parameters& ppar, 
@@ -80,7 +166,6 @@ namespace AS
             double *row)
     {
         double i2H = ppar.i2Q[0]; // a'*inv(H) = a'*inv(H)*a
-        int first_num = c.ind; // first !=0 element
 
 
         // reset memory
@@ -88,14 +173,14 @@ namespace AS
 
 
         // a * iH * -I
-        row[first_num] = -i2H * c.coef_x;
-        row[first_num + 3] = -i2H * c.coef_y;
+        row[0] = -i2H * c.coef_x;
+        row[3] = -i2H * c.coef_y;
 
-        if (first_num/SMPC_NUM_STATE_VAR != ppar.N-1)
+        if (c.ind/SMPC_NUM_STATE_VAR != ppar.N-1)
         {
             // a * iH * A'
-            row[first_num + 6] = i2H * c.coef_x;
-            row[first_num + 9] = i2H * c.coef_y;
+            row[6] = i2H * c.coef_x;
+            row[9] = i2H * c.coef_y;
         }
 
         // initialize the last element in the row
@@ -105,6 +190,64 @@ namespace AS
 
 
 
+    /**
+     * @brief Selects a cached matrix ecL, which was formed for the same 
+     * sampling times and heights of CoM, if there is no such matrix, the 
+     * least recently used matrix is formed. Only the blocks, which follow
+     * the longest common prefix of the sequences of sampling times and 
+     * heights found in the cache, are recomputed.
+     *
+     * @param[in] ppar   parameters.
+     */
+    void chol_solve::form_ecL(const problem_parameters& ppar)
+    {
+        if (ecL_cache_size == 0)
+        {
+            ecL->form (ppar);
+            return;
+        }
+
+
+        unsigned int i;
+        unsigned int best_ind = 0;
+        int best_prefix = -1;
+        for (i = 0; i < ecL_cache_size; ++i)
+        {
+            const int prefix = ecL_cache[i]->get_common_prefix (ppar);
+            if (prefix == ppar.N)
+            {
+                break;
+            }
+            if (prefix > best_prefix)
+            {
+                best_prefix = prefix;
+                best_ind = i;
+            }
+        }
+
+        if (i == ecL_cache_size)
+        {
+            // miss: reuse the least recently used matrix, the leading blocks
+            // are taken from the matrix with the longest common prefix.
+            i = ecL_cache_size - 1;
+            ecL = ecL_cache[i];
+            ecL->form (ppar, *ecL_cache[best_ind]);
+        }
+        else
+        {
+            ecL = ecL_cache[i];
+        }
+
+        // move to the front
+        for (; i > 0; --i)
+        {
+            ecL_cache[i] = ecL_cache[i-1];
+        }
+        ecL_cache[0] = ecL;
+    }
+
+
+
     /**
      * @brief Determines feasible descent direction.
      *
@@ -121,14 +264,73 @@ namespace AS
         int i;
 
 
+        if (ric != NULL)
+        {
+            // dx = argmin 0.5*dx'*H*dx + x'*H*dx  s.t.  E*dx = 0
+            const double hess[3] = {1.0/ppar.i2Q[1], 1.0/ppar.i2Q[2], 1.0/ppar.i2P};
+            const double hess_pos = 1.0/ppar.i2Q[0];
+
+            // the recursion depends only on the sampling times and the
+            // heights of CoM, it is reused if they are not changed.
+            bool ric_valid = ric_formed;
+            for (i = 0; ric_valid && (i < ppar.N); ++i)
+            {
+                ric_valid = !((ric_Th[2*i] < ppar.spar[i].T) || (ric_Th[2*i] > ppar.spar[i].T)
+                        || (ric_Th[2*i + 1] < ppar.spar[i].h) || (ric_Th[2*i + 1] > ppar.spar[i].h));
+            }
+            if (!ric_valid)
+            {
+                SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_ECL_FORM);
+                for (i = 0; i < ppar.N; ++i)
+                {
+                    ric_hess_pos[3*i]     = hess_pos;
+                    ric_hess_pos[3*i + 1] = 0.0;
+                    ric_hess_pos[3*i + 2] = hess_pos;
+                    ric_Th[2*i]     = ppar.spar[i].T;
+                    ric_Th[2*i + 1] = ppar.spar[i].h;
+                }
+                ric->form (ppar.N, ppar.spar, ric_hess_pos, hess);
+                ric_formed = true;
+                SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_ECL_FORM);
+            }
+
+            for (i = 0; i < ppar.N*SMPC_NUM_STATE_VAR; i += SMPC_NUM_STATE_VAR)
+            {
+                dx[i]   = hess_pos * x[i];
+                dx[i+1] = hess[0] * x[i+1];
+                dx[i+2] = hess[1] * x[i+2];
+                dx[i+3] = hess_pos * x[i+3];
+                dx[i+4] = hess[0] * x[i+4];
+                dx[i+5] = hess[1] * x[i+5];
+            }
+            for (i = ppar.N*SMPC_NUM_STATE_VAR; i < ppar.N*SMPC_NUM_VAR; ++i)
+            {
+                dx[i] = hess[2] * x[i];
+            }
+
+            SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_SOLVE_BACKWARD);
+            ric->solve (ppar.N, ppar.spar, dx);
+            SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_SOLVE_BACKWARD);
+
+            z_ready = false;
+            return;
+        }
+
+
         // generate L
-        ecL.form (ppar);
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_ECL_FORM);
+        form_ecL (ppar);
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_ECL_FORM);
 
         // obtain s = E * x;
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_FORM_EX);
         E.form_Ex (ppar, x, s_nu);
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_FORM_EX);
 
         // obtain nu
-        ecL.solve_forward(ppar.N, s_nu);
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_SOLVE_FORWARD);
+        ecL->solve_forward(ppar.N, s_nu);
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_SOLVE_FORWARD);
         // make copy of z - it is constant
         for (i = 0; i < ppar.N * SMPC_NUM_STATE_VAR; i += SMPC_NUM_STATE_VAR)
         {
@@ -140,7 +342,10 @@ namespace AS
             s_nu[i+5] = -s_nu[i+5];
         }
         memmove(z, s_nu, sizeof(double) * ppar.N * SMPC_NUM_STATE_VAR);
-        ecL.solve_backward(ppar.N, s_nu);
+        z_ready = true;
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_SOLVE_BACKWARD);
+        ecL->solve_backward(ppar.N, s_nu);
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_SOLVE_BACKWARD);
 
         // - i2H * E' * nu
         E.form_i2HETx (ppar, s_nu, dx);
@@ -164,6 +369,123 @@ namespace AS
     }
 
 
+    /**
+     * @brief Determines feasible descent directions for several initial
+     * guesses, see #solve. The matrix ecL is formed once, the substitutions
+     * are performed for all right-hand sides in one pass over the matrix.
+     *
+     * @param[in] ppar   parameters.
+     * @param[in] M      the number of initial guesses.
+     * @param[in] x      M initial guesses.
+     * @param[out] dx    M feasible descent directions (N*#SMPC_NUM_VAR
+     *                   elements each, stored one after another).
+     * @param[out] z_multi M vectors @ref pz "z" (N*#SMPC_NUM_STATE_VAR
+     *                   elements each), one of them must be selected with
+     *                   #set_z before the working set is changed.
+     * @param[out] nu_multi M vectors (N*#SMPC_NUM_STATE_VAR elements each),
+     *                   a buffer.
+     */
+    void chol_solve::solve_multi(
+            const problem_parameters& ppar, 
+            const int M,
+            const double * const *x, 
+            double *dx,
+            double *z_multi,
+            double *nu_multi)
+    {
+        const int len = ppar.N * SMPC_NUM_STATE_VAR;
+        int i, m;
+
+
+        // generate L
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_ECL_FORM);
+        form_ecL (ppar);
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_ECL_FORM);
+
+        // obtain s = E * x;
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_FORM_EX);
+        for (m = 0; m < M; ++m)
+        {
+            E.form_Ex (ppar, x[m], &nu_multi[m*len]);
+        }
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_FORM_EX);
+
+        // obtain nu
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_SOLVE_FORWARD);
+        ecL->solve_forward_multi(ppar.N, M, nu_multi);
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_SOLVE_FORWARD);
+        // make copies of z - they are constant
+        for (i = 0; i < M*len; ++i)
+        {
+            nu_multi[i] = -nu_multi[i];
+        }
+        memmove(z_multi, nu_multi, sizeof(double) * M * len);
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_SOLVE_BACKWARD);
+        ecL->solve_backward_multi(ppar.N, M, nu_multi);
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_SOLVE_BACKWARD);
+
+        for (m = 0; m < M; ++m)
+        {
+            const double *xm = x[m];
+            double *dxm = &dx[m * ppar.N * SMPC_NUM_VAR];
+
+            // - i2H * E' * nu
+            E.form_i2HETx (ppar, &nu_multi[m*len], dxm);
+
+            // dx = -(x + inv(H) * E' * nu)
+            for (i = 0; i < ppar.N*SMPC_NUM_VAR; ++i)
+            {
+                dxm[i] -= xm[i];
+            }
+        }
+    }
+
+
+    /**
+     * @brief Selects vector @ref pz "z" formed by #solve_multi, must be
+     * called before the first update of the working set.
+     *
+     * @param[in] ppar   parameters.
+     * @param[in] z_     vector z (N*#SMPC_NUM_STATE_VAR).
+     */
+    void chol_solve::set_z (const problem_parameters& ppar, const double *z_)
+    {
+        memmove(z, z_, sizeof(double) * ppar.N * SMPC_NUM_STATE_VAR);
+        z_ready = true;
+    }
+
+
+    /**
+     * @brief Forms matrix ecL and vector @ref pz "z", which are not formed
+     * by #solve, when the unconstrained step is computed by Riccati 
+     * recursion.
+     *
+     * @param[in] ppar   parameters.
+     * @param[in] x      current point, E*x does not change along the
+     *                   unconstrained step, hence z is the same as for
+     *                   the initial guess.
+     */
+    void chol_solve::form_z (const problem_parameters& ppar, const double *x)
+    {
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_ECL_FORM);
+        form_ecL (ppar);
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_ECL_FORM);
+
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_FORM_EX);
+        E.form_Ex (ppar, x, z);
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_FORM_EX);
+
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_SOLVE_FORWARD);
+        ecL->solve_forward(ppar.N, z);
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_SOLVE_FORWARD);
+        for (int i = 0; i < ppar.N * SMPC_NUM_STATE_VAR; ++i)
+        {
+            z[i] = -z[i];
+        }
+        z_ready = true;
+    }
+
+
     /**
      * @brief A wrapper around private functions, which update Cholesky factor and 
      *  resolve the system.
@@ -175,13 +497,18 @@ namespace AS
      */
     void chol_solve::up_resolve(
             const AS::problem_parameters& ppar, 
-            const vector <AS::constraint>& active_set, 
+            const working_set &active_set, 
             const double *x, 
             double *dx)
     {
         int ic_num = active_set.size()-1;
         constraint c = active_set.back();
 
+        if (!z_ready)
+        {
+            form_z (ppar, x);
+        }
+
         update (ppar, c, ic_num);
         update_z (ppar, c, ic_num, x);
         resolve (ppar, active_set, x, dx);
@@ -203,36 +530,44 @@ namespace AS
     {
         int i, j, k;
 
-        double *new_row = icL[ic_num]; // current row in icL
+        const int first_num = c.ind; // the first !=0 element
+        icL[ic_num] = icL_cmem[c.cind];
+        icL_first_ind[ic_num] = first_num;
+
+        // current row in icL, elements are stored starting from first_num
+        double *new_row = icL[ic_num];
         // trailing elements of new_row corresponding to active constraints
-        double *new_row_end = &new_row[ppar.N*SMPC_NUM_STATE_VAR]; 
+        double *new_row_end = &new_row[ppar.N*SMPC_NUM_STATE_VAR - first_num]; 
 
         int last_num = ic_num + ppar.N*SMPC_NUM_STATE_VAR; // the last !=0 element
 
 
         // form row 'a' in the current row of icL
-        form_sa_row(ppar, c, last_num, new_row);
+        form_sa_row(ppar, c, last_num - first_num, new_row);
 
         // Forward substitution using L for equality constraints
-        ecL.solve_forward(ppar.N, new_row, c.cind/2);
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_SOLVE_FORWARD);
+        ecL->solve_forward(ppar.N, new_row, c.cind/2);
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_SOLVE_FORWARD);
 
 
         // update the trailing elements of new_row using the
         // elements computed using forward substitution above
-        for(i = c.cind/2 * SMPC_NUM_STATE_VAR; 
+        for(i = first_num; 
             i < ppar.N * SMPC_NUM_STATE_VAR; 
             i += SMPC_NUM_STATE_VAR)
         {
             // make a copy for faster computations
-            double tmp_copy_el[6] = {new_row[i], 
-                                     new_row[i+1], 
-                                     new_row[i+2], 
-                                     new_row[i+3], 
-                                     new_row[i+4], 
-                                     new_row[i+5]};
+            const double *el = &new_row[i - first_num];
+            double tmp_copy_el[6] = {el[0], 
+                                     el[1], 
+                                     el[2], 
+                                     el[3], 
+                                     el[4], 
+                                     el[5]};
 
             // update the last (diagonal) number in the row
-            new_row[last_num] -= tmp_copy_el[0] * tmp_copy_el[0] 
+            new_row[last_num - first_num] -= tmp_copy_el[0] * tmp_copy_el[0] 
                                + tmp_copy_el[1] * tmp_copy_el[1] 
                                + tmp_copy_el[2] * tmp_copy_el[2]
                                + tmp_copy_el[3] * tmp_copy_el[3] 
@@ -243,12 +578,18 @@ namespace AS
             // in icL
             for (j = 0; j < ic_num; ++j)
             {
-                new_row_end[j] -= tmp_copy_el[0] * icL[j][i]
-                                + tmp_copy_el[1] * icL[j][i+1]
-                                + tmp_copy_el[2] * icL[j][i+2] 
-                                + tmp_copy_el[3] * icL[j][i+3]
-                                + tmp_copy_el[4] * icL[j][i+4]
-                                + tmp_copy_el[5] * icL[j][i+5];
+                if (icL_first_ind[j] > i)
+                {
+                    // the elements of this row are zeros
+                    continue;
+                }
+                const double *row_el = &icL[j][i - icL_first_ind[j]];
+                new_row_end[j] -= tmp_copy_el[0] * row_el[0]
+                                + tmp_copy_el[1] * row_el[1]
+                                + tmp_copy_el[2] * row_el[2] 
+                                + tmp_copy_el[3] * row_el[3]
+                                + tmp_copy_el[4] * row_el[4]
+                                + tmp_copy_el[5] * row_el[5];
             }
         }
 
@@ -256,22 +597,22 @@ namespace AS
         // update elements in the end of icL
         for(i = SMPC_NUM_STATE_VAR * ppar.N, k = 0; i < last_num; ++i, ++k)
         {
-            new_row[i] /= icL[k][i];
-            double tmp_copy_el = new_row[i];
+            new_row[i - first_num] /= icL[k][i - icL_first_ind[k]];
+            double tmp_copy_el = new_row[i - first_num];
 
             // determine number in the row of L
 
             // update the last (diagonal) number in the row
-            new_row[last_num] -= tmp_copy_el * tmp_copy_el;
+            new_row[last_num - first_num] -= tmp_copy_el * tmp_copy_el;
 
             for (j = k+1; j < ic_num; ++j)
             {
-                new_row_end[j] -= tmp_copy_el * icL[j][i];
+                new_row_end[j] -= tmp_copy_el * icL[j][i - icL_first_ind[j]];
             }
         }
 
         // square root of the diagonal element
-        new_row[last_num] = sqrt(new_row[last_num]);
+        new_row[last_num - first_num] = sqrt(new_row[last_num - first_num]);
     }
 
 
@@ -302,14 +643,68 @@ namespace AS
         memmove (nu, z, zind * sizeof(double));
         for (int i = first_num; i < zind; ++i)
         {
-            zn -= z[i] * icL[ic_num][i];
+            zn -= z[i] * icL[ic_num][i - first_num];
         }
-        nu[zind] = z[zind] = zn/icL[ic_num][zind];
+        nu[zind] = z[zind] = zn/icL[ic_num][zind - first_num];
         return;
     }
 
 
 
+    /**
+     * @brief Adds all constraints from the given active set to L at once and
+     *  resolves the system (warm start).
+     *
+     * @param[in] ppar   parameters.
+     * @param[in] active_set a vector of guessed active constraints.
+     * @param[in] x     initial guess.
+     * @param[out] dx   feasible descent direction, must be allocated.
+     *
+     * @attention Unlike #up_resolve, this function does not require the constraints
+     * to be active at x: the resulting direction moves x onto the respective bounds
+     * (lower if c.sign is negative, upper otherwise).
+     */
+    void chol_solve::warm_resolve(
+            const AS::problem_parameters& ppar,
+            const working_set &active_set,
+            const double *x,
+            double *dx)
+    {
+        const int nW = active_set.size();
+        const int first_zind = ppar.N*SMPC_NUM_STATE_VAR;
+
+        if (!z_ready)
+        {
+            form_z (ppar, x);
+        }
+
+        // form all rows of icL
+        for (int i = 0; i < nW; ++i)
+        {
+            update (ppar, active_set[i], i);
+        }
+
+
+        // a'*(x + dx) = b, hence, zn = -a'*x - (b - a'*x) = -b
+        memmove (nu, z, first_zind * sizeof(double));
+        for (int i = 0; i < nW; ++i)
+        {
+            const constraint &c = active_set[i];
+            const int zind = first_zind + i;
+
+            double zn = (c.sign < 0) ? -c.lb : -c.ub;
+            for (int j = c.ind; j < zind; ++j)
+            {
+                zn -= z[j] * icL[i][j - c.ind];
+            }
+            nu[zind] = z[zind] = zn/icL[i][zind - c.ind];
+        }
+
+        resolve (ppar, active_set, x, dx);
+    }
+
+
+
     /**
      * @brief Determines feasible descent direction with respect to added
      *  inequality constraints.
@@ -321,7 +716,7 @@ namespace AS
      */
     void chol_solve::resolve (
             const AS::problem_parameters& ppar, 
-            const vector <AS::constraint>& active_set, 
+            const working_set &active_set, 
             const double *x, 
             double *dx)
     {
@@ -332,15 +727,18 @@ namespace AS
         for (i = nW-1; i >= 0; --i)
         {
             const int last_el_num = i + ppar.N*SMPC_NUM_STATE_VAR;
-            nu[last_el_num] /= icL[i][last_el_num];
+            const int first_num = icL_first_ind[i];
+            nu[last_el_num] /= icL[i][last_el_num - first_num];
 
-            for (int j = active_set[i].ind; j < last_el_num; ++j)
+            for (int j = first_num; j < last_el_num; ++j)
             {
-                nu[j] -= nu[last_el_num] * icL[i][j];
+                nu[j] -= nu[last_el_num] * icL[i][j - first_num];
             }
         }
         // backward substitution for ecL
-        ecL.solve_backward(ppar.N, nu);
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_SOLVE_BACKWARD);
+        ecL->solve_backward(ppar.N, nu);
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_SOLVE_BACKWARD);
 
 
         // - i2H * E' * nu
@@ -390,7 +788,7 @@ namespace AS
      */
     void chol_solve::down_resolve(
             const AS::problem_parameters& ppar, 
-            const vector <AS::constraint>& active_set,
+            const working_set &active_set,
             const int ind_exclude, 
             const double *x, 
             double *dx)
@@ -404,12 +802,13 @@ namespace AS
         for (int i = nW; i > ind_exclude; --i)
         {
             const int zind = ppar.N*SMPC_NUM_STATE_VAR + i;
-            double zn = z[zind] * icL[i][zind];
+            const int first_num = icL_first_ind[i];
+            double zn = z[zind] * icL[i][zind - first_num];
             z[zind] = z_tmp;
 
             for (int j = last_el_ind; j < zind; ++j)
             {
-                zn += z[j] * icL[i][j];
+                zn += z[j] * icL[i][j - first_num];
             }
             z_tmp = zn;
         }
@@ -424,15 +823,16 @@ namespace AS
         for (int i = ind_exclude; i < nW; i++)
         {
             int zind = ppar.N*SMPC_NUM_STATE_VAR + i;
+            const int first_num = icL_first_ind[i];
             double zn = z[zind];
 
             // zn
             // start from the first !=0 element
             for (int j = last_el_ind; j < zind; j++)
             {
-                zn -= z[j] * icL[i][j];
+                zn -= z[j] * icL[i][j - first_num];
             }
-            z[zind] = zn/icL[i][zind];
+            z[zind] = zn/icL[i][zind - first_num];
         }
 
         // copy z to nu
@@ -474,6 +874,7 @@ namespace AS
         for (int i = ind_exclude + 1; i < nW + 1; i++)
         {
             icL[i-1] = icL[i];
+            icL_first_ind[i-1] = icL_first_ind[i];
         }
         icL[nW] = downdate_row;
 
@@ -481,7 +882,7 @@ namespace AS
         for (int i = ind_exclude; i < nW; i++)
         {
             int el_index = SMPC_NUM_STATE_VAR*ppar.N + i;
-            double *cur_el = &icL[i][el_index];
+            double *cur_el = &icL[i][el_index - icL_first_ind[i]];
             double x1 = cur_el[0];
             double x2 = cur_el[1];
             double cosT, sinT;
@@ -514,11 +915,12 @@ namespace AS
             // update the lines below the current one.
             for (int j = i + 1; j < nW; j++)
             {
-                x1 = icL[j][el_index];
-                x2 = icL[j][el_index + 1];
+                double *row_el = &icL[j][el_index - icL_first_ind[j]];
+                x1 = row_el[0];
+                x2 = row_el[1];
 
-                icL[j][el_index] = sign * (cosT*x1 + sinT*x2);
-                icL[j][el_index + 1] = -sinT*x1 + cosT*x2;
+                row_el[0] = sign * (cosT*x1 + sinT*x2);
+                row_el[1] = -sinT*x1 + cosT*x2;
             }
         }
     }
@@ -11,13 +11,15 @@
  * INCLUDES 
  ****************************************/
 
-#include <vector>
 
 #include "smpc_common.h"
 #include "as_matrix_E.h"
 #include "as_matrix_ecL.h"
 #include "as_problem_param.h"
 #include "as_constraint.h"
+#include "as_working_set.h"
+#include "smpc_riccati.h"
+#include "smpc_instrumentation.h"
 
 
 /****************************************
@@ -32,21 +34,32 @@ namespace AS
 {
     /**
      * @brief Solves @ref pKKT "KKT system" using 
-     * @ref pCholesky "Cholesky decomposition".
+     * @ref pCholesky "Cholesky decomposition". The unconstrained step
+     * can be computed by Riccati recursion, see smpc#kktSolverType.
      */
     class chol_solve
     {
         public:
             /*********** Constructors / Destructors ************/
-            chol_solve (const int);
+            chol_solve (
+                    smpc::arena &,
+                    const int,
+                    const unsigned int,
+                    const smpc::kktSolverType,
+                    smpc::instrumentation &);
             ~chol_solve();
 
+            static size_t get_mem_size (const int, const unsigned int, const smpc::kktSolverType);
+
             void solve(const AS::problem_parameters&, const double *, double *);
+            void solve_multi(const AS::problem_parameters&, const int, const double * const *, double *, double *, double *);
+            void set_z (const AS::problem_parameters&, const double *);
 
-            void up_resolve(const AS::problem_parameters&, const vector<AS::constraint>&, const double *, double *);
+            void up_resolve(const AS::problem_parameters&, const AS::working_set&, const double *, double *);
+            void warm_resolve(const AS::problem_parameters&, const AS::working_set&, const double *, double *);
 
             double * get_lambda(const AS::problem_parameters&);
-            void down_resolve(const AS::problem_parameters&, const vector<AS::constraint>&, const int, const double *, double *);
+            void down_resolve(const AS::problem_parameters&, const AS::working_set&, const int, const double *, double *);
 
 
         private:
@@ -54,30 +67,71 @@ namespace AS
             void update_z (const AS::problem_parameters&, const AS::constraint&, const int, const double *);
             void downdate(const AS::problem_parameters&, const int, const int, const double *);
 
-            void resolve (const AS::problem_parameters&, const vector<AS::constraint>&, const double *, double *);
+            void resolve (const AS::problem_parameters&, const AS::working_set&, const double *, double *);
 
             void form_sa_row(const AS::problem_parameters&, const AS::constraint&, const int, double *);
 
+            void form_ecL(const AS::problem_parameters&);
+            void form_z(const AS::problem_parameters&, const double *);
+
+            static int get_icL_mem_size (const int);
+
 
     // ----------------------------------------------
     // variables
+            /// Instrumentation of the owner.
+            smpc::instrumentation *instr;
+
             /// Vector of Lagrange multipliers
             double *nu;
 
             /// matrix of equality AS::constraints
             AS::matrix_E E;
 
-            /// L for equality AS::constraints
-            AS::matrix_ecL ecL;
+            /// L for equality AS::constraints (points to one of the cached matrices)
+            AS::matrix_ecL *ecL;
 
-            /// L for inequality AS::constraints
+            /// Cached matrices ecL, ordered by the time of the last use
+            /// (the most recently used is the first).
+            AS::matrix_ecL **ecL_cache;
+
+            /// The number of cached matrices, 0 = caching is disabled.
+            unsigned int ecL_cache_size;
+
+            /// L for inequality AS::constraints, a row is stored starting 
+            /// from its first nonzero element (see #icL_first_ind).
             double **icL;   
 
+            /// Indices of the first stored elements of the rows of #icL.
+            int *icL_first_ind;
+
             /// All lines of #icL are stored in one chunk of memory.
             double *icL_mem;   
 
+            /// Memory in #icL_mem reserved for the row of each constraint.
+            double **icL_cmem;
+
             /// Vector @ref pz "z".
             double *z;
+
+            /// false if the unconstrained step is computed by #ric, in this
+            /// case #ecL and #z are formed, when the working set is changed
+            /// for the first time.
+            bool z_ready;
+
+            /// Riccati recursion (NULL if the Cholesky factor is used).
+            smpc::riccati *ric;
+
+            /// 2x2 blocks of the hessian, which correspond to the positions
+            /// of ZMP (only with #ric).
+            double *ric_hess_pos;
+
+            /// Sampling times and heights of CoM (T0, h0, T1, h1, ...), which
+            /// correspond to #ric.
+            double *ric_Th;
+
+            /// true if #ric is formed.
+            bool ric_formed;
     };
 }
 /// @}
@@ -0,0 +1,691 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @date 17.10.2026 10:01:45 MSD
+ */
+
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include "as_condensed_solve.h"
+#include "smpc_sse2.h"
+
+#include <cmath> // sqrt
+#include <cstring> // memcmp, memcpy
+
+
+/****************************************
+ * FUNCTIONS
+ ****************************************/
+namespace AS
+{
+    //==============================================
+    // constructors / destructors
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in,out] mem memory arena
+     * @param[in] N size of the preview window.
+     * @param[in,out] instr_ instrumentation
+     */
+    condensed_solve::condensed_solve (
+            smpc::arena &mem,
+            const int N,
+            smpc::instrumentation &instr_)
+    {
+        instr = &instr_;
+        is_formed = false;
+
+        Th = mem.alloc<double>(2*N);
+        L = mem.alloc<double>(N*N);
+        iLG = mem.alloc<double>(N*N);
+
+        icL = mem.alloc<double *>(2*N);
+        icL_mem = mem.alloc<double>(4*N*N);
+        for (int i = 0; i < 2*N; ++i)
+        {
+            icL[i] = &icL_mem[2*N*i];
+        }
+
+        lambda = mem.alloc<double>(2*N);
+        grad = mem.alloc<double>(2*N);
+        tmp_states = mem.alloc<double>(SMPC_NUM_STATE_VAR/2*N);
+    }
+
+
+    /**
+     * @param[in] N size of the preview window.
+     * @return the amount of memory, which must be available in the arena
+     *  passed to the constructor [bytes].
+     */
+    size_t condensed_solve::get_mem_size (const int N)
+    {
+        return (smpc::arena::get_size<double>(2*N)
+                + 2*smpc::arena::get_size<double>(N*N)
+                + smpc::arena::get_size<double *>(2*N)
+                + smpc::arena::get_size<double>(4*N*N)
+                + 2*smpc::arena::get_size<double>(2*N)
+                + smpc::arena::get_size<double>(SMPC_NUM_STATE_VAR/2*N));
+    }
+    //==============================================
+
+
+
+    /**
+     * @brief Forms the Cholesky factor of the condensed hessian and the
+     * rows of the constraints premultiplied by its inverse. Nothing is done
+     * if the sampling times and the heights of CoM are the same as in the
+     * previous call.
+     *
+     * @param[in] ppar   parameters.
+     *
+     * @note The matrices do not depend on the first transition matrix
+     * (i.e. on h_initial), since the initial state is fixed.
+     */
+    void condensed_solve::form (const problem_parameters& ppar)
+    {
+        const int N = ppar.N;
+        int i, j, k, m;
+
+
+        if (is_formed)
+        {
+            for (i = 0; i < N; ++i)
+            {
+                if (memcmp (&Th[2*i], &ppar.spar[i].T, 2*sizeof(double)) != 0)
+                {
+                    break;
+                }
+            }
+            if (i == N)
+            {
+                return;
+            }
+        }
+
+
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_ECL_FORM);
+        const double Q[3] = {1.0/ppar.i2Q[0], 1.0/ppar.i2Q[1], 1.0/ppar.i2Q[2]};
+        double *gamma = tmp_states;
+
+        for (k = 0; k < N; ++k)
+        {
+            // responses of the states to the jerk k:
+            // gamma_i = A_i * ... * A_{k+1} * B_k
+            gamma[3*k]   = ppar.spar[k].B[0];
+            gamma[3*k+1] = ppar.spar[k].B[1];
+            gamma[3*k+2] = ppar.spar[k].B[2];
+            for (i = k+1; i < N; ++i)
+            {
+                const double A3 = ppar.spar[i].A3;
+                const double A6 = ppar.spar[i].A6;
+                const double *gp = &gamma[3*(i-1)];
+
+                gamma[3*i]   = gp[0] + A3*gp[1] + A6*gp[2];
+                gamma[3*i+1] =            gp[1] + A3*gp[2];
+                gamma[3*i+2] =                       gp[2];
+            }
+
+            // positions of ZMP
+            for (i = 0; i < k; ++i)
+            {
+                iLG[i*N + k] = 0.0;
+            }
+            for (; i < N; ++i)
+            {
+                iLG[i*N + k] = gamma[3*i];
+            }
+
+            // H(j,k) = B_j' * p_j, where p_j = Q*gamma_j + A_{j+1}' * p_{j+1}
+            double p[3] = {0.0, 0.0, 0.0};
+            for (j = N-1; j >= k; --j)
+            {
+                if (j < N-1)
+                {
+                    const double A3 = ppar.spar[j+1].A3;
+                    const double A6 = ppar.spar[j+1].A6;
+
+                    p[2] += A6*p[0] + A3*p[1];
+                    p[1] += A3*p[0];
+                }
+                p[0] += Q[0]*gamma[3*j];
+                p[1] += Q[1]*gamma[3*j+1];
+                p[2] += Q[2]*gamma[3*j+2];
+
+                const double *b = ppar.spar[j].B;
+                L[j*N + k] = b[0]*p[0] + b[1]*p[1] + b[2]*p[2];
+            }
+            L[k*N + k] += 1.0/ppar.i2P;
+        }
+
+
+        // Cholesky factorization of the lower triangle in place
+        for (j = 0; j < N; ++j)
+        {
+            double *Lj = &L[j*N];
+
+            for (k = 0; k < j; ++k)
+            {
+                const double *Lk = &L[k*N];
+                double el = Lj[k];
+                for (m = 0; m < k; ++m)
+                {
+                    el -= Lj[m] * Lk[m];
+                }
+                Lj[k] = el / Lk[k];
+            }
+
+            double el = Lj[j];
+            for (m = 0; m < j; ++m)
+            {
+                el -= Lj[m] * Lj[m];
+            }
+            Lj[j] = sqrt(el);
+        }
+
+
+        // iLG = inv(L) * Gp'
+        for (i = 0; i < N; ++i)
+        {
+            double *w = &iLG[i*N];
+            for (j = 0; j < N; ++j)
+            {
+                const double *Lj = &L[j*N];
+                double el = w[j];
+                for (m = 0; m < j; ++m)
+                {
+                    el -= Lj[m] * w[m];
+                }
+                w[j] = el / Lj[j];
+            }
+        }
+
+
+        for (i = 0; i < N; ++i)
+        {
+            // T and h are stored one after another
+            memcpy (&Th[2*i], &ppar.spar[i].T, 2*sizeof(double));
+        }
+        is_formed = true;
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_ECL_FORM);
+    }
+
+
+
+    /**
+     * @brief Computes the gradient of the objective with respect to the
+     * jerks at the given point and premultiplies it by inv(L), the result
+     * is stored in #grad.
+     *
+     * @param[in] ppar   parameters.
+     * @param[in] x      current point (the states and the controls).
+     */
+    void condensed_solve::form_grad (const problem_parameters& ppar, const double *x)
+    {
+        const int N = ppar.N;
+        const double Q[3] = {1.0/ppar.i2Q[0], 1.0/ppar.i2Q[1], 1.0/ppar.i2Q[2]};
+        const double P = 1.0/ppar.i2P;
+        const double *u = &x[N*SMPC_NUM_STATE_VAR];
+        int j, m;
+
+
+        // adjoint pass: p_j = Q*x_j + A_{j+1}' * p_{j+1}, g_j = B_j' * p_j + P*u_j
+        double px[3] = {0.0, 0.0, 0.0};
+        double py[3] = {0.0, 0.0, 0.0};
+        for (j = N-1; j >= 0; --j)
+        {
+            if (j < N-1)
+            {
+                const double A3 = ppar.spar[j+1].A3;
+                const double A6 = ppar.spar[j+1].A6;
+
+                px[2] += A6*px[0] + A3*px[1];
+                px[1] += A3*px[0];
+                py[2] += A6*py[0] + A3*py[1];
+                py[1] += A3*py[0];
+            }
+
+            const double *xj = &x[j*SMPC_NUM_STATE_VAR];
+            px[0] += Q[0]*xj[0];
+            px[1] += Q[1]*xj[1];
+            px[2] += Q[2]*xj[2];
+            py[0] += Q[0]*xj[3];
+            py[1] += Q[1]*xj[4];
+            py[2] += Q[2]*xj[5];
+
+            const double *b = ppar.spar[j].B;
+            grad[2*j]   = b[0]*px[0] + b[1]*px[1] + b[2]*px[2] + P*u[2*j];
+            grad[2*j+1] = b[0]*py[0] + b[1]*py[1] + b[2]*py[2] + P*u[2*j+1];
+        }
+
+
+        // forward substitution
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_SOLVE_FORWARD);
+        for (j = 0; j < N; ++j)
+        {
+            const double *Lj = &L[j*N];
+
+#ifdef __SSE2__
+            // two independent sums shorten the chain of dependencies
+            __m128d sum0 = _mm_setzero_pd ();
+            __m128d sum1 = _mm_setzero_pd ();
+            for (m = 0; m+1 < j; m += 2)
+            {
+                sum0 = _mm_add_pd (sum0, _mm_mul_pd (_mm_set1_pd (Lj[m]), _mm_loadu_pd (&grad[2*m])));
+                sum1 = _mm_add_pd (sum1, _mm_mul_pd (_mm_set1_pd (Lj[m+1]), _mm_loadu_pd (&grad[2*m+2])));
+            }
+            if (m < j)
+            {
+                sum0 = _mm_add_pd (sum0, _mm_mul_pd (_mm_set1_pd (Lj[m]), _mm_loadu_pd (&grad[2*m])));
+            }
+            _mm_storeu_pd (&grad[2*j],
+                    _mm_div_pd (
+                        _mm_sub_pd (_mm_loadu_pd (&grad[2*j]), _mm_add_pd (sum0, sum1)),
+                        _mm_set1_pd (Lj[j])));
+#else
+            for (m = 0; m < j; ++m)
+            {
+                grad[2*j]   -= Lj[m] * grad[2*m];
+                grad[2*j+1] -= Lj[m] * grad[2*m+1];
+            }
+            grad[2*j]   /= Lj[j];
+            grad[2*j+1] /= Lj[j];
+#endif
+        }
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_SOLVE_FORWARD);
+    }
+
+
+
+    /**
+     * @brief Computes the direction dx = -inv(L') * #grad, the states are
+     * obtained from the controls using the dynamics (x_{-1} = 0).
+     *
+     * @param[in] ppar   parameters.
+     * @param[out] dx    direction, must be allocated.
+     */
+    void condensed_solve::form_dx (const problem_parameters& ppar, double *dx)
+    {
+        const int N = ppar.N;
+        double *du = &dx[N*SMPC_NUM_STATE_VAR];
+        int i, m;
+
+
+        // backward substitution, the rows of L are traversed in the
+        // reverse order, the updates of the elements are independent.
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_SOLVE_BACKWARD);
+        for (i = N-1; i >= 0; --i)
+        {
+            const double *Li = &L[i*N];
+
+#ifdef __SSE2__
+            const __m128d g = _mm_div_pd (_mm_loadu_pd (&grad[2*i]), _mm_set1_pd (Li[i]));
+            _mm_storeu_pd (&grad[2*i], g);
+            _mm_storeu_pd (&du[2*i], _mm_sub_pd (_mm_setzero_pd (), g));
+            for (m = 0; m < i; ++m)
+            {
+                _mm_storeu_pd (&grad[2*m],
+                        _mm_sub_pd (_mm_loadu_pd (&grad[2*m]), _mm_mul_pd (_mm_set1_pd (Li[m]), g)));
+            }
+#else
+            grad[2*i]   /= Li[i];
+            grad[2*i+1] /= Li[i];
+            du[2*i]   = -grad[2*i];
+            du[2*i+1] = -grad[2*i+1];
+            for (m = 0; m < i; ++m)
+            {
+                grad[2*m]   -= Li[m] * grad[2*i];
+                grad[2*m+1] -= Li[m] * grad[2*i+1];
+            }
+#endif
+        }
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_SOLVE_BACKWARD);
+
+
+        double sx[3] = {0.0, 0.0, 0.0};
+        double sy[3] = {0.0, 0.0, 0.0};
+        for (i = 0; i < N; ++i)
+        {
+            const double A3 = ppar.spar[i].A3;
+            const double A6 = ppar.spar[i].A6;
+            const double *b = ppar.spar[i].B;
+            double *dxi = &dx[i*SMPC_NUM_STATE_VAR];
+
+            dxi[0] = sx[0] + A3*sx[1] + A6*sx[2] + b[0]*du[2*i];
+            dxi[1] =            sx[1] + A3*sx[2] + b[1]*du[2*i];
+            dxi[2] =                       sx[2] + b[2]*du[2*i];
+            dxi[3] = sy[0] + A3*sy[1] + A6*sy[2] + b[0]*du[2*i+1];
+            dxi[4] =            sy[1] + A3*sy[2] + b[1]*du[2*i+1];
+            dxi[5] =                       sy[2] + b[2]*du[2*i+1];
+
+            sx[0] = dxi[0]; sx[1] = dxi[1]; sx[2] = dxi[2];
+            sy[0] = dxi[3]; sy[1] = dxi[4]; sy[2] = dxi[5];
+        }
+    }
+
+
+
+    /**
+     * @brief Determines feasible descent direction.
+     *
+     * @param[in] ppar   parameters.
+     * @param[in] x    initial guess.
+     * @param[out] dx   feasible descent direction, must be allocated.
+     */
+    void condensed_solve::solve (
+            const problem_parameters& ppar,
+            const double *x,
+            double *dx)
+    {
+        form (ppar);
+        form_grad (ppar, x);
+        form_dx (ppar, dx);
+    }
+
+
+
+    /**
+     * @brief Adds a row to the Cholesky factor of A(W,:)*inv(H)*A(W,:)'.
+     *
+     * @param[in] ppar   parameters.
+     * @param[in] active_set a vector of active constraints.
+     * @param[in] ind index of the added constraint in the set, the rows of
+     *  the preceding constraints must be formed.
+     */
+    void condensed_solve::update (
+            const problem_parameters& ppar,
+            const working_set& active_set,
+            const int ind)
+    {
+        const int N = ppar.N;
+        const constraint &c = active_set[ind];
+        const double *w = &iLG[(c.ind/SMPC_NUM_STATE_VAR)*N];
+        double *row = icL[ind];
+
+
+        for (int i = 0; i <= ind; ++i)
+        {
+            const constraint &ci = active_set[i];
+            const double *wi = &iLG[(ci.ind/SMPC_NUM_STATE_VAR)*N];
+            int j;
+
+            // a * inv(H) * a_i'
+            double el = 0.0;
+            for (j = 0; j < N; ++j)
+            {
+                el += w[j] * wi[j];
+            }
+            el *= c.coef_x*ci.coef_x + c.coef_y*ci.coef_y;
+
+            for (j = 0; j < i; ++j)
+            {
+                el -= row[j] * icL[i][j];
+            }
+
+            if (i < ind)
+            {
+                row[i] = el / icL[i][i];
+            }
+            else
+            {
+                row[i] = sqrt(el);
+            }
+        }
+    }
+
+
+
+    /**
+     * @brief Determines feasible descent direction with respect to the
+     * constraints in the working set.
+     *
+     * @param[in] ppar   parameters.
+     * @param[in] active_set a vector of active constraints.
+     * @param[in] x     initial guess.
+     * @param[in] to_bounds if true, the direction moves x onto the bounds
+     *  (lower if c.sign is negative, upper otherwise), otherwise the
+     *  constraints are assumed to be active at x.
+     * @param[out] dx   feasible descent direction, must be allocated.
+     */
+    void condensed_solve::resolve (
+            const problem_parameters& ppar,
+            const working_set &active_set,
+            const double *x,
+            const bool to_bounds,
+            double *dx)
+    {
+        const int N = ppar.N;
+        const int nW = active_set.size();
+        int i, j;
+
+
+        form_grad (ppar, x);
+
+        // A(W,:)*inv(H)*A(W,:)' * lambda = -A(W,:)*inv(H)*g - (b - A(W,:)*x)
+        for (i = 0; i < nW; ++i)
+        {
+            const constraint &c = active_set[i];
+            const double *w = &iLG[(c.ind/SMPC_NUM_STATE_VAR)*N];
+
+#ifdef __SSE2__
+            __m128d wg = _mm_setzero_pd ();
+            for (j = 0; j < N; ++j)
+            {
+                wg = _mm_add_pd (wg, _mm_mul_pd (_mm_set1_pd (w[j]), _mm_loadu_pd (&grad[2*j])));
+            }
+            double wgxy[2];
+            _mm_storeu_pd (wgxy, wg);
+            const double wgx = wgxy[0];
+            const double wgy = wgxy[1];
+#else
+            double wgx = 0.0;
+            double wgy = 0.0;
+            for (j = 0; j < N; ++j)
+            {
+                wgx += w[j] * grad[2*j];
+                wgy += w[j] * grad[2*j+1];
+            }
+#endif
+            lambda[i] = -(c.coef_x*wgx + c.coef_y*wgy);
+
+            if (to_bounds)
+            {
+                lambda[i] -= ((c.sign < 0) ? c.lb : c.ub)
+                    - (c.coef_x*x[c.ind] + c.coef_y*x[c.ind+3]);
+            }
+        }
+        for (i = 0; i < nW; ++i)
+        {
+            for (j = 0; j < i; ++j)
+            {
+                lambda[i] -= icL[i][j] * lambda[j];
+            }
+            lambda[i] /= icL[i][i];
+        }
+        for (i = nW-1; i >= 0; --i)
+        {
+            for (j = i+1; j < nW; ++j)
+            {
+                lambda[i] -= icL[j][i] * lambda[j];
+            }
+            lambda[i] /= icL[i][i];
+        }
+
+        // inv(L)*g + inv(L)*A(W,:)'*lambda
+        for (i = 0; i < nW; ++i)
+        {
+            const constraint &c = active_set[i];
+            const double *w = &iLG[(c.ind/SMPC_NUM_STATE_VAR)*N];
+            const double lx = c.coef_x * lambda[i];
+            const double ly = c.coef_y * lambda[i];
+
+#ifdef __SSE2__
+            const __m128d lxy = _mm_set_pd (ly, lx);
+            for (j = 0; j < N; ++j)
+            {
+                _mm_storeu_pd (&grad[2*j],
+                        _mm_add_pd (_mm_loadu_pd (&grad[2*j]), _mm_mul_pd (lxy, _mm_set1_pd (w[j]))));
+            }
+#else
+            for (j = 0; j < N; ++j)
+            {
+                grad[2*j]   += lx * w[j];
+                grad[2*j+1] += ly * w[j];
+            }
+#endif
+        }
+
+        form_dx (ppar, dx);
+    }
+
+
+
+    /**
+     * @brief Adds the last constraint from the working set and determines
+     * feasible descent direction.
+     *
+     * @param[in] ppar   parameters.
+     * @param[in] active_set a vector of active constraints.
+     * @param[in] x     initial guess.
+     * @param[out] dx   feasible descent direction, must be allocated.
+     */
+    void condensed_solve::up_resolve (
+            const problem_parameters& ppar,
+            const working_set &active_set,
+            const double *x,
+            double *dx)
+    {
+        update (ppar, active_set, active_set.size() - 1);
+        resolve (ppar, active_set, x, false, dx);
+    }
+
+
+
+    /**
+     * @brief Adds all constraints from the given active set at once and
+     *  determines the direction (warm start).
+     *
+     * @param[in] ppar   parameters.
+     * @param[in] active_set a vector of guessed active constraints.
+     * @param[in] x     initial guess.
+     * @param[out] dx   feasible descent direction, must be allocated.
+     *
+     * @attention Unlike #up_resolve, this function does not require the constraints
+     * to be active at x: the resulting direction moves x onto the respective bounds
+     * (lower if c.sign is negative, upper otherwise).
+     */
+    void condensed_solve::warm_resolve (
+            const problem_parameters& ppar,
+            const working_set &active_set,
+            const double *x,
+            double *dx)
+    {
+        for (unsigned int i = 0; i < active_set.size(); ++i)
+        {
+            update (ppar, active_set, i);
+        }
+        resolve (ppar, active_set, x, true, dx);
+    }
+
+
+
+    /**
+     * @brief Removes a constraint from the Cholesky factor and determines
+     * feasible descent direction.
+     *
+     * @param[in] ppar   parameters.
+     * @param[in] active_set a vector of active constraints (the excluded
+     *  constraint must be already removed).
+     * @param[in] ind_exclude index of excluded constraint.
+     * @param[in] x     initial guess.
+     * @param[out] dx   feasible descent direction, must be allocated.
+     */
+    void condensed_solve::down_resolve (
+            const problem_parameters& ppar,
+            const working_set &active_set,
+            const int ind_exclude,
+            const double *x,
+            double *dx)
+    {
+        downdate (active_set.size(), ind_exclude);
+        resolve (ppar, active_set, x, false, dx);
+    }
+
+
+
+    /**
+     * @return a pointer to the memory where current lambdas are stored.
+     */
+    double * condensed_solve::get_lambda ()
+    {
+        return (lambda);
+    }
+
+
+
+    /**
+     * @brief Delete a line from #icL, the triangular form is restored
+     * using Givens rotations (see '@ref pCholDown').
+     *
+     * @param[in] nW    number of added constrains.
+     * @param[in] ind_exclude index of excluded constraint.
+     */
+    void condensed_solve::downdate (const int nW, const int ind_exclude)
+    {
+        // Shuffle memory pointers to avoid copying of the data.
+        double * downdate_row = icL[ind_exclude];
+        for (int i = ind_exclude + 1; i < nW + 1; i++)
+        {
+            icL[i-1] = icL[i];
+        }
+        icL[nW] = downdate_row;
+
+
+        for (int i = ind_exclude; i < nW; i++)
+        {
+            double *cur_el = &icL[i][i];
+            double x1 = cur_el[0];
+            double x2 = cur_el[1];
+            double cosT, sinT;
+
+
+            // Givens rotation matrix
+            if (fabs(x2) >= fabs(x1))
+            {
+                double t = x1/x2;
+                sinT = 1/sqrt(1 + t*t);
+                cosT = sinT*t;
+            }
+            else
+            {
+                double t = x2/x1;
+                cosT = 1/sqrt(1 + t*t);
+                sinT = cosT*t;
+            }
+
+
+            // update elements in the current line
+            cur_el[0] = cosT*x1 + sinT*x2;
+            cur_el[1] = 0;
+
+            // change sign if needed (diagonal elements of Cholesky
+            // decomposition must be positive)
+            double sign = copysign(1, cur_el[0]);
+            cur_el[0] = fabs(cur_el[0]);
+
+            // update the lines below the current one.
+            for (int j = i + 1; j < nW; j++)
+            {
+                double *row_el = &icL[j][i];
+                x1 = row_el[0];
+                x2 = row_el[1];
+
+                row_el[0] = sign * (cosT*x1 + sinT*x2);
+                row_el[1] = -sinT*x1 + cosT*x2;
+            }
+        }
+    }
+}
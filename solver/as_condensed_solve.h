@@ -0,0 +1,117 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @date 17.10.2026 10:01:45 MSD
+ */
+
+
+#ifndef AS_CONDENSED_SOLVE_H
+#define AS_CONDENSED_SOLVE_H
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include "smpc_common.h"
+#include "as_problem_param.h"
+#include "as_constraint.h"
+#include "as_working_set.h"
+#include "smpc_arena.h"
+#include "smpc_instrumentation.h"
+
+
+/****************************************
+ * DEFINES
+ ****************************************/
+
+/// @addtogroup gAS
+/// @{
+namespace AS
+{
+    /**
+     * @brief Solves the equality constrained subproblems of the active set
+     * method in the condensed form: the states are expressed through the
+     * controls (x = Gamma*u + const, Gamma depends only on the sampling
+     * times and the heights of CoM), hence the only variables are 2*N
+     * jerks and the hessian H = Gamma'*Q*Gamma + P is dense. The hessian is
+     * the same for x and y components, its Cholesky factor L (N x N) is
+     * reused while the sampling times and the heights are not changed.
+     *
+     * The constraints are handled by the range-space method: the Cholesky
+     * factor of A(W,:)*inv(H)*A(W,:)' is updated, when a constraint is
+     * added to or removed from the working set W. The interface mirrors
+     * AS#chol_solve, the states in the direction dx are computed from the
+     * controls.
+     */
+    class condensed_solve
+    {
+        public:
+            /*********** Constructors / Destructors ************/
+            condensed_solve (smpc::arena &, const int, smpc::instrumentation &);
+            static size_t get_mem_size (const int);
+
+            void solve (const AS::problem_parameters&, const double *, double *);
+
+            void up_resolve (const AS::problem_parameters&, const AS::working_set&, const double *, double *);
+            void warm_resolve (const AS::problem_parameters&, const AS::working_set&, const double *, double *);
+
+            double * get_lambda ();
+            void down_resolve (const AS::problem_parameters&, const AS::working_set&, const int, const double *, double *);
+
+
+        private:
+            void form (const AS::problem_parameters&);
+            void form_grad (const AS::problem_parameters&, const double *);
+            void form_dx (const AS::problem_parameters&, double *);
+            void update (const AS::problem_parameters&, const AS::working_set&, const int);
+            void downdate (const int, const int);
+
+            void resolve (
+                    const AS::problem_parameters&,
+                    const AS::working_set&,
+                    const double *,
+                    const bool,
+                    double *);
+
+
+    // ----------------------------------------------
+    // variables
+            /// Instrumentation of the owner.
+            smpc::instrumentation *instr;
+
+            /// Sampling times and heights of CoM (T0, h0, T1, h1, ...), which
+            /// correspond to #L.
+            double *Th;
+
+            /// true if #L is formed.
+            bool is_formed;
+
+            /// Cholesky factor of the hessian of jerks of one component
+            /// (N x N, lower triangular, row-major).
+            double *L;
+
+            /// Rows of inv(L)*Gp', where Gp (N x N) maps the jerks of one
+            /// component to the positions of ZMP, i.e. row i corresponds
+            /// to the constraints of the i-th state (N x N, row-major).
+            double *iLG;
+
+            /// Cholesky factor of A(W,:)*inv(H)*A(W,:)', row i corresponds
+            /// to i-th constraint in the working set.
+            double **icL;
+
+            /// All lines of #icL are stored in one chunk of memory.
+            double *icL_mem;
+
+            /// Lagrange multipliers of the constraints in the working set.
+            double *lambda;
+
+            /// Gradient of the objective with respect to the jerks (2*N,
+            /// the x and y components are adjacent, as the controls in the
+            /// vector of variables), it is also used in substitutions.
+            double *grad;
+
+            /// Temporary storage for the states of one component (3*N).
+            double *tmp_states;
+    };
+}
+/// @}
+#endif /*AS_CONDENSED_SOLVE_H*/
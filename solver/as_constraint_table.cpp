@@ -0,0 +1,454 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @date 17.10.2026 12:00:00 MSD
+ */
+
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include "solver_config.h"
+#include "as_constraint_table.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#ifdef HAVE_AVX_DISPATCH
+#include <immintrin.h>
+#endif
+
+
+/****************************************
+ * FUNCTIONS
+ ****************************************/
+namespace AS
+{
+    //==============================================
+    // constructors / destructors
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in,out] mem memory arena
+     * @param[in] N size of the preview window.
+     */
+    constraint_table::constraint_table (smpc::arena &mem, const int N)
+    {
+        num = 2*N;
+
+        coef_x = mem.alloc<double>(num);
+        coef_y = mem.alloc<double>(num);
+        lb = mem.alloc<double>(num);
+        ub = mem.alloc<double>(num);
+        active = mem.alloc<double>(num);
+        sign = mem.alloc<int>(num);
+
+#ifdef HAVE_AVX_DISPATCH
+        avx_on = __builtin_cpu_supports ("avx");
+#else
+        avx_on = false;
+#endif
+    }
+
+
+    /**
+     * @param[in] N size of the preview window
+     * @return the amount of memory, which must be available in the arena
+     *  passed to the constructor [bytes].
+     */
+    size_t constraint_table::get_mem_size (const int N)
+    {
+        return (5*smpc::arena::get_size<double>(2*N)
+                + smpc::arena::get_size<int>(2*N));
+    }
+    //==============================================
+
+
+    /**
+     * @brief Set parameters of the bound, the constraint becomes inactive.
+     *
+     * @param[in] cind the number of constraint
+     * @param[in] coef_x_ coefficient for x coordinate
+     * @param[in] coef_y_ coefficient for y coordinate
+     * @param[in] lb_ lower bound
+     * @param[in] ub_ upper bound
+     */
+    void constraint_table::set (
+            const int cind,
+            const double coef_x_,
+            const double coef_y_,
+            const double lb_,
+            const double ub_)
+    {
+        coef_x[cind] = coef_x_;
+        coef_y[cind] = coef_y_;
+        lb[cind] = lb_;
+        ub[cind] = ub_;
+        active[cind] = 0.0;
+    }
+
+
+    /**
+     * @brief Add the constraint to the working set.
+     *
+     * @param[in] cind the number of constraint
+     * @param[in] sign_ -1 if the lower bound is active, 1 otherwise.
+     */
+    void constraint_table::activate (const int cind, const int sign_)
+    {
+        active[cind] = 1.0;
+        sign[cind] = sign_;
+    }
+
+
+    /**
+     * @brief Remove the constraint from the working set.
+     *
+     * @param[in] cind the number of constraint
+     */
+    void constraint_table::deactivate (const int cind)
+    {
+        active[cind] = 0.0;
+    }
+
+
+    /**
+     * @brief Returns a copy of the constraint.
+     *
+     * @param[in] cind the number of constraint
+     *
+     * @return constraint
+     */
+    constraint constraint_table::get (const int cind) const
+    {
+        constraint c;
+
+        c.set (cind, coef_x[cind], coef_y[cind], lb[cind], ub[cind], active[cind] > 0.0);
+        c.sign = sign[cind];
+
+        return (c);
+    }
+
+
+
+    /**
+     * @brief Finds the inactive constraint, which blocks the step in the
+     * given direction first.
+     *
+     * @param[in] X the current point
+     * @param[in] dX feasible descent direction
+     * @param[in] tol tolerance
+     * @param[in,out] alpha the maximal length of the step as input, the
+     *  length of the step till the blocking constraint as output.
+     * @param[out] sign_ -1 if the lower bound is blocking, 1 otherwise,
+     *  unchanged if there is no blocking constraint.
+     *
+     * @return the number of the blocking constraint or -1. If several
+     *  constraints block the step at the same point, the one with the
+     *  smallest number is returned.
+     */
+    int constraint_table::find_blocking (
+            const double *X,
+            const double *dX,
+            const double tol,
+            double &alpha,
+            int &sign_) const
+    {
+        int ind = -1;
+
+#ifdef HAVE_AVX_DISPATCH
+        if (avx_on)
+        {
+            find_blocking_avx (X, dX, tol, alpha, ind, sign_);
+            return (ind);
+        }
+#endif
+#ifdef __SSE2__
+        find_blocking_sse2 (X, dX, tol, alpha, ind, sign_);
+#else
+        find_blocking_scalar (0, num, X, dX, tol, alpha, ind, sign_);
+#endif
+        return (ind);
+    }
+
+
+
+    /**
+     * @brief Scalar version of #find_blocking, processes the given range
+     * of constraints.
+     *
+     * @param[in] first the first constraint
+     * @param[in] last the constraint after the last one
+     * @param[in] X the current point
+     * @param[in] dX feasible descent direction
+     * @param[in] tol tolerance
+     * @param[in,out] alpha the length of the step
+     * @param[in,out] ind the number of the blocking constraint
+     * @param[in,out] sign_ the sign of the blocking constraint
+     */
+    void constraint_table::find_blocking_scalar (
+            const int first,
+            const int last,
+            const double *X,
+            const double *dX,
+            const double tol,
+            double &alpha,
+            int &ind,
+            int &sign_) const
+    {
+        for (int i = first; i < last; ++i)
+        {
+            // Check only inactive constraints for violation.
+            // The constraints in the working set will not be violated regardless of
+            // the depth of descent
+            if (active[i] > 0.0)
+            {
+                continue;
+            }
+
+            const int xind = i/2*SMPC_NUM_STATE_VAR;
+            const double constr = X[xind]*coef_x[i] + X[xind+3]*coef_y[i];
+            const double d_constr = dX[xind]*coef_x[i] + dX[xind+3]*coef_y[i];
+
+            if ( d_constr < -tol )
+            {
+                const double t = (lb[i] - constr)/d_constr;
+                if (t < alpha)
+                {
+                    alpha = t;
+                    ind = i;
+                    sign_ = -1;
+                }
+            }
+            else if ( d_constr > tol )
+            {
+                const double t = (ub[i] - constr)/d_constr;
+                if (t < alpha)
+                {
+                    alpha = t;
+                    ind = i;
+                    sign_ = 1;
+                }
+            }
+        }
+    }
+
+
+
+    /**
+     * @brief Selects the best result from the results of several vector lanes.
+     *
+     * @param[in] lanes_num the number of lanes
+     * @param[in] lane_alpha step lengths
+     * @param[in] lane_ind numbers of constraints (-1 if not found)
+     * @param[in] lane_sign signs of constraints
+     * @param[in,out] alpha the length of the step
+     * @param[in,out] ind the number of the blocking constraint
+     * @param[in,out] sign_ the sign of the blocking constraint
+     */
+    static inline void reduce_lanes (
+            const int lanes_num,
+            const double *lane_alpha,
+            const double *lane_ind,
+            const double *lane_sign,
+            double &alpha,
+            int &ind,
+            int &sign_)
+    {
+        for (int i = 0; i < lanes_num; ++i)
+        {
+            const int cur_ind = static_cast<int>(lane_ind[i]);
+            if (cur_ind < 0)
+            {
+                continue;
+            }
+
+            // the same tie-breaking as in the scalar version: the constraint
+            // with the smallest number wins.
+            if ((lane_alpha[i] < alpha)
+                    || (!(alpha < lane_alpha[i]) && (cur_ind < ind)))
+            {
+                alpha = lane_alpha[i];
+                ind = cur_ind;
+                sign_ = (lane_sign[i] < 0.0) ? -1 : 1;
+            }
+        }
+    }
+
+
+#ifdef __SSE2__
+    /**
+     * @brief SSE2 version of #find_blocking: two constraints of a state
+     * are processed at once.
+     *
+     * @param[in] X the current point
+     * @param[in] dX feasible descent direction
+     * @param[in] tol tolerance
+     * @param[in,out] alpha the length of the step
+     * @param[in,out] ind the number of the blocking constraint
+     * @param[in,out] sign_ the sign of the blocking constraint
+     */
+    void constraint_table::find_blocking_sse2 (
+            const double *X,
+            const double *dX,
+            const double tol,
+            double &alpha,
+            int &ind,
+            int &sign_) const
+    {
+        const __m128d v_tol = _mm_set1_pd (tol);
+        const __m128d v_neg_tol = _mm_set1_pd (-tol);
+        const __m128d v_zero = _mm_setzero_pd ();
+        const __m128d v_one = _mm_set1_pd (1.0);
+        const __m128d v_minus_one = _mm_set1_pd (-1.0);
+        const __m128d v_two = _mm_set1_pd (2.0);
+
+        __m128d best_alpha = _mm_set1_pd (alpha);
+        __m128d best_ind = _mm_set1_pd (-1.0);
+        __m128d best_sign = v_one;
+        __m128d cur_ind = _mm_set_pd (1.0, 0.0);
+
+        for (int i = 0, xind = 0; i < num; i += 2, xind += SMPC_NUM_STATE_VAR)
+        {
+            const __m128d cx = _mm_loadu_pd (&coef_x[i]);
+            const __m128d cy = _mm_loadu_pd (&coef_y[i]);
+
+            const __m128d constr = _mm_add_pd (
+                    _mm_mul_pd (_mm_set1_pd (X[xind]), cx),
+                    _mm_mul_pd (_mm_set1_pd (X[xind+3]), cy));
+            const __m128d d_constr = _mm_add_pd (
+                    _mm_mul_pd (_mm_set1_pd (dX[xind]), cx),
+                    _mm_mul_pd (_mm_set1_pd (dX[xind+3]), cy));
+
+            const __m128d lower = _mm_cmplt_pd (d_constr, v_neg_tol);
+            const __m128d upper = _mm_cmpgt_pd (d_constr, v_tol);
+            const __m128d valid = _mm_and_pd (
+                    _mm_or_pd (lower, upper),
+                    _mm_cmpeq_pd (_mm_loadu_pd (&active[i]), v_zero));
+
+            // bound = lower ? lb : ub
+            const __m128d bound = _mm_or_pd (
+                    _mm_and_pd (lower, _mm_loadu_pd (&lb[i])),
+                    _mm_andnot_pd (lower, _mm_loadu_pd (&ub[i])));
+            // division by 1 in the invalid lanes
+            const __m128d divisor = _mm_or_pd (
+                    _mm_and_pd (valid, d_constr),
+                    _mm_andnot_pd (valid, v_one));
+            const __m128d t = _mm_div_pd (_mm_sub_pd (bound, constr), divisor);
+
+            const __m128d better = _mm_and_pd (valid, _mm_cmplt_pd (t, best_alpha));
+            best_alpha = _mm_or_pd (
+                    _mm_and_pd (better, t),
+                    _mm_andnot_pd (better, best_alpha));
+            best_ind = _mm_or_pd (
+                    _mm_and_pd (better, cur_ind),
+                    _mm_andnot_pd (better, best_ind));
+            best_sign = _mm_or_pd (
+                    _mm_and_pd (better, _mm_or_pd (
+                            _mm_and_pd (lower, v_minus_one),
+                            _mm_andnot_pd (lower, v_one))),
+                    _mm_andnot_pd (better, best_sign));
+
+            cur_ind = _mm_add_pd (cur_ind, v_two);
+        }
+
+        double lane_alpha[2];
+        double lane_ind[2];
+        double lane_sign[2];
+        _mm_storeu_pd (lane_alpha, best_alpha);
+        _mm_storeu_pd (lane_ind, best_ind);
+        _mm_storeu_pd (lane_sign, best_sign);
+        reduce_lanes (2, lane_alpha, lane_ind, lane_sign, alpha, ind, sign_);
+    }
+#endif
+
+
+#ifdef HAVE_AVX_DISPATCH
+    /**
+     * @brief AVX version of #find_blocking: constraints of two states
+     * are processed at once, used only if supported by the CPU.
+     *
+     * @param[in] X the current point
+     * @param[in] dX feasible descent direction
+     * @param[in] tol tolerance
+     * @param[in,out] alpha the length of the step
+     * @param[in,out] ind the number of the blocking constraint
+     * @param[in,out] sign_ the sign of the blocking constraint
+     */
+    __attribute__((target("avx")))
+    void constraint_table::find_blocking_avx (
+            const double *X,
+            const double *dX,
+            const double tol,
+            double &alpha,
+            int &ind,
+            int &sign_) const
+    {
+        const __m256d v_tol = _mm256_set1_pd (tol);
+        const __m256d v_neg_tol = _mm256_set1_pd (-tol);
+        const __m256d v_zero = _mm256_setzero_pd ();
+        const __m256d v_one = _mm256_set1_pd (1.0);
+        const __m256d v_minus_one = _mm256_set1_pd (-1.0);
+        const __m256d v_four = _mm256_set1_pd (4.0);
+
+        __m256d best_alpha = _mm256_set1_pd (alpha);
+        __m256d best_ind = _mm256_set1_pd (-1.0);
+        __m256d best_sign = v_one;
+        __m256d cur_ind = _mm256_set_pd (3.0, 2.0, 1.0, 0.0);
+
+        // the last state is processed separately if the number of states is odd
+        const int vnum = num - num % 4;
+        int i, xind;
+        for (i = 0, xind = 0; i < vnum; i += 4, xind += 2*SMPC_NUM_STATE_VAR)
+        {
+            const __m256d cx = _mm256_loadu_pd (&coef_x[i]);
+            const __m256d cy = _mm256_loadu_pd (&coef_y[i]);
+
+            const __m256d x = _mm256_set_pd (
+                    X[xind + SMPC_NUM_STATE_VAR], X[xind + SMPC_NUM_STATE_VAR], X[xind], X[xind]);
+            const __m256d y = _mm256_set_pd (
+                    X[xind + SMPC_NUM_STATE_VAR + 3], X[xind + SMPC_NUM_STATE_VAR + 3], X[xind + 3], X[xind + 3]);
+            const __m256d dx = _mm256_set_pd (
+                    dX[xind + SMPC_NUM_STATE_VAR], dX[xind + SMPC_NUM_STATE_VAR], dX[xind], dX[xind]);
+            const __m256d dy = _mm256_set_pd (
+                    dX[xind + SMPC_NUM_STATE_VAR + 3], dX[xind + SMPC_NUM_STATE_VAR + 3], dX[xind + 3], dX[xind + 3]);
+
+            // multiplication and addition are not fused to get the same
+            // results as in the scalar version
+            const __m256d constr = _mm256_add_pd (_mm256_mul_pd (x, cx), _mm256_mul_pd (y, cy));
+            const __m256d d_constr = _mm256_add_pd (_mm256_mul_pd (dx, cx), _mm256_mul_pd (dy, cy));
+
+            const __m256d lower = _mm256_cmp_pd (d_constr, v_neg_tol, _CMP_LT_OQ);
+            const __m256d upper = _mm256_cmp_pd (d_constr, v_tol, _CMP_GT_OQ);
+            const __m256d valid = _mm256_and_pd (
+                    _mm256_or_pd (lower, upper),
+                    _mm256_cmp_pd (_mm256_loadu_pd (&active[i]), v_zero, _CMP_EQ_OQ));
+
+            const __m256d bound = _mm256_blendv_pd (_mm256_loadu_pd (&ub[i]), _mm256_loadu_pd (&lb[i]), lower);
+            // division by 1 in the invalid lanes
+            const __m256d divisor = _mm256_blendv_pd (v_one, d_constr, valid);
+            const __m256d t = _mm256_div_pd (_mm256_sub_pd (bound, constr), divisor);
+
+            const __m256d better = _mm256_and_pd (valid, _mm256_cmp_pd (t, best_alpha, _CMP_LT_OQ));
+            best_alpha = _mm256_blendv_pd (best_alpha, t, better);
+            best_ind = _mm256_blendv_pd (best_ind, cur_ind, better);
+            best_sign = _mm256_blendv_pd (best_sign, _mm256_blendv_pd (v_one, v_minus_one, lower), better);
+
+            cur_ind = _mm256_add_pd (cur_ind, v_four);
+        }
+
+        double lane_alpha[4];
+        double lane_ind[4];
+        double lane_sign[4];
+        _mm256_storeu_pd (lane_alpha, best_alpha);
+        _mm256_storeu_pd (lane_ind, best_ind);
+        _mm256_storeu_pd (lane_sign, best_sign);
+        reduce_lanes (4, lane_alpha, lane_ind, lane_sign, alpha, ind, sign_);
+
+        find_blocking_scalar (vnum, num, X, dX, tol, alpha, ind, sign_);
+    }
+#endif
+}
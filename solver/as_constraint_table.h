@@ -0,0 +1,95 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @date 17.10.2026 12:00:00 MSD
+ */
+
+
+#ifndef AS_CONSTRAINT_TABLE_H
+#define AS_CONSTRAINT_TABLE_H
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include "smpc_common.h"
+#include "as_constraint.h"
+#include "smpc_arena.h"
+
+
+/****************************************
+ * TYPEDEFS
+ ****************************************/
+/// @addtogroup gAS
+/// @{
+
+namespace AS
+{
+    /**
+     * @brief Stores all constraints as a structure of arrays, which
+     * allows to check them for blocking using SIMD instructions.
+     *
+     * @note Constraints 2*i and 2*i+1 are associated with the state i.
+     */
+    class constraint_table
+    {
+        public:
+            /*********** Constructors / Destructors ************/
+            constraint_table (smpc::arena &, const int);
+
+            static size_t get_mem_size (const int);
+
+
+            void set (const int, const double, const double, const double, const double);
+            void activate (const int, const int);
+            void deactivate (const int);
+            constraint get (const int) const;
+
+            int find_blocking (const double *, const double *, const double, double &, int &) const;
+
+
+        private:
+            void find_blocking_scalar (
+                    const int, const int,
+                    const double *, const double *, const double,
+                    double &, int &, int &) const;
+#ifdef __SSE2__
+            void find_blocking_sse2 (
+                    const double *, const double *, const double,
+                    double &, int &, int &) const;
+#endif
+#ifdef HAVE_AVX_DISPATCH
+            void find_blocking_avx (
+                    const double *, const double *, const double,
+                    double &, int &, int &) const;
+#endif
+
+
+            /// The number of constraints.
+            int num;
+
+            //@{
+            /// Coefficients
+            double *coef_x;
+            double *coef_y;
+            //@}
+
+            /// Lower bounds.
+            double *lb;
+
+            /// Upper bounds.
+            double *ub;
+
+            /// 1.0 if the constraint is in the working set, 0.0 otherwise.
+            double *active;
+
+            /// Signs of the active constraints, see AS#constraint#sign.
+            int *sign;
+
+            /// true if the CPU supports 256 bit vector instructions.
+            bool avx_on;
+    };
+}
+///@}
+
+#endif /*AS_CONSTRAINT_TABLE_H*/
@@ -11,6 +11,7 @@
  ****************************************/
 
 #include "as_matrix_E.h"
+#include "smpc_sse2.h"
 
 
 
@@ -33,11 +34,59 @@ namespace AS
         double *res = result;
         // a pointer to 6 current state variables
         const double *xc = x;
-        const double *xcp = NULL;
 
 
         state_parameters stp = ppar.spar[0];
 
+#ifdef __SSE2__
+        // x and y components of the current and the previous state
+        __m128d xc0 = smpc_load_xy (&xc[0]);
+        __m128d xc1 = smpc_load_xy (&xc[1]);
+        __m128d xc2 = smpc_load_xy (&xc[2]);
+        __m128d u = _mm_loadu_pd (control);
+
+        // result = -I * x + B * u
+        smpc_store_xy (&res[0], _mm_sub_pd (_mm_mul_pd (_mm_set1_pd (stp.B[0]), u), xc0));
+        smpc_store_xy (&res[1], _mm_sub_pd (_mm_mul_pd (_mm_set1_pd (stp.B[1]), u), xc1));
+        smpc_store_xy (&res[2], _mm_sub_pd (_mm_mul_pd (_mm_set1_pd (stp.B[2]), u), xc2));
+
+
+        for (int i = 1; i < ppar.N; i++)
+        {
+            // next control variables
+            control = &control[SMPC_NUM_CONTROL_VAR];
+            res = &res[SMPC_NUM_STATE_VAR];
+            xc = &xc[SMPC_NUM_STATE_VAR];
+
+            stp = ppar.spar[i];
+
+            const __m128d A3 = _mm_set1_pd (stp.A3);
+            const __m128d A6 = _mm_set1_pd (stp.A6);
+            const __m128d xcp0 = xc0;
+            const __m128d xcp1 = xc1;
+            const __m128d xcp2 = xc2;
+            xc0 = smpc_load_xy (&xc[0]);
+            xc1 = smpc_load_xy (&xc[1]);
+            xc2 = smpc_load_xy (&xc[2]);
+            u = _mm_loadu_pd (control);
+
+            // result = -I * x + B * u + A * xp
+            smpc_store_xy (&res[0], _mm_add_pd (_mm_add_pd (_mm_add_pd (
+                                _mm_sub_pd (_mm_mul_pd (_mm_set1_pd (stp.B[0]), u), xc0),
+                                xcp0),
+                            _mm_mul_pd (A3, xcp1)),
+                        _mm_mul_pd (A6, xcp2)));
+            smpc_store_xy (&res[1], _mm_add_pd (_mm_add_pd (
+                            _mm_sub_pd (_mm_mul_pd (_mm_set1_pd (stp.B[1]), u), xc1),
+                            xcp1),
+                        _mm_mul_pd (A3, xcp2)));
+            smpc_store_xy (&res[2], _mm_add_pd (
+                        _mm_sub_pd (_mm_mul_pd (_mm_set1_pd (stp.B[2]), u), xc2),
+                        xcp2));
+        }
+#else
+        const double *xcp = NULL;
+
         // result = -I * x + B * u
         res[0] = -xc[0] + stp.B[0] * control[0];
         res[1] = -xc[1] + stp.B[1] * control[0];
@@ -65,6 +114,7 @@ namespace AS
             res[4] = -xc[4] + stp.B[1] * control[1] +                   xcp[4] + stp.A3 * xcp[5];
             res[5] = -xc[5] + stp.B[2] * control[1] +                                     xcp[5];
         }
+#endif
     }
 
 
@@ -87,6 +137,64 @@ namespace AS
         const double *xc = x;
         const double *xcn = &xc[SMPC_NUM_STATE_VAR];
 
+#ifdef __SSE2__
+        const __m128d neg_i2Q0 = _mm_set1_pd (-i2Q[0]);
+        const __m128d neg_i2Q1 = _mm_set1_pd (-i2Q[1]);
+        const __m128d neg_i2Q2 = _mm_set1_pd (-i2Q[2]);
+        const __m128d neg_i2P = _mm_set1_pd (-ppar.i2P);
+
+        // x and y components of the current and the next elements of nu
+        __m128d xc0 = smpc_load_xy (&xc[0]);
+        __m128d xc1 = smpc_load_xy (&xc[1]);
+        __m128d xc2 = smpc_load_xy (&xc[2]);
+
+        for (i = 0; i < ppar.N-1; i++)
+        {
+            const __m128d A3 = _mm_set1_pd (ppar.spar[i+1].A3);
+            const __m128d A6 = _mm_set1_pd (ppar.spar[i+1].A6);
+            const __m128d xcn0 = smpc_load_xy (&xcn[0]);
+            const __m128d xcn1 = smpc_load_xy (&xcn[1]);
+            const __m128d xcn2 = smpc_load_xy (&xcn[2]);
+
+
+            // result = i2H * [-I'  A'] * x
+            smpc_store_xy (&res[0], _mm_mul_pd (neg_i2Q0, _mm_sub_pd (xcn0, xc0)));
+            smpc_store_xy (&res[1], _mm_mul_pd (neg_i2Q1, 
+                        _mm_add_pd (_mm_sub_pd (_mm_mul_pd (A3, xcn0), xc1), xcn1)));
+            smpc_store_xy (&res[2], _mm_mul_pd (neg_i2Q2, 
+                        _mm_add_pd (_mm_add_pd (_mm_sub_pd (_mm_mul_pd (A6, xcn0), xc2), _mm_mul_pd (A3, xcn1)), xcn2)));
+
+
+            // result = i2H * B' * x
+            state_parameters stp = ppar.spar[i];
+            _mm_storeu_pd (control_res, _mm_mul_pd (neg_i2P, _mm_add_pd (_mm_add_pd (
+                                _mm_mul_pd (_mm_set1_pd (stp.B[0]), xc0),
+                                _mm_mul_pd (_mm_set1_pd (stp.B[1]), xc1)),
+                            _mm_mul_pd (_mm_set1_pd (stp.B[2]), xc2))));
+
+
+            res = &res[SMPC_NUM_STATE_VAR];
+            control_res = &control_res[SMPC_NUM_CONTROL_VAR];
+            xcn = &xcn[SMPC_NUM_STATE_VAR];
+            xc0 = xcn0;
+            xc1 = xcn1;
+            xc2 = xcn2;
+        }
+
+
+        // result = i2H * [-I'  A'] * x
+        smpc_store_xy (&res[0], _mm_mul_pd (_mm_set1_pd (i2Q[0]), xc0));
+        smpc_store_xy (&res[1], _mm_mul_pd (_mm_set1_pd (i2Q[1]), xc1));
+        smpc_store_xy (&res[2], _mm_mul_pd (_mm_set1_pd (i2Q[2]), xc2));
+
+
+        // result = i2H * B' * x
+        state_parameters stp = ppar.spar[i];
+        _mm_storeu_pd (control_res, _mm_mul_pd (neg_i2P, _mm_add_pd (_mm_add_pd (
+                            _mm_mul_pd (_mm_set1_pd (stp.B[0]), xc0),
+                            _mm_mul_pd (_mm_set1_pd (stp.B[1]), xc1)),
+                        _mm_mul_pd (_mm_set1_pd (stp.B[2]), xc2))));
+#else
         for (i = 0; i < ppar.N-1; i++)
         {
             double A3 = ppar.spar[i+1].A3;
@@ -128,5 +236,6 @@ namespace AS
         state_parameters stp = ppar.spar[i];
         control_res[0] = -ppar.i2P * (stp.B[0] * xc[0] + stp.B[1] * xc[1] + stp.B[2] * xc[2]);
         control_res[1] = -ppar.i2P * (stp.B[0] * xc[3] + stp.B[1] * xc[4] + stp.B[2] * xc[5]);
+#endif
     }
 }
@@ -12,6 +12,7 @@
 #include "as_matrix_ecL.h"
 
 #include <cmath> // sqrt
+#include <cstring> // memcmp, memcpy
 
 
 /****************************************
@@ -47,12 +48,21 @@ namespace AS
     //==============================================
     // constructors / destructors
 
-    matrix_ecL::matrix_ecL (const int N)
+    /**
+     * @brief Constructor
+     *
+     * @param[in,out] mem memory arena
+     * @param[in] N size of the preview window
+     */
+    matrix_ecL::matrix_ecL (smpc::arena &mem, const int N)
     {
-        ecL = new double[MATRIX_SIZE_3x3*N + MATRIX_SIZE_3x3*(N-1)]();
+        ecL = mem.alloc<double>(MATRIX_SIZE_3x3*N + MATRIX_SIZE_3x3*(N-1));
 
-        iQAT = new double[MATRIX_SIZE_3x3];
-        ecL_diag = new double*[N];
+        iQAT = mem.alloc<double>(MATRIX_SIZE_3x3);
+        ecL_diag = mem.alloc<double *>(N);
+
+        Th = mem.alloc<double>(2*N);
+        is_formed = false;
 
         /**
             A constant and well structured 'upper' part of Cholesky factor, 
@@ -90,7 +100,7 @@ namespace AS
         {
             ecL_diag[i] = &ecL[i * MATRIX_SIZE_3x3 * 2];
         }
-        ecL_ndiag = new double*[N-1];
+        ecL_ndiag = mem.alloc<double *>(N-1);
         for (int i = 0; i < N-1; i++)
         {
             ecL_ndiag[i] = &ecL[i * MATRIX_SIZE_3x3 * 2 + MATRIX_SIZE_3x3];
@@ -98,19 +108,18 @@ namespace AS
     }
 
 
-    matrix_ecL::~matrix_ecL()
+    /**
+     * @param[in] N size of the preview window
+     * @return the amount of memory, which must be available in the arena
+     *  passed to the constructor [bytes].
+     */
+    size_t matrix_ecL::get_mem_size (const int N)
     {
-        if (ecL != NULL)
-            delete ecL;
-
-        if (ecL_diag != NULL)
-            delete ecL_diag;
-
-        if (ecL_ndiag != NULL)
-            delete ecL_ndiag;
-
-        if (iQAT != NULL)
-            delete iQAT;
+        return (smpc::arena::get_size<double>(MATRIX_SIZE_3x3*N + MATRIX_SIZE_3x3*(N-1))
+                + smpc::arena::get_size<double>(MATRIX_SIZE_3x3)
+                + smpc::arena::get_size<double *>(N)
+                + smpc::arena::get_size<double>(2*N)
+                + smpc::arena::get_size<double *>(N-1));
     }
     //==============================================
 
@@ -289,20 +298,96 @@ namespace AS
      * @param[in] ppar parameters.
      */
     void matrix_ecL::form (const problem_parameters& ppar)
+    {
+        form_tail (ppar, 0);
+    }
+
+
+
+    /**
+     * @brief Builds matrix L reusing the leading blocks of an already formed
+     * matrix.
+     *
+     * @param[in] ppar parameters.
+     * @param[in] src a matrix, which was formed for the same N, may
+     *  be the same as this matrix.
+     *
+     * @note A block of L depends on the sampling times and heights of CoM
+     * of all preceding steps of the preview window, hence only the blocks
+     * corresponding to the longest common prefix of the sequences can be
+     * reused. The remaining blocks are recomputed, the result is identical
+     * to the result of full factorization.
+     */
+    void matrix_ecL::form (const problem_parameters& ppar, const matrix_ecL &src)
+    {
+        const int own_prefix = get_common_prefix (ppar);
+        if (&src == this)
+        {
+            form_tail (ppar, own_prefix);
+            return;
+        }
+
+        const int src_prefix = src.get_common_prefix (ppar);
+        if (src_prefix > own_prefix)
+        {
+            // diagonal blocks 0 ... src_prefix-1 and non-diagonal blocks
+            // 0 ... src_prefix-2 are stored one after another
+            memcpy (ecL, src.ecL, 
+                    sizeof(double) * MATRIX_SIZE_3x3 * (2*src_prefix - 1));
+            memcpy (Th, src.Th, sizeof(double) * 2 * src_prefix);
+            is_formed = true;
+            form_tail (ppar, src_prefix);
+        }
+        else
+        {
+            form_tail (ppar, own_prefix);
+        }
+    }
+
+
+
+    /**
+     * @brief Builds matrix L starting from the given state, the preceding
+     * blocks must be already formed.
+     *
+     * @param[in] ppar parameters.
+     * @param[in] start_ind index of the first state, which must be recomputed.
+     */
+    void matrix_ecL::form_tail (const problem_parameters& ppar, const int start_ind)
     {
         int i;
         state_parameters stp;
 
 
+        if (start_ind >= ppar.N)
+        {
+            return;
+        }
+
+        for (i = start_ind; i < ppar.N; i++)
+        {
+            // T and h are stored one after another
+            memcpy (&Th[2*i], &ppar.spar[i].T, 2*sizeof(double));
+        }
+        is_formed = true;
 
-        // the first matrix on diagonal
-        stp = ppar.spar[0];
-        form_iQBiPB (stp.B, ppar.i2Q, ppar.i2P, ecL_diag[0]);
-        chol_dec (ecL_diag[0]);
+
+        if (start_ind == 0)
+        {
+            // the first matrix on diagonal
+            stp = ppar.spar[0];
+            form_iQBiPB (stp.B, ppar.i2Q, ppar.i2P, ecL_diag[0]);
+            chol_dec (ecL_diag[0]);
+            i = 1;
+        }
+        else
+        {
+            i = start_ind;
+        }
 
 
         // offsets
-        for (i = 1; i < ppar.N; i++)
+        for (; i < ppar.N; i++)
         {
             stp = ppar.spar[i];
             form_iQAT (stp.A3, stp.A6, ppar.i2Q);
@@ -318,26 +403,60 @@ namespace AS
 
 
     /**
-     * @brief Solve system ecL * x = b using forward substitution.
+     * @brief Finds the number of leading steps of the preview window, for
+     * which the matrix was formed using the same sampling times and heights
+     * of CoM as given in the parameters.
      *
-     * @param[in] N number of states in the preview window
-     * @param[in,out] x vector "b" as input, vector "x" as output
-     *                  (N * #SMPC_NUM_STATE_VAR)
-     * @param[in] start_ind an index of a state, from which substitution 
-     *                      should start
+     * @param[in] ppar parameters.
      *
-     * @note This function can perform partial forward substitution
-     * starting from a given state, and ignoring all preceding states.
-     * This is useful when it is known, that all variables in the 
-     * preceding states are 0.
+     * @return the length of the common prefix (0 ... N), 0 if the matrix was
+     * never formed.
+     *
+     * @note The values are compared bitwise, which is sufficient, since the
+     * sequences are produced by the same code on each iteration.
      */
-    void matrix_ecL::solve_forward(const int N, double *x, const int start_ind) const
+    int matrix_ecL::get_common_prefix (const problem_parameters& ppar) const
     {
-        int i = start_ind, j = start_ind;
-        double *xc = &x[SMPC_NUM_STATE_VAR * start_ind]; // 6 current elements of x
+        if (!is_formed)
+        {
+            return (0);
+        }
 
+        int i;
+        for (i = 0; i < ppar.N; i++)
+        {
+            if (memcmp (&Th[2*i], &ppar.spar[i].T, 2*sizeof(double)) != 0)
+            {
+                break;
+            }
+        }
+        return (i);
+    }
 
-        // compute the first 6 elements using forward substitution
+
+    /**
+     * @brief Checks if the matrix was formed using the same sequences
+     * of sampling times and heights of CoM as given in the parameters.
+     *
+     * @param[in] ppar parameters.
+     *
+     * @return true if the matrix can be reused without forming.
+     */
+    bool matrix_ecL::check_parameters (const problem_parameters& ppar) const
+    {
+        return (get_common_prefix (ppar) == ppar.N);
+    }
+
+
+
+    /**
+     * @brief Forward substitution for the first block of a vector.
+     *
+     * @param[in] i index of the state
+     * @param[in,out] xc 6 elements of the vector corresponding to the state.
+     */
+    inline void matrix_ecL::forward_first (const int i, double *xc) const
+    {
         xc[0] /= ecL_diag[i][0];
         xc[3] /= ecL_diag[i][0];
 
@@ -352,37 +471,126 @@ namespace AS
 
         xc[5] -= xc[3] * ecL_diag[i][2] + xc[4] * ecL_diag[i][5];
         xc[5] /= ecL_diag[i][8];
+    }
 
-        ++i;
 
-        for (; i < N; ++i, ++j)
-        {
-            // 6 elements of x computed on the previous iteration
-            double *xp = xc;
-            // switch to the next level of L / next 6 elements
-            xc = &xc[SMPC_NUM_STATE_VAR];
+    /**
+     * @brief Forward substitution for a block of a vector, except the first one.
+     *
+     * @param[in] i index of the state
+     * @param[in] xp 6 elements computed for the state i-1.
+     * @param[in,out] xc 6 elements of the vector corresponding to the state i.
+     */
+    inline void matrix_ecL::forward_next (const int i, const double *xp, double *xc) const
+    {
+        const int j = i - 1;
 
+        // update the right part of the equation and compute elements
+        xc[0] -= xp[0] * ecL_ndiag[j][0] + xp[1] * ecL_ndiag[j][3] + xp[2] * ecL_ndiag[j][6];
+        xc[0] /= ecL_diag[i][0];
 
-            // update the right part of the equation and compute elements
-            xc[0] -= xp[0] * ecL_ndiag[j][0] + xp[1] * ecL_ndiag[j][3] + xp[2] * ecL_ndiag[j][6];
-            xc[0] /= ecL_diag[i][0];
+        xc[3] -= xp[3] * ecL_ndiag[j][0] + xp[4] * ecL_ndiag[j][3] + xp[5] * ecL_ndiag[j][6];
+        xc[3] /= ecL_diag[i][0];
 
-            xc[3] -= xp[3] * ecL_ndiag[j][0] + xp[4] * ecL_ndiag[j][3] + xp[5] * ecL_ndiag[j][6];
-            xc[3] /= ecL_diag[i][0];
 
+        xc[1] -= xp[1] * ecL_ndiag[j][4] + xp[2] * ecL_ndiag[j][7] + xc[0] * ecL_diag[i][1];
+        xc[1] /= ecL_diag[i][4];
+
+        xc[4] -= xp[4] * ecL_ndiag[j][4] + xp[5] * ecL_ndiag[j][7] + xc[3] * ecL_diag[i][1];
+        xc[4] /= ecL_diag[i][4];
+
+
+        xc[2] -= xp[2] * ecL_ndiag[j][8] + xc[0] * ecL_diag[i][2] + xc[1] * ecL_diag[i][5];
+        xc[2] /= ecL_diag[i][8];
+
+        xc[5] -= xp[5] * ecL_ndiag[j][8] + xc[3] * ecL_diag[i][2] + xc[4] * ecL_diag[i][5];
+        xc[5] /= ecL_diag[i][8];
+    }
+
+
+    /**
+     * @brief Backward substitution for the last block of a vector.
+     *
+     * @param[in] i index of the state (N-1)
+     * @param[in,out] xc 6 elements of the vector corresponding to the state.
+     */
+    inline void matrix_ecL::backward_last (const int i, double *xc) const
+    {
+        xc[2] /= ecL_diag[i][8];
+        xc[5] /= ecL_diag[i][8];
+
+        xc[1] -= xc[2] * ecL_diag[i][5];
+        xc[1] /= ecL_diag[i][4];
+        xc[4] -= xc[5] * ecL_diag[i][5];
+        xc[4] /= ecL_diag[i][4];
+
+        xc[0] -= xc[2] * ecL_diag[i][2] + xc[1] * ecL_diag[i][1];
+        xc[0] /= ecL_diag[i][0];
+        xc[3] -= xc[5] * ecL_diag[i][2] + xc[4] * ecL_diag[i][1];
+        xc[3] /= ecL_diag[i][0];
+    }
+
+
+    /**
+     * @brief Backward substitution for a block of a vector, except the last one.
+     *
+     * @param[in] i index of the state
+     * @param[in] xp 6 elements computed for the state i+1.
+     * @param[in,out] xc 6 elements of the vector corresponding to the state i.
+     */
+    inline void matrix_ecL::backward_next (const int i, const double *xp, double *xc) const
+    {
+        // update the right part of the equation and compute elements
+        xc[2] -= xp[0] * ecL_ndiag[i][6] + xp[1] * ecL_ndiag[i][7] + xp[2] * ecL_ndiag[i][8];
+        xc[2] /= ecL_diag[i][8];
+
+        xc[5] -= xp[3] * ecL_ndiag[i][6] + xp[4] * ecL_ndiag[i][7] + xp[5] * ecL_ndiag[i][8];
+        xc[5] /= ecL_diag[i][8];
+
+
+        xc[1] -= xp[0] * ecL_ndiag[i][3] + xp[1] * ecL_ndiag[i][4] + xc[2] * ecL_diag[i][5];
+        xc[1] /= ecL_diag[i][4];
+
+        xc[4] -= xp[3] * ecL_ndiag[i][3] + xp[4] * ecL_ndiag[i][4] + xc[5] * ecL_diag[i][5];
+        xc[4] /= ecL_diag[i][4];
+
+
+        xc[0] -= xp[0] * ecL_ndiag[i][0] + xc[2] * ecL_diag[i][2] + xc[1] * ecL_diag[i][1];
+        xc[0] /= ecL_diag[i][0];
+
+        xc[3] -= xp[3] * ecL_ndiag[i][0] + xc[5] * ecL_diag[i][2] + xc[4] * ecL_diag[i][1];
+        xc[3] /= ecL_diag[i][0];
+    }
 
-            xc[1] -= xp[1] * ecL_ndiag[j][4] + xp[2] * ecL_ndiag[j][7] + xc[0] * ecL_diag[i][1];
-            xc[1] /= ecL_diag[i][4];
 
-            xc[4] -= xp[4] * ecL_ndiag[j][4] + xp[5] * ecL_ndiag[j][7] + xc[3] * ecL_diag[i][1];
-            xc[4] /= ecL_diag[i][4];
 
+    /**
+     * @brief Solve system ecL * x = b using forward substitution.
+     *
+     * @param[in] N number of states in the preview window
+     * @param[in,out] x vector "b" as input, vector "x" as output
+     *                  ((N - start_ind) * #SMPC_NUM_STATE_VAR), the first
+     *                  element corresponds to the state start_ind.
+     * @param[in] start_ind an index of a state, from which substitution 
+     *                      should start
+     *
+     * @note This function can perform partial forward substitution
+     * starting from a given state, and ignoring all preceding states.
+     * This is useful when it is known, that all variables in the 
+     * preceding states are 0.
+     */
+    void matrix_ecL::solve_forward(const int N, double *x, const int start_ind) const
+    {
+        double *xc = x; // 6 current elements of x
 
-            xc[2] -= xp[2] * ecL_ndiag[j][8] + xc[0] * ecL_diag[i][2] + xc[1] * ecL_diag[i][5];
-            xc[2] /= ecL_diag[i][8];
+        // compute the first 6 elements using forward substitution
+        forward_first (start_ind, xc);
 
-            xc[5] -= xp[5] * ecL_ndiag[j][8] + xc[3] * ecL_diag[i][2] + xc[4] * ecL_diag[i][5];
-            xc[5] /= ecL_diag[i][8];
+        for (int i = start_ind + 1; i < N; ++i)
+        {
+            // switch to the next level of L / next 6 elements
+            forward_next (i, xc, &xc[SMPC_NUM_STATE_VAR]);
+            xc = &xc[SMPC_NUM_STATE_VAR];
         }
     }
 
@@ -395,51 +603,71 @@ namespace AS
      */
     void matrix_ecL::solve_backward (const int N, double *x) const
     {
-        int i;
-        double *xc = & x[(N-1)*SMPC_NUM_STATE_VAR]; // current 6 elements of result
-        double *xp; // 6 elements computed on the previous iteration
-        
-
         // compute the last 6 elements using backward substitution
-        xc[2] /= ecL_diag[N-1][8];
-        xc[5] /= ecL_diag[N-1][8];
-
-        xc[1] -= xc[2] * ecL_diag[N-1][5];
-        xc[1] /= ecL_diag[N-1][4];
-        xc[4] -= xc[5] * ecL_diag[N-1][5];
-        xc[4] /= ecL_diag[N-1][4];
+        backward_last (N-1, &x[(N-1)*SMPC_NUM_STATE_VAR]);
 
-        xc[0] -= xc[2] * ecL_diag[N-1][2] + xc[1] * ecL_diag[N-1][1];
-        xc[0] /= ecL_diag[N-1][0];
-        xc[3] -= xc[5] * ecL_diag[N-1][2] + xc[4] * ecL_diag[N-1][1];
-        xc[3] /= ecL_diag[N-1][0];
-
-
-        for (i = N-2; i >= 0 ; i--)
+        for (int i = N-2; i >= 0 ; i--)
         {
-            xp = xc;
-            xc = & x[i*SMPC_NUM_STATE_VAR];
+            backward_next (i, &x[(i+1)*SMPC_NUM_STATE_VAR], &x[i*SMPC_NUM_STATE_VAR]);
+        }
+    }
 
-            // update the right part of the equation and compute elements
-            xc[2] -= xp[0] * ecL_ndiag[i][6] + xp[1] * ecL_ndiag[i][7] + xp[2] * ecL_ndiag[i][8];
-            xc[2] /= ecL_diag[i][8];
 
-            xc[5] -= xp[3] * ecL_ndiag[i][6] + xp[4] * ecL_ndiag[i][7] + xp[5] * ecL_ndiag[i][8];
-            xc[5] /= ecL_diag[i][8];
+    /**
+     * @brief Solve systems ecL * x = b for several vectors b at once using
+     * forward substitution. The matrix is traversed only once: each block
+     * of the matrix is applied to all vectors.
+     *
+     * @param[in] N number of states in the preview window
+     * @param[in] M the number of vectors
+     * @param[in,out] x M vectors "b" as input (N * #SMPC_NUM_STATE_VAR
+     *                  elements each, stored one after another), vectors
+     *                  "x" as output.
+     */
+    void matrix_ecL::solve_forward_multi (const int N, const int M, double *x) const
+    {
+        const int len = N*SMPC_NUM_STATE_VAR;
 
+        for (int m = 0; m < M; ++m)
+        {
+            forward_first (0, &x[m*len]);
+        }
 
-            xc[1] -= xp[0] * ecL_ndiag[i][3] + xp[1] * ecL_ndiag[i][4] + xc[2] * ecL_diag[i][5];
-            xc[1] /= ecL_diag[i][4];
+        for (int i = 1; i < N; ++i)
+        {
+            double *xc = &x[i*SMPC_NUM_STATE_VAR];
+            for (int m = 0; m < M; ++m, xc += len)
+            {
+                forward_next (i, xc - SMPC_NUM_STATE_VAR, xc);
+            }
+        }
+    }
 
-            xc[4] -= xp[3] * ecL_ndiag[i][3] + xp[4] * ecL_ndiag[i][4] + xc[5] * ecL_diag[i][5];
-            xc[4] /= ecL_diag[i][4];
 
+    /**
+     * @brief Solve systems ecL' * x = b for several vectors b at once using
+     * backward substitution, see #solve_forward_multi.
+     *
+     * @param[in] N number of states in the preview window
+     * @param[in] M the number of vectors
+     * @param[in,out] x M vectors "b" as input, vectors "x" as output.
+     */
+    void matrix_ecL::solve_backward_multi (const int N, const int M, double *x) const
+    {
+        const int len = N*SMPC_NUM_STATE_VAR;
 
-            xc[0] -= xp[0] * ecL_ndiag[i][0] + xc[2] * ecL_diag[i][2] + xc[1] * ecL_diag[i][1];
-            xc[0] /= ecL_diag[i][0];
+        for (int m = 0; m < M; ++m)
+        {
+            backward_last (N-1, &x[m*len + (N-1)*SMPC_NUM_STATE_VAR]);
+        }
 
-            xc[3] -= xp[3] * ecL_ndiag[i][0] + xc[5] * ecL_diag[i][2] + xc[4] * ecL_diag[i][1];
-            xc[3] /= ecL_diag[i][0];
+        for (int i = N-2; i >= 0 ; i--)
+        {
+            double *xc = &x[i*SMPC_NUM_STATE_VAR];
+            for (int m = 0; m < M; ++m, xc += len)
+            {
+                backward_next (i, xc + SMPC_NUM_STATE_VAR, xc);
+            }
         }
     }
 }
@@ -36,19 +36,26 @@ namespace AS
     {
         public:
             /*********** Constructors / Destructors ************/
-            matrix_ecL(const int);
-            ~matrix_ecL();
+            matrix_ecL(smpc::arena &, const int);
+
+            static size_t get_mem_size (const int);
 
             void form (const problem_parameters&);
+            void form (const problem_parameters&, const matrix_ecL &);
+            int get_common_prefix (const problem_parameters&) const;
+            bool check_parameters (const problem_parameters&) const;
 
             void solve_backward (const int, double *) const;
             void solve_forward (const int, double *, const int start_ind = 0) const;
+            void solve_backward_multi (const int, const int, double *) const;
+            void solve_forward_multi (const int, const int, double *) const;
 
             double *ecL;
             double **ecL_diag;
             double **ecL_ndiag;
 
         private:
+            void form_tail (const problem_parameters&, const int);
             void chol_dec (double *);
 
             void form_iQBiPB (const double *, const double *, const double, double*);
@@ -58,9 +65,21 @@ namespace AS
             void form_L_non_diag(const double *, double *);
             void form_L_diag(const double *, double *);
 
+            void forward_first (const int, double *) const;
+            void forward_next (const int, const double *, double *) const;
+            void backward_last (const int, double *) const;
+            void backward_next (const int, const double *, double *) const;
+
 
             // intermediate results used in computation of L
             double *iQAT;       /// inv(Q) * A'
+
+            /// Sampling times and heights of CoM (T0, h0, T1, h1, ...), which
+            /// were used to form the matrix.
+            double *Th;
+
+            /// false if the matrix was never formed.
+            bool is_formed;
     };
 }
 /// @}
@@ -17,7 +17,18 @@
  ****************************************/
 namespace AS
 {
+    /**
+     * @brief Constructor
+     *
+     * @param[in,out] mem memory arena
+     * @param[in] N_ size of the preview window
+     * @param[in] gain_position position gain
+     * @param[in] gain_velocity velocity gain
+     * @param[in] gain_acceleration acceleration gain
+     * @param[in] gain_jerk jerk gain
+     */
     problem_parameters::problem_parameters (
+        smpc::arena &mem,
         const int N_,
         const double gain_position,
         const double gain_velocity,
@@ -32,15 +43,18 @@ namespace AS
 
         i2P = 1/(2 * (gain_jerk/2));
 
-        spar = new state_parameters[N];
+        spar = mem.alloc<state_parameters>(N);
     }
 
 
-
-    problem_parameters::~problem_parameters()
+    /**
+     * @param[in] N size of the preview window
+     * @return the amount of memory, which must be available in the arena
+     *  passed to the constructor [bytes].
+     */
+    size_t problem_parameters::get_mem_size (const int N)
     {
-        if (spar != NULL)
-            delete [] spar;
+        return (smpc::arena::get_size<state_parameters>(N));
     }
 
 
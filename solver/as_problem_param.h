@@ -13,6 +13,7 @@
  ****************************************/
 
 #include "smpc_common.h"
+#include "smpc_arena.h"
 
 /****************************************
  * DEFINES
@@ -45,8 +46,9 @@ namespace AS
     class problem_parameters
     {
         public:
-            problem_parameters (const int, const double, const double, const double, const double);
-            ~problem_parameters();
+            problem_parameters (smpc::arena &, const int, const double, const double, const double, const double);
+
+            static size_t get_mem_size (const int);
 
             void set_state_parameters (const double*, const double*, const double);
 
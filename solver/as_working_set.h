@@ -0,0 +1,142 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @date 17.10.2026 18:00:00 MSD
+ */
+
+
+#ifndef AS_WORKING_SET_H
+#define AS_WORKING_SET_H
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include "smpc_common.h"
+#include "as_constraint.h"
+#include "smpc_arena.h"
+
+
+/****************************************
+ * TYPEDEFS
+ ****************************************/
+/// @addtogroup gAS
+/// @{
+
+namespace AS
+{
+    /**
+     * @brief An ordered set of active constraints. Only one bound of each
+     * of 2*N constraints can be active, hence the capacity of the set is
+     * known in advance, and the elements are stored in a preallocated array.
+     * The interface mimics the relevant part of std::vector.
+     */
+    class working_set
+    {
+        public:
+            /**
+             * @brief Constructor
+             *
+             * @param[in,out] mem memory arena
+             * @param[in] N size of the preview window
+             */
+            working_set (smpc::arena &mem, const int N)
+            {
+                constraints = mem.alloc<constraint>(2*N);
+                num = 0;
+            }
+
+
+            /**
+             * @param[in] N size of the preview window
+             * @return the amount of memory, which must be available in the arena
+             *  passed to the constructor [bytes].
+             */
+            static size_t get_mem_size (const int N)
+            {
+                return (smpc::arena::get_size<constraint>(2*N));
+            }
+
+
+            /// @return the number of active constraints.
+            unsigned int size () const
+            {
+                return (num);
+            }
+
+            //@{
+            /// @return i-th active constraint.
+            constraint & operator[] (const unsigned int i)
+            {
+                return (constraints[i]);
+            }
+            const constraint & operator[] (const unsigned int i) const
+            {
+                return (constraints[i]);
+            }
+            //@}
+
+            /// @return the last added constraint.
+            const constraint & back () const
+            {
+                return (constraints[num-1]);
+            }
+
+
+            /**
+             * @brief Adds a constraint to the end of the set.
+             *
+             * @param[in] c constraint
+             */
+            void push_back (const constraint &c)
+            {
+                constraints[num] = c;
+                ++num;
+            }
+
+
+            /**
+             * @brief Removes a constraint, the order of the remaining
+             * constraints is preserved.
+             *
+             * @param[in] ind index of the constraint in the set
+             */
+            void erase (const unsigned int ind)
+            {
+                for (unsigned int i = ind + 1; i < num; ++i)
+                {
+                    constraints[i-1] = constraints[i];
+                }
+                --num;
+            }
+
+
+            /**
+             * @brief Drops the constraints starting from the given position.
+             *
+             * @param[in] num_ the new size of the set (not greater than the current).
+             */
+            void resize (const unsigned int num_)
+            {
+                num = num_;
+            }
+
+
+            /// Removes all constraints.
+            void clear ()
+            {
+                num = 0;
+            }
+
+
+        private:
+            /// Active constraints.
+            constraint *constraints;
+
+            /// The number of active constraints.
+            unsigned int num;
+    };
+}
+///@}
+
+#endif /*AS_WORKING_SET_H*/
@@ -12,6 +12,9 @@
 
 #include "ip_chol_solve.h"
 
+#include <new> // placement new
+#include <cmath> // fabs
+
 
 /****************************************
  * FUNCTIONS 
@@ -24,22 +27,117 @@ namespace IP
     /**
      * @brief Constructor
      *
+     * @param[in,out] mem memory arena
      * @param[in] N size of the preview window.
+     * @param[in] refactor_tol_ relative change of an element of i2hess, which
+     *  requires refactorization (0 -- the factor is always formed from scratch).
+     * @param[in] kkt_solver method used to solve the KKT system.
+     * @param[in,out] instr_ instrumentation
      */
-    chol_solve::chol_solve (const int N) : ecL(N)
+    chol_solve::chol_solve (
+            smpc::arena &mem, 
+            const int N, 
+            const double refactor_tol_,
+            const smpc::kktSolverType kkt_solver,
+            smpc::instrumentation &instr_)
     {
-        w = new double[N*SMPC_NUM_STATE_VAR];
+        instr = &instr_;
+        refactor_tol = refactor_tol_;
+        factor_ready = false;
+        factor_exact = true;
+
+        ric = NULL;
+        ric_hess_pos = NULL;
+        ecL = NULL;
+
+        if (kkt_solver == smpc::SMPC_KKT_RICCATI)
+        {
+            ric = new (mem.alloc<smpc::riccati>(1)) smpc::riccati(mem, N);
+            ric_hess_pos = mem.alloc<double>(3*N);
+        }
+        else
+        {
+            ecL = new (mem.alloc< matrix_ecL<double> >(1)) matrix_ecL<double>(mem, N);
+        }
+        w = mem.alloc<double>(N*SMPC_NUM_STATE_VAR);
+        i2hess_factor = mem.alloc<double>(2*N);
     }
 
 
+    /// Destructor
     chol_solve::~chol_solve()
     {
-        if (w != NULL)
-            delete w;
+        if (ecL != NULL)
+        {
+            ecL->~matrix_ecL();
+        }
+    }
+
+
+    /**
+     * @param[in] N size of the preview window.
+     * @param[in] kkt_solver method used to solve the KKT system.
+     * @return the amount of memory, which must be available in the arena
+     *  passed to the constructor [bytes].
+     */
+    size_t chol_solve::get_mem_size (
+            const int N,
+            const smpc::kktSolverType kkt_solver)
+    {
+        size_t mem_size = smpc::arena::get_size<double>(N*SMPC_NUM_STATE_VAR)
+            + smpc::arena::get_size<double>(2*N);
+
+        if (kkt_solver == smpc::SMPC_KKT_RICCATI)
+        {
+            mem_size += smpc::arena::get_size<smpc::riccati>(1)
+                + smpc::riccati::get_mem_size(N)
+                + smpc::arena::get_size<double>(3*N);
+        }
+        else
+        {
+            mem_size += smpc::arena::get_size< matrix_ecL<double> >(1)
+                + matrix_ecL<double>::get_mem_size(N);
+        }
+
+        return (mem_size);
     }
     //==============================================
 
 
+    /**
+     * @brief If the rotation angle is constant (see
+     * problem_parameters#constant_angle), the factor corresponds to the
+     * unrotated problem, i.e. E*inv(H)*E' = R * ecL * ecL' * R', where R
+     * rotates the x and y elements of each state by this angle. This
+     * function multiplies a vector by R or R'; it does nothing, if the
+     * angle is not constant or is zero.
+     *
+     * @param[in] ppar          parameters.
+     * @param[in] transpose     multiply by R' if true, by R otherwise.
+     * @param[in,out] x         vector (N * #SMPC_NUM_STATE_VAR)
+     */
+    void chol_solve::rotate (const problem_parameters& ppar, const bool transpose, double *x)
+    {
+        const double cosA = ppar.spar[0].cos;
+        const double sinA = transpose ? -ppar.spar[0].sin : ppar.spar[0].sin;
+
+        if (!ppar.constant_angle || !((sinA < 0.0) || (sinA > 0.0)))
+        {
+            return;
+        }
+
+        for (int i = 0; i < ppar.N*SMPC_NUM_STATE_VAR; i += SMPC_NUM_STATE_VAR)
+        {
+            for (int j = i; j < i + 3; ++j)
+            {
+                const double x_el = x[j];
+                x[j]   = cosA * x_el - sinA * x[j+3];
+                x[j+3] = sinA * x_el + cosA * x[j+3];
+            }
+        }
+    }
+
+
     /**
      * @brief Determines feasible descent direction.
      *
@@ -56,19 +154,164 @@ namespace IP
             const double *x, 
             double *dx)
     {
+        // generate L
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_ECL_FORM);
+        if (ric != NULL)
+        {
+            // the hessian of the positions in X_tilde: R * H * R'
+            for (int i = 0; i < ppar.N; ++i)
+            {
+                const double cosA = ppar.spar[i].cos;
+                const double sinA = ppar.spar[i].sin;
+                const double hx = 1.0 / i2hess[2*i];
+                const double hy = 1.0 / i2hess[2*i + 1];
+
+                ric_hess_pos[3*i]     = cosA*cosA*hx + sinA*sinA*hy;
+                ric_hess_pos[3*i + 1] = cosA*sinA*(hx - hy);
+                ric_hess_pos[3*i + 2] = sinA*sinA*hx + cosA*cosA*hy;
+            }
+            const double hess[3] = {1.0/ppar.i2Q[1], 1.0/ppar.i2Q[2], 1.0/ppar.i2P};
+            ric->form (ppar.N, ppar.spar, ric_hess_pos, hess);
+        }
+        else
+        {
+            form_factor (ppar, i2hess);
+        }
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_ECL_FORM);
+
+        resolve (ppar, i2hess_grad, i2hess, dx);
+    }
+
+
+    /**
+     * @brief The factor must be formed from scratch on the next call of
+     * #solve, must be called when the parameters of the problem change.
+     */
+    void chol_solve::reset()
+    {
+        factor_ready = false;
+    }
+
+
+    /**
+     * @brief Forms the Cholesky factor. If #refactor_tol is set, only the
+     * block rows starting from the first one, where an element of i2hess
+     * has changed by more than #refactor_tol (relative), are formed. The
+     * factor is not formed at all, if there are no such elements. In both
+     * cases the factor may correspond to the lagged elements of i2hess, 
+     * which are kept in #i2hess_factor, see #resolve.
+     *
+     * @param[in] ppar          parameters.
+     * @param[in] i2hess        diagonal elements of inverted hessian.
+     */
+    void chol_solve::form_factor (const problem_parameters& ppar, const double *i2hess)
+    {
+        int first_block = 0;
+        factor_exact = true;
+
+        if (refactor_tol > 0.0)
+        {
+            if (factor_ready)
+            {
+                int i;
+                int first_inexact = ppar.N;
+                for (i = 0; i < 2*ppar.N; ++i)
+                {
+                    const double diff = fabs (i2hess[i] - i2hess_factor[i]);
+                    if (diff > refactor_tol * i2hess_factor[i])
+                    {
+                        break;
+                    }
+                    if ((diff > 0.0) && (first_inexact == ppar.N))
+                    {
+                        first_inexact = i/2;
+                    }
+                }
+                first_block = i/2;
+                factor_exact = (first_inexact >= first_block);
+            }
+
+            for (int i = 2*first_block; i < 2*ppar.N; ++i)
+            {
+                i2hess_factor[i] = i2hess[i];
+            }
+            factor_ready = true;
+
+            if (first_block == ppar.N)
+            {
+                return;
+            }
+
+            // the factor must correspond to the elements, which are kept
+            i2hess = i2hess_factor;
+        }
+
+        ecL->form (ppar, i2hess, first_block);
+    }
+
+
+    /**
+     * @brief Determines feasible descent direction for a different
+     * gradient using the Cholesky factor formed by the last call of #solve.
+     *
+     * @param[in] ppar          parameters.
+     * @param[in] i2hess_grad   negated inverted hessian * g.
+     * @param[in] i2hess        diagonal elements of inverted hessian, must
+     *                          be the same as in the last call of #solve.
+     * @param[out] dx           feasible descent direction, must be allocated.
+     */
+    void chol_solve::resolve(
+            const problem_parameters& ppar, 
+            const double *i2hess_grad,
+            const double *i2hess,
+            double *dx)
+    {
+        if (ric != NULL)
+        {
+            resolve_riccati (ppar, i2hess_grad, i2hess, dx);
+            return;
+        }
+
         double *s_w = w;
         int i,j;
 
 
-        // generate L
-        ecL.form (ppar, i2hess);
+        // If the factor is lagged, the step is computed using the lagged
+        // inverted hessian (i2hess_metric), i.e. the step is made in a 
+        // slightly different metric. Such step is still feasible and is
+        // a descent direction, hence no refinement is needed. The elements
+        // of i2hess_grad are scaled accordingly (dx is used as a buffer).
+        const double *i2hess_metric = i2hess;
+        const double *i2hess_grad_metric = i2hess_grad;
+        if (!factor_exact)
+        {
+            i2hess_metric = i2hess_factor;
+            for (i = 0; i < ppar.N*SMPC_NUM_VAR; ++i)
+            {
+                dx[i] = i2hess_grad[i];
+            }
+            for (i = 0; i < ppar.N*2; ++i)
+            {
+                dx[i*3] *= i2hess_factor[i] / i2hess[i];
+            }
+            i2hess_grad_metric = dx;
+        }
+
 
         // obtain s = E * x;
-        E.form_Ex (ppar, i2hess_grad, s_w);
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_FORM_EX);
+        E.form_Ex (ppar, i2hess_grad_metric, s_w);
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_FORM_EX);
 
         // obtain w
-        ecL.solve_forward(ppar.N, s_w);
-        ecL.solve_backward(ppar.N, s_w);
+        rotate (ppar, true, s_w);
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_SOLVE_FORWARD);
+        ecL->solve_forward(ppar.N, s_w);
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_SOLVE_FORWARD);
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_SOLVE_BACKWARD);
+        ecL->solve_backward(ppar.N, s_w);
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_SOLVE_BACKWARD);
+        rotate (ppar, false, s_w);
 
         // E' * w
         E.form_ETx (ppar, s_w, dx);
@@ -80,11 +323,18 @@ namespace IP
         const double i2H[3] = {ppar.i2Q[1], ppar.i2Q[2], ppar.i2P};
         for (i = 0, j = 0; i < ppar.N*2; i += 2, j += SMPC_NUM_STATE_VAR)
         {
+            double i2hess_grad_pos[2] = {i2hess_grad[j], i2hess_grad[j+3]};
+            if (!factor_exact)
+            {
+                i2hess_grad_pos[0] *= i2hess_factor[i] / i2hess[i];
+                i2hess_grad_pos[1] *= i2hess_factor[i+1] / i2hess[i+1];
+            }
+
             // dx for state variables
-            dx[j]   = i2hess_grad[j]   - i2hess[i] * dx[j]; 
+            dx[j]   = i2hess_grad_pos[0] - i2hess_metric[i] * dx[j]; 
             dx[j+1] = i2hess_grad[j+1] - i2H[0] * dx[j+1]; 
             dx[j+2] = i2hess_grad[j+2] - i2H[1] * dx[j+2]; 
-            dx[j+3] = i2hess_grad[j+3] - i2hess[i+1] * dx[j+3]; 
+            dx[j+3] = i2hess_grad_pos[1] - i2hess_metric[i+1] * dx[j+3]; 
             dx[j+4] = i2hess_grad[j+4] - i2H[0] * dx[j+4]; 
             dx[j+5] = i2hess_grad[j+5] - i2H[1] * dx[j+5]; 
         }
@@ -95,4 +345,61 @@ namespace IP
             dx[i+1] = i2hess_grad[i+1] - i2H[2] * dx[i+1];
         }
     }
+
+
+    /**
+     * @brief Determines feasible descent direction using Riccati recursion
+     * formed by the last call of #solve, see #resolve.
+     *
+     * @param[in] ppar          parameters.
+     * @param[in] i2hess_grad   negated inverted hessian * g.
+     * @param[in] i2hess        diagonal elements of inverted hessian.
+     * @param[out] dx           feasible descent direction, must be allocated.
+     *
+     * @note dx minimizes 0.5*dx'*H*dx + g'*dx subject to E*dx = 0, the
+     * gradient is recovered as g = -H * i2hess_grad and rotated to 
+     * @ref pX_tilde "X_tilde", the solution is rotated back.
+     */
+    void chol_solve::resolve_riccati(
+            const problem_parameters& ppar, 
+            const double *i2hess_grad,
+            const double *i2hess,
+            double *dx)
+    {
+        const double hess[3] = {1.0/ppar.i2Q[1], 1.0/ppar.i2Q[2], 1.0/ppar.i2P};
+        int i,j;
+
+        for (i = 0, j = 0; i < ppar.N; ++i, j += SMPC_NUM_STATE_VAR)
+        {
+            const double cosA = ppar.spar[i].cos;
+            const double sinA = ppar.spar[i].sin;
+            const double gx = -i2hess_grad[j]   / i2hess[2*i];
+            const double gy = -i2hess_grad[j+3] / i2hess[2*i + 1];
+
+            dx[j]   = cosA*gx - sinA*gy;
+            dx[j+1] = -hess[0] * i2hess_grad[j+1];
+            dx[j+2] = -hess[1] * i2hess_grad[j+2];
+            dx[j+3] = sinA*gx + cosA*gy;
+            dx[j+4] = -hess[0] * i2hess_grad[j+4];
+            dx[j+5] = -hess[1] * i2hess_grad[j+5];
+        }
+        for (i = ppar.N*SMPC_NUM_STATE_VAR; i < ppar.N*SMPC_NUM_VAR; ++i)
+        {
+            dx[i] = -hess[2] * i2hess_grad[i];
+        }
+
+        SMPC_PHASE_START(*instr, smpc::SMPC_PHASE_SOLVE_BACKWARD);
+        ric->solve (ppar.N, ppar.spar, dx);
+        SMPC_PHASE_STOP(*instr, smpc::SMPC_PHASE_SOLVE_BACKWARD);
+
+        for (i = 0, j = 0; i < ppar.N; ++i, j += SMPC_NUM_STATE_VAR)
+        {
+            const double cosA = ppar.spar[i].cos;
+            const double sinA = ppar.spar[i].sin;
+            const double dx_x = dx[j];
+
+            dx[j]   =  cosA*dx_x + sinA*dx[j+3];
+            dx[j+3] = -sinA*dx_x + cosA*dx[j+3];
+        }
+    }
 }
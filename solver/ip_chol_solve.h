@@ -15,6 +15,8 @@
 #include "ip_matrix_E.h"
 #include "ip_matrix_ecL.h"
 #include "ip_problem_param.h"
+#include "smpc_riccati.h"
+#include "smpc_instrumentation.h"
 
 
 /****************************************
@@ -30,23 +32,63 @@ namespace IP
 {
     /**
      * @brief Solves @ref pKKT "KKT system" using 
-     * @ref pCholesky "Cholesky decomposition".
+     * @ref pCholesky "Cholesky decomposition" or Riccati recursion,
+     * see smpc#kktSolverType.
      */
     class chol_solve
     {
         public:
             /*********** Constructors / Destructors ************/
-            chol_solve (const int);
+            chol_solve (
+                    smpc::arena &,
+                    const int,
+                    const double,
+                    const smpc::kktSolverType,
+                    smpc::instrumentation &);
             ~chol_solve();
 
+            static size_t get_mem_size (const int, const smpc::kktSolverType);
+
             void solve(const problem_parameters&, const double *, const double *, const double *, double *);
+            void resolve(const problem_parameters&, const double *, const double *, double *);
+            void reset();
 
         private:
+            void form_factor (const problem_parameters&, const double *);
+            void rotate (const problem_parameters&, const bool, double *);
+            void resolve_riccati (const problem_parameters&, const double *, const double *, double *);
+
+
+            /// Instrumentation of the owner.
+            smpc::instrumentation *instr;
+
+            /// Relative change of an element of i2hess, which requires
+            /// refactorization (0 -- the factor is always formed from scratch).
+            double refactor_tol;
+
+            /// Elements of i2hess, which correspond to the current factor.
+            double *i2hess_factor;
+
+            /// true if the factor can be reused.
+            bool factor_ready;
+
+            /// false if the factor corresponds to the lagged elements of
+            /// i2hess, i.e. to #i2hess_factor.
+            bool factor_exact;
+
+            /// Riccati recursion (NULL if the Cholesky factor is used), 
+            /// #refactor_tol is not used in this case.
+            smpc::riccati *ric;
+
+            /// 2x2 blocks of the hessian, which correspond to the positions
+            /// of ZMP in @ref pX_tilde "X_tilde" (only with #ric).
+            double *ric_hess_pos;
+
             /// matrix of equality constraints
             matrix_E E;
 
-            /// L for equality constraints
-            matrix_ecL ecL;
+            /// L for equality constraints (NULL if #ric is used)
+            matrix_ecL<double> *ecL;
 
             /// Lagrange multipliers
             double *w;
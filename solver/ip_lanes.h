@@ -0,0 +1,174 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief A vector of values of the same variable in several independent
+ *  problems, which are solved at once.
+ */
+
+
+#ifndef IP_LANES_H
+#define IP_LANES_H
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include <cmath> // sqrt
+
+#include "smpc_sse2.h"
+
+
+/// @addtogroup gIP
+/// @{
+
+namespace IP
+{
+    /**
+     * @brief Values of a variable in t_num problems (lanes). The arithmetic
+     * operators are applied lane-wise, so that the code written for double
+     * (e.g. IP#matrix_ecL) can be instantiated for several problems. The
+     * loops over the lanes have a fixed length and are vectorized by the
+     * compiler.
+     *
+     * @tparam t_num the number of lanes.
+     *
+     * @note The operators are defined as friends and are found only by
+     * argument dependent lookup, hence they do not hide the functions
+     * operating on double (e.g. sqrt).
+     */
+    template <int t_num>
+        class lanes
+    {
+        public:
+            /// Values are not initialized.
+            lanes () {};
+
+            /**
+             * @brief Sets all lanes to the same value.
+             *
+             * @param[in] a value
+             */
+            lanes (const double a)
+            {
+                for (int l = 0; l < t_num; ++l)
+                {
+                    v[l] = a;
+                }
+            }
+
+
+            ///@{
+            /// Lane-wise operations.
+            lanes & operator+= (const lanes &a)
+            {
+                for (int l = 0; l < t_num; ++l)
+                {
+                    v[l] += a.v[l];
+                }
+                return (*this);
+            }
+
+            lanes & operator-= (const lanes &a)
+            {
+                for (int l = 0; l < t_num; ++l)
+                {
+                    v[l] -= a.v[l];
+                }
+                return (*this);
+            }
+
+            lanes & operator*= (const lanes &a)
+            {
+                for (int l = 0; l < t_num; ++l)
+                {
+                    v[l] *= a.v[l];
+                }
+                return (*this);
+            }
+
+            lanes & operator/= (const lanes &a)
+            {
+                for (int l = 0; l < t_num; ++l)
+                {
+                    v[l] /= a.v[l];
+                }
+                return (*this);
+            }
+
+            friend lanes operator- (const lanes &a)
+            {
+                lanes res;
+                for (int l = 0; l < t_num; ++l)
+                {
+                    res.v[l] = -a.v[l];
+                }
+                return (res);
+            }
+
+            friend lanes operator+ (const lanes &a, const lanes &b)
+            {
+                lanes res;
+                for (int l = 0; l < t_num; ++l)
+                {
+                    res.v[l] = a.v[l] + b.v[l];
+                }
+                return (res);
+            }
+
+            friend lanes operator- (const lanes &a, const lanes &b)
+            {
+                lanes res;
+                for (int l = 0; l < t_num; ++l)
+                {
+                    res.v[l] = a.v[l] - b.v[l];
+                }
+                return (res);
+            }
+
+            friend lanes operator* (const lanes &a, const lanes &b)
+            {
+                lanes res;
+                for (int l = 0; l < t_num; ++l)
+                {
+                    res.v[l] = a.v[l] * b.v[l];
+                }
+                return (res);
+            }
+
+            friend lanes operator/ (const lanes &a, const lanes &b)
+            {
+                lanes res;
+                for (int l = 0; l < t_num; ++l)
+                {
+                    res.v[l] = a.v[l] / b.v[l];
+                }
+                return (res);
+            }
+
+            friend lanes sqrt (const lanes &a)
+            {
+                lanes res;
+                int l = 0;
+#ifdef __SSE2__
+                // sqrt() from <cmath> is not vectorized, since it sets errno
+                for (; l + 1 < t_num; l += 2)
+                {
+                    _mm_storeu_pd (&res.v[l], _mm_sqrt_pd (_mm_loadu_pd (&a.v[l])));
+                }
+#endif
+                for (; l < t_num; ++l)
+                {
+                    res.v[l] = std::sqrt (a.v[l]);
+                }
+                return (res);
+            }
+            ///@}
+
+
+            /// Values.
+            double v[t_num];
+    };
+}
+/// @}
+
+#endif /*IP_LANES_H*/
@@ -0,0 +1,116 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @date 17.10.2026 09:18:10 MSD
+ */
+
+
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include "ip_lockstep_param.h"
+
+#include <cmath> //cos,sin
+
+/****************************************
+ * FUNCTIONS
+ ****************************************/
+
+namespace IP
+{
+    /**
+     * @brief Constructor
+     *
+     * @param[in,out] mem memory arena
+     * @param[in] N_ size of the preview window
+     * @param[in] gain_position position gain
+     * @param[in] gain_velocity velocity gain
+     * @param[in] gain_acceleration acceleration gain
+     * @param[in] gain_jerk jerk gain
+     */
+    template <int t_num>
+        lockstep_parameters<t_num>::lockstep_parameters (
+            smpc::arena &mem,
+            const int N_,
+            const double gain_position,
+            const double gain_velocity,
+            const double gain_acceleration,
+            const double gain_jerk)
+    {
+        N = N_;
+
+        i2Q[0] = 1/(2*(gain_position/2));
+        i2Q[1] = 1/(2*(gain_velocity/2));
+        i2Q[2] = 1/(2*(gain_acceleration/2));
+
+        i2P = 1/(2 * (gain_jerk/2));
+
+        spar = mem.alloc< state_parameters_t< lanes<t_num> > >(N);
+        h_initial = 0.0;
+        constant_angle = false;
+    }
+
+
+    /**
+     * @param[in] N size of the preview window
+     * @return the amount of memory, which must be available in the arena
+     *  passed to the constructor [bytes].
+     */
+    template <int t_num>
+        size_t lockstep_parameters<t_num>::get_mem_size (const int N)
+    {
+        return (smpc::arena::get_size< state_parameters_t< lanes<t_num> > >(N));
+    }
+
+
+
+    /** @brief Initializes parameters of one of the problems, the same
+        as problem_parameters#set_state_parameters.
+
+        @param[in] lane index of the problem
+        @param[in] T_ Sampling time [sec.]
+        @param[in] h_ Height of the Center of Mass divided by gravity
+        @param[in] h_initial_ current h
+        @param[in] angle Rotation angle for each state in the preview window
+     */
+    template <int t_num>
+        void lockstep_parameters<t_num>::set_state_parameters (
+            const int lane,
+            const double* T_,
+            const double* h_,
+            const double h_initial_,
+            const double* angle)
+    {
+        h_initial.v[lane] = h_initial_;
+
+        for (int i = 0; i < N; i++)
+        {
+            spar[i].cos.v[lane] = cos(angle[i]);
+            spar[i].sin.v[lane] = sin(angle[i]);
+
+            if (i == 0)
+            {
+                spar[i].A6.v[lane] = T_[i]*T_[i]/2 - (h_[0] - h_initial_);
+            }
+            else
+            {
+                spar[i].A6.v[lane] = T_[i]*T_[i]/2 - (h_[i] - h_[i-1]);
+            }
+
+            spar[i].T.v[lane] = T_[i];
+            spar[i].h.v[lane] = h_[i];
+
+            spar[i].B[2].v[lane] = T_[i];
+            spar[i].B[1].v[lane] = T_[i]*T_[i]/2;
+            spar[i].B[0].v[lane] = spar[i].B[1].v[lane]*T_[i]/3 - h_[i]*T_[i];
+
+            spar[i].A3.v[lane] = T_[i];
+        }
+    }
+
+
+    template class lockstep_parameters<4>;
+    template class lockstep_parameters<8>;
+}
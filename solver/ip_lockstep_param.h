@@ -0,0 +1,72 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @date 17.10.2026 09:18:10 MSD
+ */
+
+
+#ifndef IP_LOCKSTEP_PARAM_H
+#define IP_LOCKSTEP_PARAM_H
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include "smpc_common.h"
+#include "smpc_arena.h"
+#include "ip_problem_param.h"
+#include "ip_lanes.h"
+
+/****************************************
+ * TYPEDEFS
+ ****************************************/
+
+/// @addtogroup gIP
+/// @{
+
+namespace IP
+{
+    /**
+     * @brief Parameters of t_num problems with the same length of the
+     * preview window and the same gains, which are solved at once. The
+     * members are the same as in IP#problem_parameters, but the parameters
+     * of the states are stored in IP#lanes.
+     *
+     * @tparam t_num the number of problems.
+     */
+    template <int t_num>
+        class lockstep_parameters
+    {
+        public:
+            lockstep_parameters (smpc::arena &, const int, const double, const double, const double, const double);
+
+            static size_t get_mem_size (const int);
+
+            void set_state_parameters (const int, const double*, const double*, const double, const double*);
+
+
+            /** Number of iterations in a preview window. */
+            int N;
+
+            ///@{
+            /** State related penalty.*/
+            double i2Q[3];
+            ///@}
+
+            ///@{
+            /** Control related penalty. */
+            double i2P;
+            ///@}
+
+            /// Height of the CoM at initial state divided by the gravity.
+            lanes<t_num> h_initial;
+
+            /// Always false: the factorization is never decoupled, see
+            /// IP#problem_parameters#constant_angle.
+            bool constant_angle;
+
+            state_parameters_t< lanes<t_num> > *spar;
+    };
+}
+///@}
+#endif /*IP_LOCKSTEP_PARAM_H*/
@@ -0,0 +1,199 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Evaluation of the logarithmic barrier as a logarithm of a product.
+ */
+
+
+#ifndef IP_LOG_BARRIER_H
+#define IP_LOG_BARRIER_H
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include <cmath> // log, frexp
+
+#include "ip_lanes.h"
+
+
+/****************************************
+ * DEFINES
+ ****************************************/
+
+/// The number of calls of IP#log_sum#add, after which the partial products
+/// are normalized. Each of them must not contain more than 8 factors, so
+/// that a product of factors, which are not smaller than 1e-38, does not
+/// underflow.
+#define SMPC_IP_LOG_NORMALIZE_PERIOD 4
+
+/// log(2)
+#define SMPC_IP_LN2 0.69314718055994530942
+
+
+/// @addtogroup gIP
+/// @{
+
+namespace IP
+{
+    /**
+     * @brief Computes a sum of logarithms of positive numbers as a logarithm
+     * of their product, i.e. one call of log() instead of one per term.
+     *
+     * The factors are accumulated in two independent partial products
+     * (lanes), which can be processed in parallel. The partial products
+     * are periodically split into a mantissa and an exponent (frexp), the
+     * exponents are accumulated separately, hence the products do not
+     * overflow or underflow.
+     */
+    class log_sum
+    {
+        public:
+            log_sum()
+            {
+                product[0] = 1.0;
+                product[1] = 1.0;
+                exponent = 0;
+                counter = 0;
+            }
+
+
+            /**
+             * @brief Adds logarithms of two numbers (one per lane).
+             *
+             * @param[in] a positive number, at most two factors are allowed.
+             * @param[in] b positive number, at most two factors are allowed.
+             */
+            void add (const double a, const double b)
+            {
+                product[0] *= a;
+                product[1] *= b;
+
+                if (++counter == SMPC_IP_LOG_NORMALIZE_PERIOD)
+                {
+                    normalize();
+                }
+            }
+
+
+            /**
+             * @return the sum of logarithms.
+             */
+            double get()
+            {
+                normalize();
+                return (log (product[0] * product[1]) + exponent * SMPC_IP_LN2);
+            }
+
+
+        private:
+            /// Moves the exponents of the partial products to #exponent.
+            void normalize()
+            {
+                int exp0, exp1;
+
+                product[0] = frexp (product[0], &exp0);
+                product[1] = frexp (product[1], &exp1);
+                exponent += exp0 + exp1;
+                counter = 0;
+            }
+
+
+            /// Partial products (lanes), the mantissas are in [0.5, 1)
+            /// after normalization.
+            double product[2];
+
+            /// Sum of the exponents of the normalized partial products.
+            int exponent;
+
+            /// The number of calls of #add since the last normalization.
+            int counter;
+    };
+
+
+
+    /**
+     * @brief The same as IP#log_sum, but the sums are computed for several
+     * problems (IP#lanes) at once.
+     *
+     * @tparam t_num the number of problems.
+     */
+    template <int t_num>
+        class log_sum_lanes
+    {
+        public:
+            log_sum_lanes()
+            {
+                product[0] = 1.0;
+                product[1] = 1.0;
+                for (int l = 0; l < t_num; ++l)
+                {
+                    exponent[l] = 0;
+                }
+                counter = 0;
+            }
+
+
+            /**
+             * @brief Adds logarithms of two numbers in each lane.
+             *
+             * @param[in] a positive numbers, at most two factors are allowed.
+             * @param[in] b positive numbers, at most two factors are allowed.
+             */
+            void add (const lanes<t_num> &a, const lanes<t_num> &b)
+            {
+                product[0] *= a;
+                product[1] *= b;
+
+                if (++counter == SMPC_IP_LOG_NORMALIZE_PERIOD)
+                {
+                    normalize();
+                }
+            }
+
+
+            /**
+             * @return the sums of logarithms.
+             */
+            lanes<t_num> get()
+            {
+                lanes<t_num> res;
+
+                normalize();
+                for (int l = 0; l < t_num; ++l)
+                {
+                    res.v[l] = log (product[0].v[l] * product[1].v[l]) + exponent[l] * SMPC_IP_LN2;
+                }
+                return (res);
+            }
+
+
+        private:
+            /// Moves the exponents of the partial products to #exponent.
+            void normalize()
+            {
+                for (int l = 0; l < t_num; ++l)
+                {
+                    int exp0, exp1;
+
+                    product[0].v[l] = frexp (product[0].v[l], &exp0);
+                    product[1].v[l] = frexp (product[1].v[l], &exp1);
+                    exponent[l] += exp0 + exp1;
+                }
+                counter = 0;
+            }
+
+
+            /// Partial products.
+            lanes<t_num> product[2];
+
+            /// Sums of the exponents of the normalized partial products.
+            int exponent[t_num];
+
+            /// The number of calls of #add since the last normalization.
+            int counter;
+    };
+}
+/// @}
+
+#endif /*IP_LOG_BARRIER_H*/
@@ -11,6 +11,7 @@
  ****************************************/
 
 #include "ip_matrix_E.h"
+#include "ip_lockstep_param.h"
 
 
 
@@ -27,17 +28,18 @@ namespace IP
      * @param[in] x vector x (#SMPC_NUM_VAR * N).
      * @param[out] result vector E*x (#SMPC_NUM_STATE_VAR * N)
      */
-    void matrix_E::form_Ex (const problem_parameters& ppar, const double *x, double *result)
+    template <class t_param, class t_value>
+        void matrix_E::form_Ex (const t_param& ppar, const t_value *x, t_value *result)
     {
-        const double *control = &x[ppar.N*SMPC_NUM_STATE_VAR];
+        const t_value *control = &x[ppar.N*SMPC_NUM_STATE_VAR];
         // a pointer to 6 current elements of result
-        double *res = result;
+        t_value *res = result;
 
 
-        state_parameters stp = ppar.spar[0];
+        state_parameters_t<t_value> stp = ppar.spar[0];
 
         // a pointer to 6 current state variables
-        const double *xc = x;
+        const t_value *xc = x;
 
         // result = -R * x + B * u
         res[0] = -(stp.cos * xc[0] - stp.sin * xc[3]) + stp.B[0] * control[0];
@@ -52,8 +54,8 @@ namespace IP
         {
             stp = ppar.spar[i];
 
-            const double cosA = ppar.spar[i-1].cos;
-            const double sinA = ppar.spar[i-1].sin;
+            const t_value cosA = ppar.spar[i-1].cos;
+            const t_value sinA = ppar.spar[i-1].sin;
 
             // next control variables
             control = &control[SMPC_NUM_CONTROL_VAR];
@@ -80,21 +82,22 @@ namespace IP
      * @param[in] x vector x (#SMPC_NUM_STATE_VAR * N).
      * @param[out] result vector E' * nu (#SMPC_NUM_VAR * N)
      */
-    void matrix_E::form_ETx (const problem_parameters& ppar, const double *x, double *result)
+    template <class t_param, class t_value>
+        void matrix_E::form_ETx (const t_param& ppar, const t_value *x, t_value *result)
     {
         int i;
-        state_parameters stp;
+        state_parameters_t<t_value> stp;
 
-        double *res = result;
-        double *control_res = &result[ppar.N*SMPC_NUM_STATE_VAR];
-        const double *xc;
+        t_value *res = result;
+        t_value *control_res = &result[ppar.N*SMPC_NUM_STATE_VAR];
+        const t_value *xc;
 
 
         for (i = 0; i < ppar.N-1; i++)
         {
             stp = ppar.spar[i];
-            const double A3 = ppar.spar[i+1].A3;
-            const double A6 = ppar.spar[i+1].A6;
+            const t_value A3 = ppar.spar[i+1].A3;
+            const t_value A6 = ppar.spar[i+1].A6;
 
 
             // a pointer to 6 current elements of nu
@@ -140,4 +143,13 @@ namespace IP
         control_res[0] = stp.B[0] * xc[0] + stp.B[1] * xc[1] + stp.B[2] * xc[2];
         control_res[1] = stp.B[0] * xc[3] + stp.B[1] * xc[4] + stp.B[2] * xc[5];
     }
+
+
+    template void matrix_E::form_Ex (const problem_parameters&, const double *, double *);
+    template void matrix_E::form_ETx (const problem_parameters&, const double *, double *);
+
+    template void matrix_E::form_Ex (const lockstep_parameters<4>&, const lanes<4> *, lanes<4> *);
+    template void matrix_E::form_ETx (const lockstep_parameters<4>&, const lanes<4> *, lanes<4> *);
+    template void matrix_E::form_Ex (const lockstep_parameters<8>&, const lanes<8> *, lanes<8> *);
+    template void matrix_E::form_ETx (const lockstep_parameters<8>&, const lanes<8> *, lanes<8> *);
 }
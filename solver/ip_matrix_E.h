@@ -28,6 +28,10 @@ namespace IP
 {
     /**
      * @brief Implements multiplication of matrix E and E' by a vector.
+     *
+     * The functions are templates: t_param is the type of the parameters
+     * (IP#problem_parameters or IP#lockstep_parameters), t_value is the
+     * type of the elements of the vectors (double or IP#lanes).
      */
     class matrix_E
     {
@@ -36,8 +40,10 @@ namespace IP
             matrix_E (){};
             ~matrix_E (){};
 
-            void form_Ex (const problem_parameters&, const double *, double *);
-            void form_ETx (const problem_parameters&, const double *, double *);
+            template <class t_param, class t_value>
+                void form_Ex (const t_param&, const t_value *, t_value *);
+            template <class t_param, class t_value>
+                void form_ETx (const t_param&, const t_value *, t_value *);
     };
 }
 /// @}
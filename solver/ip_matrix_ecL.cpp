@@ -10,6 +10,7 @@
  ****************************************/
 
 #include "ip_matrix_ecL.h"
+#include "ip_lockstep_param.h"
 
 #include <cmath> // sqrt
 
@@ -23,16 +24,28 @@ namespace IP
     // constructors / destructors
 
 
-    matrix_ecL::matrix_ecL (const int N)
+    /**
+     * @brief Constructor
+     *
+     * @param[in,out] mem memory arena
+     * @param[in] N size of the preview window
+     */
+    template <class t_float, class t_input>
+        matrix_ecL<t_float, t_input>::matrix_ecL (smpc::arena &mem, const int N)
     {
-        ecL = new double[MATRIX_SIZE_6x6*N + MATRIX_SIZE_6x6*(N-1)]();
+        ecL = mem.alloc<t_float>(MATRIX_SIZE_6x6*N + MATRIX_SIZE_6x6*(N-1));
     }
 
 
-    matrix_ecL::~matrix_ecL()
+    /**
+     * @param[in] N size of the preview window
+     * @return the amount of memory, which must be available in the arena
+     *  passed to the constructor [bytes].
+     */
+    template <class t_float, class t_input>
+        size_t matrix_ecL<t_float, t_input>::get_mem_size (const int N)
     {
-        if (ecL != NULL)
-            delete ecL;
+        return (smpc::arena::get_size<t_float>(MATRIX_SIZE_6x6*N + MATRIX_SIZE_6x6*(N-1)));
     }
 
     //==============================================
@@ -51,11 +64,12 @@ namespace IP
      * @attention Only elements lying below the main diagonal of 4x4 matrix
      *            are initialized (other elements are not unique).
      */
-    void matrix_ecL::form_M (
-            const double sinA,
-            const double cosA,
+    template <class t_float, class t_input>
+        void matrix_ecL<t_float, t_input>::form_M (
+            const t_input sinA,
+            const t_input cosA,
             const double *i2Q,
-            const double* i2hess)
+            const t_input* i2hess)
     {
         /*      R        *       Q        *       R'      =      M
          * |c    -s    |   |a1          |   |c     s    |   |a1cc+a2ss     a1cs-a2cs    |
@@ -86,7 +100,8 @@ namespace IP
      * @attention Only the elements below the main diagonal are used
      *              in conmputations.
      */
-    void matrix_ecL::chol_dec (double *mx)
+    template <class t_float, class t_input>
+        void matrix_ecL<t_float, t_input>::chol_dec (t_float *mx)
     {
         mx[0] = sqrt(mx[0]);
         mx[1] /= mx[0];
@@ -118,13 +133,50 @@ namespace IP
 
 
 
+    /**
+     * @brief Performs Cholesky decomposition of a matrix, which consists
+     * of two independent 3x3 blocks (x and y), the elements coupling
+     * them are set to zero.
+     *
+     * @param[in,out] mx a pointer to a 6x6 matrix, the result is 
+     *                    stored in the same place.
+     *
+     * @attention Only the elements below the main diagonal are used
+     *              in conmputations.
+     */
+    template <class t_float, class t_input>
+        void matrix_ecL<t_float, t_input>::chol_dec_decoupled (t_float *mx)
+    {
+        // x and y are processed in two independent lanes
+        mx[0]  = sqrt(mx[0]);
+        mx[21] = sqrt(mx[21]);
+        mx[1]  /= mx[0];
+        mx[22] /= mx[21];
+        mx[2]  /= mx[0];
+        mx[23] /= mx[21];
+
+        mx[7]  = sqrt(mx[7]  - mx[1]*mx[1]);
+        mx[28] = sqrt(mx[28] - mx[22]*mx[22]);
+        mx[8]  = (mx[8]  - mx[1]*mx[2])  /mx[7];
+        mx[29] = (mx[29] - mx[22]*mx[23])/mx[28];
+
+        mx[14] = sqrt(mx[14] - mx[2]*mx[2]   - mx[8]*mx[8]);
+        mx[35] = sqrt(mx[35] - mx[23]*mx[23] - mx[29]*mx[29]);
+
+        mx[3] = mx[4] = mx[5] = mx[9] = mx[10] = mx[11] = 
+            mx[15] = mx[16] = mx[17] = 0;
+    }
+
+
+
     /**
      * @brief Forms matrix MAT = M * A'
      *
      * @param[in] A3 4th and 7th elements of A.
      * @param[in] A6 6th element of A.
      */
-    void matrix_ecL::form_MAT (const double A3, const double A6)
+    template <class t_float, class t_input>
+        void matrix_ecL<t_float, t_input>::form_MAT (const t_input A3, const t_input A6)
     {
         MAT[0]  =           M[0];
         MAT[22] = MAT[1]  = A3 * M[7];
@@ -148,7 +200,8 @@ namespace IP
      * @param[in] ecLp previous matrix lying on the diagonal of L
      * @param[in] ecLc the result is stored here
      */
-    void matrix_ecL::form_L_non_diag(const double *ecLp, double *ecLc)
+    template <class t_float, class t_input>
+        void matrix_ecL<t_float, t_input>::form_L_non_diag(const t_float *ecLp, t_float *ecLc)
     {
         /* 
          * L(k,k)   * L(k+1,k)' = -M*A'
@@ -197,6 +250,37 @@ namespace IP
     }
 
 
+    /**
+     * @brief Forms a 6x6 matrix L(k+1, k) in the decoupled case (see
+     * #chol_dec_decoupled), the elements coupling x and y are set to zero.
+     *
+     * @param[in] ecLp previous matrix lying on the diagonal of L
+     * @param[in] ecLc the result is stored here
+     */
+    template <class t_float, class t_input>
+        void matrix_ecL<t_float, t_input>::form_L_non_diag_decoupled(const t_float *ecLp, t_float *ecLc)
+    {
+        // x and y are processed in two independent lanes
+        ecLc[0]  = -MAT[0] /ecLp[0];
+        ecLc[21] = -MAT[21]/ecLp[21];
+
+        ecLc[6]  = (-MAT[1]  - ecLc[0] *ecLp[1])  / ecLp[7];
+        ecLc[27] = (-MAT[22] - ecLc[21]*ecLp[22]) / ecLp[28];
+        ecLc[7]  = -MAT[7] /ecLp[7];
+        ecLc[28] = -MAT[28]/ecLp[28];
+
+        ecLc[12] = (-MAT[2]  - ecLc[0] *ecLp[2]  - ecLc[6] *ecLp[8])  / ecLp[14];
+        ecLc[33] = (-MAT[23] - ecLc[21]*ecLp[23] - ecLc[27]*ecLp[29]) / ecLp[35];
+        ecLc[13] = (-MAT[8]  - ecLc[7] *ecLp[8])  / ecLp[14];
+        ecLc[34] = (-MAT[29] - ecLc[28]*ecLp[29]) / ecLp[35];
+        ecLc[14] = -MAT[14]/ecLp[14];
+        ecLc[35] = -MAT[35]/ecLp[35];
+
+        ecLc[3] = ecLc[9] = ecLc[15] = ecLc[18] = ecLc[19] = ecLc[20] = 
+            ecLc[24] = ecLc[25] = ecLc[26] = ecLc[30] = ecLc[31] = ecLc[32] = 0;
+    }
+
+
     /**
      * @brief Forms a 6x6 matrix L(0, 0) = chol (M + B * inv(2*P) * B).
      *
@@ -206,7 +290,8 @@ namespace IP
      *
      * @attention Only the elements below the main diagonal are initialized.
      */
-    void matrix_ecL::form_L_diag(const double *B, const double i2P, double *ecLc)
+    template <class t_float, class t_input>
+        void matrix_ecL<t_float, t_input>::form_L_diag(const t_input *B, const double i2P, t_float *ecLc)
     {
         // diagonal elements
         ecLc[0]  =            i2P * B[0]*B[0] + M[0];
@@ -243,9 +328,10 @@ namespace IP
      *
      * @attention Only the elements below the main diagonal are initialized.
      */
-    void matrix_ecL::form_AMATMBiPB(const double A3, const double A6, const double *B, const double i2P, double *result)
+    template <class t_float, class t_input>
+        void matrix_ecL<t_float, t_input>::form_AMATMBiPB(const t_input A3, const t_input A6, const t_input *B, const double i2P, t_float *result)
     {
-        const double tmpvar = A3*MAT[1] + A6*MAT[2] + i2P * B[0]*B[0];
+        const t_input tmpvar = A3*MAT[1] + A6*MAT[2] + i2P * B[0]*B[0];
 
         result[0]  =              tmpvar + M[0] + MAT[0];
         result[22] = result[1]  = i2P * B[0]*B[1]        +             MAT[1] + A3*MAT[2];
@@ -272,7 +358,8 @@ namespace IP
      *
      * @attention Only the elements below the main diagonal are initialized.
      */
-    void matrix_ecL::form_L_diag (const double *p, double *ecLc)
+    template <class t_float, class t_input>
+        void matrix_ecL<t_float, t_input>::form_L_diag (const t_float *p, t_float *ecLc)
     {
         /* - L(k+1,k) * L(k+1,k)' + A*M*A' + MBiPB
          * xxxxxx   x  x
@@ -317,33 +404,111 @@ namespace IP
 
 
 
+    /**
+     * @brief Forms a 6x6 matrix L(k+1, k+1) in the decoupled case (see
+     * #chol_dec_decoupled).
+     *
+     * @param[in] p a 6x6 matrix lying to the left from ecLc on the same 
+     *                 level of L
+     * @param[in,out] ecLc AMATMBiPB as input / the result is stored here
+     *
+     * @attention Only the elements below the main diagonal are initialized.
+     */
+    template <class t_float, class t_input>
+        void matrix_ecL<t_float, t_input>::form_L_diag_decoupled (const t_float *p, t_float *ecLc)
+    {
+        // x and y are processed in two independent lanes
+        ecLc[0]  += - p[0] *p[0]  - p[6] *p[6]  - p[12]*p[12];
+        ecLc[21] += - p[21]*p[21] - p[27]*p[27] - p[33]*p[33];
+        ecLc[1]  +=               - p[6] *p[7]  - p[12]*p[13];
+        ecLc[22] +=               - p[27]*p[28] - p[33]*p[34];
+        ecLc[2]  +=                             - p[12]*p[14];
+        ecLc[23] +=                             - p[33]*p[35];
+
+        ecLc[7]  +=               - p[7] *p[7]  - p[13]*p[13];
+        ecLc[28] +=               - p[28]*p[28] - p[34]*p[34];
+        ecLc[8]  +=                             - p[13]*p[14];
+        ecLc[29] +=                             - p[34]*p[35];
+
+        ecLc[14] +=                             - p[14]*p[14];
+        ecLc[35] +=                             - p[35]*p[35];
+
+
+        // chol (L(k+1,k+1))
+        chol_dec_decoupled (ecLc);
+    }
+
+
+
     /**
      * @brief Builds matrix L.
      *
      * @param[in] ppar      parameters.
      * @param[in] i2hess    2*N diagonal elements of inverted hessian.
+     * @param[in] first_block the number of the first block row of L, which
+     *                  must be formed. The preceding rows are kept, they
+     *                  must correspond to the same first 2*first_block
+     *                  elements of i2hess.
+     *
+     * @note If the rotation angle is constant (see
+     * problem_parameters#constant_angle), L is formed for the unrotated
+     * problem: the blocks are decoupled and only their 3x3 parts
+     * corresponding to x and y are computed, the right hand sides must be
+     * rotated accordingly, see IP#chol_solve.
      */
-    void matrix_ecL::form (const problem_parameters& ppar, const double *i2hess)
+    template <class t_float, class t_input>
+        template <class t_param>
+        void matrix_ecL<t_float, t_input>::form (const t_param& ppar, const t_input *i2hess, const int first_block)
     {
         int i;
-        state_parameters stp;
-
-        stp = ppar.spar[0];
+        state_parameters_t<t_input> stp;
+        const bool decoupled = ppar.constant_angle;
 
-        // the first matrix on diagonal
-        form_M (stp.sin, stp.cos, ppar.i2Q, i2hess);
-        form_L_diag (stp.B, ppar.i2P, ecL);
+        if (first_block == 0)
+        {
+            stp = ppar.spar[0];
+            if (decoupled)
+            {
+                stp.sin = 0.0;
+                stp.cos = 1.0;
+            }
+
+            // the first matrix on diagonal
+            form_M (stp.sin, stp.cos, ppar.i2Q, i2hess);
+            form_L_diag (stp.B, ppar.i2P, ecL);
+            i = 1;
+        }
+        else
+        {
+            // M of the preceding block row is needed to form MAT
+            i = first_block;
+            i2hess = &i2hess[2*(i-1)];
+            stp = ppar.spar[i-1];
+            if (decoupled)
+            {
+                stp.sin = 0.0;
+                stp.cos = 1.0;
+            }
+            form_M (stp.sin, stp.cos, ppar.i2Q, i2hess);
+        }
 
         // offsets
-        double *ecL_cur = &ecL[MATRIX_SIZE_6x6];
-        double *ecL_prev = &ecL[0];
-        for (i = 1; i < ppar.N; i++)
+        t_float *ecL_prev = &ecL[MATRIX_SIZE_6x6*(2*i - 2)];
+        t_float *ecL_cur = &ecL_prev[MATRIX_SIZE_6x6];
+        for (; i < ppar.N; i++)
         {
             stp = ppar.spar[i];
 
             // form all matrices
             form_MAT (stp.A3, stp.A6);
-            form_L_non_diag (ecL_prev, ecL_cur);
+            if (decoupled)
+            {
+                form_L_non_diag_decoupled (ecL_prev, ecL_cur);
+            }
+            else
+            {
+                form_L_non_diag (ecL_prev, ecL_cur);
+            }
 
             // update offsets
             ecL_cur = &ecL_cur[MATRIX_SIZE_6x6];
@@ -351,9 +516,18 @@ namespace IP
 
 
             i2hess = &i2hess[2];
-            form_M (stp.sin, stp.cos, ppar.i2Q, i2hess);
-            form_AMATMBiPB(stp.A3, stp.A6, stp.B, ppar.i2P, ecL_cur);
-            form_L_diag(ecL_prev, ecL_cur);
+            if (decoupled)
+            {
+                form_M (0.0, 1.0, ppar.i2Q, i2hess);
+                form_AMATMBiPB(stp.A3, stp.A6, stp.B, ppar.i2P, ecL_cur);
+                form_L_diag_decoupled(ecL_prev, ecL_cur);
+            }
+            else
+            {
+                form_M (stp.sin, stp.cos, ppar.i2Q, i2hess);
+                form_AMATMBiPB(stp.A3, stp.A6, stp.B, ppar.i2P, ecL_cur);
+                form_L_diag(ecL_prev, ecL_cur);
+            }
 
             // update offsets
             ecL_cur = &ecL_cur[MATRIX_SIZE_6x6];
@@ -370,13 +544,14 @@ namespace IP
      * @param[in,out] x vector "b" as input, vector "x" as output
      *                  (N * #SMPC_NUM_STATE_VAR)
      */
-    void matrix_ecL::solve_forward(const int N, double *x)
+    template <class t_float, class t_input>
+        void matrix_ecL<t_float, t_input>::solve_forward(const int N, t_float *x)
     {
-        double *xc = x; // 6 current elements of x
-        double *xp; // 6 elements of x computed on the previous iteration
-        double *ecL_cur = &ecL[0];  // lower triangular matrix lying on the 
+        t_float *xc = x; // 6 current elements of x
+        t_float *xp; // 6 elements of x computed on the previous iteration
+        t_float *ecL_cur = &ecL[0];  // lower triangular matrix lying on the 
                                     // diagonal of L
-        double *ecL_prev;   // upper triangular matrix lying to the left from
+        t_float *ecL_prev;   // upper triangular matrix lying to the left from
                             // ecL_cur at the same level of L
 
 
@@ -432,16 +607,17 @@ namespace IP
      * @param[in] N number of states in the preview window
      * @param[in,out] x vector "b" as input, vector "x" as output.
      */
-    void matrix_ecL::solve_backward (const int N, double *x)
+    template <class t_float, class t_input>
+        void matrix_ecL<t_float, t_input>::solve_backward (const int N, t_float *x)
     {
-        double *xc = & x[(N-1)*SMPC_NUM_STATE_VAR]; // current 6 elements of result
-        double *xp; // 6 elements computed on the previous iteration
+        t_float *xc = & x[(N-1)*SMPC_NUM_STATE_VAR]; // current 6 elements of result
+        t_float *xp; // 6 elements computed on the previous iteration
         
         // elements of these matrices accessed as if they were transposed
         // lower triangular matrix lying on the diagonal of L
-        double *ecL_cur = &ecL[2 * (N - 1) * MATRIX_SIZE_6x6];
+        t_float *ecL_cur = &ecL[2 * (N - 1) * MATRIX_SIZE_6x6];
         // upper triangular matrix lying to the right from ecL_cur at the same level of L'
-        double *ecL_prev; 
+        t_float *ecL_prev; 
 
 
         // compute the last 6 elements using backward substitution
@@ -486,4 +662,13 @@ namespace IP
             xc[0] = (xc[0] - xc[5]*ecL_cur[5]  - xc[4]*ecL_cur[4]  - xc[3]*ecL_cur[3] - xc[2]*ecL_cur[2] - xc[1]*ecL_cur[1]) / ecL_cur[0];
         }
     }
+
+
+    template class matrix_ecL<double>;
+    template void matrix_ecL<double>::form (const problem_parameters&, const double *, const int);
+
+    template class matrix_ecL< lanes<4>, lanes<4> >;
+    template class matrix_ecL< lanes<8>, lanes<8> >;
+    template void matrix_ecL< lanes<4>, lanes<4> >::form (const lockstep_parameters<4>&, const lanes<4> *, const int);
+    template void matrix_ecL< lanes<8>, lanes<8> >::form (const lockstep_parameters<8>&, const lanes<8> *, const int);
 }
@@ -38,37 +38,47 @@ namespace IP
     /**
      * @brief Initializes lower diagonal matrix @ref pCholesky "L" and 
      * performs backward and forward substitutions using this matrix.
+     *
+     * @tparam t_float type of the elements of L.
+     * @tparam t_input type of the input parameters: double, or IP#lanes if
+     *  several problems are processed at once (t_float must be the same).
      */
-    class matrix_ecL
+    template <class t_float, class t_input = double>
+        class matrix_ecL
     {
         public:
             /*********** Constructors / Destructors ************/
-            matrix_ecL(const int);
-            ~matrix_ecL();
+            matrix_ecL(smpc::arena &, const int);
 
-            void form (const problem_parameters&, const double *);
+            static size_t get_mem_size (const int);
 
-            void solve_backward (const int, double *);
-            void solve_forward (const int, double *);
+            template <class t_param>
+                void form (const t_param&, const t_input *, const int first_block = 0);
 
-            double *ecL;
+            void solve_backward (const int, t_float *);
+            void solve_forward (const int, t_float *);
+
+            t_float *ecL;
 
 
 
         private:
-            void chol_dec (double *);
-            void form_M (const double, const double, const double*, const double*);
-            void form_MAT (const double, const double);
-            void form_AMATMBiPB(const double, const double, const double *, const double, double *);
+            void chol_dec (t_float *);
+            void chol_dec_decoupled (t_float *);
+            void form_M (const t_input, const t_input, const double*, const t_input*);
+            void form_MAT (const t_input, const t_input);
+            void form_AMATMBiPB(const t_input, const t_input, const t_input *, const double, t_float *);
 
-            void form_L_non_diag(const double *, double *);
-            void form_L_diag(const double *, const double, double *);
-            void form_L_diag(const double *, double *);
+            void form_L_non_diag(const t_float *, t_float *);
+            void form_L_non_diag_decoupled(const t_float *, t_float *);
+            void form_L_diag(const t_input *, const double, t_float *);
+            void form_L_diag(const t_float *, t_float *);
+            void form_L_diag_decoupled(const t_float *, t_float *);
 
 
             // intermediate results used in computation of L
-            double M[MATRIX_SIZE_6x6];         /// R * inv(Q) * R'
-            double MAT[MATRIX_SIZE_6x6];       /// M * A'
+            t_float M[MATRIX_SIZE_6x6];         /// R * inv(Q) * R'
+            t_float MAT[MATRIX_SIZE_6x6];       /// M * A'
     };
 }
 /// @}
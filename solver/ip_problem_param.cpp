@@ -20,7 +20,18 @@
 
 namespace IP
 {
+    /**
+     * @brief Constructor
+     *
+     * @param[in,out] mem memory arena
+     * @param[in] N_ size of the preview window
+     * @param[in] gain_position position gain
+     * @param[in] gain_velocity velocity gain
+     * @param[in] gain_acceleration acceleration gain
+     * @param[in] gain_jerk jerk gain
+     */
     problem_parameters::problem_parameters (
+        smpc::arena &mem,
         const int N_,
         const double gain_position,
         const double gain_velocity,
@@ -35,15 +46,19 @@ namespace IP
 
         i2P = 1/(2 * (gain_jerk/2));
 
-        spar = new state_parameters[N];
+        spar = mem.alloc<state_parameters>(N);
+        constant_angle = false;
     }
 
 
-
-    problem_parameters::~problem_parameters()
+    /**
+     * @param[in] N size of the preview window
+     * @return the amount of memory, which must be available in the arena
+     *  passed to the constructor [bytes].
+     */
+    size_t problem_parameters::get_mem_size (const int N)
     {
-        if (spar != NULL)
-            delete [] spar;
+        return (smpc::arena::get_size<state_parameters>(N));
     }
 
 
@@ -61,9 +76,15 @@ namespace IP
         const double* angle)
     {
         h_initial = h_initial_;
+        constant_angle = true;
 
         for (int i = 0; i < N; i++)
         {
+            if ((angle[i] < angle[0]) || (angle[i] > angle[0]))
+            {
+                constant_angle = false;
+            }
+
             spar[i].cos = cos(angle[i]);
             spar[i].sin = sin(angle[i]);
 
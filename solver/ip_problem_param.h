@@ -13,6 +13,7 @@
  ****************************************/
 
 #include "smpc_common.h"
+#include "smpc_arena.h"
 
 /****************************************
  * DEFINES
@@ -23,24 +24,34 @@
  ****************************************/
 namespace IP
 {
-    class state_parameters
+    /**
+     * @brief Parameters of a state.
+     *
+     * @tparam t_value type of the parameters: double, or IP#lanes, if the
+     *  parameters of several problems are processed at once.
+     */
+    template <class t_value>
+        class state_parameters_t
     {
         public:
-            double cos;
-            double sin;
+            t_value cos;
+            t_value sin;
 
             // parameters used in generation of A and B matrices
             /** Preview sampling time  */
-            double T;
+            t_value T;
             /** h = @ref ph "hCoM/gravity". */
-            double h;
+            t_value h;
 
-            double A3;
-            double A6;
+            t_value A3;
+            t_value A6;
 
-            double B[3];
+            t_value B[3];
     };
 
+    /// Parameters of a state of one problem.
+    typedef state_parameters_t<double> state_parameters;
+
 
     /**
      * @brief A set of problem parameters.
@@ -48,8 +59,9 @@ namespace IP
     class problem_parameters
     {
         public:
-            problem_parameters (const int, const double, const double, const double, const double);
-            ~problem_parameters();
+            problem_parameters (smpc::arena &, const int, const double, const double, const double, const double);
+
+            static size_t get_mem_size (const int);
 
             void set_state_parameters (const double*, const double*, const double, const double*);
 
@@ -72,6 +84,11 @@ namespace IP
             /// precede the first state in the preview window.
             double h_initial;
 
+            /// true if the rotation angle is the same for all states in the
+            /// preview window, in this case the problem is decoupled by
+            /// IP#chol_solve into two problems for x and y.
+            bool constant_angle;
+
             state_parameters *spar;
     };
 }
@@ -12,6 +12,7 @@
  * TEMPLATES
  ****************************************/
 #include "smpc_common.h"
+#include "smpc_sse2.h"
 #include "state_handling.h"
 
 
@@ -73,6 +74,34 @@ void form_init_fp_tilde (
         //------------------------------------
 
 
+#ifdef __SSE2__
+        const __m128d prev0 = smpc_load_xy (&prev_state[0]);
+        const __m128d prev1 = smpc_load_xy (&prev_state[1]);
+        const __m128d prev2 = smpc_load_xy (&prev_state[2]);
+        const __m128d A3 = _mm_set1_pd (ppar.spar[i].A3);
+        const __m128d A6 = _mm_set1_pd (ppar.spar[i].A6);
+
+        // x and y components are processed in two lanes
+        const __m128d u = _mm_add_pd (_mm_sub_pd (_mm_sub_pd (
+                        _mm_mul_pd (_mm_set1_pd (-iCpB_CpA[0]), prev0),
+                        _mm_mul_pd (_mm_set1_pd (iCpB_CpA[1]), prev1)),
+                    _mm_mul_pd (_mm_set1_pd (iCpB_CpA[2]), prev2)),
+                _mm_mul_pd (_mm_set1_pd (iCpB), _mm_set_pd (y_coord[i], x_coord[i])));
+        _mm_storeu_pd (control, u);
+
+        smpc_store_xy (&cur_state[0], _mm_add_pd (_mm_add_pd (_mm_add_pd (
+                            prev0,
+                            _mm_mul_pd (A3, prev1)),
+                        _mm_mul_pd (A6, prev2)),
+                    _mm_mul_pd (_mm_set1_pd (ppar.spar[i].B[0]), u)));
+        smpc_store_xy (&cur_state[1], _mm_add_pd (_mm_add_pd (
+                        prev1,
+                        _mm_mul_pd (A3, prev2)),
+                    _mm_mul_pd (_mm_set1_pd (ppar.spar[i].B[1]), u)));
+        smpc_store_xy (&cur_state[2], _mm_add_pd (
+                    prev2,
+                    _mm_mul_pd (_mm_set1_pd (ppar.spar[i].B[2]), u)));
+#else
         control[0] = -iCpB_CpA[0]*prev_state[0] - iCpB_CpA[1]*prev_state[1] - iCpB_CpA[2]*prev_state[2] + iCpB*x_coord[i];
         control[1] = -iCpB_CpA[0]*prev_state[3] - iCpB_CpA[1]*prev_state[4] - iCpB_CpA[2]*prev_state[5] + iCpB*y_coord[i];
 
@@ -82,6 +111,7 @@ void form_init_fp_tilde (
         cur_state[3] = prev_state[3] + ppar.spar[i].A3*prev_state[4] + ppar.spar[i].A6*prev_state[5] + ppar.spar[i].B[0]*control[1];
         cur_state[4] =                                 prev_state[4] + ppar.spar[i].A3*prev_state[5] + ppar.spar[i].B[1]*control[1];
         cur_state[5] =                                                                 prev_state[5] + ppar.spar[i].B[2]*control[1];
+#endif
 
 
         prev_state = &X[SMPC_NUM_STATE_VAR*i];
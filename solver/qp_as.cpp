@@ -11,8 +11,10 @@
 #include "qp.h"
 #include "qp_as.h"
 #include "state_handling.h"
+#include "smpc_sse2.h"
 
 #include <cmath> //cos,sin
+#include <new> // placement new
 
 
 using namespace AS;
@@ -21,8 +23,27 @@ using namespace AS;
  * FUNCTIONS
  ****************************************/
 
+/**
+ * @brief Resolves #smpc::SMPC_KKT_AUTO.
+ *
+ * @param[in] N Number of sampling times in a preview window
+ * @param[in] kkt_solver requested method
+ *
+ * @return the method, which is used by the solver.
+ */
+static smpc::kktSolverType select_kkt_solver (const int N, const smpc::kktSolverType kkt_solver)
+{
+    if (kkt_solver == smpc::SMPC_KKT_AUTO)
+    {
+        return ((N <= SMPC_AS_CONDENSED_MAX_N) ? smpc::SMPC_KKT_CONDENSED : smpc::SMPC_KKT_CHOLESKY);
+    }
+    return (kkt_solver);
+}
+
+
 /** @brief Constructor: initialization of the constant parameters
 
+    @param[in,out] mem memory arena, see #get_mem_size
     @param[in] N_ Number of sampling times in a preview window
     @param[in] gain_position Position gain
     @param[in] gain_velocity Velocity gain
@@ -32,8 +53,14 @@ using namespace AS;
     @param[in] obj_computation_on_ enable computation of the objective function
     @param[in] max_added_constraints_num_ limit on the number of the added constraints
     @param[in] constraint_removal_on_ enable constraint removal
+    @param[in] warm_start_on_ enable warm start using the active set from the
+                previous call
+    @param[in] ecL_cache_size the number of cached Cholesky factors of
+                equality constraints
+    @param[in] kkt_solver method used to solve the KKT systems
 */
 qp_as::qp_as(
+        smpc::arena &mem,
         const int N_, 
         const double gain_position, 
         const double gain_velocity, 
@@ -42,17 +69,31 @@ qp_as::qp_as(
         const double tol_,
         const bool obj_computation_on_,
         const unsigned int max_added_constraints_num_,
-        const bool constraint_removal_on_) : 
-    problem_parameters (N_, gain_position, gain_velocity, gain_acceleration, gain_jerk),
-    chol (N_)
+        const bool constraint_removal_on_,
+        const bool warm_start_on_,
+        const unsigned int ecL_cache_size,
+        const smpc::kktSolverType kkt_solver) : 
+    problem_parameters (mem, N_, gain_position, gain_velocity, gain_acceleration, gain_jerk),
+    active_set (mem, N_),
+    constraints (mem, N_)
 {
-    dX = new double[SMPC_NUM_VAR*N]();
+    chol = NULL;
+    cnd = NULL;
+    if (select_kkt_solver (N_, kkt_solver) == smpc::SMPC_KKT_CONDENSED)
+    {
+        cnd = new (mem.alloc<condensed_solve>(1)) condensed_solve (mem, N_, instr);
+    }
+    else
+    {
+        chol = new (mem.alloc<chol_solve>(1)) chol_solve (mem, N_, ecL_cache_size, kkt_solver, instr);
+    }
 
-    constraints.resize(2*N);
+    dX = mem.alloc<double>(SMPC_NUM_VAR*N);
 
     tol = tol_,
     obj_computation_on = obj_computation_on_;
     constraint_removal_on = constraint_removal_on_;
+    warm_start_on = warm_start_on_;
 
     max_added_constraints_num = max_added_constraints_num_;
     if (max_added_constraints_num == 0)
@@ -62,11 +103,47 @@ qp_as::qp_as(
 }
 
 
-/** Destructor */
+/**
+ * @param[in] N Number of sampling times in a preview window
+ * @param[in] ecL_cache_size the number of cached Cholesky factors of
+ *  equality constraints
+ * @param[in] kkt_solver method used to solve the KKT systems
+ *
+ * @return the amount of memory, which must be available in the arena
+ *  passed to the constructor [bytes].
+ */
+size_t qp_as::get_mem_size (const int N, const unsigned int ecL_cache_size, const smpc::kktSolverType kkt_solver)
+{
+    size_t solver_mem_size;
+
+    if (select_kkt_solver (N, kkt_solver) == smpc::SMPC_KKT_CONDENSED)
+    {
+        solver_mem_size = smpc::arena::get_size<condensed_solve>(1)
+            + condensed_solve::get_mem_size(N);
+    }
+    else
+    {
+        solver_mem_size = smpc::arena::get_size<chol_solve>(1)
+            + chol_solve::get_mem_size(N, ecL_cache_size, kkt_solver);
+    }
+
+    return (problem_parameters::get_mem_size(N)
+            + solver_mem_size
+            + working_set::get_mem_size(N)
+            + constraint_table::get_mem_size(N)
+            + smpc::arena::get_size<double>(SMPC_NUM_VAR*N));
+}
+
+
+/**
+ * @brief Destructor
+ */
 qp_as::~qp_as()
 {
-    if (dX != NULL)
-        delete dX;
+    if (chol != NULL)
+    {
+        chol->~chol_solve();
+    }
 }
 
 
@@ -75,33 +152,71 @@ qp_as::~qp_as()
     @param[in] T_ Sampling time (for the moment it is assumed to be constant) [sec.]
     @param[in] h_ Height of the Center of Mass divided by gravity
     @param[in] h_initial_ current h
-    @param[in] angle Rotation angle for each state in the preview window
+    @param[in] angle_ Rotation angle for each state in the preview window
     @param[in] zref_x_ reference values of z_x
     @param[in] zref_y_ reference values of z_y
-    @param[in] lb array of lower constraints for z_x and z_y
-    @param[in] ub array of upper constraints for z_x and z_y
+    @param[in] lb_ array of lower constraints for z_x and z_y
+    @param[in] ub_ array of upper constraints for z_x and z_y
 */
 void qp_as::set_parameters(
         const double* T_, 
         const double* h_, 
         const double h_initial_,
-        const double* angle,
+        const double* angle_,
         const double* zref_x_,
         const double* zref_y_,
-        const double* lb,
-        const double* ub)
+        const double* lb_,
+        const double* ub_)
 {
     set_state_parameters (T_, h_, h_initial_);
 
     zref_x = zref_x_;
     zref_y = zref_y_;
+    angle = angle_;
+    lb = lb_;
+    ub = ub_;
 
-    active_set.clear();
+
+    // The preview window is shifted by one step: shift the active set of the
+    // previous iteration and drop the constraints of the first state, which
+    // does not exist anymore.
+    unsigned int num_warm_constraints = 0;
+    if (warm_start_on)
+    {
+        for (unsigned int i = 0; i < active_set.size(); ++i)
+        {
+            if (active_set[i].cind >= 2)
+            {
+                active_set[num_warm_constraints].cind = active_set[i].cind - 2;
+                active_set[num_warm_constraints].sign = active_set[i].sign;
+                ++num_warm_constraints;
+            }
+        }
+    }
+    active_set.resize(num_warm_constraints);
 
     added_constraints_num = 0;
     removed_constraints_num = 0;
 
+    set_constraints();
+
+
+    // the guessed active set
+    for (unsigned int i = 0; i < active_set.size(); ++i)
+    {
+        constraints.activate (active_set[i].cind, active_set[i].sign);
+        active_set[i] = constraints.get (active_set[i].cind);
+    }
+}
+
+
 
+/**
+ * @brief Initializes the constraints using the current reference ZMP
+ * positions, all constraints are inactive.
+ */
+void qp_as::set_constraints()
+{
     // form inv(2*H) *g and initialize constraints
     // inv(2*H) * g  =  inv (2*(beta/2)) * beta * Cp' * zref  =  zref
     for (int i = 0, cind = 0; i < N; ++i)
@@ -111,18 +226,16 @@ void qp_as::set_parameters(
         double RTzref_x = (cosR*zref_x[i] + sinR*zref_y[i]);
         double RTzref_y = (-sinR*zref_x[i] + cosR*zref_y[i]);
 
-        constraints[cind].set(
+        constraints.set(
                 cind, cosR, sinR, 
                 lb[cind] - RTzref_x, 
-                ub[cind] - RTzref_x, 
-                false);
+                ub[cind] - RTzref_x);
         ++cind;
 
-        constraints[cind].set(
+        constraints.set(
                 cind, -sinR, cosR, 
                 lb[cind] - RTzref_y, 
-                ub[cind] - RTzref_y, 
-                false);
+                ub[cind] - RTzref_y);
         ++cind;
     }
 }
@@ -160,50 +273,17 @@ int qp_as::check_blocking_constraints()
 {
     alpha = 1;
 
-    /* Index to include in the working set, -1 if no constraint have to be included. */
-    int activated_var_num = -1;
     int sign = 0;
 
+    /* Index to include in the working set, -1 if no constraint have to be included. */
+    SMPC_PHASE_START(instr, smpc::SMPC_PHASE_CHECK_BLOCKING);
+    int activated_var_num = constraints.find_blocking (X, dX, tol, alpha, sign);
+    SMPC_PHASE_STOP(instr, smpc::SMPC_PHASE_CHECK_BLOCKING);
 
-    for (unsigned int i = 0; i < constraints.size(); ++i)
-    {
-        // Check only inactive constraints for violation. 
-        // The constraints in the working set will not be violated regardless of 
-        // the depth of descent
-        if (!constraints[i].isActive)
-        {
-            const constraint c = constraints[i];
-
-            const double constr = X[c.ind]*c.coef_x + X[c.ind+3]*c.coef_y;
-            const double d_constr = dX[c.ind]*c.coef_x + dX[c.ind+3]*c.coef_y;
-
-            if ( d_constr < -tol )
-            {
-                const double t = (c.lb - constr)/d_constr;
-                if (t < alpha)
-                {
-                    alpha = t;
-                    activated_var_num = i;
-                    sign = -1;
-                }
-            }
-            else if ( d_constr > tol )
-            {
-                const double t = (c.ub - constr)/d_constr;
-                if (t < alpha)
-                {
-                    alpha = t;
-                    activated_var_num = i;
-                    sign = 1;
-                }
-            }
-        }
-    }
     if (activated_var_num != -1)
     {
-        constraints[activated_var_num].sign = sign;
-        constraints[activated_var_num].isActive = true;
-        active_set.push_back(constraints[activated_var_num]);
+        constraints.activate (activated_var_num, sign);
+        active_set.push_back(constraints.get (activated_var_num));
     }
 
     return (activated_var_num);
@@ -240,8 +320,8 @@ int qp_as::choose_excl_constr (const double *lambda)
 
     if (ind_exclude != -1)
     {
-        constraints[active_set[ind_exclude].cind].isActive = false;
-        active_set.erase(active_set.begin()+ind_exclude);
+        constraints.deactivate (active_set[ind_exclude].cind);
+        active_set.erase(ind_exclude);
     }
 
     return (ind_exclude);
@@ -257,6 +337,9 @@ int qp_as::choose_excl_constr (const double *lambda)
  */
 void qp_as::solve (vector<double> &obj_log)
 {
+    instr.stats.reset();
+    SMPC_PHASE_START(instr, smpc::SMPC_PHASE_SOLVE);
+
     for (int i = 0; i < N; ++i)
     {
         const int ind = i*SMPC_NUM_STATE_VAR;
@@ -266,17 +349,212 @@ void qp_as::solve (vector<double> &obj_log)
     if (obj_computation_on)
     {
         obj_log.clear();
-        obj_log.push_back(compute_obj());
+        smpc_log_value (obj_log, compute_obj());
     }
 
     // obtain dX
-    chol.solve(*this, X, dX);
+    if (cnd != NULL)
+    {
+        cnd->solve(*this, X, dX);
+    }
+    else
+    {
+        chol->solve(*this, X, dX);
+    }
+
+    if (active_set.size() != 0)
+    {
+        // warm start: add all guessed constraints at once
+        if (cnd != NULL)
+        {
+            cnd->warm_resolve(*this, active_set, X, dX);
+        }
+        else
+        {
+            chol->warm_resolve(*this, active_set, X, dX);
+        }
+
+        // If the full step violates some inactive constraint, the initial
+        // point does not lie on the guessed bounds after the step and the
+        // working set is inconsistent -> fall back to the cold start.
+        if (check_blocking_constraints() != -1)
+        {
+            for (unsigned int i = 0; i < active_set.size(); ++i)
+            {
+                constraints.deactivate (active_set[i].cind);
+            }
+            active_set.clear();
+
+            if (cnd != NULL)
+            {
+                cnd->solve(*this, X, dX);
+            }
+            else
+            {
+                chol->solve(*this, X, dX);
+            }
+        }
+    }
+
+    solve_active_set (obj_log);
+
+    for (int i = 0; i < N; ++i)
+    {
+        const int ind = i*SMPC_NUM_STATE_VAR;
+        X[ind]   += zref_x[i];
+        X[ind+3] += zref_y[i];
+    }
 
+    active_set_size = active_set.size();
+
+    SMPC_PHASE_STOP(instr, smpc::SMPC_PHASE_SOLVE);
+}
+
+
+/**
+ * @param[in] N Number of sampling times in a preview window
+ * @param[in] M the number of right-hand sides
+ *
+ * @return the number of elements in the buffer passed to #solve_multi.
+ */
+size_t qp_as::get_multi_mem_size (const int N, const int M)
+{
+    return (M * N * (SMPC_NUM_VAR + 2*SMPC_NUM_STATE_VAR));
+}
+
+
+/**
+ * @brief Solves M problems, which differ only in the reference ZMP
+ * positions and the initial points. The matrix of equality constraints is
+ * factorized once, the initial unconstrained steps of all problems are
+ * obtained in one pass, then the active set method is applied to each of
+ * the problems.
+ *
+ * @param[in] M the number of problems
+ * @param[in] zref_x_ M arrays of reference values of z_x
+ * @param[in] zref_y_ M arrays of reference values of z_y
+ * @param[in,out] X_ M initial guesses / solutions
+ * @param[in] mem a buffer, see #get_multi_mem_size
+ * @param[in,out] obj_log a vector of objective function values (the last
+ *  problem)
+ *
+ * @note The guessed active set is not used (cold start), the counters are
+ * accumulated over all problems. The working set of the last problem is
+ * discarded, so it is not used as a guess by the next call of
+ * #set_parameters. In the condensed mode the hessian is factorized once,
+ * but the steps are computed separately for each problem.
+ */
+void qp_as::solve_multi (
+        const int M,
+        const double * const *zref_x_,
+        const double * const *zref_y_,
+        double * const *X_,
+        double *mem,
+        vector<double> &obj_log)
+{
+    double *dX_multi = mem;
+    double *z_multi = &dX_multi[M*N*SMPC_NUM_VAR];
+    double *nu_multi = &z_multi[M*N*SMPC_NUM_STATE_VAR];
+
+    instr.stats.reset();
+    SMPC_PHASE_START(instr, smpc::SMPC_PHASE_SOLVE);
+
+    for (int m = 0; m < M; ++m)
+    {
+        for (int i = 0; i < N; ++i)
+        {
+            const int ind = i*SMPC_NUM_STATE_VAR;
+            X_[m][ind]   -= zref_x_[m][i];
+            X_[m][ind+3] -= zref_y_[m][i];
+        }
+    }
+
+    // obtain dX for all problems
+    if (chol != NULL)
+    {
+        chol->solve_multi(*this, M, X_, dX_multi, z_multi, nu_multi);
+    }
+
+    unsigned int total_added_num = 0;
+    unsigned int total_removed_num = 0;
+    for (int m = 0; m < M; ++m)
+    {
+        zref_x = zref_x_[m];
+        zref_y = zref_y_[m];
+        X = X_[m];
+
+        active_set.clear();
+        added_constraints_num = 0;
+        removed_constraints_num = 0;
+        set_constraints();
+
+        if (cnd != NULL)
+        {
+            // the condensed hessian is factorized once, the first
+            // problem forms it.
+            cnd->solve(*this, X, dX);
+        }
+        else
+        {
+            const double *dXm = &dX_multi[m*N*SMPC_NUM_VAR];
+            for (int i = 0; i < N*SMPC_NUM_VAR; ++i)
+            {
+                dX[i] = dXm[i];
+            }
+            chol->set_z (*this, &z_multi[m*N*SMPC_NUM_STATE_VAR]);
+        }
+
+        if (obj_computation_on)
+        {
+            obj_log.clear();
+            smpc_log_value (obj_log, compute_obj());
+        }
+
+        solve_active_set (obj_log);
+
+        for (int i = 0; i < N; ++i)
+        {
+            const int ind = i*SMPC_NUM_STATE_VAR;
+            X[ind]   += zref_x[i];
+            X[ind+3] += zref_y[i];
+        }
+
+        total_added_num += added_constraints_num;
+        total_removed_num += removed_constraints_num;
+    }
+
+    added_constraints_num = total_added_num;
+    removed_constraints_num = total_removed_num;
+    active_set_size = active_set.size();
+
+    // the working set of the last problem is not a guess for the problem,
+    // which is passed to set_parameters next (warm start)
+    active_set.clear();
+
+    SMPC_PHASE_STOP(instr, smpc::SMPC_PHASE_SOLVE);
+}
+
+
+/**
+ * @brief Applies the active set method starting from #X, the initial
+ * descent direction #dX must be formed by the caller.
+ *
+ * @param[in,out] obj_log a vector of objective function values
+ */
+void qp_as::solve_active_set (vector<double> &obj_log)
+{
     for (;;)
     {
         int activated_var_num = check_blocking_constraints();
 
         // Move in the feasible descent direction
+#ifdef __SSE2__
+        const __m128d v_alpha = _mm_set1_pd (alpha);
+        for (int i = 0; i < N*SMPC_NUM_VAR; i += 2)
+        {
+            _mm_storeu_pd (&X[i], _mm_add_pd (_mm_loadu_pd (&X[i]), _mm_mul_pd (v_alpha, _mm_loadu_pd (&dX[i]))));
+        }
+#else
         for (int i = 0; i < N*SMPC_NUM_VAR; i += SMPC_NUM_VAR)
         {
             X[i]   += alpha * dX[i];
@@ -288,10 +566,11 @@ void qp_as::solve (vector<double> &obj_log)
             X[i+6] += alpha * dX[i+6];
             X[i+7] += alpha * dX[i+7];
         }
+#endif
 
         if (obj_computation_on)
         {
-            obj_log.push_back(compute_obj());
+            smpc_log_value (obj_log, compute_obj());
         }
 
         if (activated_var_num != -1)
@@ -303,18 +582,40 @@ void qp_as::solve (vector<double> &obj_log)
             }
 
             // add row to the L matrix and find new dX
-            chol.up_resolve (*this, active_set, X, dX);
+            SMPC_PHASE_START(instr, smpc::SMPC_PHASE_UP_RESOLVE);
+            if (cnd != NULL)
+            {
+                cnd->up_resolve (*this, active_set, X, dX);
+            }
+            else
+            {
+                chol->up_resolve (*this, active_set, X, dX);
+            }
+            SMPC_PHASE_STOP(instr, smpc::SMPC_PHASE_UP_RESOLVE);
         }
         else if (constraint_removal_on)
         {
             // no new inequality constraints
-            int ind_exclude = choose_excl_constr (chol.get_lambda(*this));
+            SMPC_PHASE_START(instr, smpc::SMPC_PHASE_GET_LAMBDA);
+            const double *lambda = (cnd != NULL) ? cnd->get_lambda() : chol->get_lambda(*this);
+            SMPC_PHASE_STOP(instr, smpc::SMPC_PHASE_GET_LAMBDA);
+
+            int ind_exclude = choose_excl_constr (lambda);
             if (ind_exclude == -1)
             {
                 break;
             }
 
-            chol.down_resolve (*this, active_set, ind_exclude, X, dX);
+            SMPC_PHASE_START(instr, smpc::SMPC_PHASE_DOWN_RESOLVE);
+            if (cnd != NULL)
+            {
+                cnd->down_resolve (*this, active_set, ind_exclude, X, dX);
+            }
+            else
+            {
+                chol->down_resolve (*this, active_set, ind_exclude, X, dX);
+            }
+            SMPC_PHASE_STOP(instr, smpc::SMPC_PHASE_DOWN_RESOLVE);
             ++removed_constraints_num;
         }
         else
@@ -322,15 +623,6 @@ void qp_as::solve (vector<double> &obj_log)
             break;
         }
     }
-
-    for (int i = 0; i < N; ++i)
-    {
-        const int ind = i*SMPC_NUM_STATE_VAR;
-        X[ind]   += zref_x[i];
-        X[ind+3] += zref_y[i];
-    }
-
-    active_set_size = active_set.size();
 }
 
 
@@ -342,7 +634,47 @@ void qp_as::solve (vector<double> &obj_log)
  */
 double qp_as::compute_obj()
 {
-    int i,j;
+    int i;
+
+#ifdef __SSE2__
+    // x and y components are accumulated in two lanes
+    __m128d obj_pos = _mm_setzero_pd ();
+    __m128d obj_vel = _mm_setzero_pd ();
+    __m128d obj_acc = _mm_setzero_pd ();
+    __m128d obj_jerk = _mm_setzero_pd ();
+
+    // phi_X = X'*H*X + g'*X
+    for(i = 0; i < N*SMPC_NUM_STATE_VAR; i += SMPC_NUM_STATE_VAR)
+    {
+        const __m128d X_pos = smpc_load_xy (&X[i]);
+        const __m128d X_vel = smpc_load_xy (&X[i+1]);
+        const __m128d X_acc = smpc_load_xy (&X[i+2]);
+
+        // X'*H*X
+        obj_pos = _mm_add_pd (obj_pos, _mm_mul_pd (X_pos, X_pos));
+        obj_vel = _mm_add_pd (obj_vel, _mm_mul_pd (X_vel, X_vel));
+        obj_acc = _mm_add_pd (obj_acc, _mm_mul_pd (X_acc, X_acc));
+    }
+    for (; i < N*SMPC_NUM_VAR; i += SMPC_NUM_CONTROL_VAR)
+    {
+        // X'*H*X
+        const __m128d X_jerk = _mm_loadu_pd (&X[i]);
+        obj_jerk = _mm_add_pd (obj_jerk, _mm_mul_pd (X_jerk, X_jerk));
+    }
+
+    // sum of the lanes
+    double obj[4][2];
+    _mm_storeu_pd (obj[0], obj_pos);
+    _mm_storeu_pd (obj[1], obj_vel);
+    _mm_storeu_pd (obj[2], obj_acc);
+    _mm_storeu_pd (obj[3], obj_jerk);
+
+    return (0.5*((obj[0][0] + obj[0][1])/i2Q[0] 
+                + (obj[1][0] + obj[1][1])/i2Q[1] 
+                + (obj[2][0] + obj[2][1])/i2Q[2] 
+                + (obj[3][0] + obj[3][1])/i2P));
+#else
+    int j;
     double obj_pos = 0;
     double obj_vel = 0;
     double obj_acc = 0;
@@ -367,5 +699,6 @@ double qp_as::compute_obj()
     }
 
     return (0.5*(obj_pos/i2Q[0] + obj_vel/i2Q[1] + obj_acc/i2Q[2] + obj_jerk/i2P));
+#endif
 }
 
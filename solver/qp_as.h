@@ -14,7 +14,11 @@
  ****************************************/
 #include "smpc_common.h"
 #include "as_chol_solve.h"
+#include "as_condensed_solve.h"
 #include "as_constraint.h"
+#include "as_constraint_table.h"
+#include "as_working_set.h"
+#include "smpc_instrumentation.h"
 #include "as_problem_param.h"
 
 #include <vector>
@@ -39,6 +43,7 @@ class qp_as : public AS::problem_parameters
     public:
 // functions        
         qp_as(
+                smpc::arena &,
                 const int N_, 
                 const double, 
                 const double, 
@@ -47,9 +52,14 @@ class qp_as : public AS::problem_parameters
                 const double, 
                 const bool,
                 const unsigned int,
-                const bool);
+                const bool,
+                const bool,
+                const unsigned int,
+                const smpc::kktSolverType);
         ~qp_as();
 
+        static size_t get_mem_size (const int, const unsigned int, const smpc::kktSolverType);
+
         void set_parameters(
                 const double*, 
                 const double*, 
@@ -62,6 +72,14 @@ class qp_as : public AS::problem_parameters
 
 
         void solve (vector<double> &);
+        void solve_multi (
+                const int,
+                const double * const *,
+                const double * const *,
+                double * const *,
+                double *,
+                vector<double> &);
+        static size_t get_multi_mem_size (const int, const int);
         void form_init_fp (
                 const double *, 
                 const double *, 
@@ -83,24 +101,43 @@ class qp_as : public AS::problem_parameters
     // limits
         bool constraint_removal_on;
         unsigned int max_added_constraints_num;
+    // warm start
+        bool warm_start_on;
+
+    // instrumentation
+        smpc::instrumentation instr;
 
 
     private:
 
 // functions        
+        void set_constraints();
+        void solve_active_set (vector<double> &);
         int check_blocking_constraints();
         int choose_excl_constr (const double *);
         double compute_obj();
 
 // variables        
 
-        /// An instance of AS#chol_solve class.
-        AS::chol_solve chol;
+        /// An instance of AS#chol_solve class (NULL if #cnd is used).
+        AS::chol_solve *chol;
+
+        /// An instance of AS#condensed_solve class (NULL if #chol is used).
+        AS::condensed_solve *cnd;
 
 
         const double *zref_x;
         const double *zref_y;
 
+        /// Rotation angles, see #set_parameters.
+        const double *angle;
+
+        ///@{
+        /// Bounds of the ZMP positions, see #set_parameters.
+        const double *lb;
+        const double *ub;
+        ///@}
+
         /// tolerance
         double tol;
 
@@ -108,10 +145,10 @@ class qp_as : public AS::problem_parameters
 
     // active set        
         /// A set of active constraints.
-        vector <AS::constraint> active_set;
+        AS::working_set active_set;
 
-        /// Vector of constraints.
-        vector <AS::constraint> constraints;
+        /// All constraints.
+        AS::constraint_table constraints;
 
 
     // descent direction
@@ -8,13 +8,12 @@
 /****************************************
  * INCLUDES 
  ****************************************/
+#include <cfloat> // DBL_MAX
+
 #include "qp_ip.h"
 #include "state_handling.h"
 #include "qp.h"
 
-
-#include <cmath> // log
-
 /****************************************
  * FUNCTIONS
  ****************************************/
@@ -26,6 +25,7 @@ using namespace IP;
 
 /** @brief Constructor: initialization of the constant parameters
 
+    @param[in,out] mem memory arena, see #get_mem_size
     @param[in] N_ Number of sampling times in a preview window
     @param[in] gain_position_ (Alpha) Position gain
     @param[in] gain_velocity_ (Beta) Velocity gain
@@ -34,8 +34,14 @@ using namespace IP;
     @param[in] tol_ tolerance
     @param[in] obj_computation_on_ enable computation of the objective function
     @param[in] bs_type_ type of backtracking search
+    @param[in] warm_start_on_ enable warm start using the previous solution
+    @param[in] method_ interior-point method
+    @param[in] refactor_tol relative change of the inverted hessian, which
+        requires refactorization of the Cholesky factor
+    @param[in] kkt_solver method used to solve the KKT system
 */
 qp_ip::qp_ip(
+        smpc::arena &mem,
         const int N_, 
         const double gain_position_,
         const double gain_velocity_,
@@ -43,20 +49,36 @@ qp_ip::qp_ip(
         const double gain_jerk_,
         const double tol_,
         const bool obj_computation_on_,
-        const backtrackingSearchType bs_type_) :
-    problem_parameters (N_, gain_position_, gain_velocity_, gain_acceleration_, gain_jerk_),
-    chol (N_)
+        const backtrackingSearchType bs_type_,
+        const bool warm_start_on_,
+        const ipMethodType method_,
+        const double refactor_tol,
+        const kktSolverType kkt_solver) :
+    problem_parameters (mem, N_, gain_position_, gain_velocity_, gain_acceleration_, gain_jerk_),
+    // the primal-dual method computes the steps of the dual variables from
+    // dX, which must be the Newton step, hence the factor is always exact
+    chol (mem, N_, (method_ == SMPC_IP_METHOD_PRIMAL_DUAL) ? 0.0 : refactor_tol, kkt_solver, instr)
 {
-    dX = new double[SMPC_NUM_VAR*N]();
-    g = new double[2*N];
-    i2hess = new double[2*N];
-    i2hess_grad = new double[N*SMPC_NUM_VAR];
-    grad = new double[2*N];
+    dX = mem.alloc<double>(SMPC_NUM_VAR*N);
+    g = mem.alloc<double>(2*N);
+    i2hess = mem.alloc<double>(2*N);
+    i2hess_grad = mem.alloc<double>(N*SMPC_NUM_VAR);
+    grad = mem.alloc<double>(2*N);
+    warm_controls = mem.alloc<double>(2*N);
+    lambda_lb = mem.alloc<double>(2*N);
+    lambda_ub = mem.alloc<double>(2*N);
+    dlambda_lb = mem.alloc<double>(2*N);
+    dlambda_ub = mem.alloc<double>(2*N);
 
     tol = tol_;
 
+    warm_start_on = warm_start_on_;
+    warm_start_ready = false;
+    warm_kappa = 0.0;
+
     obj_computation_on = obj_computation_on_;
     bs_type = bs_type_;
+    method = method_;
 
     gain_position = gain_position_;
 
@@ -67,19 +89,19 @@ qp_ip::qp_ip(
 }
 
 
-/** Destructor */
-qp_ip::~qp_ip()
+/**
+ * @param[in] N Number of sampling times in a preview window
+ * @param[in] kkt_solver method used to solve the KKT system
+ *
+ * @return the amount of memory, which must be available in the arena
+ *  passed to the constructor [bytes].
+ */
+size_t qp_ip::get_mem_size (const int N, const kktSolverType kkt_solver)
 {
-    if (g != NULL)
-        delete g;
-    if (i2hess != NULL)
-        delete i2hess;
-    if (i2hess_grad != NULL)
-        delete i2hess_grad;
-    if (grad != NULL)
-        delete grad;
-    if (dX  != NULL)
-        delete dX;
+    return (problem_parameters::get_mem_size(N)
+            + chol_solve::get_mem_size(N, kkt_solver)
+            + 2*smpc::arena::get_size<double>(SMPC_NUM_VAR*N)
+            + 8*smpc::arena::get_size<double>(2*N));
 }
 
 
@@ -113,6 +135,7 @@ void qp_ip::set_parameters(
     zref_y = zref_y_;
 
     form_g (zref_x, zref_y);
+    chol.reset();
 }
 
 
@@ -155,7 +178,8 @@ void qp_ip::form_g (const double *zref_x_, const double *zref_y_)
  */
 double qp_ip::form_grad_i2hess_logbar (const double kappa)
 {
-    double phi_X_logbar = 1.0;
+    IP::log_sum phi_X_logbar;
+    double lb_ub_prod[2];
 
     // grad = H*X + g + kappa * b;
     // initialize inverted hessian
@@ -166,10 +190,14 @@ double qp_ip::form_grad_i2hess_logbar (const double kappa)
         double lb_diff = -lb[i] + X[j];
         double ub_diff =  ub[i] - X[j];
 
-        // logarithmic barrier
+        // logarithmic barrier (x and y are accumulated in different lanes)
         if (bs_type == SMPC_IP_BS_LOGBAR)
         {
-            phi_X_logbar += log(lb_diff * ub_diff);
+            lb_ub_prod[i & 1] = lb_diff * ub_diff;
+            if (i & 1)
+            {
+                phi_X_logbar.add (lb_ub_prod[0], lb_ub_prod[1]);
+            }
         }
 
         lb_diff = 1/lb_diff;
@@ -196,7 +224,11 @@ double qp_ip::form_grad_i2hess_logbar (const double kappa)
         i2hess_grad[i+1] = - X[i+1];  //grad[i+1] * i2P;
     }
 
-    return (-kappa * phi_X_logbar);
+    if (bs_type == SMPC_IP_BS_LOGBAR)
+    {
+        return (-kappa * (1.0 + phi_X_logbar.get()));
+    }
+    return (-kappa);
 }
 
 
@@ -289,23 +321,41 @@ double qp_ip::init_alpha()
 
 
 /**
- * @brief Forms bs_alpha * (objective') * dX.
+ * @brief Forms bs_alpha * (objective') * dX and the coefficients of the
+ * quadratic part of phi(X+alpha*dX), which is a polynomial of alpha:
+ * c0 + c1*alpha + c2*alpha^2.
+ *
+ * @param[in,out] phi_coef coefficients c0, c1, c2; c0 (the value of the
+ *  quadratic part of phi(X)) must be set by the caller, c1 and c2 are
+ *  formed by this function.
  *
  * @return result of multiplication.
  */
-double qp_ip::form_bs_alpha_obj_dX()
+double qp_ip::form_bs_alpha_obj_dX(double *phi_coef)
 {
     double res_pos = 0;
     double res_vel = 0;
     double res_acc = 0;
     double res_jerk = 0;
+
+    // (H*X + g)'*dX, positions only
+    double quad_pos = 0;
+
+    // dX'*H*dX
+    double sq_pos = 0;
+    double sq_vel = 0;
+    double sq_acc = 0;
+    double sq_jerk = 0;
     
     for (int i = 0, j = 0; i < N*SMPC_NUM_STATE_VAR; i += SMPC_NUM_STATE_VAR, j += 2)
     {
+        const double quad_pos_el = (X[i]*gain_position + g[j]) * dX[i]
+                                 + (X[i+3]*gain_position + g[j+1]) * dX[i+3];
+        quad_pos += quad_pos_el;
+
         if (bs_type == SMPC_IP_BS_ORIGINAL)
         {
-            res_pos += (X[i]*gain_position + g[j]) * dX[i]
-                     + (X[i+3]*gain_position + g[j+1]) * dX[i+3];
+            res_pos += quad_pos_el;
         }
         else
         {
@@ -318,73 +368,131 @@ double qp_ip::form_bs_alpha_obj_dX()
 
         res_acc += X[i+2] * dX[i+2]  //grad[i+2] * dX[i+2]
                  + X[i+5] * dX[i+5]; //grad[i+5] * dX[i+5];
+
+        sq_pos += dX[i]   * dX[i]   + dX[i+3] * dX[i+3];
+        sq_vel += dX[i+1] * dX[i+1] + dX[i+4] * dX[i+4];
+        sq_acc += dX[i+2] * dX[i+2] + dX[i+5] * dX[i+5];
     }
     for (int i = N*SMPC_NUM_STATE_VAR; i < N*SMPC_NUM_VAR; i += SMPC_NUM_CONTROL_VAR)
     {
         res_jerk += X[i] * dX[i] + X[i+1] * dX[i+1];
             // grad[i+6] * dX[i+6]
             // grad[i+7] * dX[i+7];
+
+        sq_jerk += dX[i] * dX[i] + dX[i+1] * dX[i+1];
     }
 
-    return ((res_pos + res_vel/i2Q[1] + res_acc/i2Q[2] + res_jerk/i2P)*bs_alpha);
+    res_vel /= i2Q[1];
+    res_acc /= i2Q[2];
+    res_jerk /= i2P;
+
+    phi_coef[1] = quad_pos + res_vel + res_acc + res_jerk;
+    phi_coef[2] = Q[0]*sq_pos + Q[1]*sq_vel + Q[2]*sq_acc + P*sq_jerk;
+
+    return ((res_pos + res_vel + res_acc + res_jerk)*bs_alpha);
 }
 
 
 /**
- * @brief Forms phi(X+alpha*dX)
+ * @brief Forms phi(X+alpha*dX). The quadratic part is a polynomial of
+ * alpha, only the logarithmic barrier terms are computed for the given
+ * step length.
  *
  * @param[in] kappa logarithmic barrier multiplicator.
  * @param[in] alpha step length
+ * @param[in] phi_coef coefficients of the quadratic part, see #form_bs_alpha_obj_dX.
  *
  * @return a value of phi.
  */
-double qp_ip::form_phi_X_tmp (const double kappa, const double alpha)
+double qp_ip::form_phi_X_tmp (const double kappa, const double alpha, const double *phi_coef)
 {
-    int i,j;
+    const double phi_quad = phi_coef[0] + alpha * (phi_coef[1] + alpha * phi_coef[2]);
 
+    if (bs_type == SMPC_IP_BS_ORIGINAL)
+    {
+        return (phi_quad);
+    }
 
-    // phi_X += X'*H*X
-    double res_gX = 0;
-    double res_pos = 0;
-    double res_vel = 0;
-    double res_acc = 0;
-    double res_jerk = 0;
-    double res_logbar = 1.0;
-    for (i = 0,j = 0; i < 2*N; i+=2, j += SMPC_NUM_STATE_VAR)
-    {
-        double X_tmp[6] = {
-            X[j]   + alpha * dX[j],
-            X[j+1] + alpha * dX[j+1],
-            X[j+2] + alpha * dX[j+2],
-            X[j+3] + alpha * dX[j+3],
-            X[j+4] + alpha * dX[j+4],
-            X[j+5] + alpha * dX[j+5],
-        };
+    IP::log_sum res_logbar;
+    for (int i = 0, j = 0; i < 2*N; i += 2, j += SMPC_NUM_STATE_VAR)
+    {
+        const double x = X[j]   + alpha * dX[j];
+        const double y = X[j+3] + alpha * dX[j+3];
 
         // logarithmic barrier
-        res_logbar += log((-lb[i]   + X_tmp[0]) * (ub[i]   - X_tmp[0])
-                    * (-lb[i+1] + X_tmp[3]) * (ub[i+1] - X_tmp[3]));
+        res_logbar.add ((-lb[i]   + x) * (ub[i]   - x),
+                        (-lb[i+1] + y) * (ub[i+1] - y));
+    }
 
-        // phi_X += g'*X
-        res_gX  += g[i] * X_tmp[0] + g[i+1] * X_tmp[3];
+    return (phi_quad - kappa * (1.0 + res_logbar.get()));
+}
 
-        // phi_X += X'*H*X // states
-        res_pos += X_tmp[0]*X_tmp[0] + X_tmp[3]*X_tmp[3];
-        res_vel += X_tmp[1]*X_tmp[1] + X_tmp[4]*X_tmp[4];
-        res_acc += X_tmp[2]*X_tmp[2] + X_tmp[5]*X_tmp[5];
-    }
-    // phi_X += X'*H*X // controls
-    for (i = N*SMPC_NUM_STATE_VAR; i < N*SMPC_NUM_VAR; i += SMPC_NUM_CONTROL_VAR)
+
+/**
+ * @brief Minimizes phi(X+alpha*dX) on [0, alpha_max] using Newton method
+ * safeguarded by bisection (phi is convex). The derivatives of the
+ * quadratic part are obtained from its coefficients, hence an iteration
+ * requires 4*#N divisions and no logarithms.
+ *
+ * @param[in] kappa logarithmic barrier multiplicator.
+ * @param[in] alpha_max feasible step length.
+ * @param[in] phi_coef coefficients of the quadratic part, see #form_bs_alpha_obj_dX.
+ *
+ * @return step length.
+ */
+double qp_ip::form_alpha_newton (const double kappa, const double alpha_max, const double *phi_coef)
+{
+    double alpha_lo = 0.0;
+    double alpha_hi = alpha_max;
+    double alpha = alpha_max;
+
+    for (int k = 0; k < SMPC_IP_BS_NEWTON_MAX_ITER; ++k)
     {
-        double X_tmp[2] = {
-            X[i]   + alpha * dX[i],
-            X[i+1] + alpha * dX[i+1]
-        };
+        ++bs_counter;
+
+        // the first and the second derivatives of phi(X+alpha*dX)
+        double dphi = phi_coef[1] + 2 * phi_coef[2] * alpha;
+        double ddphi = 2 * phi_coef[2];
+        for (int i = 0; i < 2*N; i++)
+        {
+            const int j = 3*i;
+            const double X_tmp = X[j] + alpha * dX[j];
+            const double lb_diff = dX[j] / (X_tmp - lb[i]);
+            const double ub_diff = dX[j] / (ub[i] - X_tmp);
+
+            dphi += kappa * (ub_diff - lb_diff);
+            ddphi += kappa * (lb_diff*lb_diff + ub_diff*ub_diff);
+        }
 
-        res_jerk += X_tmp[0] * X_tmp[0] + X_tmp[1] * X_tmp[1];
+        if (dphi < 0)
+        {
+            if (k == 0)
+            {
+                // phi decreases on the whole interval
+                break;
+            }
+            alpha_lo = alpha;
+        }
+        else
+        {
+            alpha_hi = alpha;
+        }
+
+        const double alpha_prev = alpha;
+        alpha -= dphi / ddphi;
+        if (!((alpha > alpha_lo) && (alpha < alpha_hi)))
+        {
+            alpha = (alpha_lo + alpha_hi) / 2;
+        }
+
+        // stopping criterion (step size)
+        if (fabs (alpha - alpha_prev) < tol * alpha_max)
+        {
+            break;
+        }
     }
 
-    return (res_gX + Q[0]*res_pos + Q[1]*res_vel + Q[2]*res_acc + P*res_jerk - kappa * res_logbar);
+    return (alpha);
 }
 
 
@@ -426,13 +534,112 @@ void qp_ip::set_ip_parameters (
  */
 void qp_ip::solve(vector<double> &obj_log)
 {
+    instr.stats.reset();
+    SMPC_PHASE_START(instr, smpc::SMPC_PHASE_SOLVE);
+
     if (obj_computation_on)
     {
         obj_log.clear();
-        obj_log.push_back(compute_obj(true));
+        smpc_log_value (obj_log, compute_obj(true));
+    }
+
+    if (method == SMPC_IP_METHOD_PRIMAL_DUAL)
+    {
+        solve_primal_dual (obj_log);
+    }
+    else
+    {
+        solve_barrier (obj_log);
     }
 
+    if (warm_start_on)
+    {
+        const double *control = &X[SMPC_NUM_STATE_VAR*N];
+        for (int i = 0; i < 2*N; ++i)
+        {
+            warm_controls[i] = control[i];
+        }
+        warm_start_ready = true;
+    }
+
+    SMPC_PHASE_STOP(instr, smpc::SMPC_PHASE_SOLVE);
+}
+
+
+/**
+ * @brief Solves M problems, which differ only in the reference ZMP
+ * positions and the initial points, one after another using #solve. The
+ * hessian depends on the current point, hence no work is shared between
+ * the problems except for the parameters of the states, which are formed
+ * once by #set_parameters; if #refactor_tol is set, the factor is not
+ * reset between the problems and its leading block rows may be reused.
+ *
+ * @param[in] M the number of problems
+ * @param[in] zref_x_ M arrays of reference values of z_x
+ * @param[in] zref_y_ M arrays of reference values of z_y
+ * @param[in,out] X_ M initial guesses / solutions
+ * @param[in,out] obj_log a vector of objective function values (the last
+ *  problem)
+ *
+ * @note The counters are accumulated over all problems. The problems start
+ * with the same barrier parameter, the warm start data are taken from
+ * the last problem.
+ */
+void qp_ip::solve_multi (
+        const int M,
+        const double * const *zref_x_,
+        const double * const *zref_y_,
+        double * const *X_,
+        vector<double> &obj_log)
+{
+    const double init_warm_kappa = warm_kappa;
+    unsigned int total_int_loop = 0;
+    unsigned int total_ext_loop = 0;
+    unsigned int total_bs = 0;
+    smpc::solver_stats total_stats;
+
+    for (int m = 0; m < M; ++m)
+    {
+        zref_x = zref_x_[m];
+        zref_y = zref_y_[m];
+        form_g (zref_x, zref_y);
+        X = X_[m];
+        warm_kappa = init_warm_kappa;
+
+        solve (obj_log);
+
+        total_int_loop += int_loop_counter;
+        total_ext_loop += ext_loop_counter;
+        total_bs += bs_counter;
+        for (int k = 0; k < smpc::SMPC_PHASE_NUM; ++k)
+        {
+            total_stats.ticks[k] += instr.stats.ticks[k];
+            total_stats.calls[k] += instr.stats.calls[k];
+        }
+    }
+
+    int_loop_counter = total_int_loop;
+    ext_loop_counter = total_ext_loop;
+    bs_counter = total_bs;
+    instr.stats = total_stats;
+}
+
+
+
+/**
+ * @brief Solve QP using logarithmic barrier method.
+ *
+ * @param[in,out] obj_log a vector of objective function values
+ */
+void qp_ip::solve_barrier(vector<double> &obj_log)
+{
     double kappa = 1/t;
+    if (warm_start_on && warm_start_ready && (warm_kappa < kappa))
+    {
+        // the previous solution is close to the central path of the
+        // previous barrier parameter.
+        kappa = warm_kappa;
+    }
     double duality_gap = 2*N*kappa;
 
     int_loop_counter = 0;
@@ -455,6 +662,7 @@ void qp_ip::solve(vector<double> &obj_log)
             break;
         }
 
+        warm_kappa = kappa;
         kappa /= mu;
         duality_gap = 2*N*kappa;
         if (duality_gap < tol_out)
@@ -465,6 +673,314 @@ void qp_ip::solve(vector<double> &obj_log)
 }
 
 
+
+/**
+ * @brief Solve QP using primal-dual interior-point method with Mehrotra
+ * predictor-corrector steps. The equality constraints are satisfied by
+ * the initial point and are preserved by the steps, the inequality
+ * constraints are handled using the Lagrange multipliers of the bounds.
+ * Both steps of an iteration are obtained with the same Cholesky factor.
+ *
+ * @param[in,out] obj_log a vector of objective function values
+ */
+void qp_ip::solve_primal_dual(vector<double> &obj_log)
+{
+    const double num_bounds = 4*N;
+
+    double kappa = 1/t;
+    if (warm_start_on && warm_start_ready && (warm_kappa < kappa))
+    {
+        kappa = warm_kappa;
+    }
+
+    const unsigned int iter_limit = (max_iter == 0) ? SMPC_IP_PD_MAX_ITER : max_iter;
+
+    int_loop_counter = 0;
+    ext_loop_counter = 1;
+    bs_counter = 0;
+
+    // the multipliers correspond to the central path of the barrier method
+    init_lambda_pd (kappa);
+    bool centered = false;
+
+    double duality_gap = form_gap_pd (0.0);
+    while (int_loop_counter < iter_limit)
+    {
+        ++int_loop_counter;
+
+        // stopping criterion (negligible gap), the centering parameter
+        // cannot be computed
+        if (!(duality_gap > 0.0))
+        {
+            break;
+        }
+        const double mu_pd = duality_gap / num_bounds;
+
+
+        // predictor (affine scaling) step
+        form_grad_i2hess_pd (0.0, false);
+        chol.solve (*this, i2hess_grad, i2hess, X, dX);
+
+        // stopping criterion (duality gap and decrement)
+        const double decrement = form_decrement ();
+        if ((duality_gap < tol_out) && (decrement < tol))
+        {
+            break;
+        }
+
+        // The initial guess is far from the optimum in the directions,
+        // which are not restricted by the bounds (e.g. the jerks at the
+        // end of long preview windows). Such errors are reduced only by a
+        // constant factor on each iteration, since the steps are limited
+        // by the bounds, and the slacks vanish before the errors are
+        // removed. The Newton steps of the barrier method remove them.
+        if (!centered && (decrement > SMPC_IP_PD_CENTERING_DECREMENT))
+        {
+            centered = true;
+            while (int_loop_counter < iter_limit)
+            {
+                ++int_loop_counter;
+                if (!solve_onestep (kappa, obj_log))
+                {
+                    break;
+                }
+            }
+            init_lambda_pd (kappa);
+            duality_gap = form_gap_pd (0.0);
+            continue;
+        }
+        form_dlambda_pd ();
+
+        const double mu_aff = form_gap_pd (form_max_step_pd ()) / num_bounds;
+        const double sigma = (mu_aff / mu_pd) * (mu_aff / mu_pd) * (mu_aff / mu_pd);
+
+
+        // corrector (centering) step, the factor is reused
+        form_grad_i2hess_pd (sigma * mu_pd, true);
+        chol.resolve (*this, i2hess_grad, i2hess, dX);
+        form_dlambda_pd ();
+
+        // Short steps are not a reason to stop: they are made, when the
+        // initial point is far from the optimum, and are followed by long
+        // steps once the multipliers are adjusted.
+        const double alpha = min (1.0, SMPC_IP_PD_STEP_FRACTION * form_max_step_pd ());
+
+        // stopping criterion (negligible step): the slacks of the active
+        // bounds are lost in rounding errors
+        if (!check_step_pd (alpha))
+        {
+            break;
+        }
+
+
+        for (int i = 0; i < N*SMPC_NUM_VAR; i += SMPC_NUM_VAR)
+        {
+            X[i]   += alpha * dX[i];
+            X[i+1] += alpha * dX[i+1];
+            X[i+2] += alpha * dX[i+2];
+            X[i+3] += alpha * dX[i+3];
+            X[i+4] += alpha * dX[i+4];
+            X[i+5] += alpha * dX[i+5];
+            X[i+6] += alpha * dX[i+6];
+            X[i+7] += alpha * dX[i+7];
+        }
+        for (int i = 0; i < 2*N; ++i)
+        {
+            lambda_lb[i] += alpha * dlambda_lb[i];
+            lambda_ub[i] += alpha * dlambda_ub[i];
+        }
+        duality_gap = form_gap_pd (0.0);
+
+        if (obj_computation_on)
+        {
+            smpc_log_value (obj_log, compute_obj(true));
+        }
+    }
+
+    warm_kappa = duality_gap / num_bounds;
+}
+
+
+/**
+ * @brief Forms the right hand side of the Newton system of the primal-dual
+ * method and the varying elements of i2hess. The right hand sides of the
+ * complementarity equations are stored in #dlambda_lb and #dlambda_ub.
+ *
+ * @param[in] sigma_mu centering term
+ * @param[in] corrector if true, the second order correction is added
+ *  using the predictor step, which is stored in #dX, #dlambda_lb and
+ *  #dlambda_ub.
+ */
+void qp_ip::form_grad_i2hess_pd (const double sigma_mu, const bool corrector)
+{
+    for (int i = 0; i < 2*N; i++)
+    {
+        const int j = 3*i;
+        const double lb_diff = 1/(X[j] - lb[i]);
+        const double ub_diff = 1/(ub[i] - X[j]);
+
+        double r_lb = sigma_mu;
+        double r_ub = sigma_mu;
+        if (corrector)
+        {
+            r_lb -= dX[j] * dlambda_lb[i];
+            r_ub += dX[j] * dlambda_ub[i];
+        }
+        dlambda_lb[i] = r_lb;
+        dlambda_ub[i] = r_ub;
+
+        // grad = H*X + g - r_lb / (X - lb) + r_ub / (ub - X)
+        const double grad_el = X[j]*gain_position + g[i] - r_lb*lb_diff + r_ub*ub_diff;
+
+        // hess = 2H + lambda_lb / (X - lb) + lambda_ub / (ub - X)
+        const double i2hess_el = 1/(gain_position + lambda_lb[i]*lb_diff + lambda_ub[i]*ub_diff);
+        i2hess[i] = i2hess_el;
+
+        i2hess_grad[j] = -grad_el * i2hess_el;
+        i2hess_grad[j+1] = - X[j+1];
+        i2hess_grad[j+2] = - X[j+2];
+    }
+
+    for (int i = N*SMPC_NUM_STATE_VAR; i < N*SMPC_NUM_VAR; i+= SMPC_NUM_CONTROL_VAR)
+    {
+        i2hess_grad[i]   = - X[i];
+        i2hess_grad[i+1] = - X[i+1];
+    }
+}
+
+
+/**
+ * @brief Forms the steps of the Lagrange multipliers from the step of the
+ * ZMP positions and the right hand sides formed by #form_grad_i2hess_pd.
+ */
+void qp_ip::form_dlambda_pd ()
+{
+    for (int i = 0; i < 2*N; i++)
+    {
+        const int j = 3*i;
+        const double lb_diff = X[j] - lb[i];
+        const double ub_diff = ub[i] - X[j];
+
+        dlambda_lb[i] = (dlambda_lb[i] - lambda_lb[i] * dX[j]) / lb_diff - lambda_lb[i];
+        dlambda_ub[i] = (dlambda_ub[i] + lambda_ub[i] * dX[j]) / ub_diff - lambda_ub[i];
+    }
+}
+
+
+/**
+ * @brief Initializes the Lagrange multipliers of the bounds, so that the
+ * primal-dual point lies on the central path of the barrier method, if
+ * the current point is centered.
+ *
+ * @param[in] kappa logarithmic barrier multiplier
+ */
+void qp_ip::init_lambda_pd (const double kappa)
+{
+    for (int i = 0; i < 2*N; ++i)
+    {
+        lambda_lb[i] = kappa / (X[i*3] - lb[i]);
+        lambda_ub[i] = kappa / (ub[i] - X[i*3]);
+    }
+}
+
+
+/**
+ * @brief Finds the maximal step, which keeps the slacks of the bounds
+ * and the Lagrange multipliers nonnegative.
+ *
+ * @return the step length, not greater than 1.
+ */
+double qp_ip::form_max_step_pd ()
+{
+    double alpha = 1.0;
+
+    for (int i = 0; i < 2*N; i++)
+    {
+        const double dz = dX[i*3];
+
+        if (dz < 0)
+        {
+            alpha = min (alpha, (lb[i] - X[i*3]) / dz);
+        }
+        else if (dz > 0)
+        {
+            alpha = min (alpha, (ub[i] - X[i*3]) / dz);
+        }
+
+        if (dlambda_lb[i] < 0)
+        {
+            alpha = min (alpha, -lambda_lb[i] / dlambda_lb[i]);
+        }
+        if (dlambda_ub[i] < 0)
+        {
+            alpha = min (alpha, -lambda_ub[i] / dlambda_ub[i]);
+        }
+    }
+
+    return (alpha);
+}
+
+
+/**
+ * @brief Checks the iterate after a step of the primal-dual method.
+ *
+ * @param[in] alpha step length
+ *
+ * @return true if the iterate is finite, and the slacks of the bounds and
+ *  the Lagrange multipliers are positive.
+ */
+bool qp_ip::check_step_pd (const double alpha)
+{
+    for (int i = 0; i < 2*N; i++)
+    {
+        const double z = X[i*3] + alpha * dX[i*3];
+
+        // false for NaN
+        if (!((z - lb[i] > 0.0)
+                    && (ub[i] - z > 0.0)
+                    && (lambda_lb[i] + alpha * dlambda_lb[i] > 0.0)
+                    && (lambda_ub[i] + alpha * dlambda_ub[i] > 0.0)))
+        {
+            return (false);
+        }
+    }
+
+    for (int i = 0; i < N*SMPC_NUM_VAR; i++)
+    {
+        // false for NaN and infinity
+        if (!(fabs (X[i] + alpha * dX[i]) <= DBL_MAX))
+        {
+            return (false);
+        }
+    }
+
+    return (true);
+}
+
+
+/**
+ * @brief Computes the duality gap after a step.
+ *
+ * @param[in] alpha step length, the current gap is returned if it is 0.
+ *
+ * @return sum of the products of the slacks and the Lagrange multipliers.
+ */
+double qp_ip::form_gap_pd (const double alpha)
+{
+    double gap = 0.0;
+
+    for (int i = 0; i < 2*N; i++)
+    {
+        const double z = X[i*3] + alpha * dX[i*3];
+
+        gap += (z - lb[i]) * (lambda_lb[i] + alpha * dlambda_lb[i])
+             + (ub[i] - z) * (lambda_ub[i] + alpha * dlambda_ub[i]);
+    }
+
+    return (gap);
+}
+
+
 double qp_ip::form_decrement()
 {
     double decrement_pos = 0;
@@ -504,11 +1020,15 @@ bool qp_ip::solve_onestep (const double kappa, vector<double> &obj_log)
 {
     /// Value of phi(X), where phi is the cost function + log barrier.
     double phi_X = 0.0;
+    /// Coefficients of the quadratic part of phi(X+alpha*dX), see
+    /// #form_bs_alpha_obj_dX.
+    double phi_coef[3] = {0.0, 0.0, 0.0};
 
     if (bs_type == SMPC_IP_BS_LOGBAR)
     {
         phi_X = form_grad_i2hess_logbar (kappa);
-        phi_X += form_phi_X ();
+        phi_coef[0] = form_phi_X ();
+        phi_X += phi_coef[0];
     }
     else
     {
@@ -516,6 +1036,7 @@ bool qp_ip::solve_onestep (const double kappa, vector<double> &obj_log)
         if (bs_type == SMPC_IP_BS_ORIGINAL)
         {
             phi_X = compute_obj(false);
+            phi_coef[0] = phi_X;
         }
     }
 
@@ -540,18 +1061,27 @@ bool qp_ip::solve_onestep (const double kappa, vector<double> &obj_log)
 
 
     // backtracking search
-    if (bs_type != SMPC_IP_BS_NONE)
+    if (bs_type == SMPC_IP_BS_LOGBAR_NEWTON)
     {
-        double bs_kappa = kappa;
-        if (bs_type == SMPC_IP_BS_ORIGINAL)
+        SMPC_PHASE_START(instr, smpc::SMPC_PHASE_BT_SEARCH);
+        form_bs_alpha_obj_dX (phi_coef);
+        alpha = form_alpha_newton (kappa, alpha, phi_coef);
+        SMPC_PHASE_STOP(instr, smpc::SMPC_PHASE_BT_SEARCH);
+
+        // stopping criterion (step size)
+        if (alpha < tol)
         {
-            bs_kappa = 0.0; // eliminates logarithmic barrier
+            return (false); // done
         }
-        const double bs_alpha_grad_dX = form_bs_alpha_obj_dX ();
+    }
+    else if (bs_type != SMPC_IP_BS_NONE)
+    {
+        SMPC_PHASE_START(instr, smpc::SMPC_PHASE_BT_SEARCH);
+        const double bs_alpha_grad_dX = form_bs_alpha_obj_dX (phi_coef);
         for (;;)
         {
             ++bs_counter;
-            if (form_phi_X_tmp (bs_kappa, alpha) <= phi_X + alpha * bs_alpha_grad_dX)
+            if (form_phi_X_tmp (kappa, alpha, phi_coef) <= phi_X + alpha * bs_alpha_grad_dX)
             {
                 break;
             }
@@ -561,9 +1091,11 @@ bool qp_ip::solve_onestep (const double kappa, vector<double> &obj_log)
             // stopping criterion (step size)
             if (alpha < tol)
             {
+                SMPC_PHASE_STOP(instr, smpc::SMPC_PHASE_BT_SEARCH);
                 return (false); // done
             }
         }
+        SMPC_PHASE_STOP(instr, smpc::SMPC_PHASE_BT_SEARCH);
     }
 
 
@@ -581,7 +1113,7 @@ bool qp_ip::solve_onestep (const double kappa, vector<double> &obj_log)
     }
     if (obj_computation_on)
     {
-        obj_log.push_back(compute_obj(true));
+        smpc_log_value (obj_log, compute_obj(true));
     }
 
     return (true);
@@ -608,7 +1140,14 @@ void qp_ip::form_init_fp (
         double* X_)
 {
     X = X_;
-    form_init_fp_tilde<problem_parameters>(*this, x_coord, y_coord, init_state, tilde_state, X);
+    if (warm_start_on && warm_start_ready)
+    {
+        form_init_fp_warm (x_coord, y_coord, init_state, tilde_state);
+    }
+    else
+    {
+        form_init_fp_tilde<problem_parameters>(*this, x_coord, y_coord, init_state, tilde_state, X);
+    }
 
     // go back to bar states
     double *cur_state = X;
@@ -620,6 +1159,96 @@ void qp_ip::form_init_fp (
 }
 
 
+/**
+ * @brief Generates an initial feasible point using the previous solution:
+ * the controls are shifted by one step and applied to the initial state.
+ * The ZMP positions, which are too close to the bounds or violate them,
+ * are moved towards the given feasible points, see #SMPC_IP_WARM_START_INTERIOR.
+ * The resulting states are in @ref pX_tilde "X_tilde" form.
+ *
+ * @param[in] x_coord x coordinates of points satisfying constraints
+ * @param[in] y_coord y coordinates of points satisfying constraints
+ * @param[in] init_state current state
+ * @param[in] tilde_state if true the state is assumed to be in @ref pX_tilde "X_tilde" form
+ */
+void qp_ip::form_init_fp_warm (
+        const double *x_coord, 
+        const double *y_coord, 
+        const double *init_state,
+        const bool tilde_state)
+{
+    double *control = &X[SMPC_NUM_STATE_VAR*N];
+    double *cur_state = X;
+    double X_tilde[6] = {
+        init_state[0], init_state[1], init_state[2],
+        init_state[3], init_state[4], init_state[5]};
+    if (!tilde_state)
+    {
+        state_handling::orig_to_tilde (h_initial, X_tilde);
+    }
+    const double *prev_state = X_tilde;
+
+
+    for (int i = 0; i < N; ++i)
+    {
+        // the last control is repeated
+        const double *warm_control = &warm_controls[SMPC_NUM_CONTROL_VAR * ((i + 1 < N) ? i + 1 : N - 1)];
+        const double sinA = spar[i].sin;
+        const double cosA = spar[i].cos;
+
+        // ZMP position, when the control is zero
+        const double zmp_free[2] = {
+            prev_state[0] + spar[i].A3*prev_state[1] + spar[i].A6*prev_state[2],
+            prev_state[3] + spar[i].A3*prev_state[4] + spar[i].A6*prev_state[5]};
+
+        // ZMP positions of the feasible point and of the shifted solution
+        // relative to it, in the rotated frame, where the bounds are given.
+        const double diff[2] = {
+            zmp_free[0] + spar[i].B[0]*warm_control[0] - x_coord[i],
+            zmp_free[1] + spar[i].B[0]*warm_control[1] - y_coord[i]};
+        const double fp_bar[2] = {
+             cosA*x_coord[i] + sinA*y_coord[i],
+            -sinA*x_coord[i] + cosA*y_coord[i]};
+        const double diff_bar[2] = {
+             cosA*diff[0] + sinA*diff[1],
+            -sinA*diff[0] + cosA*diff[1]};
+
+        // The ZMP is placed at fp + theta * diff, theta <= 1. It is scaled
+        // to keep a margin, if the shifted solution is outside the bounds
+        // or too close to them.
+        double theta = 1.0 / SMPC_IP_WARM_START_INTERIOR;
+        for (int j = 0; j < 2; ++j)
+        {
+            if (diff_bar[j] > 0)
+            {
+                theta = min (theta, (ub[2*i + j] - fp_bar[j]) / diff_bar[j]);
+            }
+            else if (diff_bar[j] < 0)
+            {
+                theta = min (theta, (lb[2*i + j] - fp_bar[j]) / diff_bar[j]);
+            }
+        }
+        theta *= SMPC_IP_WARM_START_INTERIOR;
+
+
+        control[0] = (x_coord[i] + theta*diff[0] - zmp_free[0]) / spar[i].B[0];
+        control[1] = (y_coord[i] + theta*diff[1] - zmp_free[1]) / spar[i].B[0];
+
+        cur_state[0] = zmp_free[0] + spar[i].B[0]*control[0];
+        cur_state[1] = prev_state[1] + spar[i].A3*prev_state[2] + spar[i].B[1]*control[0];
+        cur_state[2] =                                   prev_state[2] + spar[i].B[2]*control[0];
+        cur_state[3] = zmp_free[1] + spar[i].B[0]*control[1];
+        cur_state[4] = prev_state[4] + spar[i].A3*prev_state[5] + spar[i].B[1]*control[1];
+        cur_state[5] =                                   prev_state[5] + spar[i].B[2]*control[1];
+
+
+        prev_state = cur_state;
+        cur_state = &cur_state[SMPC_NUM_STATE_VAR];
+        control = &control[SMPC_NUM_CONTROL_VAR];
+    }
+}
+
+
 /**
  * @brief Computes value of the objective function.
  *
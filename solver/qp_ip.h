@@ -15,7 +15,9 @@
 #include "smpc_solver.h"
 #include "smpc_common.h"
 #include "ip_chol_solve.h"
+#include "smpc_instrumentation.h"
 #include "ip_problem_param.h"
+#include "ip_log_barrier.h"
 
 #include <vector>
 
@@ -24,6 +26,38 @@
  * Defines
  ****************************************/
 
+/**
+ * On warm start the ZMP positions of the shifted solution are moved towards
+ * the given feasible points, so that they are not farther than this fraction
+ * of the distance from the feasible point to the bounds.
+ */
+#define SMPC_IP_WARM_START_INTERIOR 0.99
+
+/**
+ * The fraction of the maximal step to the boundary of the positive orthant,
+ * which is made by the primal-dual method.
+ */
+#define SMPC_IP_PD_STEP_FRACTION 0.99
+
+/**
+ * The maximal number of iterations of the primal-dual method, which is
+ * used if the limit is not given.
+ */
+#define SMPC_IP_PD_MAX_ITER 100
+
+/**
+ * If the Newton decrement of the first step of the primal-dual method
+ * exceeds this value, the initial point is centered using the Newton steps
+ * of the barrier method first.
+ */
+#define SMPC_IP_PD_CENTERING_DECREMENT 1e15
+
+/**
+ * The maximal number of iterations of the Newton line search, see
+ * #SMPC_IP_BS_LOGBAR_NEWTON.
+ */
+#define SMPC_IP_BS_NEWTON_MAX_ITER 10
+
 
 using namespace std;
 using namespace smpc;
@@ -40,6 +74,7 @@ class qp_ip : public IP::problem_parameters
     public:
 // functions        
         qp_ip(
+                smpc::arena &,
                 const int N_, 
                 const double, 
                 const double, 
@@ -47,8 +82,13 @@ class qp_ip : public IP::problem_parameters
                 const double,
                 const double,
                 const bool,
-                const backtrackingSearchType);
-        ~qp_ip();
+                const backtrackingSearchType,
+                const bool,
+                const ipMethodType,
+                const double,
+                const kktSolverType);
+
+        static size_t get_mem_size (const int, const kktSolverType);
 
         void set_parameters(
                 const double*, 
@@ -77,6 +117,12 @@ class qp_ip : public IP::problem_parameters
                 const double);
 
         void solve(vector<double> &);
+        void solve_multi (
+                const int,
+                const double * const *,
+                const double * const *,
+                double * const *,
+                vector<double> &);
 
         /** Variables for the QP (contain the states + control variables).
             Initial feasible point with respect to the equality and inequality 
@@ -88,6 +134,9 @@ class qp_ip : public IP::problem_parameters
         unsigned int ext_loop_counter;
         unsigned int bs_counter;
 
+    // instrumentation
+        smpc::instrumentation instr;
+
 
     private:
     // parameters
@@ -98,6 +147,37 @@ class qp_ip : public IP::problem_parameters
 
         bool obj_computation_on;
         backtrackingSearchType bs_type;
+        ipMethodType method;
+
+
+    // warm start
+        bool warm_start_on;
+
+        /// true if the solution of the previous problem is available.
+        bool warm_start_ready;
+
+        /// Controls of the previous solution (2*#N).
+        double *warm_controls;
+
+        /// The value of kappa (1/t), which was used in the last external
+        /// loop iteration of the previous call of #solve.
+        double warm_kappa;
+
+
+    // primal-dual method
+        ///@{
+        /// Lagrange multipliers of the lower and upper bounds (2*#N each).
+        double *lambda_lb;
+        double *lambda_ub;
+        ///@}
+
+        ///@{
+        /// Steps of the Lagrange multipliers (2*#N each). Before a step is
+        /// formed, they contain the right hand sides of the complementarity
+        /// equations, see #form_grad_i2hess_pd.
+        double *dlambda_lb;
+        double *dlambda_ub;
+        ///@}
 
 
     // variables and descent direction
@@ -153,14 +233,24 @@ class qp_ip : public IP::problem_parameters
 
 // functions        
         double init_alpha();
-        double form_bs_alpha_obj_dX ();
-        double form_phi_X_tmp (const double, const double);
+        double form_bs_alpha_obj_dX (double *);
+        double form_phi_X_tmp (const double, const double, const double *);
+        double form_alpha_newton (const double, const double, const double *);
         bool solve_onestep (const double, vector<double> &);
+        void solve_barrier (vector<double> &);
+        void solve_primal_dual (vector<double> &);
+        void form_grad_i2hess_pd (const double, const bool);
+        void form_dlambda_pd ();
+        void init_lambda_pd (const double);
+        double form_max_step_pd ();
+        bool check_step_pd (const double);
+        double form_gap_pd (const double);
         void form_g (const double *, const double *);
         double form_grad_i2hess_logbar (const double);
         double form_phi_X ();
         double form_decrement();
         double compute_obj(const bool);
+        void form_init_fp_warm (const double *, const double *, const double *, const bool);
 };
 
 ///@}
@@ -0,0 +1,745 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @date 17.10.2026 09:18:10 MSD
+ */
+
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+#include "qp_ip_lockstep.h"
+#include "ip_log_barrier.h"
+#include "state_handling.h"
+#include "qp.h"
+
+#include <new> // placement new
+
+/****************************************
+ * FUNCTIONS
+ ****************************************/
+
+using namespace IP;
+
+//==============================================
+// qp_ip_lockstep
+
+/** @brief Constructor: initialization of the constant parameters
+
+    @param[in,out] mem memory arena, see #get_mem_size
+    @param[in] N_ Number of sampling times in a preview window
+    @param[in] gain_position_ (Alpha) Position gain
+    @param[in] gain_velocity_ (Beta) Velocity gain
+    @param[in] gain_acceleration_ (Gamma) Acceleration gain
+    @param[in] gain_jerk_ (Eta) Jerk gain
+    @param[in] tol_ tolerance
+*/
+template <int t_num>
+qp_ip_lockstep<t_num>::qp_ip_lockstep(
+        smpc::arena &mem,
+        const int N_,
+        const double gain_position_,
+        const double gain_velocity_,
+        const double gain_acceleration_,
+        const double gain_jerk_,
+        const double tol_) :
+    ppar (mem, N_, gain_position_, gain_velocity_, gain_acceleration_, gain_jerk_),
+    lane_par (mem, N_, gain_position_, gain_velocity_, gain_acceleration_, gain_jerk_)
+{
+    const int N = N_;
+
+    Xl = mem.alloc<lanes_t>(SMPC_NUM_VAR*N);
+    dX = mem.alloc<lanes_t>(SMPC_NUM_VAR*N);
+    g = mem.alloc<lanes_t>(2*N);
+    i2hess = mem.alloc<lanes_t>(2*N);
+    i2hess_grad = mem.alloc<lanes_t>(SMPC_NUM_VAR*N);
+    grad = mem.alloc<lanes_t>(2*N);
+    w = mem.alloc<lanes_t>(SMPC_NUM_STATE_VAR*N);
+    lb = mem.alloc<lanes_t>(2*N);
+    ub = mem.alloc<lanes_t>(2*N);
+    ecL = new (mem.alloc< matrix_ecL<lanes_t, lanes_t> >(1)) matrix_ecL<lanes_t, lanes_t>(mem, N);
+
+    for (int l = 0; l < t_num; ++l)
+    {
+        X[l] = NULL;
+        int_loop_counter[l] = 0;
+        ext_loop_counter[l] = 0;
+        bs_counter[l] = 0;
+    }
+    lockstep_counter = 0;
+
+    tol = tol_;
+    gain_position = gain_position_;
+
+    Q[0] = gain_position_/2;
+    Q[1] = gain_velocity_/2;
+    Q[2] = gain_acceleration_/2;
+    P = gain_jerk_/2;
+}
+
+
+/**
+ * @param[in] N Number of sampling times in a preview window
+ *
+ * @return the amount of memory, which must be available in the arena
+ *  passed to the constructor [bytes].
+ */
+template <int t_num>
+size_t qp_ip_lockstep<t_num>::get_mem_size (const int N)
+{
+    return (lockstep_parameters<t_num>::get_mem_size(N)
+            + problem_parameters::get_mem_size(N)
+            + 3*smpc::arena::get_size<lanes_t>(SMPC_NUM_VAR*N)
+            + 5*smpc::arena::get_size<lanes_t>(2*N)
+            + smpc::arena::get_size<lanes_t>(SMPC_NUM_STATE_VAR*N)
+            + smpc::arena::get_size< matrix_ecL<lanes_t, lanes_t> >(1)
+            + matrix_ecL<lanes_t, lanes_t>::get_mem_size(N));
+}
+
+
+/** @brief Initializes one of the quadratic problems.
+
+    @param[in] lane index of the problem
+    @param[in] T Sampling time [sec.]
+    @param[in] h Height of the Center of Mass divided by gravity
+    @param[in] h_initial_ current h
+    @param[in] angle Rotation angle for each state in the preview window
+    @param[in] zref_x reference values of z_x
+    @param[in] zref_y reference values of z_y
+    @param[in] lb_ array of lower bounds for z_x and z_y
+    @param[in] ub_ array of upper bounds for z_x and z_y
+*/
+template <int t_num>
+void qp_ip_lockstep<t_num>::set_parameters(
+        const int lane,
+        const double* T,
+        const double* h,
+        const double h_initial_,
+        const double* angle,
+        const double* zref_x,
+        const double* zref_y,
+        const double* lb_,
+        const double* ub_)
+{
+    ppar.set_state_parameters (lane, T, h, h_initial_, angle);
+
+    for (int i = 0; i < ppar.N; i++)
+    {
+        const double cosA = ppar.spar[i].cos.v[lane];
+        const double sinA = ppar.spar[i].sin.v[lane];
+
+        // inv (2*H) * R' * Cp' * zref, see qp_ip#form_g
+        g[i*2].v[lane] = -(cosA*zref_x[i] + sinA*zref_y[i])*gain_position;
+        g[i*2 + 1].v[lane] = -(-sinA*zref_x[i] + cosA*zref_y[i])*gain_position;
+    }
+
+    for (int i = 0; i < 2*ppar.N; i++)
+    {
+        lb[i].v[lane] = lb_[i];
+        ub[i].v[lane] = ub_[i];
+    }
+}
+
+
+/**
+ * @brief Generates an initial feasible point for one of the problems, the
+ * same as qp_ip#form_init_fp without warm start.
+ *
+ * @param[in] lane index of the problem
+ * @param[in] x_coord x coordinates of points satisfying constraints
+ * @param[in] y_coord y coordinates of points satisfying constraints
+ * @param[in] init_state current state
+ * @param[in] tilde_state if true the state is assumed to be in @ref pX_tilde "X_tilde" form
+ * @param[in,out] X_ initial guess / solution of optimization problem
+ */
+template <int t_num>
+void qp_ip_lockstep<t_num>::form_init_fp (
+        const int lane,
+        const double *x_coord,
+        const double *y_coord,
+        const double *init_state,
+        const bool tilde_state,
+        double* X_)
+{
+    X[lane] = X_;
+
+    lane_par.h_initial = ppar.h_initial.v[lane];
+    for (int i = 0; i < ppar.N; i++)
+    {
+        lane_par.spar[i].cos  = ppar.spar[i].cos.v[lane];
+        lane_par.spar[i].sin  = ppar.spar[i].sin.v[lane];
+        lane_par.spar[i].T    = ppar.spar[i].T.v[lane];
+        lane_par.spar[i].h    = ppar.spar[i].h.v[lane];
+        lane_par.spar[i].A3   = ppar.spar[i].A3.v[lane];
+        lane_par.spar[i].A6   = ppar.spar[i].A6.v[lane];
+        lane_par.spar[i].B[0] = ppar.spar[i].B[0].v[lane];
+        lane_par.spar[i].B[1] = ppar.spar[i].B[1].v[lane];
+        lane_par.spar[i].B[2] = ppar.spar[i].B[2].v[lane];
+    }
+    form_init_fp_tilde<problem_parameters>(lane_par, x_coord, y_coord, init_state, tilde_state, X_);
+
+    // go back to bar states
+    double *cur_state = X_;
+    for (int i = 0; i < ppar.N; i++)
+    {
+        state_handling::tilde_to_bar (lane_par.spar[i].sin, lane_par.spar[i].cos, cur_state);
+        cur_state = &cur_state[SMPC_NUM_STATE_VAR];
+    }
+}
+
+
+/**
+ * @brief Set parameters of interior-point method, see qp_ip#set_ip_parameters.
+ *
+ * @param[in] t_ logarithmic barrier parameter
+ * @param[in] mu_ multiplier of t, >1.
+ * @param[in] bs_alpha_ backtracking search parameter alpha
+ * @param[in] bs_beta_  backtracking search parameter beta
+ * @param[in] max_iter_ maximum number of internal loop iterations
+ * @param[in] tol_out_ tolerance of the outer loop
+ */
+template <int t_num>
+void qp_ip_lockstep<t_num>::set_ip_parameters (
+        const double t_,
+        const double mu_,
+        const double bs_alpha_,
+        const double bs_beta_,
+        const unsigned int max_iter_,
+        const double tol_out_)
+{
+    t = t_;
+    mu = mu_;
+    bs_alpha = bs_alpha_;
+    bs_beta = bs_beta_;
+    max_iter = max_iter_;
+    tol_out = tol_out_;
+}
+
+
+
+/**
+ * @brief Solves the problems. The outer and inner loops of
+ * qp_ip#solve_barrier are unrolled into a state of each problem: its
+ * barrier parameter and counters. In each iteration all problems, which
+ * are not solved yet, make one step of the inner loop; a problem, which
+ * cannot make a step, proceeds to the next value of the barrier parameter.
+ */
+template <int t_num>
+void qp_ip_lockstep<t_num>::solve()
+{
+    const int N = ppar.N;
+    lanes_t kappa = 1/t;
+    bool running[t_num];
+    bool step[t_num];
+    bool running_any = true;
+
+    instr.stats.reset();
+    SMPC_PHASE_START(instr, smpc::SMPC_PHASE_SOLVE);
+
+    for (int i = 0; i < N*SMPC_NUM_VAR; ++i)
+    {
+        for (int l = 0; l < t_num; ++l)
+        {
+            Xl[i].v[l] = X[l][i];
+        }
+    }
+    for (int l = 0; l < t_num; ++l)
+    {
+        running[l] = true;
+        int_loop_counter[l] = 0;
+        ext_loop_counter[l] = 1;
+        bs_counter[l] = 0;
+    }
+    lockstep_counter = 0;
+
+
+    while (running_any)
+    {
+        ++lockstep_counter;
+        for (int l = 0; l < t_num; ++l)
+        {
+            if (running[l])
+            {
+                ++int_loop_counter[l];
+            }
+        }
+
+        solve_onestep (kappa, running, step);
+
+        running_any = false;
+        for (int l = 0; l < t_num; ++l)
+        {
+            if (!running[l])
+            {
+                continue;
+            }
+
+            // The inner loop is finished if no step was made. If the
+            // limit on the number of iterations is reached, the outer
+            // loop only decreases kappa.
+            const bool iter_limit = (max_iter > 0) && (int_loop_counter[l] == max_iter);
+            if (!step[l] || iter_limit)
+            {
+                for (;;)
+                {
+                    kappa.v[l] /= mu;
+                    if (2*N*kappa.v[l] < tol_out)
+                    {
+                        running[l] = false;
+                        break;
+                    }
+                    ++ext_loop_counter[l];
+                    if (!iter_limit)
+                    {
+                        break;
+                    }
+                }
+            }
+
+            running_any = running_any || running[l];
+        }
+    }
+
+
+    for (int i = 0; i < N*SMPC_NUM_VAR; ++i)
+    {
+        for (int l = 0; l < t_num; ++l)
+        {
+            X[l][i] = Xl[i].v[l];
+        }
+    }
+
+    SMPC_PHASE_STOP(instr, smpc::SMPC_PHASE_SOLVE);
+}
+
+
+/**
+ * @brief One step of interior point method for all problems, see
+ * qp_ip#solve_onestep.
+ *
+ * @param[in] kappa logarithmic barrier multipliers
+ * @param[in] running the problems, which are not solved yet, the step
+ *  length is zero in the other lanes.
+ * @param[out] step true if a step was made, false if alpha or dX are too small.
+ */
+template <int t_num>
+void qp_ip_lockstep<t_num>::solve_onestep (const lanes_t &kappa, const bool *running, bool *step)
+{
+    bool pending[t_num];
+    lanes_t alpha = 0.0;
+
+    lanes_t phi_X = form_grad_i2hess_logbar (kappa);
+    // coefficients of the quadratic part of phi(X+alpha*dX)
+    lanes_t phi_coef[3];
+    phi_coef[0] = form_phi_X ();
+    phi_X += phi_coef[0];
+
+
+    SMPC_PHASE_START(instr, smpc::SMPC_PHASE_ECL_FORM);
+    ecL->form (ppar, i2hess);
+    SMPC_PHASE_STOP(instr, smpc::SMPC_PHASE_ECL_FORM);
+    form_dX ();
+
+
+    // stopping criterion (decrement)
+    const lanes_t decrement = form_decrement ();
+    for (int l = 0; l < t_num; ++l)
+    {
+        pending[l] = running[l] && !(decrement.v[l] < tol);
+        step[l] = false;
+    }
+
+    // stopping criterion (step size)
+    form_init_alpha (pending, alpha);
+    for (int l = 0; l < t_num; ++l)
+    {
+        if (pending[l] && (alpha.v[l] < tol))
+        {
+            pending[l] = false;
+            alpha.v[l] = 0.0;
+        }
+    }
+
+
+    // backtracking search, the lanes are evaluated until each of them is
+    // accepted or rejected.
+    SMPC_PHASE_START(instr, smpc::SMPC_PHASE_BT_SEARCH);
+    const lanes_t bs_alpha_grad_dX = form_bs_alpha_obj_dX (phi_coef);
+    for (;;)
+    {
+        bool pending_any = false;
+        for (int l = 0; l < t_num; ++l)
+        {
+            pending_any = pending_any || pending[l];
+        }
+        if (!pending_any)
+        {
+            break;
+        }
+
+        const lanes_t phi_X_tmp = form_phi_X_tmp (kappa, alpha, phi_coef);
+        for (int l = 0; l < t_num; ++l)
+        {
+            if (!pending[l])
+            {
+                continue;
+            }
+
+            ++bs_counter[l];
+            if (phi_X_tmp.v[l] <= phi_X.v[l] + alpha.v[l] * bs_alpha_grad_dX.v[l])
+            {
+                pending[l] = false;
+                step[l] = true;
+                continue;
+            }
+
+            alpha.v[l] = bs_beta * alpha.v[l];
+
+            // stopping criterion (step size)
+            if (alpha.v[l] < tol)
+            {
+                pending[l] = false;
+                alpha.v[l] = 0.0;
+            }
+        }
+    }
+    SMPC_PHASE_STOP(instr, smpc::SMPC_PHASE_BT_SEARCH);
+
+
+    // Move in the feasible descent direction
+    for (int i = 0; i < ppar.N*SMPC_NUM_VAR; ++i)
+    {
+        Xl[i] += alpha * dX[i];
+    }
+}
+
+
+/**
+ * @brief Determines feasible descent direction, see chol_solve#resolve.
+ */
+template <int t_num>
+void qp_ip_lockstep<t_num>::form_dX ()
+{
+    const int N = ppar.N;
+    int i,j;
+
+    // obtain s = E * x;
+    SMPC_PHASE_START(instr, smpc::SMPC_PHASE_FORM_EX);
+    E.form_Ex (ppar, i2hess_grad, w);
+    SMPC_PHASE_STOP(instr, smpc::SMPC_PHASE_FORM_EX);
+
+    // obtain w
+    SMPC_PHASE_START(instr, smpc::SMPC_PHASE_SOLVE_FORWARD);
+    ecL->solve_forward(N, w);
+    SMPC_PHASE_STOP(instr, smpc::SMPC_PHASE_SOLVE_FORWARD);
+    SMPC_PHASE_START(instr, smpc::SMPC_PHASE_SOLVE_BACKWARD);
+    ecL->solve_backward(N, w);
+    SMPC_PHASE_STOP(instr, smpc::SMPC_PHASE_SOLVE_BACKWARD);
+
+    // E' * w
+    E.form_ETx (ppar, w, dX);
+
+
+    // dx = -iH*(grad + E'*w)
+    const double i2H[3] = {ppar.i2Q[1], ppar.i2Q[2], ppar.i2P};
+    for (i = 0, j = 0; i < N*2; i += 2, j += SMPC_NUM_STATE_VAR)
+    {
+        // dx for state variables
+        dX[j]   = i2hess_grad[j]   - i2hess[i] * dX[j];
+        dX[j+1] = i2hess_grad[j+1] - i2H[0] * dX[j+1];
+        dX[j+2] = i2hess_grad[j+2] - i2H[1] * dX[j+2];
+        dX[j+3] = i2hess_grad[j+3] - i2hess[i+1] * dX[j+3];
+        dX[j+4] = i2hess_grad[j+4] - i2H[0] * dX[j+4];
+        dX[j+5] = i2hess_grad[j+5] - i2H[1] * dX[j+5];
+    }
+    for (i = N*SMPC_NUM_STATE_VAR; i < N*SMPC_NUM_VAR; i += 2)
+    {
+        // dx for control variables
+        dX[i]   = i2hess_grad[i]   - i2H[2] * dX[i];
+        dX[i+1] = i2hess_grad[i+1] - i2H[2] * dX[i+1];
+    }
+}
+
+
+/**
+ * @brief Compute gradient of phi (partially), varying elements of
+ * i2hess, logarithmic barrier part of phi, i2hess_grad = -i2hess*grad,
+ * see qp_ip#form_grad_i2hess_logbar.
+ *
+ * @param[in] kappa 1/t, logarithmic barrier multiplicators.
+ *
+ * @return logarithmic barrier part of phi.
+ */
+template <int t_num>
+IP::lanes<t_num> qp_ip_lockstep<t_num>::form_grad_i2hess_logbar (const lanes_t &kappa)
+{
+    const int N = ppar.N;
+    IP::log_sum_lanes<t_num> phi_X_logbar;
+    lanes_t lb_ub_prod[2];
+
+    for (int i = 0; i < 2*N; i++)
+    {
+        const int j = 3*i;
+        lanes_t lb_diff = -lb[i] + Xl[j];
+        lanes_t ub_diff =  ub[i] - Xl[j];
+
+        // logarithmic barrier (x and y are accumulated in different products)
+        lb_ub_prod[i & 1] = lb_diff * ub_diff;
+        if (i & 1)
+        {
+            phi_X_logbar.add (lb_ub_prod[0], lb_ub_prod[1]);
+        }
+
+        lb_diff = 1/lb_diff;
+        ub_diff = 1/ub_diff;
+
+        // grad = H*X + g + kappa * (ub_diff - lb_diff)
+        const lanes_t grad_el = Xl[j]*gain_position + g[i] + kappa * (ub_diff - lb_diff);
+        grad[i] = grad_el;
+
+        // hess = 2H + kappa * (ub_diff^2 + lb_diff^2)
+        const lanes_t i2hess_el = 1/(gain_position + kappa * (ub_diff*ub_diff + lb_diff*lb_diff));
+        i2hess[i] = i2hess_el;
+
+        i2hess_grad[j] = -grad_el * i2hess_el;
+        i2hess_grad[j+1] = - Xl[j+1];
+        i2hess_grad[j+2] = - Xl[j+2];
+    }
+
+    for (int i = N*SMPC_NUM_STATE_VAR; i < N*SMPC_NUM_VAR; i++)
+    {
+        i2hess_grad[i] = - Xl[i];
+    }
+
+    return (-kappa * (1.0 + phi_X_logbar.get()));
+}
+
+
+/**
+ * @brief Compute the quadratic part of phi_X, see qp_ip#form_phi_X.
+ */
+template <int t_num>
+IP::lanes<t_num> qp_ip_lockstep<t_num>::form_phi_X ()
+{
+    const int N = ppar.N;
+    int i,j;
+    lanes_t phi_X_pos = 0.0;
+    lanes_t phi_X_vel = 0.0;
+    lanes_t phi_X_acc = 0.0;
+    lanes_t phi_X_jerk = 0.0;
+    lanes_t phi_X_gX = 0.0;
+
+    // phi_X = X'*H*X + g'*X
+    for(i = 0, j = 0;
+        i < N*SMPC_NUM_STATE_VAR;
+        i += SMPC_NUM_STATE_VAR, j += 2)
+    {
+        // X'*H*X
+        phi_X_pos += Xl[i]*Xl[i] + Xl[i+3]*Xl[i+3];
+        phi_X_vel += Xl[i+1]*Xl[i+1] + Xl[i+4]*Xl[i+4];
+        phi_X_acc += Xl[i+2]*Xl[i+2] + Xl[i+5]*Xl[i+5];
+
+        // g'*X
+        phi_X_gX  += g[j]*Xl[i] + g[j+1]*Xl[i+3];
+    }
+    for (; i < N*SMPC_NUM_VAR; i += SMPC_NUM_CONTROL_VAR)
+    {
+        // X'*H*X
+        phi_X_jerk += Xl[i] * Xl[i] + Xl[i+1] * Xl[i+1];
+    }
+
+    return (Q[0]*phi_X_pos + Q[1]*phi_X_vel + Q[2]*phi_X_acc + P*phi_X_jerk + phi_X_gX);
+}
+
+
+/**
+ * @brief Find initial values of alpha, see qp_ip#init_alpha.
+ *
+ * @param[in] pending the lanes, for which alpha must be found.
+ * @param[in,out] alpha initial values of alpha (0 if it is too small),
+ *  the other lanes are not changed.
+ */
+template <int t_num>
+void qp_ip_lockstep<t_num>::form_init_alpha (const bool *pending, lanes_t &alpha)
+{
+    lanes_t min_alpha = 1.0;
+
+    for (int i = 0; i < 2*ppar.N; i++)
+    {
+        const lanes_t &dz = dX[i*3];
+        const lanes_t &z = Xl[i*3];
+
+        for (int l = 0; l < t_num; ++l)
+        {
+            // lower bound may be violated
+            if (dz.v[l] < 0)
+            {
+                const double tmp_alpha = (lb[i].v[l] - z.v[l])/dz.v[l];
+                if (tmp_alpha < min_alpha.v[l])
+                {
+                    min_alpha.v[l] = tmp_alpha;
+                }
+            }
+            // upper bound may be violated
+            else if (dz.v[l] > 0)
+            {
+                const double tmp_alpha = (ub[i].v[l] - z.v[l])/dz.v[l];
+                if (tmp_alpha < min_alpha.v[l])
+                {
+                    min_alpha.v[l] = tmp_alpha;
+                }
+            }
+        }
+    }
+
+    for (int l = 0; l < t_num; ++l)
+    {
+        if (!pending[l])
+        {
+            continue;
+        }
+
+        alpha.v[l] = 1.0;
+        if (min_alpha.v[l] > tol)
+        {
+            while (alpha.v[l] > min_alpha.v[l])
+            {
+                alpha.v[l] *= bs_beta;
+            }
+        }
+        else
+        {
+            alpha.v[l] = 0;
+        }
+    }
+}
+
+
+/**
+ * @brief Forms bs_alpha * (objective') * dX and the coefficients of the
+ * quadratic part of phi(X+alpha*dX), see qp_ip#form_bs_alpha_obj_dX.
+ *
+ * @param[in,out] phi_coef coefficients c0, c1, c2; c0 must be set by the
+ *  caller.
+ *
+ * @return result of multiplication.
+ */
+template <int t_num>
+IP::lanes<t_num> qp_ip_lockstep<t_num>::form_bs_alpha_obj_dX(lanes_t *phi_coef)
+{
+    const int N = ppar.N;
+    lanes_t res_pos = 0.0;
+    lanes_t res_vel = 0.0;
+    lanes_t res_acc = 0.0;
+    lanes_t res_jerk = 0.0;
+
+    // (H*X + g)'*dX, positions only
+    lanes_t quad_pos = 0.0;
+
+    // dX'*H*dX
+    lanes_t sq_pos = 0.0;
+    lanes_t sq_vel = 0.0;
+    lanes_t sq_acc = 0.0;
+    lanes_t sq_jerk = 0.0;
+
+    for (int i = 0, j = 0; i < N*SMPC_NUM_STATE_VAR; i += SMPC_NUM_STATE_VAR, j += 2)
+    {
+        quad_pos += (Xl[i]*gain_position + g[j]) * dX[i]
+                  + (Xl[i+3]*gain_position + g[j+1]) * dX[i+3];
+
+        res_pos += grad[j]   * dX[i]
+                 + grad[j+1] * dX[i+3];
+
+        res_vel += Xl[i+1] * dX[i+1]
+                 + Xl[i+4] * dX[i+4];
+
+        res_acc += Xl[i+2] * dX[i+2]
+                 + Xl[i+5] * dX[i+5];
+
+        sq_pos += dX[i]   * dX[i]   + dX[i+3] * dX[i+3];
+        sq_vel += dX[i+1] * dX[i+1] + dX[i+4] * dX[i+4];
+        sq_acc += dX[i+2] * dX[i+2] + dX[i+5] * dX[i+5];
+    }
+    for (int i = N*SMPC_NUM_STATE_VAR; i < N*SMPC_NUM_VAR; i += SMPC_NUM_CONTROL_VAR)
+    {
+        res_jerk += Xl[i] * dX[i] + Xl[i+1] * dX[i+1];
+
+        sq_jerk += dX[i] * dX[i] + dX[i+1] * dX[i+1];
+    }
+
+    res_vel /= ppar.i2Q[1];
+    res_acc /= ppar.i2Q[2];
+    res_jerk /= ppar.i2P;
+
+    phi_coef[1] = quad_pos + res_vel + res_acc + res_jerk;
+    phi_coef[2] = Q[0]*sq_pos + Q[1]*sq_vel + Q[2]*sq_acc + P*sq_jerk;
+
+    return ((res_pos + res_vel + res_acc + res_jerk)*bs_alpha);
+}
+
+
+/**
+ * @brief Forms phi(X+alpha*dX), see qp_ip#form_phi_X_tmp.
+ *
+ * @param[in] kappa logarithmic barrier multiplicators.
+ * @param[in] alpha step lengths
+ * @param[in] phi_coef coefficients of the quadratic part, see #form_bs_alpha_obj_dX.
+ *
+ * @return values of phi.
+ */
+template <int t_num>
+IP::lanes<t_num> qp_ip_lockstep<t_num>::form_phi_X_tmp (
+        const lanes_t &kappa,
+        const lanes_t &alpha,
+        const lanes_t *phi_coef)
+{
+    const lanes_t phi_quad = phi_coef[0] + alpha * (phi_coef[1] + alpha * phi_coef[2]);
+
+    IP::log_sum_lanes<t_num> res_logbar;
+    for (int i = 0, j = 0; i < 2*ppar.N; i += 2, j += SMPC_NUM_STATE_VAR)
+    {
+        const lanes_t x = Xl[j]   + alpha * dX[j];
+        const lanes_t y = Xl[j+3] + alpha * dX[j+3];
+
+        // logarithmic barrier
+        res_logbar.add ((-lb[i]   + x) * (ub[i]   - x),
+                        (-lb[i+1] + y) * (ub[i+1] - y));
+    }
+
+    return (phi_quad - kappa * (1.0 + res_logbar.get()));
+}
+
+
+/**
+ * @brief Computes the Newton decrement, see qp_ip#form_decrement.
+ */
+template <int t_num>
+IP::lanes<t_num> qp_ip_lockstep<t_num>::form_decrement()
+{
+    const int N = ppar.N;
+    lanes_t decrement_pos = 0.0;
+    lanes_t decrement_vel = 0.0;
+    lanes_t decrement_acc = 0.0;
+    lanes_t decrement_jerk = 0.0;
+    for (int i = 0, j = 0; i < N*2; i += 2, j += SMPC_NUM_STATE_VAR)
+    {
+        decrement_pos += dX[j]   * dX[j]   / i2hess[i]
+                       + dX[j+3] * dX[j+3] / i2hess[i+1];
+
+        decrement_vel += dX[j+1] * dX[j+1]
+                       + dX[j+4] * dX[j+4];
+
+        decrement_acc += dX[j+2] * dX[j+2]
+                       + dX[j+5] * dX[j+5];
+    }
+    for (int i = N*SMPC_NUM_STATE_VAR; i < N*SMPC_NUM_VAR; i += SMPC_NUM_CONTROL_VAR)
+    {
+        decrement_jerk += dX[i]   * dX[i]
+                        + dX[i+1] * dX[i+1];
+    }
+    return (decrement_pos + decrement_vel/ppar.i2Q[1] + decrement_acc/ppar.i2Q[2] + decrement_jerk/ppar.i2P);
+}
+
+
+template class qp_ip_lockstep<4>;
+template class qp_ip_lockstep<8>;
@@ -0,0 +1,185 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @date 17.10.2026 09:18:10 MSD
+ */
+
+
+#ifndef QPIP_LOCKSTEP_H
+#define QPIP_LOCKSTEP_H
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+#include "smpc_solver.h"
+#include "smpc_common.h"
+#include "smpc_instrumentation.h"
+#include "ip_lanes.h"
+#include "ip_lockstep_param.h"
+#include "ip_matrix_E.h"
+#include "ip_matrix_ecL.h"
+#include "ip_problem_param.h"
+
+
+using namespace std;
+using namespace smpc;
+
+/// @addtogroup gIP
+/// @{
+
+/**
+ * @brief Solves t_num quadratic programs of the same size (see #qp_ip)
+ * using the logarithmic barrier method: the problems are processed in
+ * lockstep, each of them occupies one lane of IP#lanes.
+ *
+ * An iteration of the method is performed for all problems at once. The
+ * number of iterations and the steps are determined for each problem
+ * separately, exactly as in #qp_ip with smpc#SMPC_IP_BS_LOGBAR search.
+ * A problem, which is solved, is
+ * masked: the step length in its lane is set to zero, until all problems
+ * are solved.
+ *
+ * @tparam t_num the number of problems.
+ */
+template <int t_num>
+    class qp_ip_lockstep
+{
+    public:
+        qp_ip_lockstep(
+                smpc::arena &,
+                const int N_,
+                const double,
+                const double,
+                const double,
+                const double,
+                const double);
+
+        static size_t get_mem_size (const int);
+
+        void set_parameters(
+                const int,
+                const double*,
+                const double*,
+                const double,
+                const double*,
+                const double*,
+                const double*,
+                const double*,
+                const double*);
+
+        void form_init_fp (
+                const int,
+                const double *,
+                const double *,
+                const double *,
+                const bool,
+                double *);
+
+        void set_ip_parameters (
+                const double,
+                const double,
+                const double,
+                const double,
+                const unsigned int,
+                const double);
+
+        void solve();
+
+
+        /// Parameters of the problems.
+        IP::lockstep_parameters<t_num> ppar;
+
+        /// Solutions of the problems (given to #form_init_fp).
+        double *X[t_num];
+
+        ///@{
+        /// The number of iterations for each problem, see #qp_ip.
+        unsigned int int_loop_counter[t_num];
+        unsigned int ext_loop_counter[t_num];
+        unsigned int bs_counter[t_num];
+        ///@}
+
+        /// The number of iterations performed in lockstep.
+        unsigned int lockstep_counter;
+
+    // instrumentation
+        smpc::instrumentation instr;
+
+
+    private:
+        typedef IP::lanes<t_num> lanes_t;
+
+    // parameters
+        double gain_position;
+
+        /// tolerance
+        double tol;
+
+        ///@{
+        /// Diagonal elements of H.
+        double Q[3];
+        double P;
+        ///@}
+
+
+    // variables and descent direction
+
+        /// Variables of the problems (#SMPC_NUM_VAR*N).
+        lanes_t *Xl;
+
+        /// Feasible descent direction (#SMPC_NUM_VAR*N).
+        lanes_t *dX;
+
+        /// 2*N non-zero elements of vector @ref pg "g".
+        lanes_t *g;
+
+        /// Inverted hessian: non-repeating diagonal elements (2*N).
+        lanes_t *i2hess;
+
+        /// Inverted hessian * gradient (N*#SMPC_NUM_VAR)
+        lanes_t *i2hess_grad;
+
+        /// Gradient, only the elements that correspond to the ZMP positions (2*N).
+        lanes_t *grad;
+
+        /// Lagrange multipliers (N*#SMPC_NUM_STATE_VAR).
+        lanes_t *w;
+
+        ///@{
+        /// lower and upper bounds (2*N).
+        lanes_t *lb;
+        lanes_t *ub;
+        ///@}
+
+        /// Parameters of one problem, used to form an initial feasible point.
+        IP::problem_parameters lane_par;
+
+        /// Matrix of equality constraints.
+        IP::matrix_E E;
+
+        /// L for equality constraints.
+        IP::matrix_ecL<lanes_t, lanes_t> *ecL;
+
+
+// IP parameters
+        double t; /// logarithmic barrier parameter
+        double mu; /// multiplier of t, >1.
+        double bs_alpha; /// backtracking search parameter alpha
+        double bs_beta; /// backtracking search parameter beta
+        unsigned int max_iter; /// maximum number of internal loop iterations (in total)
+        double tol_out; /// tolerance of the outer loop
+
+
+// functions
+        void solve_onestep (const lanes_t &, const bool *, bool *);
+        void form_init_alpha (const bool *, lanes_t &);
+        lanes_t form_bs_alpha_obj_dX (lanes_t *);
+        lanes_t form_phi_X_tmp (const lanes_t &, const lanes_t &, const lanes_t *);
+        lanes_t form_grad_i2hess_logbar (const lanes_t &);
+        lanes_t form_phi_X ();
+        lanes_t form_decrement();
+        void form_dX ();
+};
+
+///@}
+#endif /*QPIP_LOCKSTEP_H*/
@@ -0,0 +1,101 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @date 17.10.2026 16:00:00 MSD
+ */
+
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include "smpc_arena.h"
+#include "solver_config.h"
+
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h> // mmap, munmap, mlock
+#endif
+
+
+/****************************************
+ * FUNCTIONS
+ ****************************************/
+namespace smpc
+{
+    /**
+     * @brief Constructor, which allocates a block of memory owned by the
+     * arena. The block is aligned to #SMPC_ARENA_ALIGNMENT.
+     *
+     * @param[in] size_ the size of the block [bytes].
+     * @param[in] huge_pages if true, try to map the block on huge pages
+     *  (the size is rounded up to #SMPC_HUGE_PAGE_SIZE), the ordinary heap
+     *  memory is used if the huge pages are not available, see #huge_pages_on.
+     */
+    arena::arena (const size_t size_, const bool huge_pages)
+    {
+        used = 0;
+        own_mem = NULL;
+        mapped_size = 0;
+
+#if defined(HAVE_SYS_MMAN_H) && defined(MAP_HUGETLB)
+        if (huge_pages)
+        {
+            const size_t map_size =
+                (size_ + SMPC_HUGE_PAGE_SIZE - 1) / SMPC_HUGE_PAGE_SIZE * SMPC_HUGE_PAGE_SIZE;
+            void *ptr = mmap (
+                    NULL,
+                    map_size,
+                    PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                    -1, 0);
+
+            if (ptr != MAP_FAILED)
+            {
+                mem = static_cast<char *>(ptr);
+                size = map_size;
+                mapped_size = map_size;
+                return;
+            }
+        }
+#else
+        (void) huge_pages;
+#endif
+
+        // the first array is aligned by alloc()
+        size = size_ + SMPC_ARENA_ALIGNMENT - 1;
+        own_mem = new char[size];
+        mem = own_mem;
+    }
+
+
+    /// Destructor
+    arena::~arena()
+    {
+#ifdef HAVE_SYS_MMAN_H
+        if (mapped_size > 0)
+        {
+            munmap (mem, mapped_size);
+        }
+#endif
+        if (own_mem != NULL)
+        {
+            delete [] own_mem;
+        }
+    }
+
+
+    /**
+     * @brief Locks the memory of the arena in RAM, so that it cannot
+     * be paged out (useful for real-time threads).
+     *
+     * @return true on success, false if locking failed or is not supported.
+     */
+    bool arena::lock ()
+    {
+#ifdef HAVE_SYS_MMAN_H
+        return (mlock (mem, size) == 0);
+#else
+        return (false);
+#endif
+    }
+}
@@ -0,0 +1,547 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @date 17.10.2026 23:00:00 MSD
+ */
+
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include "solver_config.h"
+
+#include <pthread.h>
+#include <unistd.h> // sysconf()
+
+#ifdef HAVE_PTHREAD_SETAFFINITY_NP
+#include <sched.h> // cpu_set_t
+#endif
+
+#include "smpc_batch.h"
+#include "smpc_instrumentation.h"
+
+
+/****************************************
+ * TYPEDEFS
+ ****************************************/
+
+namespace smpc
+{
+    /**
+     * @brief A pool of threads used by smpc#solver_batch. Each thread has
+     * a queue of the indices of problems: the owner takes the problems
+     * from the head of its queue, the other threads steal them from the
+     * tail. The problems are not added during the solution, hence a
+     * thread, which finds all queues empty, is done.
+     */
+    class batch_pool
+    {
+        public:
+            /// A thread and its queue.
+            struct worker
+            {
+                /// The pool.
+                batch_pool *pool;
+                /// Index of the thread.
+                unsigned int id;
+                /// The thread.
+                pthread_t thread;
+                /// Protects #head and #tail.
+                pthread_mutex_t mutex;
+                /// Indices of the problems assigned to the thread.
+                std::vector<unsigned int> tasks;
+                /// The first task in the queue.
+                unsigned int head;
+                /// The task following the last task in the queue.
+                unsigned int tail;
+            };
+
+
+            batch_pool (solver_batch &, const unsigned int, const bool);
+            ~batch_pool();
+
+            void assign (const unsigned int);
+            void run ();
+
+
+            /// The number of threads.
+            unsigned int threads_num;
+
+
+        private:
+            static void *thread_main (void *);
+            void work (worker &);
+            bool take (worker &, unsigned int &);
+            bool steal (worker &, unsigned int &);
+
+
+            /// The batch.
+            solver_batch &batch;
+
+            /// The threads.
+            worker *workers;
+
+            /// Pin the threads to the processors.
+            bool pin_threads_on;
+
+            /// false if no thread could be started, then the problems are
+            /// solved by the caller of #run.
+            bool threads_on;
+
+            /// Protects #generation, #active_num and #stop.
+            pthread_mutex_t mutex;
+            /// Signaled, when a new batch is started or the threads are stopped.
+            pthread_cond_t start_cond;
+            /// Signaled, when all threads are done.
+            pthread_cond_t done_cond;
+
+            /// Incremented by each call of #run.
+            unsigned int generation;
+            /// The number of threads, which are still working.
+            unsigned int active_num;
+            /// Tells the threads to terminate.
+            bool stop;
+    };
+}
+
+
+/****************************************
+ * FUNCTIONS
+ ****************************************/
+namespace smpc
+{
+    //************************************************************
+    // batch_pool
+    //************************************************************
+
+    /**
+     * @brief Starts the threads. If a thread cannot be created, the
+     * number of threads is reduced to the number of started threads; if
+     * none can be created, the problems are solved by the caller of #run.
+     *
+     * @param[in] batch_ the batch
+     * @param[in] threads_num_ the number of threads (0 -- the number of
+     * online processors)
+     * @param[in] pin_threads_on_ pin the threads to the processors
+     */
+    batch_pool::batch_pool (
+            solver_batch &batch_,
+            const unsigned int threads_num_,
+            const bool pin_threads_on_) : batch (batch_)
+    {
+        threads_num = threads_num_;
+        if (threads_num == 0)
+        {
+            const long cpu_num = sysconf(_SC_NPROCESSORS_ONLN);
+            threads_num = (cpu_num > 0) ? cpu_num : 1;
+        }
+        pin_threads_on = pin_threads_on_;
+
+        generation = 0;
+        active_num = 0;
+        stop = false;
+
+        pthread_mutex_init (&mutex, NULL);
+        pthread_cond_init (&start_cond, NULL);
+        pthread_cond_init (&done_cond, NULL);
+
+        workers = new worker[threads_num];
+        for (unsigned int i = 0; i < threads_num; ++i)
+        {
+            workers[i].pool = this;
+            workers[i].id = i;
+            workers[i].head = 0;
+            workers[i].tail = 0;
+            pthread_mutex_init (&workers[i].mutex, NULL);
+        }
+
+        unsigned int started_num = 0;
+        for (; started_num < threads_num; ++started_num)
+        {
+            if (pthread_create (&workers[started_num].thread, NULL, thread_main, &workers[started_num]) != 0)
+            {
+                break;
+            }
+        }
+        threads_on = (started_num > 0);
+        if (started_num < threads_num)
+        {
+            // the queue of the first thread is kept for the caller
+            const unsigned int used_num = threads_on ? started_num : 1;
+            for (unsigned int i = used_num; i < threads_num; ++i)
+            {
+                pthread_mutex_destroy (&workers[i].mutex);
+            }
+            threads_num = used_num;
+        }
+    }
+
+
+    /**
+     * @brief Stops the threads.
+     */
+    batch_pool::~batch_pool()
+    {
+        pthread_mutex_lock (&mutex);
+        stop = true;
+        pthread_cond_broadcast (&start_cond);
+        pthread_mutex_unlock (&mutex);
+
+        for (unsigned int i = 0; i < threads_num; ++i)
+        {
+            if (threads_on)
+            {
+                pthread_join (workers[i].thread, NULL);
+            }
+            pthread_mutex_destroy (&workers[i].mutex);
+        }
+        delete [] workers;
+
+        pthread_cond_destroy (&done_cond);
+        pthread_cond_destroy (&start_cond);
+        pthread_mutex_destroy (&mutex);
+    }
+
+
+    /**
+     * @brief Adds a problem to the queue of its home thread, must not be
+     * called during #run.
+     *
+     * @param[in] ind index of the problem
+     */
+    void batch_pool::assign (const unsigned int ind)
+    {
+        workers[ind % threads_num].tasks.push_back(ind);
+    }
+
+
+    /**
+     * @brief Fills the queues, wakes the threads up and waits until all
+     * problems are solved.
+     */
+    void batch_pool::run ()
+    {
+        for (unsigned int i = 0; i < threads_num; ++i)
+        {
+            workers[i].head = 0;
+            workers[i].tail = workers[i].tasks.size();
+        }
+
+        if (!threads_on)
+        {
+            work (workers[0]);
+            return;
+        }
+
+        pthread_mutex_lock (&mutex);
+        ++generation;
+        active_num = threads_num;
+        pthread_cond_broadcast (&start_cond);
+        while (active_num > 0)
+        {
+            pthread_cond_wait (&done_cond, &mutex);
+        }
+        pthread_mutex_unlock (&mutex);
+    }
+
+
+    /**
+     * @brief The main function of a thread: waits for a new batch, solves
+     * the problems, repeats.
+     *
+     * @param[in] arg the worker
+     */
+    void *batch_pool::thread_main (void *arg)
+    {
+        worker &w = *static_cast<worker *>(arg);
+        batch_pool &pool = *w.pool;
+
+#ifdef HAVE_PTHREAD_SETAFFINITY_NP
+        if (pool.pin_threads_on)
+        {
+            const long cpu_num = sysconf(_SC_NPROCESSORS_ONLN);
+            if (cpu_num > 0)
+            {
+                cpu_set_t cpu_set;
+                CPU_ZERO (&cpu_set);
+                CPU_SET (w.id % cpu_num, &cpu_set);
+                pthread_setaffinity_np (pthread_self(), sizeof(cpu_set), &cpu_set);
+            }
+        }
+#endif
+
+        unsigned int last_generation = 0;
+        for (;;)
+        {
+            pthread_mutex_lock (&pool.mutex);
+            while ((pool.generation == last_generation) && (!pool.stop))
+            {
+                pthread_cond_wait (&pool.start_cond, &pool.mutex);
+            }
+            if (pool.stop)
+            {
+                pthread_mutex_unlock (&pool.mutex);
+                break;
+            }
+            last_generation = pool.generation;
+            pthread_mutex_unlock (&pool.mutex);
+
+            pool.work (w);
+
+            pthread_mutex_lock (&pool.mutex);
+            --pool.active_num;
+            if (pool.active_num == 0)
+            {
+                pthread_cond_signal (&pool.done_cond);
+            }
+            pthread_mutex_unlock (&pool.mutex);
+        }
+        return (NULL);
+    }
+
+
+    /**
+     * @brief Solves the problems from the own queue, then steals the
+     * problems from the other queues.
+     *
+     * @param[in,out] w the worker
+     */
+    void batch_pool::work (worker &w)
+    {
+        unsigned int ind;
+
+        while (take (w, ind))
+        {
+            batch.solve_problem (ind, w.id, false);
+        }
+        while (steal (w, ind))
+        {
+            batch.solve_problem (ind, w.id, true);
+        }
+    }
+
+
+    /**
+     * @brief Takes a problem from the head of the own queue.
+     *
+     * @param[in,out] w the worker
+     * @param[out] ind index of the problem
+     *
+     * @return false if the queue is empty.
+     */
+    bool batch_pool::take (worker &w, unsigned int &ind)
+    {
+        bool taken = false;
+
+        pthread_mutex_lock (&w.mutex);
+        if (w.head < w.tail)
+        {
+            ind = w.tasks[w.head];
+            ++w.head;
+            taken = true;
+        }
+        pthread_mutex_unlock (&w.mutex);
+
+        return (taken);
+    }
+
+
+    /**
+     * @brief Takes a problem from the tail of the queue of another thread,
+     * the threads are checked starting from the next one.
+     *
+     * @param[in] w the worker
+     * @param[out] ind index of the problem
+     *
+     * @return false if all queues are empty.
+     */
+    bool batch_pool::steal (worker &w, unsigned int &ind)
+    {
+        for (unsigned int i = 1; i < threads_num; ++i)
+        {
+            worker &victim = workers[(w.id + i) % threads_num];
+            bool taken = false;
+
+            pthread_mutex_lock (&victim.mutex);
+            if (victim.head < victim.tail)
+            {
+                --victim.tail;
+                ind = victim.tasks[victim.tail];
+                taken = true;
+            }
+            pthread_mutex_unlock (&victim.mutex);
+
+            if (taken)
+            {
+                return (true);
+            }
+        }
+        return (false);
+    }
+
+
+
+    //************************************************************
+    // batch_problem
+    //************************************************************
+
+    /**
+     * @brief Constructor: allocates the arrays.
+     *
+     * @param[in] sol_ solver, the problem takes the ownership
+     * @param[in] N_ number of sampling times in a preview window
+     */
+    batch_problem::batch_problem (solver *sol_, const int N_)
+    {
+        sol = sol_;
+        N = N_;
+
+        // T, h, angle, zref_x, zref_y, fp_x, fp_y -- N;
+        // lb, ub -- 2*N; X -- NUM_VAR*N
+        mem = new double[(11 + SMPC_NUM_VAR)*N]();
+        T      = mem;
+        h      = &T[N];
+        angle  = &h[N];
+        zref_x = &angle[N];
+        zref_y = &zref_x[N];
+        fp_x   = &zref_y[N];
+        fp_y   = &fp_x[N];
+        lb     = &fp_y[N];
+        ub     = &lb[2*N];
+        X      = &ub[2*N];
+
+        h_initial = 0.0;
+        init_state_zmp = false;
+        enabled = true;
+
+        status = SMPC_BATCH_NOT_SOLVED;
+        thread = 0;
+        stolen = false;
+        ticks = 0.0;
+    }
+
+
+    batch_problem::~batch_problem()
+    {
+        delete sol;
+        delete [] mem;
+    }
+
+
+
+    //************************************************************
+    // solver_batch
+    //************************************************************
+
+    solver_batch::solver_batch (
+            const unsigned int threads_num,
+            const bool pin_threads_on)
+    {
+        stolen_num = 0;
+        pool = new batch_pool (*this, threads_num, pin_threads_on);
+    }
+
+
+    solver_batch::~solver_batch()
+    {
+        delete pool;
+        for (unsigned int i = 0; i < problems.size(); ++i)
+        {
+            delete problems[i];
+        }
+    }
+
+
+    unsigned int solver_batch::add (solver *sol, const int N)
+    {
+        const unsigned int ind = problems.size();
+
+        problems.push_back(new batch_problem(sol, N));
+        pool->assign(ind);
+
+        return (ind);
+    }
+
+
+    unsigned int solver_batch::get_threads_num () const
+    {
+        return (pool->threads_num);
+    }
+
+
+    unsigned int solver_batch::solve_all ()
+    {
+        pool->run();
+
+        unsigned int solved_num = 0;
+        stolen_num = 0;
+        for (unsigned int i = 0; i < problems.size(); ++i)
+        {
+            if (problems[i]->status == SMPC_BATCH_SOLVED)
+            {
+                ++solved_num;
+            }
+            if (problems[i]->stolen)
+            {
+                ++stolen_num;
+            }
+        }
+        return (solved_num);
+    }
+
+
+    /**
+     * @brief Solves a problem, called by the threads of the pool.
+     *
+     * @param[in] ind index of the problem
+     * @param[in] thread index of the thread
+     * @param[in] stolen true if the thread is not the home thread of the problem
+     */
+    void solver_batch::solve_problem (
+            const unsigned int ind,
+            const unsigned int thread,
+            const bool stolen)
+    {
+        batch_problem &p = *problems[ind];
+
+        p.thread = thread;
+        p.stolen = stolen;
+        p.ticks = 0.0;
+        if (!p.enabled)
+        {
+            p.status = SMPC_BATCH_NOT_SOLVED;
+            return;
+        }
+
+        const double start = instrumentation::get_ticks();
+        // an exception must not leave the thread
+        try
+        {
+            p.sol->set_parameters (p.T, p.h, p.h_initial, p.angle, p.zref_x, p.zref_y, p.lb, p.ub);
+            if (p.init_state_zmp)
+            {
+                state_zmp init_state;
+                init_state.set (
+                        p.init_state.state_vector[0], p.init_state.state_vector[1], p.init_state.state_vector[2],
+                        p.init_state.state_vector[3], p.init_state.state_vector[4], p.init_state.state_vector[5]);
+                p.sol->form_init_fp (p.fp_x, p.fp_y, init_state, p.X);
+            }
+            else
+            {
+                state_com init_state;
+                init_state.set (
+                        p.init_state.state_vector[0], p.init_state.state_vector[1], p.init_state.state_vector[2],
+                        p.init_state.state_vector[3], p.init_state.state_vector[4], p.init_state.state_vector[5]);
+                p.sol->form_init_fp (p.fp_x, p.fp_y, init_state, p.X);
+            }
+            p.sol->solve();
+            p.status = SMPC_BATCH_SOLVED;
+        }
+        catch (...)
+        {
+            p.status = SMPC_BATCH_FAILED;
+        }
+        p.ticks = instrumentation::get_ticks() - start;
+    }
+}
@@ -13,6 +13,7 @@
  ****************************************/
 
 #include <cstddef>
+#include <vector>
 #include <smpc_solver.h>
 
 /****************************************
@@ -30,6 +31,21 @@
  * PROTOTYPES 
  ****************************************/
 
+/**
+ * @brief Appends a value to a log. The memory for the log is reserved in
+ * advance and is never reallocated, if the log is full, the value is dropped.
+ *
+ * @param[in,out] log log
+ * @param[in] value value
+ */
+inline void smpc_log_value (std::vector<double> &log, const double value)
+{
+    if (log.size() < log.capacity())
+    {
+        log.push_back(value);
+    }
+}
+
 ///@}
 #endif /*SMPC_COMMON_H*/
 
@@ -0,0 +1,477 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @date 17.10.2026 21:00:00 MSD
+ */
+
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include <cstring> // memcmp
+
+#include "smpc_input_log.h"
+
+
+/****************************************
+ * DEFINES
+ ****************************************/
+
+/// The first bytes of a log file.
+#define SMPC_INPUT_LOG_MAGIC "SMPCLOG"
+/// The length of the magic string including the terminating null.
+#define SMPC_INPUT_LOG_MAGIC_LEN 8
+/// The version of the format.
+#define SMPC_INPUT_LOG_VERSION 3
+
+/// The number of unsigned ints in the parameters of the solver.
+#define SMPC_INPUT_LOG_CONFIG_NUM_UINT 12
+/// The number of doubles in the parameters of the solver.
+#define SMPC_INPUT_LOG_CONFIG_NUM_DOUBLE 11
+
+/// The type of the initial state in a record.
+#define SMPC_INPUT_LOG_STATE_COM 0
+/// The type of the initial state in a record.
+#define SMPC_INPUT_LOG_STATE_ZMP 1
+
+
+/****************************************
+ * FUNCTIONS
+ ****************************************/
+namespace smpc
+{
+    //************************************************************
+    // input_log_config
+    //************************************************************
+
+    input_log_config::input_log_config()
+    {
+        set_as();
+    }
+
+
+    void input_log_config::set_as (
+            const double gain_position_,
+            const double gain_velocity_,
+            const double gain_acceleration_,
+            const double gain_jerk_,
+            const double tol_,
+            const unsigned int max_added_constraints_num_,
+            const bool constraint_removal_on_,
+            const bool obj_computation_on_,
+            const bool warm_start_on_,
+            const unsigned int ecL_cache_size_,
+            const kktSolverType kkt_solver_)
+    {
+        // the parameters of IP are reset to the defaults
+        set_ip();
+
+        solver_type = SMPC_INPUT_LOG_SOLVER_AS;
+        gain_position = gain_position_;
+        gain_velocity = gain_velocity_;
+        gain_acceleration = gain_acceleration_;
+        gain_jerk = gain_jerk_;
+        tol = tol_;
+        max_added_constraints_num = max_added_constraints_num_;
+        constraint_removal_on = constraint_removal_on_;
+        obj_computation_on = obj_computation_on_;
+        warm_start_on = warm_start_on_;
+        ecL_cache_size = ecL_cache_size_;
+        kkt_solver = kkt_solver_;
+    }
+
+
+    void input_log_config::set_ip (
+            const double gain_position_,
+            const double gain_velocity_,
+            const double gain_acceleration_,
+            const double gain_jerk_,
+            const double tol_,
+            const double tol_out_,
+            const double t_,
+            const double mu_,
+            const double bs_alpha_,
+            const double bs_beta_,
+            const int unsigned max_iter_,
+            const backtrackingSearchType bs_type_,
+            const bool obj_computation_on_,
+            const solver_ip_parameters &ip_par_)
+    {
+        solver_type = SMPC_INPUT_LOG_SOLVER_IP;
+        gain_position = gain_position_;
+        gain_velocity = gain_velocity_;
+        gain_acceleration = gain_acceleration_;
+        gain_jerk = gain_jerk_;
+        tol = tol_;
+        tol_out = tol_out_;
+        t = t_;
+        mu = mu_;
+        bs_alpha = bs_alpha_;
+        bs_beta = bs_beta_;
+        max_iter = max_iter_;
+        bs_type = bs_type_;
+        obj_computation_on = obj_computation_on_;
+        ip_par = ip_par_;
+
+        // the parameters of AS are reset to the defaults
+        max_added_constraints_num = 0;
+        constraint_removal_on = true;
+        warm_start_on = false;
+        ecL_cache_size = 1;
+        kkt_solver = SMPC_KKT_CHOLESKY;
+    }
+
+
+    solver * input_log_config::create_solver (const int N) const
+    {
+        if (solver_type == SMPC_INPUT_LOG_SOLVER_AS)
+        {
+            return (new solver_as (
+                        N, gain_position, gain_velocity, gain_acceleration, gain_jerk, tol,
+                        max_added_constraints_num, constraint_removal_on, obj_computation_on,
+                        warm_start_on, ecL_cache_size, kkt_solver));
+        }
+        else
+        {
+            return (new solver_ip (
+                        N, gain_position, gain_velocity, gain_acceleration, gain_jerk, tol,
+                        tol_out, t, mu, bs_alpha, bs_beta, max_iter, bs_type,
+                        obj_computation_on, ip_par));
+        }
+    }
+
+
+
+    //************************************************************
+    // input_recorder
+    //************************************************************
+
+    input_recorder::input_recorder()
+    {
+        file = NULL;
+        buffer = NULL;
+        N = 0;
+    }
+
+
+    input_recorder::~input_recorder()
+    {
+        close();
+    }
+
+
+    bool input_recorder::open (
+            const char *filename,
+            const int N_,
+            const input_log_config &config,
+            const size_t buffer_size)
+    {
+        close();
+
+        file = fopen (filename, "wb");
+        if (file == NULL)
+        {
+            return (false);
+        }
+
+        // the buffer is allocated here, so that no allocations are made
+        // when records are written.
+        if (buffer_size > 0)
+        {
+            buffer = new char[buffer_size];
+            setvbuf (file, buffer, _IOFBF, buffer_size);
+        }
+        N = N_;
+
+        const unsigned int header[2] = {SMPC_INPUT_LOG_VERSION, static_cast<unsigned int>(N)};
+        const unsigned int config_uint[SMPC_INPUT_LOG_CONFIG_NUM_UINT] = {
+            config.solver_type,
+            config.obj_computation_on,
+            config.max_added_constraints_num,
+            config.constraint_removal_on,
+            config.warm_start_on,
+            config.ecL_cache_size,
+            config.kkt_solver,
+            config.max_iter,
+            config.bs_type,
+            config.ip_par.warm_start_on,
+            config.ip_par.method,
+            config.ip_par.kkt_solver};
+        const double config_double[SMPC_INPUT_LOG_CONFIG_NUM_DOUBLE] = {
+            config.gain_position,
+            config.gain_velocity,
+            config.gain_acceleration,
+            config.gain_jerk,
+            config.tol,
+            config.tol_out,
+            config.t,
+            config.mu,
+            config.bs_alpha,
+            config.bs_beta,
+            config.ip_par.refactor_tol};
+
+        if ((fwrite (SMPC_INPUT_LOG_MAGIC, 1, SMPC_INPUT_LOG_MAGIC_LEN, file) != SMPC_INPUT_LOG_MAGIC_LEN)
+                || (fwrite (header, sizeof(unsigned int), 2, file) != 2)
+                || (fwrite (config_uint, sizeof(unsigned int), SMPC_INPUT_LOG_CONFIG_NUM_UINT, file)
+                        != SMPC_INPUT_LOG_CONFIG_NUM_UINT)
+                || (fwrite (config_double, sizeof(double), SMPC_INPUT_LOG_CONFIG_NUM_DOUBLE, file)
+                        != SMPC_INPUT_LOG_CONFIG_NUM_DOUBLE))
+        {
+            close();
+            return (false);
+        }
+
+        return (true);
+    }
+
+
+    void input_recorder::close()
+    {
+        if (file != NULL)
+        {
+            fclose (file);
+            file = NULL;
+        }
+        if (buffer != NULL)
+        {
+            delete [] buffer;
+            buffer = NULL;
+        }
+        N = 0;
+    }
+
+
+    bool input_recorder::record (
+            const double* T,
+            const double* h,
+            const double h_initial,
+            const double* angle,
+            const double* zref_x,
+            const double* zref_y,
+            const double* lb,
+            const double* ub,
+            const double *x_coord,
+            const double *y_coord,
+            const state_com &init_state)
+    {
+        return (write_record (
+                    T, h, h_initial, angle, zref_x, zref_y, lb, ub, x_coord, y_coord,
+                    SMPC_INPUT_LOG_STATE_COM, init_state));
+    }
+
+
+    bool input_recorder::record (
+            const double* T,
+            const double* h,
+            const double h_initial,
+            const double* angle,
+            const double* zref_x,
+            const double* zref_y,
+            const double* lb,
+            const double* ub,
+            const double *x_coord,
+            const double *y_coord,
+            const state_zmp &init_state)
+    {
+        return (write_record (
+                    T, h, h_initial, angle, zref_x, zref_y, lb, ub, x_coord, y_coord,
+                    SMPC_INPUT_LOG_STATE_ZMP, init_state));
+    }
+
+
+    bool input_recorder::write_record (
+            const double* T,
+            const double* h,
+            const double h_initial,
+            const double* angle,
+            const double* zref_x,
+            const double* zref_y,
+            const double* lb,
+            const double* ub,
+            const double *x_coord,
+            const double *y_coord,
+            const unsigned int state_type,
+            const state &init_state)
+    {
+        if (file == NULL)
+        {
+            return (false);
+        }
+
+        const size_t n = N;
+        const double *arrays[] = {T, h, angle, zref_x, zref_y, x_coord, y_coord};
+        const size_t num_arrays = sizeof(arrays) / sizeof(arrays[0]);
+
+        bool ok = (fwrite (&state_type, sizeof(unsigned int), 1, file) == 1)
+            && (fwrite (&h_initial, sizeof(double), 1, file) == 1)
+            && (fwrite (init_state.state_vector, sizeof(double), SMPC_NUM_STATE_VAR, file) == SMPC_NUM_STATE_VAR);
+
+        for (size_t i = 0; ok && (i < num_arrays); ++i)
+        {
+            ok = (fwrite (arrays[i], sizeof(double), n, file) == n);
+        }
+
+        return (ok
+                && (fwrite (lb, sizeof(double), 2*n, file) == 2*n)
+                && (fwrite (ub, sizeof(double), 2*n, file) == 2*n));
+    }
+
+
+
+    //************************************************************
+    // input_log_reader
+    //************************************************************
+
+    input_log_reader::input_log_reader()
+    {
+        N = 0;
+        T = h = angle = zref_x = zref_y = lb = ub = fp_x = fp_y = NULL;
+        h_initial = 0.0;
+        init_state_is_zmp = false;
+        file = NULL;
+        mem = NULL;
+    }
+
+
+    input_log_reader::~input_log_reader()
+    {
+        close();
+    }
+
+
+    bool input_log_reader::open (const char *filename)
+    {
+        close();
+
+        file = fopen (filename, "rb");
+        if (file == NULL)
+        {
+            return (false);
+        }
+
+        char magic[SMPC_INPUT_LOG_MAGIC_LEN];
+        unsigned int header[2];
+        unsigned int config_uint[SMPC_INPUT_LOG_CONFIG_NUM_UINT];
+        double config_double[SMPC_INPUT_LOG_CONFIG_NUM_DOUBLE];
+        if ((fread (magic, 1, SMPC_INPUT_LOG_MAGIC_LEN, file) != SMPC_INPUT_LOG_MAGIC_LEN)
+                || (memcmp (magic, SMPC_INPUT_LOG_MAGIC, SMPC_INPUT_LOG_MAGIC_LEN) != 0)
+                || (fread (header, sizeof(unsigned int), 2, file) != 2)
+                || (header[0] != SMPC_INPUT_LOG_VERSION)
+                || (header[1] == 0)
+                || (fread (config_uint, sizeof(unsigned int), SMPC_INPUT_LOG_CONFIG_NUM_UINT, file)
+                        != SMPC_INPUT_LOG_CONFIG_NUM_UINT)
+                || (fread (config_double, sizeof(double), SMPC_INPUT_LOG_CONFIG_NUM_DOUBLE, file)
+                        != SMPC_INPUT_LOG_CONFIG_NUM_DOUBLE)
+                || (config_uint[0] > SMPC_INPUT_LOG_SOLVER_IP))
+        {
+            close();
+            return (false);
+        }
+
+        // the same order as in input_recorder::open
+        config.solver_type = static_cast<inputLogSolverType> (config_uint[0]);
+        config.obj_computation_on = (config_uint[1] != 0);
+        config.max_added_constraints_num = config_uint[2];
+        config.constraint_removal_on = (config_uint[3] != 0);
+        config.warm_start_on = (config_uint[4] != 0);
+        config.ecL_cache_size = config_uint[5];
+        config.kkt_solver = static_cast<kktSolverType> (config_uint[6]);
+        config.max_iter = config_uint[7];
+        config.bs_type = static_cast<backtrackingSearchType> (config_uint[8]);
+        config.ip_par.warm_start_on = (config_uint[9] != 0);
+        config.ip_par.method = static_cast<ipMethodType> (config_uint[10]);
+        config.ip_par.kkt_solver = static_cast<kktSolverType> (config_uint[11]);
+
+        config.gain_position = config_double[0];
+        config.gain_velocity = config_double[1];
+        config.gain_acceleration = config_double[2];
+        config.gain_jerk = config_double[3];
+        config.tol = config_double[4];
+        config.tol_out = config_double[5];
+        config.t = config_double[6];
+        config.mu = config_double[7];
+        config.bs_alpha = config_double[8];
+        config.bs_beta = config_double[9];
+        config.ip_par.refactor_tol = config_double[10];
+
+        N = header[1];
+        mem = new double[11*N];
+        T      = &mem[0];
+        h      = &mem[N];
+        angle  = &mem[2*N];
+        zref_x = &mem[3*N];
+        zref_y = &mem[4*N];
+        fp_x   = &mem[5*N];
+        fp_y   = &mem[6*N];
+        lb     = &mem[7*N];
+        ub     = &mem[9*N];
+
+        return (true);
+    }
+
+
+    void input_log_reader::close()
+    {
+        if (file != NULL)
+        {
+            fclose (file);
+            file = NULL;
+        }
+        if (mem != NULL)
+        {
+            delete [] mem;
+            mem = NULL;
+        }
+        T = h = angle = zref_x = zref_y = lb = ub = fp_x = fp_y = NULL;
+        N = 0;
+        config = input_log_config();
+    }
+
+
+    bool input_log_reader::read()
+    {
+        if (file == NULL)
+        {
+            return (false);
+        }
+
+        unsigned int state_type;
+        double state_vector[SMPC_NUM_STATE_VAR];
+        // the arrays are stored contiguously in the same order as in the record
+        const size_t n = 11*N;
+
+        if ((fread (&state_type, sizeof(unsigned int), 1, file) != 1)
+                || (fread (&h_initial, sizeof(double), 1, file) != 1)
+                || (fread (state_vector, sizeof(double), SMPC_NUM_STATE_VAR, file) != SMPC_NUM_STATE_VAR)
+                || (fread (mem, sizeof(double), n, file) != n))
+        {
+            return (false);
+        }
+
+        init_state_is_zmp = (state_type == SMPC_INPUT_LOG_STATE_ZMP);
+        state &init_state = init_state_is_zmp
+            ? static_cast<state &>(init_state_zmp)
+            : static_cast<state &>(init_state_com);
+        for (int i = 0; i < SMPC_NUM_STATE_VAR; ++i)
+        {
+            init_state.state_vector[i] = state_vector[i];
+        }
+
+        return (true);
+    }
+
+
+    void input_log_reader::apply (solver &sol, double *X) const
+    {
+        sol.set_parameters (T, h, h_initial, angle, zref_x, zref_y, lb, ub);
+        if (init_state_is_zmp)
+        {
+            sol.form_init_fp (fp_x, fp_y, init_state_zmp, X);
+        }
+        else
+        {
+            sol.form_init_fp (fp_x, fp_y, init_state_com, X);
+        }
+    }
+}
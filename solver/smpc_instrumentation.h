@@ -0,0 +1,111 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @date 17.10.2026 20:00:00 MSD
+ */
+
+
+#ifndef SMPC_INSTRUMENTATION_H
+#define SMPC_INSTRUMENTATION_H
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include "smpc_common.h"
+#include "solver_config.h"
+
+#ifdef SMPC_INSTRUMENTATION
+#if defined(HAVE_RDTSC)
+#include <x86intrin.h> // __rdtsc
+#elif defined(HAVE_CLOCK_GETTIME)
+#include <ctime> // clock_gettime
+#endif
+#endif
+
+
+/****************************************
+ * DEFINES
+ ****************************************/
+
+/// @addtogroup gINTERNALS
+/// @{
+
+#ifdef SMPC_INSTRUMENTATION
+/// Marks the beginning of a phase, see smpc#solverPhaseType.
+#define SMPC_PHASE_START(instr, phase) (instr).start(phase)
+/// Marks the end of a phase, see smpc#solverPhaseType.
+#define SMPC_PHASE_STOP(instr, phase) (instr).stop(phase)
+#else
+#define SMPC_PHASE_START(instr, phase)
+#define SMPC_PHASE_STOP(instr, phase)
+#endif
+
+
+/****************************************
+ * TYPEDEFS
+ ****************************************/
+
+namespace smpc
+{
+    /**
+     * @brief Collects smpc#solver_stats. The functions are not supposed to
+     * be called directly, use #SMPC_PHASE_START and #SMPC_PHASE_STOP,
+     * which are empty unless SMPC_INSTRUMENTATION is defined.
+     */
+    class instrumentation
+    {
+        public:
+            /**
+             * @brief Remembers the time, when the phase is started.
+             *
+             * @param[in] phase phase
+             */
+            void start (const solverPhaseType phase)
+            {
+                started[phase] = get_ticks();
+            }
+
+
+            /**
+             * @brief Accumulates the time spent in the phase.
+             *
+             * @param[in] phase phase
+             */
+            void stop (const solverPhaseType phase)
+            {
+                stats.ticks[phase] += get_ticks() - started[phase];
+                ++stats.calls[phase];
+            }
+
+
+            /**
+             * @return current value of a monotonic counter: the time stamp
+             * counter on x86, nanoseconds otherwise.
+             */
+            static double get_ticks()
+            {
+#if defined(SMPC_INSTRUMENTATION) && defined(HAVE_RDTSC)
+                return (static_cast<double>(__rdtsc()));
+#elif defined(SMPC_INSTRUMENTATION) && defined(HAVE_CLOCK_GETTIME)
+                timespec ts;
+                clock_gettime (CLOCK_MONOTONIC, &ts);
+                return (ts.tv_sec * 1e9 + ts.tv_nsec);
+#else
+                return (0.0);
+#endif
+            }
+
+
+            /// Collected statistics.
+            solver_stats stats;
+
+
+        private:
+            /// The moments, when the phases were started.
+            double started[SMPC_PHASE_NUM];
+    };
+}
+/// @}
+
+#endif /*SMPC_INSTRUMENTATION_H*/
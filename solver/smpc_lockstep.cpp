@@ -0,0 +1,202 @@
+/**
+ * @file
+ * @brief The interface class, a wrapper around #qp_ip_lockstep.
+ *
+ * @author Alexander Sherikov
+ * @date 17.10.2026 09:18:10 MSD
+ */
+
+
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include "qp_ip_lockstep.h"
+#include "smpc_lockstep.h"
+#include "state_handling.h"
+
+#include <new> // placement new
+
+
+/****************************************
+ * FUNCTIONS
+ ****************************************/
+namespace smpc
+{
+    template <int t_lanes>
+    solver_ip_lockstep<t_lanes>::solver_ip_lockstep (
+                    const int N,
+                    const double gain_position, const double gain_velocity, const double gain_acceleration,
+                    const double gain_jerk,
+                    const double tol, const double tol_out,
+                    const double t,
+                    const double mu,
+                    const double bs_alpha, const double bs_beta,
+                    const unsigned int max_iter)
+    {
+        const size_t arena_size = get_mem_size (N);
+
+        own_mem = new double[(arena_size + sizeof(double) - 1) / sizeof(double)];
+        arena qp_mem (own_mem, arena_size);
+
+        qp_sol = new (qp_mem.alloc< qp_ip_lockstep<t_lanes> >(1)) qp_ip_lockstep<t_lanes> (
+                qp_mem,
+                N,
+                gain_position, gain_velocity, gain_acceleration, gain_jerk,
+                tol);
+        qp_sol->set_ip_parameters (t, mu, bs_alpha, bs_beta, max_iter, tol_out);
+
+        for (int l = 0; l < t_lanes; ++l)
+        {
+            int_loop_iterations[l] = 0;
+            ext_loop_iterations[l] = 0;
+            bt_search_iterations[l] = 0;
+        }
+        lockstep_iterations = 0;
+    }
+
+
+    template <int t_lanes>
+    solver_ip_lockstep<t_lanes>::~solver_ip_lockstep()
+    {
+        qp_sol->~qp_ip_lockstep<t_lanes>();
+        delete [] own_mem;
+    }
+
+
+    template <int t_lanes>
+    size_t solver_ip_lockstep<t_lanes>::get_mem_size (const int N)
+    {
+        return (arena::get_size< qp_ip_lockstep<t_lanes> >(1) + qp_ip_lockstep<t_lanes>::get_mem_size (N));
+    }
+
+
+    template <int t_lanes>
+    void solver_ip_lockstep<t_lanes>::set_parameters(
+            const int lane,
+            const double* T, const double* h, const double h_initial,
+            const double* angle,
+            const double* zref_x, const double* zref_y,
+            const double* lb, const double* ub)
+    {
+        qp_sol->set_parameters(lane, T, h, h_initial, angle, zref_x, zref_y, lb, ub);
+    }
+
+
+    template <int t_lanes>
+    void solver_ip_lockstep<t_lanes>::form_init_fp (
+            const int lane,
+            const double *x_coord,
+            const double *y_coord,
+            const state_com &init_state,
+            double* X)
+    {
+        qp_sol->form_init_fp (lane, x_coord, y_coord, init_state.state_vector, false, X);
+    }
+
+
+    template <int t_lanes>
+    void solver_ip_lockstep<t_lanes>::form_init_fp (
+            const int lane,
+            const double *x_coord,
+            const double *y_coord,
+            const state_zmp &init_state,
+            double* X)
+    {
+        qp_sol->form_init_fp (lane, x_coord, y_coord, init_state.state_vector, true, X);
+    }
+
+
+    template <int t_lanes>
+    void solver_ip_lockstep<t_lanes>::solve()
+    {
+        qp_sol->solve ();
+
+        for (int l = 0; l < t_lanes; ++l)
+        {
+            int_loop_iterations[l] = qp_sol->int_loop_counter[l];
+            ext_loop_iterations[l] = qp_sol->ext_loop_counter[l];
+            bt_search_iterations[l] = qp_sol->bs_counter[l];
+        }
+        lockstep_iterations = qp_sol->lockstep_counter;
+        stats = qp_sol->instr.stats;
+    }
+
+
+    //************************************************************
+
+
+    template <int t_lanes>
+    void solver_ip_lockstep<t_lanes>::get_next_state (const int lane, state_zmp &s) const
+    {
+        get_state (lane, s, 0);
+    }
+
+
+    template <int t_lanes>
+    void solver_ip_lockstep<t_lanes>::get_state (const int lane, state_zmp &s, const int ind) const
+    {
+        const int N = qp_sol->ppar.N;
+        const int index = (ind >= N) ? N - 1 : ind;
+
+        for (int i = 0; i < SMPC_NUM_STATE_VAR; i++)
+        {
+            s.state_vector[i] = qp_sol->X[lane][index*SMPC_NUM_STATE_VAR + i];
+        }
+        state_handling::bar_to_tilde (
+                qp_sol->ppar.spar[index].sin.v[lane],
+                qp_sol->ppar.spar[index].cos.v[lane],
+                s.state_vector);
+    }
+
+
+    template <int t_lanes>
+    void solver_ip_lockstep<t_lanes>::get_next_state (const int lane, state_com &s) const
+    {
+        get_state (lane, s, 0);
+    }
+
+
+    template <int t_lanes>
+    void solver_ip_lockstep<t_lanes>::get_state (const int lane, state_com &s, const int ind) const
+    {
+        const int N = qp_sol->ppar.N;
+        const int index = (ind >= N) ? N - 1 : ind;
+
+        for (int i = 0; i < SMPC_NUM_STATE_VAR; i++)
+        {
+            s.state_vector[i] = qp_sol->X[lane][index*SMPC_NUM_STATE_VAR + i];
+        }
+        state_handling::bar_to_tilde (
+                qp_sol->ppar.spar[index].sin.v[lane],
+                qp_sol->ppar.spar[index].cos.v[lane],
+                s.state_vector);
+        state_handling::tilde_to_orig (qp_sol->ppar.spar[index].h.v[lane], s.state_vector);
+    }
+
+
+    //************************************************************
+
+
+    template <int t_lanes>
+    void solver_ip_lockstep<t_lanes>::get_first_controls (const int lane, control &c) const
+    {
+        get_controls (lane, c, 0);
+    }
+
+
+    template <int t_lanes>
+    void solver_ip_lockstep<t_lanes>::get_controls (const int lane, control &c, const int ind) const
+    {
+        state_handling::get_controls (
+                qp_sol->ppar.N,
+                qp_sol->X[lane],
+                ind,
+                c.control_vector);
+    }
+
+
+    template class solver_ip_lockstep<4>;
+    template class solver_ip_lockstep<8>;
+}
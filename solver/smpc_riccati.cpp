@@ -0,0 +1,342 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @date 17.10.2026 09:50:32 MSD
+ */
+
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include "smpc_riccati.h"
+#include "as_problem_param.h"
+#include "ip_problem_param.h"
+
+
+/****************************************
+ * FUNCTIONS
+ ****************************************/
+namespace smpc
+{
+    /**
+     * @brief Computes out = A' * v, where v and out are two vectors of 6
+     * elements (x and y components), which are stored with the given strides.
+     *
+     * @param[in] A3 parameter of A
+     * @param[in] A6 parameter of A
+     * @param[in] v input vector
+     * @param[in] v_stride distance between the elements of v
+     * @param[out] out output vector
+     * @param[in] out_stride distance between the elements of out
+     */
+    static inline void mult_AT (
+            const double A3,
+            const double A6,
+            const double *v,
+            const int v_stride,
+            double *out,
+            const int out_stride)
+    {
+        for (int j = 0; j < 2; ++j)
+        {
+            const double v0 = v[3*j*v_stride];
+            const double v1 = v[(3*j+1)*v_stride];
+            const double v2 = v[(3*j+2)*v_stride];
+
+            out[3*j*out_stride]     = v0;
+            out[(3*j+1)*out_stride] = A3*v0 + v1;
+            out[(3*j+2)*out_stride] = A6*v0 + A3*v1 + v2;
+        }
+    }
+
+
+    /**
+     * @brief Adds the hessian of a state to a 6x6 matrix.
+     *
+     * @param[in] hess_pos 3 elements of the 2x2 block, which correspond to
+     *  the position of ZMP (xx, xy, yy)
+     * @param[in] hess hessian of the velocity and of the acceleration
+     * @param[in,out] S the matrix (row-major)
+     */
+    static inline void add_hess (const double *hess_pos, const double *hess, double *S)
+    {
+        S[0]    += hess_pos[0];
+        S[3]    += hess_pos[1];
+        S[3*6]  += hess_pos[1];
+        S[3*6+3]+= hess_pos[2];
+
+        S[1*6+1] += hess[0];
+        S[4*6+4] += hess[0];
+        S[2*6+2] += hess[1];
+        S[5*6+5] += hess[1];
+    }
+
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in,out] mem memory arena
+     * @param[in] N size of the preview window.
+     */
+    riccati::riccati (arena &mem, const int N)
+    {
+        K = mem.alloc<double>(12*N);
+        iG = mem.alloc<double>(3*N);
+        k = mem.alloc<double>(SMPC_NUM_CONTROL_VAR*N);
+    }
+
+
+    /**
+     * @param[in] N size of the preview window.
+     * @return the amount of memory, which must be available in the arena
+     *  passed to the constructor [bytes].
+     */
+    size_t riccati::get_mem_size (const int N)
+    {
+        return (arena::get_size<double>(12*N)
+                + arena::get_size<double>(3*N)
+                + arena::get_size<double>(SMPC_NUM_CONTROL_VAR*N));
+    }
+
+
+    /**
+     * @brief Performs backward Riccati recursion: the cost-to-go hessians
+     * S_i are eliminated stage by stage starting from the last one,
+     * only the matrices required by #solve are kept.
+     *
+     * @param[in] N size of the preview window.
+     * @param[in] spar parameters of the states.
+     * @param[in] hess_pos 2x2 blocks of the hessian, which correspond to the
+     *  positions of ZMP (3*N elements: xx, xy, yy for each state).
+     * @param[in] hess hessian of the velocity, of the acceleration and of
+     *  the controls (3 elements, the same for all states).
+     */
+    template <class t_state_parameters>
+        void riccati::form (
+                const int N,
+                const t_state_parameters *spar,
+                const double *hess_pos,
+                const double *hess)
+    {
+        // cost-to-go hessian of the current state
+        double S[36] = {0.0};
+        // S*Acl
+        double SAcl[36];
+        // closed-loop matrix Acl = A + B*K
+        double Acl[36];
+        // B'*S
+        double BS[12];
+        // B'*S*A
+        double F[12];
+
+        add_hess (&hess_pos[3*(N-1)], hess, S);
+        for (int i = N-1; ; --i)
+        {
+            const double A3 = spar[i].A3;
+            const double A6 = spar[i].A6;
+            const double *b = spar[i].B;
+            double *Ki = &K[12*i];
+            double *iGi = &iG[3*i];
+            int r, c, m;
+
+
+            // B'*S, B acts on x and y components separately
+            for (c = 0; c < 6; ++c)
+            {
+                BS[c]   = b[0]*S[c]      + b[1]*S[6+c]    + b[2]*S[12+c];
+                BS[6+c] = b[0]*S[18+c]   + b[1]*S[24+c]   + b[2]*S[30+c];
+            }
+
+            // G = B'*S*B + hess_u*I
+            const double G00 = hess[2] + b[0]*BS[0] + b[1]*BS[1] + b[2]*BS[2];
+            const double G01 =           b[0]*BS[3] + b[1]*BS[4] + b[2]*BS[5];
+            const double G11 = hess[2] + b[0]*BS[9] + b[1]*BS[10] + b[2]*BS[11];
+            const double det = G00*G11 - G01*G01;
+            iGi[0] = G11/det;
+            iGi[1] = -G01/det;
+            iGi[2] = G00/det;
+
+            // K = -inv(G)*B'*S*A
+            mult_AT (A3, A6, &BS[0], 1, &F[0], 1);
+            mult_AT (A3, A6, &BS[6], 1, &F[6], 1);
+            for (c = 0; c < 6; ++c)
+            {
+                Ki[c]   = -(iGi[0]*F[c] + iGi[1]*F[6+c]);
+                Ki[6+c] = -(iGi[1]*F[c] + iGi[2]*F[6+c]);
+            }
+
+            if (i == 0)
+            {
+                break;
+            }
+
+
+            // Acl = A + B*K
+            for (r = 0; r < 6; ++r)
+            {
+                for (c = 0; c < 6; ++c)
+                {
+                    Acl[r*6+c] = b[r%3]*Ki[(r/3)*6+c];
+                }
+            }
+            for (m = 0; m < 2; ++m)
+            {
+                double *Aclm = &Acl[3*m*6 + 3*m];
+                Aclm[0]  += 1.0;
+                Aclm[1]  += A3;
+                Aclm[2]  += A6;
+                Aclm[7]  += 1.0;
+                Aclm[8]  += A3;
+                Aclm[14] += 1.0;
+            }
+
+            // S = Acl'*S*Acl + hess_u*K'*K + Q
+            // (Joseph form, A'*S*A - F'*inv(G)*F is equivalent, but loses 
+            // precision, when the elements of Q differ by many orders of 
+            // magnitude, e.g. near the bounds in the interior-point method)
+            for (r = 0; r < 6; ++r)
+            {
+                for (c = 0; c < 6; ++c)
+                {
+                    double sum = 0.0;
+                    for (m = 0; m < 6; ++m)
+                    {
+                        sum += S[r*6+m]*Acl[m*6+c];
+                    }
+                    SAcl[r*6+c] = sum;
+                }
+            }
+            for (r = 0; r < 6; ++r)
+            {
+                for (c = r; c < 6; ++c)
+                {
+                    double sum = hess[2]*(Ki[r]*Ki[c] + Ki[6+r]*Ki[6+c]);
+                    for (m = 0; m < 6; ++m)
+                    {
+                        sum += Acl[m*6+r]*SAcl[m*6+c];
+                    }
+                    S[r*6+c] = S[c*6+r] = sum;
+                }
+            }
+            add_hess (&hess_pos[3*(i-1)], hess, S);
+        }
+    }
+
+
+    /**
+     * @brief Solves the subproblem using the factorization formed by the
+     * last call of #form: the linear terms of the cost-to-go are propagated
+     * backward, then the optimal controls and states are computed forward
+     * starting from x_{-1} = 0.
+     *
+     * @param[in] N size of the preview window.
+     * @param[in] spar parameters of the states, must be the same as in #form.
+     * @param[in,out] q_dx on entry -- vector q (N*#SMPC_NUM_VAR, the states
+     *  followed by the controls), on exit -- the solution dx.
+     */
+    template <class t_state_parameters>
+        void riccati::solve (
+                const int N,
+                const t_state_parameters *spar,
+                double *q_dx)
+    {
+        const double *qu = &q_dx[N*SMPC_NUM_STATE_VAR];
+        // linear term of the cost-to-go of the current state
+        double s[SMPC_NUM_STATE_VAR];
+        int i, j;
+
+
+        for (j = 0; j < SMPC_NUM_STATE_VAR; ++j)
+        {
+            s[j] = q_dx[(N-1)*SMPC_NUM_STATE_VAR + j];
+        }
+        for (i = N-1; ; --i)
+        {
+            const double *b = spar[i].B;
+            const double *Ki = &K[12*i];
+            const double *iGi = &iG[3*i];
+            double *ki = &k[SMPC_NUM_CONTROL_VAR*i];
+
+            // k = -inv(G) * (B'*s + qu)
+            const double e0 = b[0]*s[0] + b[1]*s[1] + b[2]*s[2] + qu[SMPC_NUM_CONTROL_VAR*i];
+            const double e1 = b[0]*s[3] + b[1]*s[4] + b[2]*s[5] + qu[SMPC_NUM_CONTROL_VAR*i + 1];
+            ki[0] = -(iGi[0]*e0 + iGi[1]*e1);
+            ki[1] = -(iGi[1]*e0 + iGi[2]*e1);
+
+            if (i == 0)
+            {
+                break;
+            }
+
+            // s = A'*s + K'*(B'*s + qu) + q
+            double As[SMPC_NUM_STATE_VAR];
+            mult_AT (spar[i].A3, spar[i].A6, s, 1, As, 1);
+            const double *q = &q_dx[(i-1)*SMPC_NUM_STATE_VAR];
+            for (j = 0; j < SMPC_NUM_STATE_VAR; ++j)
+            {
+                s[j] = As[j] + Ki[j]*e0 + Ki[6+j]*e1 + q[j];
+            }
+        }
+
+
+        double *x = q_dx;
+        double *u = &q_dx[N*SMPC_NUM_STATE_VAR];
+        const double *xp = NULL;
+        for (i = 0; i < N; ++i)
+        {
+            const double *b = spar[i].B;
+            const double *ki = &k[SMPC_NUM_CONTROL_VAR*i];
+
+            if (xp == NULL)
+            {
+                // x_{-1} = 0
+                u[0] = ki[0];
+                u[1] = ki[1];
+                x[0] = b[0]*u[0];
+                x[1] = b[1]*u[0];
+                x[2] = b[2]*u[0];
+                x[3] = b[0]*u[1];
+                x[4] = b[1]*u[1];
+                x[5] = b[2]*u[1];
+            }
+            else
+            {
+                const double A3 = spar[i].A3;
+                const double A6 = spar[i].A6;
+                const double *Ki = &K[12*i];
+
+                // u = K*xp + k
+                u[0] = ki[0];
+                u[1] = ki[1];
+                for (j = 0; j < SMPC_NUM_STATE_VAR; ++j)
+                {
+                    u[0] += Ki[j]*xp[j];
+                    u[1] += Ki[6+j]*xp[j];
+                }
+
+                // x = A*xp + B*u
+                x[0] = xp[0] + A3*xp[1] + A6*xp[2] + b[0]*u[0];
+                x[1] =            xp[1] + A3*xp[2] + b[1]*u[0];
+                x[2] =                       xp[2] + b[2]*u[0];
+                x[3] = xp[3] + A3*xp[4] + A6*xp[5] + b[0]*u[1];
+                x[4] =            xp[4] + A3*xp[5] + b[1]*u[1];
+                x[5] =                       xp[5] + b[2]*u[1];
+            }
+
+            xp = x;
+            x = &x[SMPC_NUM_STATE_VAR];
+            u = &u[SMPC_NUM_CONTROL_VAR];
+        }
+    }
+
+
+    template void riccati::form<AS::state_parameters> (
+            const int, const AS::state_parameters *, const double *, const double *);
+    template void riccati::solve<AS::state_parameters> (
+            const int, const AS::state_parameters *, double *);
+    template void riccati::form<IP::state_parameters> (
+            const int, const IP::state_parameters *, const double *, const double *);
+    template void riccati::solve<IP::state_parameters> (
+            const int, const IP::state_parameters *, double *);
+}
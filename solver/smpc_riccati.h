@@ -0,0 +1,75 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @date 17.10.2026 09:50:32 MSD
+ */
+
+
+#ifndef SMPC_RICCATI_H
+#define SMPC_RICCATI_H
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include "smpc_common.h"
+#include "smpc_arena.h"
+
+
+/****************************************
+ * TYPEDEFS
+ ****************************************/
+
+/// @addtogroup gINTERNALS
+/// @{
+
+namespace smpc
+{
+    /**
+     * @brief Solves equality constrained subproblems
+     *  min 0.5*dx'*H*dx + q'*dx  s.t.  E*dx = 0
+     * by backward Riccati recursion over the stages of the preview window.
+     * H is block diagonal, the states and the controls are
+     * @ref pX_tilde "X_tilde", i.e. the dynamics are
+     * x_i = A_i * x_{i-1} + B_i * u_i (x_{-1} = 0), where A_i and B_i act
+     * on x and y components separately, the components are coupled only by
+     * the 2x2 blocks of H, which correspond to the positions of ZMP.
+     *
+     * A factorization (#form) depends only on H and the parameters of the
+     * states, it can be used with any number of vectors q (#solve).
+     */
+    class riccati
+    {
+        public:
+            riccati (arena &, const int);
+            static size_t get_mem_size (const int);
+
+            template <class t_state_parameters>
+                void form (
+                        const int,
+                        const t_state_parameters *,
+                        const double *,
+                        const double *);
+
+            template <class t_state_parameters>
+                void solve (
+                        const int,
+                        const t_state_parameters *,
+                        double *);
+
+        private:
+            /// Feedback gains K_i = -inv(G_i)*B_i'*S_i*A_i (2x6, row-major)
+            /// for each stage, where S_i is the cost-to-go hessian of x_i.
+            double *K;
+
+            /// Inverted matrices G_i = B_i'*S_i*B_i + hess_u*I (2x2,
+            /// symmetric, 3 elements: 00, 01, 11) for each stage.
+            double *iG;
+
+            /// Feedforward terms of the controls (2 for each stage).
+            double *k;
+    };
+}
+
+///@}
+#endif /*SMPC_RICCATI_H*/
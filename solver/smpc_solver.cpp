@@ -23,6 +23,29 @@
 #include "smpc_solver.h"
 #include "state_handling.h"
 
+#include <new> // placement new
+#include <stdexcept> // std::invalid_argument
+
+
+/// A compile time check of a condition (arrays of negative size are not allowed).
+#define SMPC_STATIC_CHECK(condition, name) typedef char name[(condition) ? 1 : -1]
+
+// Constant terms of SMPC_AS_MEM_SIZE and SMPC_IP_MEM_SIZE must cover the
+// objects and the padding of the arrays.
+// AS: 25 allocations + 6 allocations of the Riccati recursion, the condensed
+// formulation requires fewer allocations.
+SMPC_STATIC_CHECK(sizeof(qp_as) + sizeof(AS::chol_solve) + sizeof(smpc::riccati) + 31*SMPC_ARENA_ALIGNMENT <= 2688,
+        smpc_check_qp_as_size);
+SMPC_STATIC_CHECK(sizeof(qp_as) + sizeof(AS::condensed_solve) + 31*SMPC_ARENA_ALIGNMENT <= 2688,
+        smpc_check_qp_as_condensed_size);
+SMPC_STATIC_CHECK(sizeof(AS::matrix_ecL) + 6*SMPC_ARENA_ALIGNMENT <= 512, smpc_check_as_ecL_size);
+// IP: 16 allocations, the factor has N-1 off-diagonal blocks.
+SMPC_STATIC_CHECK(sizeof(qp_ip) + sizeof(IP::matrix_ecL<double>) + 16*(SMPC_ARENA_ALIGNMENT - 1)
+        <= 2048 + MATRIX_SIZE_6x6*sizeof(double), smpc_check_qp_ip_size);
+// IP with the Riccati recursion: 19 allocations.
+SMPC_STATIC_CHECK(sizeof(qp_ip) + sizeof(smpc::riccati) + 19*(SMPC_ARENA_ALIGNMENT - 1) <= 2048,
+        smpc_check_qp_ip_riccati_size);
+
 
 /****************************************
  * FUNCTIONS 
@@ -43,6 +66,32 @@ namespace smpc
     solver::~solver() {} // virtual destructor
 
 
+    /**
+     * @param[in] phase phase
+     * @return a human readable name of the phase.
+     */
+    const char *solver_stats::get_phase_name (const solverPhaseType phase)
+    {
+        static const char *names[SMPC_PHASE_NUM] = {
+            "solve",
+            "ecL.form",
+            "form_Ex",
+            "solve_forward",
+            "solve_backward",
+            "up_resolve",
+            "down_resolve",
+            "get_lambda",
+            "check_blocking_constraints",
+            "backtracking_search"};
+
+        if ((phase < 0) || (phase >= SMPC_PHASE_NUM))
+        {
+            return ("unknown");
+        }
+        return (names[phase]);
+    }
+
+
     solver_as::solver_as (
                     const int N,
                     const double gain_position, 
@@ -52,14 +101,130 @@ namespace smpc
                     const double tol,
                     const unsigned int max_added_constraints_num,
                     const bool constraint_removal_on,
-                    const bool obj_computation_on)
+                    const bool obj_computation_on,
+                    const bool warm_start_on,
+                    const unsigned int ecL_cache_size,
+                    const kktSolverType kkt_solver)
+    {
+        init (NULL, 0, 
+                N, 
+                gain_position, gain_velocity, gain_acceleration, gain_jerk, 
+                tol, 
+                max_added_constraints_num, constraint_removal_on,
+                obj_computation_on,
+                warm_start_on, ecL_cache_size, kkt_solver);
+    }
+
+
+    solver_as::solver_as (
+                    void *mem,
+                    const size_t mem_size,
+                    const int N,
+                    const double gain_position, 
+                    const double gain_velocity, 
+                    const double gain_acceleration,
+                    const double gain_jerk, 
+                    const double tol,
+                    const unsigned int max_added_constraints_num,
+                    const bool constraint_removal_on,
+                    const bool obj_computation_on,
+                    const bool warm_start_on,
+                    const unsigned int ecL_cache_size,
+                    const kktSolverType kkt_solver)
+    {
+        init (mem, mem_size, 
+                N, 
+                gain_position, gain_velocity, gain_acceleration, gain_jerk, 
+                tol, 
+                max_added_constraints_num, constraint_removal_on,
+                obj_computation_on,
+                warm_start_on, ecL_cache_size, kkt_solver);
+    }
+
+
+    solver_as::solver_as (
+                    arena &mem,
+                    const int N,
+                    const double gain_position, 
+                    const double gain_velocity, 
+                    const double gain_acceleration,
+                    const double gain_jerk, 
+                    const double tol,
+                    const unsigned int max_added_constraints_num,
+                    const bool constraint_removal_on,
+                    const bool obj_computation_on,
+                    const bool warm_start_on,
+                    const unsigned int ecL_cache_size,
+                    const kktSolverType kkt_solver)
+    {
+        const size_t mem_size = get_mem_size (N, ecL_cache_size, kkt_solver);
+        void *chunk = mem.alloc<char>(mem_size);
+
+        init (chunk, (chunk == NULL) ? 0 : mem_size,
+                N, 
+                gain_position, gain_velocity, gain_acceleration, gain_jerk, 
+                tol, 
+                max_added_constraints_num, constraint_removal_on,
+                obj_computation_on,
+                warm_start_on, ecL_cache_size, kkt_solver);
+    }
+
+
+    void solver_as::init (
+                    void *mem,
+                    const size_t mem_size,
+                    const int N,
+                    const double gain_position, 
+                    const double gain_velocity, 
+                    const double gain_acceleration,
+                    const double gain_jerk, 
+                    const double tol,
+                    const unsigned int max_added_constraints_num,
+                    const bool constraint_removal_on,
+                    const bool obj_computation_on,
+                    const bool warm_start_on,
+                    const unsigned int ecL_cache_size,
+                    const kktSolverType kkt_solver)
     {
-        qp_sol = new qp_as (
+        size_t arena_size = get_mem_size (N, ecL_cache_size, kkt_solver);
+
+        if (mem == NULL)
+        {
+            own_mem = new double[(arena_size + sizeof(double) - 1) / sizeof(double)];
+            mem = own_mem;
+        }
+        else
+        {
+            if (mem_size < arena_size)
+            {
+                // the bounds of the required memory are wrong
+                throw std::bad_alloc();
+            }
+            own_mem = NULL;
+            arena_size = mem_size;
+        }
+        arena qp_mem (mem, arena_size);
+
+        qp_sol = new (qp_mem.alloc<qp_as>(1)) qp_as (
+                qp_mem,
                 N, 
                 gain_position, gain_velocity, gain_acceleration, gain_jerk, 
                 tol, 
                 obj_computation_on,
-                max_added_constraints_num, constraint_removal_on);
+                max_added_constraints_num, constraint_removal_on,
+                warm_start_on, ecL_cache_size, kkt_solver);
+
+        if (obj_computation_on)
+        {
+            // the initial value + one value for each added or removed
+            // constraint (a constraint can be removed only after it was 
+            // added or guessed on warm start)
+            const unsigned int max_added = 
+                (qp_sol->max_added_constraints_num < (unsigned int) 4*N) ? 
+                    qp_sol->max_added_constraints_num : 4*N;
+            objective_log.reserve (1 + 2*N + 2*max_added);
+        }
+
         added_constraints_num = 0;
         removed_constraints_num = 0;
         active_set_size = 0;
@@ -70,8 +235,21 @@ namespace smpc
     {
         if (qp_sol != NULL)
         {
-            delete qp_sol;
+            qp_sol->~qp_as();
         }
+        if (own_mem != NULL)
+        {
+            delete [] own_mem;
+        }
+    }
+
+
+    size_t solver_as::get_mem_size (
+            const int N,
+            const unsigned int ecL_cache_size,
+            const kktSolverType kkt_solver)
+    {
+        return (arena::get_size<qp_as>(1) + qp_as::get_mem_size (N, ecL_cache_size, kkt_solver));
     }
 
 
@@ -125,6 +303,55 @@ namespace smpc
             added_constraints_num   = qp_sol->added_constraints_num;
             removed_constraints_num = qp_sol->removed_constraints_num;
             active_set_size         = qp_sol->active_set_size;
+            stats                   = qp_sol->instr.stats;
+        }
+    }
+
+
+    void solver_as::solve_multi (
+            const int M,
+            const double * const *zref_x,
+            const double * const *zref_y,
+            double * const *X)
+    {
+        if ((qp_sol != NULL) && (M > 0))
+        {
+            if (multi_mem.empty())
+            {
+                // reserve_multi() was not called
+                reserve_multi (M);
+            }
+            const int group_size = multi_mem.size() / qp_as::get_multi_mem_size (qp_sol->N, 1);
+
+            added_constraints_num   = 0;
+            removed_constraints_num = 0;
+            stats.reset();
+            for (int first = 0; first < M; first += group_size)
+            {
+                const int group_num = (M - first < group_size) ? (M - first) : group_size;
+
+                qp_sol->solve_multi (
+                        group_num, &zref_x[first], &zref_y[first], &X[first],
+                        &multi_mem[0], objective_log);
+
+                added_constraints_num   += qp_sol->added_constraints_num;
+                removed_constraints_num += qp_sol->removed_constraints_num;
+                for (int k = 0; k < SMPC_PHASE_NUM; ++k)
+                {
+                    stats.ticks[k] += qp_sol->instr.stats.ticks[k];
+                    stats.calls[k] += qp_sol->instr.stats.calls[k];
+                }
+            }
+            active_set_size = qp_sol->active_set_size;
+        }
+    }
+
+
+    void solver_as::reserve_multi (const int M)
+    {
+        if ((qp_sol != NULL) && (M > 0))
+        {
+            multi_mem.resize (qp_as::get_multi_mem_size (qp_sol->N, M));
         }
     }
 
@@ -229,15 +456,119 @@ namespace smpc
                     const double bs_alpha, const double bs_beta,
                     const unsigned int max_iter,
                     const backtrackingSearchType bs_type,
-                    const bool obj_computation_on)
+                    const bool obj_computation_on,
+                    const solver_ip_parameters &ip_par)
     {
-        qp_sol = new qp_ip (
+        init (NULL, 0,
+                N, 
+                gain_position, gain_velocity, gain_acceleration, gain_jerk, 
+                tol, tol_out, t, mu, bs_alpha, bs_beta, max_iter,
+                bs_type, obj_computation_on, ip_par);
+    }
+
+
+    solver_ip::solver_ip (
+                    void *mem,
+                    const size_t mem_size,
+                    const int N,
+                    const double gain_position, const double gain_velocity, const double gain_acceleration,
+                    const double gain_jerk, 
+                    const double tol, const double tol_out,
+                    const double t,
+                    const double mu,
+                    const double bs_alpha, const double bs_beta,
+                    const unsigned int max_iter,
+                    const backtrackingSearchType bs_type,
+                    const bool obj_computation_on,
+                    const solver_ip_parameters &ip_par)
+    {
+        init (mem, mem_size,
+                N, 
+                gain_position, gain_velocity, gain_acceleration, gain_jerk, 
+                tol, tol_out, t, mu, bs_alpha, bs_beta, max_iter,
+                bs_type, obj_computation_on, ip_par);
+    }
+
+
+    solver_ip::solver_ip (
+                    arena &mem,
+                    const int N,
+                    const double gain_position, const double gain_velocity, const double gain_acceleration,
+                    const double gain_jerk, 
+                    const double tol, const double tol_out,
+                    const double t,
+                    const double mu,
+                    const double bs_alpha, const double bs_beta,
+                    const unsigned int max_iter,
+                    const backtrackingSearchType bs_type,
+                    const bool obj_computation_on,
+                    const solver_ip_parameters &ip_par)
+    {
+        const size_t mem_size = get_mem_size (N, ip_par.kkt_solver);
+        void *chunk = mem.alloc<char>(mem_size);
+
+        init (chunk, (chunk == NULL) ? 0 : mem_size,
+                N, 
+                gain_position, gain_velocity, gain_acceleration, gain_jerk, 
+                tol, tol_out, t, mu, bs_alpha, bs_beta, max_iter,
+                bs_type, obj_computation_on, ip_par);
+    }
+
+
+    void solver_ip::init (
+                    void *mem,
+                    const size_t mem_size,
+                    const int N,
+                    const double gain_position, const double gain_velocity, const double gain_acceleration,
+                    const double gain_jerk, 
+                    const double tol, const double tol_out,
+                    const double t,
+                    const double mu,
+                    const double bs_alpha, const double bs_beta,
+                    const unsigned int max_iter,
+                    const backtrackingSearchType bs_type,
+                    const bool obj_computation_on,
+                    const solver_ip_parameters &ip_par)
+    {
+        if ((ip_par.kkt_solver != SMPC_KKT_CHOLESKY) && (ip_par.kkt_solver != SMPC_KKT_RICCATI))
+        {
+            // the condensed formulation is implemented only for AS
+            throw std::invalid_argument ("smpc::solver_ip: unsupported KKT solver");
+        }
+
+        size_t arena_size = get_mem_size (N, ip_par.kkt_solver);
+
+        if (mem == NULL)
+        {
+            own_mem = new double[(arena_size + sizeof(double) - 1) / sizeof(double)];
+            mem = own_mem;
+        }
+        else
+        {
+            if (mem_size < arena_size)
+            {
+                // the bounds of the required memory are wrong
+                throw std::bad_alloc();
+            }
+            own_mem = NULL;
+            arena_size = mem_size;
+        }
+        arena qp_mem (mem, arena_size);
+
+        qp_sol = new (qp_mem.alloc<qp_ip>(1)) qp_ip (
+                qp_mem,
                 N, 
                 gain_position, gain_velocity, gain_acceleration, gain_jerk, 
                 tol, 
-                obj_computation_on, bs_type);
+                obj_computation_on, bs_type,
+                ip_par.warm_start_on, ip_par.method, ip_par.refactor_tol, ip_par.kkt_solver);
         qp_sol->set_ip_parameters (t, mu, bs_alpha, bs_beta, max_iter, tol_out);
 
+        if (obj_computation_on)
+        {
+            objective_log.reserve (1 + ((max_iter > 0) ? max_iter : SMPC_IP_OBJ_LOG_SIZE));
+        }
+
         int_loop_iterations = 0;
         ext_loop_iterations = 0;
         bt_search_iterations = 0;
@@ -248,8 +579,20 @@ namespace smpc
     {
         if (qp_sol != NULL)
         {
-            delete qp_sol;
+            qp_sol->~qp_ip();
         }
+        if (own_mem != NULL)
+        {
+            delete [] own_mem;
+        }
+    }
+
+
+    size_t solver_ip::get_mem_size (
+            const int N,
+            const kktSolverType kkt_solver)
+    {
+        return (arena::get_size<qp_ip>(1) + qp_ip::get_mem_size (N, kkt_solver));
     }
 
 
@@ -302,6 +645,25 @@ namespace smpc
             int_loop_iterations = qp_sol->int_loop_counter;
             ext_loop_iterations = qp_sol->ext_loop_counter;
             bt_search_iterations = qp_sol->bs_counter;
+            stats = qp_sol->instr.stats;
+        }
+    }
+
+
+    void solver_ip::solve_multi (
+            const int M,
+            const double * const *zref_x,
+            const double * const *zref_y,
+            double * const *X)
+    {
+        if ((qp_sol != NULL) && (M > 0))
+        {
+            qp_sol->solve_multi (M, zref_x, zref_y, X, objective_log);
+
+            int_loop_iterations = qp_sol->int_loop_counter;
+            ext_loop_iterations = qp_sol->ext_loop_counter;
+            bt_search_iterations = qp_sol->bs_counter;
+            stats = qp_sol->instr.stats;
         }
     }
 
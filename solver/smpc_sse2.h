@@ -0,0 +1,54 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Helpers of the SSE2 kernels, which process the x and y components
+ *  of the states in two lanes. The components are stored with stride 3
+ *  (x, vx, ax, y, vy, ay), the controls are adjacent (jx, jy).
+ */
+
+
+#ifndef SMPC_SSE2_H
+#define SMPC_SSE2_H
+
+#ifdef __SSE2__
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include <emmintrin.h>
+
+
+/// @addtogroup gINTERNALS
+/// @{
+
+/**
+ * @brief Loads the x and y components of an element of a state.
+ *
+ * @param[in] x the x component, the y component is x[3].
+ *
+ * @return (x[0], x[3])
+ */
+inline __m128d smpc_load_xy (const double *x)
+{
+    return (_mm_set_pd (x[3], x[0]));
+}
+
+
+/**
+ * @brief Stores the x and y components of an element of a state.
+ *
+ * @param[out] x the x component, the y component is x[3].
+ * @param[in] v (x[0], x[3])
+ */
+inline void smpc_store_xy (double *x, const __m128d v)
+{
+    _mm_storel_pd (x, v);
+    _mm_storeh_pd (&x[3], v);
+}
+
+///@}
+
+#endif /*__SSE2__*/
+
+#endif /*SMPC_SSE2_H*/
@@ -0,0 +1,7 @@
+#define HAVE_FEENABLEEXCEPT
+#define HAVE_AVX_DISPATCH
+#define HAVE_SYS_MMAN_H
+#define HAVE_RDTSC
+#define HAVE_CLOCK_GETTIME
+/* #undef SMPC_INSTRUMENTATION */
+#define HAVE_PTHREAD_SETAFFINITY_NP
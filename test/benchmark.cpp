@@ -0,0 +1,327 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Latency benchmark: runs full simulations for a set of solver
+ *  configurations and reports the distribution of the time required to
+ *  form and solve a QP (min, median, p99, p99.9, max) and the number of
+ *  iterations. The sweep covers all test scenarios, the size of the
+ *  preview window, the gains and the tolerances for AS and both methods
+ *  of IP (IPD denotes the primal-dual method). The 'kkt' sweep compares
+ *  the Cholesky factorization, the Riccati recursion and the condensed
+ *  formulation (AS only), see smpc#kktSolverType, for several sizes of
+ *  the preview window.
+ *
+ *  The runs, which stop on the limit of the number of iterations or
+ *  produce non-finite solutions, are excluded from the statistics of
+ *  latency and iterations and are counted separately (see
+ *  #get_run_status).
+ *
+ *  Usage: benchmark.a [repetitions [output_prefix]]
+ *
+ *  The results are also written to <output_prefix>.csv and
+ *  <output_prefix>.json (the default prefix is 'benchmark').
+ */
+
+
+#include <cstdlib>
+
+#include "benchmark_common.h"
+
+///@addtogroup gTEST
+///@{
+
+
+/// The number of repetitions of each simulation (default).
+#define BENCH_REPETITIONS 10
+
+
+/**
+ * @brief Results of a benchmark run, the time is given in microseconds.
+ */
+struct bench_result
+{
+    int N;
+
+    latency_stats latency;
+
+    double iter_mean;
+    unsigned int iter_max;
+
+    /// The number of runs, which stopped on the limit of iterations.
+    unsigned int capped;
+    /// The number of runs, which produced non-finite solutions.
+    unsigned int nonfinite;
+};
+
+
+
+/**
+ * @brief Creates a test scenario.
+ *
+ * @param[in] scenario number of the scenario
+ * @param[in] N size of the preview window (used by init_10 and init_11
+ *  only, the other scenarios are defined for a fixed N), 0 -- default.
+ *
+ * @return a new scenario.
+ */
+test_init_base * create_scenario (const int scenario, const int N)
+{
+    switch (scenario)
+    {
+        case 1: return (new init_01 (""));
+        case 2: return (new init_02 (""));
+        case 3: return (new init_03 (""));
+        case 4: return (new init_04 (""));
+        case 5: return (new init_05 (""));
+        case 6: return (new init_06 (""));
+        case 7: return (new init_07 (""));
+        case 8: return (new init_08 (""));
+        case 9: return (new init_09 (""));
+        case 10: return (N > 0 ? new init_10 ("", true, N) : new init_10 (""));
+        case 11: return (N > 0 ? new init_11 ("", true, N) : new init_11 (""));
+        default: return (NULL);
+    }
+}
+
+
+/**
+ * @brief Runs the simulation several times and measures the time
+ * required to form and solve each QP.
+ *
+ * @param[in] conf configuration
+ * @param[in] repetitions the number of repetitions
+ *
+ * @return results.
+ */
+bench_result run_benchmark (const bench_config &conf, const int repetitions)
+{
+    vector<double> samples;
+    bench_result res;
+    double iter_sum = 0.0;
+
+    res.N = 0;
+    res.iter_max = 0;
+    res.capped = 0;
+    res.nonfinite = 0;
+
+    for (int rep = 0; rep < repetitions; ++rep)
+    {
+        test_init_base *test = create_scenario (conf.scenario, conf.N);
+        smpc::solver *solver = create_solver (conf, test->wmg->N);
+        res.N = test->wmg->N;
+
+        for(;;)
+        {
+            //------------------------------------------------------
+            if (test->wmg->formPreviewWindow(*test->par) == WMG_HALT)
+            {
+                break;
+            }
+            //------------------------------------------------------
+
+            smpc_parameters *par = test->par;
+
+            double start = get_time();
+            solver->set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+            solver->form_init_fp (par->fp_x, par->fp_y, par->init_state, par->X);
+            solver->solve();
+            double end = get_time();
+
+            solver->get_next_state(par->init_state);
+
+            const benchRunStatus status = get_run_status (conf.solver, *solver, res.N, par->X);
+            if (status == BENCH_RUN_CAPPED)
+            {
+                ++res.capped;
+                continue;
+            }
+            else if (status == BENCH_RUN_NONFINITE)
+            {
+                ++res.nonfinite;
+                continue;
+            }
+
+            samples.push_back ((end - start) * 1e6);
+
+            const unsigned int iter = get_iterations (conf.solver, *solver);
+            iter_sum += iter;
+            res.iter_max = max (res.iter_max, iter);
+        }
+
+        delete solver;
+        delete test->par;
+        delete test->wmg;
+        delete test;
+    }
+
+
+    res.latency = get_latency_stats (samples);
+    res.iter_mean = (samples.size() > 0) ? iter_sum / samples.size() : 0.0;
+
+    return (res);
+}
+
+
+
+int main(int argc, char **argv)
+{
+    const int repetitions = (argc > 1) ? atoi (argv[1]) : BENCH_REPETITIONS;
+    const string prefix = (argc > 2) ? argv[2] : "benchmark";
+
+    if (repetitions <= 0)
+    {
+        cout << "Usage: " << argv[0] << " [repetitions [output_prefix]]" << endl;
+        return (1);
+    }
+
+
+    // The base configuration, the sweeps vary one parameter at a time.
+    const bench_config base_as = {"", 10, 40, BENCH_AS, 8000.0, 1.0, 0.02, 1.0, 1e-7, 0.0, smpc::SMPC_KKT_CHOLESKY};
+    const bench_config base_ip = {"", 10, 40, BENCH_IP, 8000.0, 1.0, 0.02, 1.0, 1e-3, 1e-2, smpc::SMPC_KKT_CHOLESKY};
+    const bench_config base_ipd = {"", 10, 40, BENCH_IPD, 8000.0, 1.0, 0.02, 1.0, 1e-3, 1e-2, smpc::SMPC_KKT_CHOLESKY};
+    const bench_config base[3] = {base_as, base_ip, base_ipd};
+
+    const int sweep_N[] = {20, 40, 60, 80, 100};
+    const int sweep_kkt_N[] = {10, 15, 20, 30, 40, 60, 80, 100, 120};
+    const double sweep_gains[][4] = {
+        {2000.0, 150.0, 0.02, 1.0},
+        {8000.0, 1.0, 0.02, 1.0},
+        {8000.0, 150.0, 0.01, 1.0}};
+    const double sweep_tol[][2][2] = {
+        // AS: tol; IP, IPD: tol, tol_out
+        {{1e-5, 0.0}, {1e-2, 1e-1}},
+        {{1e-7, 0.0}, {1e-3, 1e-2}},
+        {{1e-9, 0.0}, {1e-4, 1e-3}}};
+
+    vector<bench_config> configs;
+    for (int s = 0; s < 3; ++s)
+    {
+        bench_config conf;
+
+        for (int scenario = 1; scenario <= 11; ++scenario)
+        {
+            conf = base[s];
+            conf.sweep = "scenario";
+            conf.scenario = scenario;
+            conf.N = 0;
+            configs.push_back (conf);
+        }
+
+        for (unsigned int i = 0; i < sizeof(sweep_N) / sizeof(sweep_N[0]); ++i)
+        {
+            conf = base[s];
+            conf.sweep = "N";
+            conf.N = sweep_N[i];
+            configs.push_back (conf);
+        }
+
+        for (unsigned int i = 0; i < sizeof(sweep_gains) / sizeof(sweep_gains[0]); ++i)
+        {
+            conf = base[s];
+            conf.sweep = "gains";
+            conf.gain_position = sweep_gains[i][0];
+            conf.gain_velocity = sweep_gains[i][1];
+            conf.gain_acceleration = sweep_gains[i][2];
+            conf.gain_jerk = sweep_gains[i][3];
+            configs.push_back (conf);
+        }
+
+        for (unsigned int i = 0; i < sizeof(sweep_tol) / sizeof(sweep_tol[0]); ++i)
+        {
+            conf = base[s];
+            conf.sweep = "tol";
+            conf.tol = sweep_tol[i][(s == BENCH_AS) ? 0 : 1][0];
+            conf.tol_out = sweep_tol[i][(s == BENCH_AS) ? 0 : 1][1];
+            configs.push_back (conf);
+        }
+
+        for (unsigned int i = 0; i < sizeof(sweep_kkt_N) / sizeof(sweep_kkt_N[0]); ++i)
+        {
+            conf = base[s];
+            conf.sweep = "kkt";
+            conf.N = sweep_kkt_N[i];
+            configs.push_back (conf);
+            conf.kkt_solver = smpc::SMPC_KKT_RICCATI;
+            configs.push_back (conf);
+            if (s == BENCH_AS)
+            {
+                conf.kkt_solver = smpc::SMPC_KKT_CONDENSED;
+                configs.push_back (conf);
+            }
+        }
+    }
+
+
+    FILE *csv = fopen ((prefix + ".csv").c_str(), "w");
+    FILE *json = fopen ((prefix + ".json").c_str(), "w");
+    if ((csv == NULL) || (json == NULL))
+    {
+        cout << "Cannot open the output files." << endl;
+        return (1);
+    }
+
+    fprintf (csv, "sweep,solver,kkt,scenario,N,gain_position,gain_velocity,gain_acceleration,gain_jerk,tol,tol_out,"
+                  "samples,capped,nonfinite,min_us,median_us,p99_us,p999_us,max_us,mean_us,iter_mean,iter_max\n");
+    fprintf (json, "{\n  \"repetitions\": %d,\n  \"results\": [\n", repetitions);
+
+    printf ("Repetitions: %d, time is given in microseconds.\n", repetitions);
+    printf ("%-8s %-3s %-4s %-7s %4s %-22s %9s %9s %9s %9s %9s %9s %7s %5s %5s\n",
+            "sweep", "   ", "kkt", "test", "N", "parameters", "min", "median", "p99", "p99.9", "max", "mean", "iter", "max", "fail");
+
+    for (unsigned int i = 0; i < configs.size(); ++i)
+    {
+        const bench_config &conf = configs[i];
+        const char *solver_names[3] = {"AS", "IP", "IPD"};
+        const char *solver_name = solver_names[conf.solver];
+        const char *kkt_names[4] = {"chol", "ric", "cnd", "auto"};
+        const char *kkt_name = kkt_names[conf.kkt_solver];
+        const bench_result res = run_benchmark (conf, repetitions);
+
+        // the varied parameters
+        char params[128] = "-";
+        if (string(conf.sweep) == "gains")
+        {
+            sprintf (params, "%g/%g/%g/%g",
+                    conf.gain_position, conf.gain_velocity, conf.gain_acceleration, conf.gain_jerk);
+        }
+        else if (string(conf.sweep) == "tol")
+        {
+            sprintf (params, "%g/%g", conf.tol, conf.tol_out);
+        }
+
+        printf ("%-8s %-3s %-4s init_%02d %4d %-22s %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f %7.2f %5u %5u\n",
+                conf.sweep, solver_name, kkt_name, conf.scenario, res.N, params,
+                res.latency.min, res.latency.median, res.latency.p99, res.latency.p999, res.latency.max, res.latency.mean,
+                res.iter_mean, res.iter_max, res.capped + res.nonfinite);
+
+        fprintf (csv, "%s,%s,%s,init_%02d,%d,%g,%g,%g,%g,%g,%g,%u,%u,%u,%f,%f,%f,%f,%f,%f,%f,%u\n",
+                conf.sweep, solver_name, kkt_name, conf.scenario, res.N,
+                conf.gain_position, conf.gain_velocity, conf.gain_acceleration, conf.gain_jerk,
+                conf.tol, conf.tol_out,
+                res.latency.num_samples, res.capped, res.nonfinite, res.latency.min, res.latency.median, res.latency.p99, res.latency.p999, res.latency.max, res.latency.mean,
+                res.iter_mean, res.iter_max);
+
+        fprintf (json,
+                "    {\"sweep\": \"%s\", \"solver\": \"%s\", \"kkt\": \"%s\", \"scenario\": \"init_%02d\", \"N\": %d, "
+                "\"gains\": [%g, %g, %g, %g], \"tol\": %g, \"tol_out\": %g, "
+                "\"samples\": %u, \"capped\": %u, \"nonfinite\": %u, \"min_us\": %f, \"median_us\": %f, \"p99_us\": %f, "
+                "\"p999_us\": %f, \"max_us\": %f, \"mean_us\": %f, "
+                "\"iter_mean\": %f, \"iter_max\": %u}%s\n",
+                conf.sweep, solver_name, kkt_name, conf.scenario, res.N,
+                conf.gain_position, conf.gain_velocity, conf.gain_acceleration, conf.gain_jerk,
+                conf.tol, conf.tol_out,
+                res.latency.num_samples, res.capped, res.nonfinite, res.latency.min, res.latency.median, res.latency.p99, res.latency.p999, res.latency.max, res.latency.mean,
+                res.iter_mean, res.iter_max,
+                (i + 1 < configs.size()) ? "," : "");
+        fflush (stdout);
+    }
+
+    fprintf (json, "  ]\n}\n");
+    fclose (csv);
+    fclose (json);
+
+    cout << "Results: " << prefix << ".csv, " << prefix << ".json" << endl;
+
+    return 0;
+}
+///@}
@@ -0,0 +1,282 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Functions shared by the benchmarking tools (benchmark.cpp,
+ *  replay.cpp).
+ */
+
+
+#include <sys/time.h>
+#include <time.h>
+#include <vector>
+#include <algorithm>
+#include <cfloat> // DBL_MAX
+#include <cmath> // fabs
+
+#include "tests_common.h"
+
+///@addtogroup gTEST
+///@{
+
+
+/// The limit of the number of iterations of the primal-dual method (the
+/// same as the default limit of smpc#solver_ip), the runs, which reach it,
+/// are not converged.
+#define BENCH_IPD_MAX_ITER 100
+
+
+/// Solver types.
+enum benchSolverType
+{
+    BENCH_AS = 0,
+    BENCH_IP = 1,
+    /// IP solver with the primal-dual method.
+    BENCH_IPD = 2
+};
+
+
+/// Status of a solver run, see #get_run_status.
+enum benchRunStatus
+{
+    /// The solver converged, the solution is finite.
+    BENCH_RUN_OK = 0,
+    /// The solver stopped on the limit of the number of iterations.
+    BENCH_RUN_CAPPED = 1,
+    /// The solution contains NaN or infinity.
+    BENCH_RUN_NONFINITE = 2
+};
+
+
+/**
+ * @brief A configuration of a benchmark run.
+ */
+struct bench_config
+{
+    /// The name of the sweep, which the configuration belongs to.
+    const char *sweep;
+
+    /// Number of the test scenario (init_01 ... init_11).
+    int scenario;
+
+    /// Size of the preview window, 0 -- the default of the scenario.
+    int N;
+
+    /// Solver type.
+    benchSolverType solver;
+
+    //@{
+    /// Gains.
+    double gain_position;
+    double gain_velocity;
+    double gain_acceleration;
+    double gain_jerk;
+    //@}
+
+    //@{
+    /// Tolerances, tol_out is used only by IP and IPD.
+    double tol;
+    double tol_out;
+    //@}
+
+    /// Method used to solve the KKT systems.
+    smpc::kktSolverType kkt_solver;
+};
+
+
+/**
+ * @brief Distribution of latency, the time is given in microseconds.
+ */
+struct latency_stats
+{
+    unsigned int num_samples;
+
+    double min;
+    double median;
+    double p99;
+    double p999;
+    double max;
+    double mean;
+};
+
+
+
+/**
+ * @return current time [s] (monotonic if possible).
+ */
+double get_time()
+{
+#ifdef CLOCK_MONOTONIC
+    timespec ts;
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec + 1e-9 * ts.tv_nsec);
+#else
+    timeval tv;
+    gettimeofday (&tv, 0);
+    return (tv.tv_sec + 1e-6 * tv.tv_usec);
+#endif
+}
+
+
+/**
+ * @param[in] sorted sorted samples
+ * @param[in] p percentile [0, 1]
+ *
+ * @return percentile (nearest rank).
+ */
+double get_percentile (const vector<double> &sorted, const double p)
+{
+    size_t rank = static_cast<size_t> (ceil (p * sorted.size()));
+    if (rank > 0)
+    {
+        --rank;
+    }
+    return (sorted[min (rank, sorted.size() - 1)]);
+}
+
+
+/**
+ * @param[in,out] samples latency samples [microseconds], sorted on exit.
+ *
+ * @return distribution of the latency.
+ */
+latency_stats get_latency_stats (vector<double> &samples)
+{
+    latency_stats res;
+
+    res.num_samples = samples.size();
+    if (res.num_samples == 0)
+    {
+        res.min = res.median = res.p99 = res.p999 = res.max = res.mean = 0.0;
+        return (res);
+    }
+
+    double sum = 0.0;
+    for (unsigned int i = 0; i < res.num_samples; ++i)
+    {
+        sum += samples[i];
+    }
+    sort (samples.begin(), samples.end());
+
+    res.min = samples.front();
+    res.median = get_percentile (samples, 0.5);
+    res.p99 = get_percentile (samples, 0.99);
+    res.p999 = get_percentile (samples, 0.999);
+    res.max = samples.back();
+    res.mean = sum / res.num_samples;
+
+    return (res);
+}
+
+
+/**
+ * @brief Creates a solver.
+ *
+ * @param[in] conf configuration
+ * @param[in] N size of the preview window
+ *
+ * @return a new solver.
+ */
+smpc::solver * create_solver (const bench_config &conf, const int N)
+{
+    if (conf.solver == BENCH_AS)
+    {
+        return (new smpc::solver_as (
+                    N,
+                    conf.gain_position,
+                    conf.gain_velocity,
+                    conf.gain_acceleration,
+                    conf.gain_jerk,
+                    conf.tol,
+                    0, true, false, false, 1,
+                    conf.kkt_solver));
+    }
+    else
+    {
+        smpc::solver_ip_parameters ip_par;
+        ip_par.method = (conf.solver == BENCH_IPD) ? smpc::SMPC_IP_METHOD_PRIMAL_DUAL : smpc::SMPC_IP_METHOD_BARRIER;
+        ip_par.kkt_solver = conf.kkt_solver;
+
+        return (new smpc::solver_ip (
+                    N,
+                    conf.gain_position,
+                    conf.gain_velocity,
+                    conf.gain_acceleration,
+                    conf.gain_jerk,
+                    conf.tol,
+                    conf.tol_out,
+                    100, 15, 0.01, 0.5,
+                    (conf.solver == BENCH_IPD) ? BENCH_IPD_MAX_ITER : 0,
+                    smpc::SMPC_IP_BS_LOGBAR,
+                    false,
+                    ip_par));
+    }
+}
+
+
+/**
+ * @param[in] type solver type
+ * @param[in] solver solver
+ *
+ * @return the number of iterations made by the solver: the number of
+ *  changes of the active set for AS, the number of internal loop
+ *  iterations for IP (IPD).
+ */
+unsigned int get_iterations (const benchSolverType type, const smpc::solver &solver)
+{
+    if (type == BENCH_AS)
+    {
+        const smpc::solver_as &as = static_cast<const smpc::solver_as &> (solver);
+        return (as.added_constraints_num + as.removed_constraints_num);
+    }
+    else
+    {
+        return (static_cast<const smpc::solver_ip &> (solver).int_loop_iterations);
+    }
+}
+
+
+/**
+ * @brief Checks the result of a run of a solver created by #create_solver.
+ *
+ * @param[in] type solver type
+ * @param[in] solver solver
+ * @param[in] N size of the preview window
+ * @param[in] X solution
+ *
+ * @return status of the run: the limit of the number of iterations is
+ *  reached by AS, if 2*N constraints are added, and by IPD after
+ *  #BENCH_IPD_MAX_ITER iterations (IP is not limited).
+ */
+benchRunStatus get_run_status (
+        const benchSolverType type,
+        const smpc::solver &solver,
+        const int N,
+        const double *X)
+{
+    for (int i = 0; i < N*SMPC_NUM_VAR; ++i)
+    {
+        // false for NaN and infinity
+        if (!(fabs (X[i]) <= DBL_MAX))
+        {
+            return (BENCH_RUN_NONFINITE);
+        }
+    }
+
+    if (type == BENCH_AS)
+    {
+        if (static_cast<const smpc::solver_as &> (solver).added_constraints_num >= static_cast<unsigned int>(2*N))
+        {
+            return (BENCH_RUN_CAPPED);
+        }
+    }
+    else if (type == BENCH_IPD)
+    {
+        if (static_cast<const smpc::solver_ip &> (solver).int_loop_iterations >= BENCH_IPD_MAX_ITER)
+        {
+            return (BENCH_RUN_CAPPED);
+        }
+    }
+
+    return (BENCH_RUN_OK);
+}
+///@}
@@ -0,0 +1,92 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Converts text reference data (one value per line, see test/data)
+ *  to the binary format described in reference_data.h.
+ *
+ *  Usage: convert_reference.a <input.dat> <output.ref> <N> <tolerance>
+ */
+
+
+#include <cstdlib>
+#include <vector>
+
+#include "tests_common.h"
+#include "reference_data.h"
+
+///@addtogroup gTEST
+///@{
+
+int main(int argc, char **argv)
+{
+    if (argc != 5)
+    {
+        cout << "Usage: " << argv[0] << " <input.dat> <output.ref> <N> <tolerance>" << endl;
+        return (1);
+    }
+
+    const int N = atoi (argv[3]);
+    const double tolerance = atof (argv[4]);
+    if (N <= 0)
+    {
+        cout << "Wrong N: " << argv[3] << endl;
+        return (1);
+    }
+
+
+    // the values are parsed in the same way as the tests used to do it,
+    // hence the binary data is identical to the values they obtained.
+    ifstream in_file (argv[1]);
+    if (!in_file.is_open())
+    {
+        cout << "Cannot open " << argv[1] << endl;
+        return (1);
+    }
+    vector<double> values;
+    double value;
+    while (in_file >> value)
+    {
+        values.push_back (value);
+    }
+    in_file.close();
+
+    const size_t step_size = N * SMPC_NUM_VAR;
+    if ((values.size() == 0) || (values.size() % step_size != 0))
+    {
+        cout << "The number of values (" << values.size()
+             << ") is not a multiple of N*SMPC_NUM_VAR (" << step_size << ")" << endl;
+        return (1);
+    }
+
+
+    reference_header header;
+    memset (&header, 0, sizeof(header));
+    strncpy (header.magic, REFERENCE_MAGIC, sizeof(header.magic));
+    header.version = REFERENCE_VERSION;
+    header.byte_order = REFERENCE_BYTE_ORDER;
+    header.N = N;
+    header.num_steps = values.size() / step_size;
+    header.tolerance = tolerance;
+
+    FILE *out_file = fopen (argv[2], "wb");
+    if (out_file == NULL)
+    {
+        cout << "Cannot open " << argv[2] << endl;
+        return (1);
+    }
+    const bool ok = (fwrite (&header, sizeof(header), 1, out_file) == 1)
+        && (fwrite (&values[0], sizeof(double), values.size(), out_file) == values.size());
+    fclose (out_file);
+    if (!ok)
+    {
+        cout << "Cannot write " << argv[2] << endl;
+        return (1);
+    }
+
+    cout << argv[2] << ": N = " << header.N
+         << ", steps = " << header.num_steps
+         << ", tolerance = " << header.tolerance << endl;
+
+    return 0;
+}
+///@}
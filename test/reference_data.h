@@ -0,0 +1,209 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Binary reference data used by the regression tests. The files
+ *  are produced from the text data by convert_reference.cpp and are
+ *  mapped to memory, so that the values are accessed without parsing.
+ *
+ *  Format (native byte order): reference_header followed by
+ *  num_steps * N * SMPC_NUM_VAR doubles, i.e. the solution for each
+ *  preview window.
+ */
+
+
+#ifndef REFERENCE_DATA_H
+#define REFERENCE_DATA_H
+
+#include <cstdio>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define REFERENCE_USE_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "smpc_solver.h"
+
+///@addtogroup gTEST
+///@{
+
+/// The first bytes of a reference file.
+#define REFERENCE_MAGIC "SMPCREF"
+/// The version of the format.
+#define REFERENCE_VERSION 1
+/// Used to detect files with a different byte order.
+#define REFERENCE_BYTE_ORDER 0x01020304
+
+
+/**
+ * @brief Header of a reference file.
+ */
+struct reference_header
+{
+    /// #REFERENCE_MAGIC
+    char magic[8];
+    /// #REFERENCE_VERSION
+    unsigned int version;
+    /// #REFERENCE_BYTE_ORDER
+    unsigned int byte_order;
+    /// Size of the preview window.
+    unsigned int N;
+    /// The number of preview windows (steps of the simulation).
+    unsigned int num_steps;
+    /// Maximal acceptable error.
+    double tolerance;
+};
+
+
+/**
+ * @brief Read-only access to a reference file.
+ */
+class reference_data
+{
+    public:
+        reference_data()
+        {
+            header = NULL;
+            data = NULL;
+            mem = NULL;
+            size = 0;
+        }
+
+        ~reference_data()
+        {
+            close();
+        }
+
+
+        /**
+         * @brief Maps a reference file to memory and checks the header.
+         *
+         * @param[in] filename name of the file
+         * @param[in] N expected size of the preview window
+         *
+         * @return true on success.
+         */
+        bool open (const char *filename, const unsigned int N)
+        {
+            close();
+
+#ifdef REFERENCE_USE_MMAP
+            int fd = ::open (filename, O_RDONLY);
+            if (fd < 0)
+            {
+                return (false);
+            }
+            struct stat st;
+            if (fstat (fd, &st) != 0)
+            {
+                ::close (fd);
+                return (false);
+            }
+            size = st.st_size;
+            void *ptr = (size > 0) ? mmap (NULL, size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+            ::close (fd);
+            if (ptr == MAP_FAILED)
+            {
+                size = 0;
+                return (false);
+            }
+            mem = static_cast<char *> (ptr);
+#else
+            FILE *file = fopen (filename, "rb");
+            if (file == NULL)
+            {
+                return (false);
+            }
+            fseek (file, 0, SEEK_END);
+            size = ftell (file);
+            fseek (file, 0, SEEK_SET);
+            mem = new char[size];
+            const bool read_ok = (fread (mem, 1, size, file) == size);
+            fclose (file);
+            if (!read_ok)
+            {
+                close();
+                return (false);
+            }
+#endif
+
+            header = reinterpret_cast<const reference_header *> (mem);
+            if ((size < sizeof(reference_header))
+                    || (strncmp (header->magic, REFERENCE_MAGIC, sizeof(header->magic)) != 0)
+                    || (header->version != REFERENCE_VERSION)
+                    || (header->byte_order != REFERENCE_BYTE_ORDER)
+                    || (header->N != N)
+                    || (size != sizeof(reference_header) + get_step_size() * header->num_steps * sizeof(double)))
+            {
+                close();
+                return (false);
+            }
+            data = reinterpret_cast<const double *> (mem + sizeof(reference_header));
+
+            return (true);
+        }
+
+
+        /**
+         * @brief Unmaps the file.
+         */
+        void close()
+        {
+            if (mem != NULL)
+            {
+#ifdef REFERENCE_USE_MMAP
+                munmap (mem, size);
+#else
+                delete [] mem;
+#endif
+            }
+            header = NULL;
+            data = NULL;
+            mem = NULL;
+            size = 0;
+        }
+
+
+        /// @return the number of values for one step.
+        size_t get_step_size() const
+        {
+            return (header->N * SMPC_NUM_VAR);
+        }
+
+
+        /**
+         * @param[in] step the number of a step
+         *
+         * @return the reference solution for the given step, NULL if
+         *  there is no data for this step.
+         */
+        const double * get_step (const unsigned int step) const
+        {
+            if ((data == NULL) || (step >= header->num_steps))
+            {
+                return (NULL);
+            }
+            return (&data[step * get_step_size()]);
+        }
+
+
+        /// Header of the file, NULL if no file is opened.
+        const reference_header *header;
+
+
+    private:
+        /// Reference solutions.
+        const double *data;
+
+        /// Memory containing the file.
+        char *mem;
+
+        /// Size of the file.
+        size_t size;
+};
+///@}
+
+#endif /*REFERENCE_DATA_H*/
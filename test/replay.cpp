@@ -0,0 +1,155 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Feeds the inputs recorded by smpc::input_recorder to a solver and
+ *  measures the time required to form and solve each QP. The distribution
+ *  of latency and the slowest ticks are reported. The solver is created
+ *  with the parameters stored in the log, see smpc::input_log_config.
+ *
+ *  Usage: replay.a <log_file> [repetitions [output_prefix]]
+ *
+ *  The latency of each tick (minimum and maximum over repetitions) and
+ *  the number of iterations are written to <output_prefix>.csv (the
+ *  default prefix is 'replay').
+ */
+
+
+#include <cstdlib>
+
+#include "benchmark_common.h"
+#include "smpc_input_log.h"
+
+///@addtogroup gTEST
+///@{
+
+/// The number of slowest ticks, which are reported.
+#define REPLAY_NUM_SLOWEST 10
+
+
+/**
+ * @param[in] config parameters of the solver stored in the log
+ *
+ * @return solver type.
+ */
+benchSolverType get_solver_type (const smpc::input_log_config &config)
+{
+    if (config.solver_type == smpc::SMPC_INPUT_LOG_SOLVER_AS)
+    {
+        return (BENCH_AS);
+    }
+    return ((config.ip_par.method == smpc::SMPC_IP_METHOD_PRIMAL_DUAL) ? BENCH_IPD : BENCH_IP);
+}
+
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        cout << "Usage: " << argv[0] << " <log_file> [repetitions [output_prefix]]" << endl;
+        return (1);
+    }
+
+    const char *log_file = argv[1];
+    const int repetitions = (argc > 2) ? atoi (argv[2]) : 1;
+    const string prefix = (argc > 3) ? argv[3] : "replay";
+    const char *solver_names[3] = {"AS", "IP", "IPD"};
+    const char *kkt_names[4] = {"chol", "ric", "cnd", "auto"};
+
+
+    vector<double> samples;
+    vector<double> tick_min;
+    vector<double> tick_max;
+    vector<unsigned int> tick_iter;
+    int N = 0;
+    smpc::input_log_config config;
+
+    for (int rep = 0; rep < repetitions; ++rep)
+    {
+        smpc::input_log_reader log;
+        if (!log.open (log_file))
+        {
+            cout << "Cannot read the log: " << log_file << endl;
+            return (1);
+        }
+        N = log.N;
+        config = log.config;
+
+        smpc::solver *solver = config.create_solver (N);
+        vector<double> X (N*SMPC_NUM_VAR);
+
+        for (unsigned int tick = 0; log.read(); ++tick)
+        {
+            double start = get_time();
+            log.apply (*solver, &X[0]);
+            solver->solve();
+            double end = get_time();
+
+            const double latency = (end - start) * 1e6;
+            samples.push_back (latency);
+
+            if (rep == 0)
+            {
+                tick_min.push_back (latency);
+                tick_max.push_back (latency);
+                tick_iter.push_back (get_iterations (get_solver_type (config), *solver));
+            }
+            else if (tick < tick_min.size())
+            {
+                tick_min[tick] = min (tick_min[tick], latency);
+                tick_max[tick] = max (tick_max[tick], latency);
+            }
+        }
+
+        delete solver;
+    }
+
+
+    const latency_stats res = get_latency_stats (samples);
+
+    const smpc::kktSolverType kkt_solver = (config.solver_type == smpc::SMPC_INPUT_LOG_SOLVER_AS)
+        ? config.kkt_solver : config.ip_par.kkt_solver;
+    printf("Solver: %s (%s), N = %d, ticks = %u, repetitions = %d, time is given in microseconds.\n",
+            solver_names[get_solver_type (config)], kkt_names[kkt_solver],
+            N, static_cast<unsigned int> (tick_min.size()), repetitions);
+    printf("Gains: %g/%g/%g/%g, tol = %g, tol_out = %g, t = %g, mu = %g\n",
+            config.gain_position, config.gain_velocity, config.gain_acceleration, config.gain_jerk,
+            config.tol, config.tol_out, config.t, config.mu);
+    printf("min = %.1f, median = %.1f, p99 = %.1f, p99.9 = %.1f, max = %.1f, mean = %.1f\n",
+            res.min, res.median, res.p99, res.p999, res.max, res.mean);
+
+
+    // ticks sorted by the maximal latency
+    vector< pair<double, unsigned int> > slowest;
+    for (unsigned int i = 0; i < tick_max.size(); ++i)
+    {
+        slowest.push_back (make_pair (tick_max[i], i));
+    }
+    sort (slowest.rbegin(), slowest.rend());
+
+    printf("Slowest ticks:\n");
+    for (unsigned int i = 0; (i < slowest.size()) && (i < REPLAY_NUM_SLOWEST); ++i)
+    {
+        const unsigned int tick = slowest[i].second;
+        printf("    tick %5u: min = %9.1f, max = %9.1f, iterations = %u\n",
+                tick, tick_min[tick], tick_max[tick], tick_iter[tick]);
+    }
+
+
+    FILE *csv = fopen ((prefix + ".csv").c_str(), "w");
+    if (csv == NULL)
+    {
+        cout << "Cannot open the output file." << endl;
+        return (1);
+    }
+    fprintf (csv, "tick,min_us,max_us,iterations\n");
+    for (unsigned int i = 0; i < tick_min.size(); ++i)
+    {
+        fprintf (csv, "%u,%f,%f,%u\n", i, tick_min[i], tick_max[i], tick_iter[i]);
+    }
+    fclose (csv);
+
+    cout << "Results: " << prefix << ".csv" << endl;
+
+    return 0;
+}
+///@}
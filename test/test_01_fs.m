@@ -0,0 +1,167 @@
+%
+% Footsteps generated using the c++ version of the WMG
+%
+
+cla;
+clear FS;
+
+FS(1).a = 0.000000;
+FS(1).p = [0.000000;0.050000];
+FS(1).d = [0.090000;0.075000;0.030000;0.025000];
+FS(1).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(1).v = [0.090000 -0.025000; 0.090000 0.075000; -0.030000 0.075000; -0.030000 -0.025000; 0.090000 -0.025000];
+FS(1).type = 1;
+
+FS(2).a = 0.000000;
+FS(2).p = [0.000000;-0.050000];
+FS(2).d = [0.090000;-0.025000;0.030000;0.075000];
+FS(2).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(2).v = [0.090000 -0.075000; 0.090000 -0.025000; -0.030000 -0.025000; -0.030000 -0.075000; 0.090000 -0.075000];
+FS(2).type = 2;
+
+FS(3).a = 0.087266;
+FS(3).p = [0.035000;0.050000];
+FS(3).d = [0.129225;0.071759;-0.009225;-0.021759];
+FS(3).D = [0.996195 0.087156;-0.087156 0.996195;-0.996195 -0.087156;0.087156 -0.996195];
+FS(3).v = [0.126836 0.032939; 0.122479 0.082749; 0.002935 0.072290; 0.007293 0.022480; 0.126836 0.032939];
+FS(3).type = 2;
+
+FS(4).a = 0.174533;
+FS(4).p = [0.078582;-0.046569];
+FS(4).d = [0.159302;-0.034507;-0.039302;0.084507];
+FS(4).D = [0.984808 0.173648;-0.173648 0.984808;-0.984808 -0.173648;0.173648 -0.984808];
+FS(4).v = [0.171556 -0.055561; 0.162874 -0.006320; 0.044697 -0.027158; 0.053379 -0.076399; 0.171556 -0.055561];
+FS(4).type = 2;
+
+FS(5).a = 0.261799;
+FS(5).p = [0.095686;0.057989];
+FS(5).d = [0.197434;0.056248;-0.077434;-0.006248];
+FS(5).D = [0.965926 0.258819;-0.258819 0.965926;-0.965926 -0.258819;0.258819 -0.965926];
+FS(5).v = [0.189090 0.057135; 0.176149 0.105431; 0.060238 0.074373; 0.073179 0.026077; 0.189090 0.057135];
+FS(5).type = 2;
+
+FS(6).a = 0.349066;
+FS(6).p = [0.155375;-0.029544];
+FS(6).d = [0.225900;-0.055904;-0.105900;0.105904];
+FS(6).D = [0.939693 0.342020;-0.342020 0.939693;-0.939693 -0.342020;0.342020 -0.939693];
+FS(6).v = [0.248498 -0.022255; 0.231397 0.024730; 0.118634 -0.016313; 0.135735 -0.063297; 0.248498 -0.022255];
+FS(6).type = 2;
+
+FS(7).a = 0.436332;
+FS(7).p = [0.154062;0.076395];
+FS(7).d = [0.261914;0.029128;-0.141914;0.020872];
+FS(7).D = [0.906308 0.422618;-0.422618 0.906308;-0.906308 -0.422618;0.422618 -0.906308];
+FS(7).v = [0.246196 0.091773; 0.225065 0.137089; 0.116308 0.086375; 0.137439 0.041059; 0.246196 0.091773];
+FS(7).type = 2;
+
+FS(8).a = 0.523599;
+FS(8).p = [0.228045;0.000556];
+FS(8).d = [0.287771;-0.088541;-0.167771;0.138541];
+FS(8).D = [0.866025 0.500000;-0.500000 0.866025;-0.866025 -0.500000;0.500000 -0.866025];
+FS(8).v = [0.318487 0.023906; 0.293487 0.067207; 0.189564 0.007207; 0.214564 -0.036094; 0.318487 0.023906];
+FS(8).type = 2;
+
+FS(9).a = 0.610865;
+FS(9).p = [0.208356;0.104659];
+FS(9).d = [0.320705;-0.008776;-0.200705;0.058776];
+FS(9).D = [0.819152 0.573576;-0.573576 0.819152;-0.819152 -0.573576;0.573576 -0.819152];
+FS(9).v = [0.296419 0.135802; 0.267740 0.176760; 0.169442 0.107930; 0.198121 0.066973; 0.296419 0.135802];
+FS(9).type = 2;
+
+FS(10).a = 0.698132;
+FS(10).p = [0.294384;0.042819];
+FS(10).d = [0.343035;-0.131425;-0.223035;0.181425];
+FS(10).D = [0.766044 0.642788;-0.642788 0.766044;-0.766044 -0.642788;0.642788 -0.766044];
+FS(10).v = [0.379398 0.081519; 0.347258 0.119821; 0.255333 0.042686; 0.287472 0.004384; 0.379398 0.081519];
+FS(10).type = 2;
+
+FS(11).a = 0.698132;
+FS(11).p = [0.256917;0.141921];
+FS(11).d = [0.378035;-0.031425;-0.258035;0.081425];
+FS(11).D = [0.766044 0.642788;-0.642788 0.766044;-0.766044 -0.642788;0.642788 -0.766044];
+FS(11).v = [0.341930 0.180621; 0.309791 0.218923; 0.217866 0.141788; 0.250005 0.103486; 0.341930 0.180621];
+FS(11).type = 2;
+
+FS(12).a = 0.698132;
+FS(12).p = [0.321195;0.065316];
+FS(12).d = [0.378035;-0.131425;-0.258035;0.181425];
+FS(12).D = [0.766044 0.642788;-0.642788 0.766044;-0.766044 -0.642788;0.642788 -0.766044];
+FS(12).v = [0.406209 0.104016; 0.374070 0.142318; 0.282144 0.065184; 0.314284 0.026882; 0.406209 0.104016];
+FS(12).type = 2;
+
+hold on
+for i=1:length(FS)
+    if FS(i).type == 1;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','r','MarkerSize',2)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'c');
+    end
+    if FS(i).type == 2;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','g','MarkerSize',4)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'r');
+    end
+end
+grid on; %axis equal
+
+
+CoM_ZMP = [
+1.1056638502954e-05 -0.000543260896171713 -0.00016544382934754 0.00812897726291897;
+0.000112092885316175 -0.00376602220185968 -0.000618276972281258 0.0043187014237808;
+0.000509739994653191 -0.00963400050933186 -0.00112716910517204 -0.00841873332602472;
+0.00153638576576997 -0.0157323939352256 -0.00122650404612649 -0.0250000000000001;
+0.00360558727406497 -0.0186704226708198 -0.000348577247228766 -0.0332651239539572;
+0.00715372903110842 -0.0162554199889277 0.00212450598487572 -0.0340610699514097;
+0.0125727019832703 -0.00735943610713825 0.00677911392337462 -0.024999999999999;
+0.0201361386017479 0.00600266409773501 0.0141069911408708 0.023076602639296;
+0.0298043564156979 0.0147984948762433 0.0261152748684451 0.0370360459044474;
+0.0408462976010507 0.0155319911904804 0.0397026091753232 0.0382093344793455;
+0.052315540938961 0.0080302018460569 0.0537582225611307 0.0265456358834111;
+0.0630892442710638 -0.00437941850806895 0.0695653218971568 -0.0227733056814611;
+0.0718237058047467 -0.0118826915941164 0.0770297478915129 -0.0351440837861196;
+0.0786627544404835 -0.0109528138894022 0.0816195583978216 -0.0341342971764517;
+0.0844216774046906 -0.00159690565098876 0.0846307925937729 -0.0201168567205746;
+0.090388699605471 0.0128540430781874 0.0832734837758449 0.0287816567544727;
+0.098533528989831 0.0231300192146039 0.0920202817116506 0.044585867059762;
+0.109046968459317 0.0256394125286076 0.104404333510687 0.0478687204165866;
+0.121239461992046 0.0200811915431561 0.119520000715722 0.0384938816969545;
+0.133564041815368 0.00958394445308422 0.142975988423104 -0.00745295504034686;
+0.143079993359954 0.00358405133061231 0.151986651737467 -0.0184736638185711;
+0.149357095441263 0.0055805465754487 0.156021249874859 -0.0168004617665479;
+0.153206735250713 0.015712148936829 0.156393774304301 -0.00256928036983396;
+0.156463478418874 0.030926752014781 0.146515756356577 0.0452919982547397;
+0.162656158290957 0.0424378352322563 0.15239276102028 0.0623786883608275;
+0.172576672309636 0.0467338693959077 0.164069438362255 0.0677812230605124;
+0.185582662893278 0.0433915022072004 0.180620599411769 0.0611953477515499;
+0.199606593850798 0.0352234727260419 0.211712391352298 0.019994245038711;
+0.210132420199005 0.0310315787868081 0.222512596612139 0.0106723885519537;
+0.216169972343815 0.034223747358443 0.226191149133821 0.0130157105823196;
+0.218562121956767 0.0451248676638374 0.224289902653769 0.0272558745743509;
+0.219699532674485 0.0610824912842655 0.206797009956133 0.0730480071326207;
+0.224588502974392 0.0740695832799315 0.210583531747107 0.0914960086372411;
+0.234557283301485 0.0807444366116907 0.222389145540842 0.0998373961707167;
+0.24891729110152 0.0804874179630757 0.241496319766576 0.0973447254325672;
+0.264915302043222 0.075539182587611 0.280619385084029 0.0639043060378786;
+0.276309818649022 0.0734482553393013 0.294401431623157 0.0575183793784826;
+0.281109124994739 0.0770960274034195 0.29831992815412 0.0608418132677527;
+0.27963356896871 0.0865920984574483 0.292866271126296 0.0741806635990148;
+0.274431077412919 0.0992251974241019 0.263783665822991 0.11504782468195;
+0.271991709656201 0.107392070372854 0.257240072111808 0.127808714283702;
+0.274912989068119 0.108108015257287 0.258993317134448 0.129560232832379;
+0.283630323126143 0.100986348396349 0.269536473320569 0.119875003331402;
+0.296486888038761 0.0881453914031543 0.302706163901193 0.0824373139972549;
+0.308170387325851 0.0760605162755428 0.316113135410274 0.0679346072382987;
+0.316981149357478 0.0668929803119828 0.324849255694076 0.0585343255600041;
+0.322899235232298 0.0607868782174035 0.329660727056942 0.0534768105558985;
+0.326304213473421 0.0573912864716068 0.331507637844045 0.0517215145587627;
+0.327756847078549 0.0561194910573855 0.331347526272643 0.0522058425451388;
+0.327848400627479 0.0563295902886901 0.330009592487666 0.0539980233769848;
+0.327109005792 0.0574359646640056 0.328138239789017 0.0563683693498626;
+0.325962416285802 0.058966078918627 0.32618446024533 0.058803739105318;
+0.324713719784899 0.0605781320396584 0.324426274819391 0.0609870716753505;
+0.323557870463279 0.0620536823795111 0.323003458733193 0.0627592988725319;
+0.322599240695299 0.0632767348702307 0.321956057137717 0.0640760288724748;
+0.321875030680603 0.0642077452065664 0.321260063148226 0.0649669100314268;
+0.321377850668301 0.0648581268360192 0.320856755693327 0.0655019345432928;
+0.321074848306382 0.065268445030766 0.320674479117851 0.0657662546647765;
+0.320922299112886 0.0654916659656482 0.320643141364397 0.0658433099256758;];
+plot (CoM_ZMP(:,1), CoM_ZMP(:,2), 'b');
+plot (CoM_ZMP(:,3), CoM_ZMP(:,4), 'ks','MarkerSize',5);
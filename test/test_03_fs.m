@@ -0,0 +1,103 @@
+%
+% Footsteps generated using the c++ version of the WMG
+%
+
+cla;
+clear FS;
+
+FS(1).a = 0.000000;
+FS(1).p = [0.000000;0.050000];
+FS(1).d = [0.090000;0.075000;0.030000;0.025000];
+FS(1).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(1).v = [0.090000 -0.025000; 0.090000 0.075000; -0.030000 0.075000; -0.030000 -0.025000; 0.090000 -0.025000];
+FS(1).type = 1;
+
+FS(2).a = 0.000000;
+FS(2).p = [0.000000;-0.050000];
+FS(2).d = [0.090000;-0.025000;0.030000;0.075000];
+FS(2).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(2).v = [0.090000 -0.075000; 0.090000 -0.025000; -0.030000 -0.025000; -0.030000 -0.075000; 0.090000 -0.075000];
+FS(2).type = 2;
+
+FS(3).a = 0.087266;
+FS(3).p = [0.035000;0.050000];
+FS(3).d = [0.129225;0.071759;-0.009225;-0.021759];
+FS(3).D = [0.996195 0.087156;-0.087156 0.996195;-0.996195 -0.087156;0.087156 -0.996195];
+FS(3).v = [0.126836 0.032939; 0.122479 0.082749; 0.002935 0.072290; 0.007293 0.022480; 0.126836 0.032939];
+FS(3).type = 2;
+
+FS(4).a = 0.174533;
+FS(4).p = [0.078582;-0.046569];
+FS(4).d = [0.159302;-0.034507;-0.039302;0.084507];
+FS(4).D = [0.984808 0.173648;-0.173648 0.984808;-0.984808 -0.173648;0.173648 -0.984808];
+FS(4).v = [0.171556 -0.055561; 0.162874 -0.006320; 0.044697 -0.027158; 0.053379 -0.076399; 0.171556 -0.055561];
+FS(4).type = 2;
+
+FS(5).a = 0.261799;
+FS(5).p = [0.095686;0.057989];
+FS(5).d = [0.197434;0.056248;-0.077434;-0.006248];
+FS(5).D = [0.965926 0.258819;-0.258819 0.965926;-0.965926 -0.258819;0.258819 -0.965926];
+FS(5).v = [0.189090 0.057135; 0.176149 0.105431; 0.060238 0.074373; 0.073179 0.026077; 0.189090 0.057135];
+FS(5).type = 2;
+
+FS(6).a = 0.349066;
+FS(6).p = [0.155375;-0.029544];
+FS(6).d = [0.225900;-0.055904;-0.105900;0.105904];
+FS(6).D = [0.939693 0.342020;-0.342020 0.939693;-0.939693 -0.342020;0.342020 -0.939693];
+FS(6).v = [0.248498 -0.022255; 0.231397 0.024730; 0.118634 -0.016313; 0.135735 -0.063297; 0.248498 -0.022255];
+FS(6).type = 2;
+
+FS(7).a = 0.436332;
+FS(7).p = [0.154062;0.076395];
+FS(7).d = [0.261914;0.029128;-0.141914;0.020872];
+FS(7).D = [0.906308 0.422618;-0.422618 0.906308;-0.906308 -0.422618;0.422618 -0.906308];
+FS(7).v = [0.246196 0.091773; 0.225065 0.137089; 0.116308 0.086375; 0.137439 0.041059; 0.246196 0.091773];
+FS(7).type = 2;
+
+FS(8).a = 0.523599;
+FS(8).p = [0.228045;0.000556];
+FS(8).d = [0.287771;-0.088541;-0.167771;0.138541];
+FS(8).D = [0.866025 0.500000;-0.500000 0.866025;-0.866025 -0.500000;0.500000 -0.866025];
+FS(8).v = [0.318487 0.023906; 0.293487 0.067207; 0.189564 0.007207; 0.214564 -0.036094; 0.318487 0.023906];
+FS(8).type = 2;
+
+FS(9).a = 0.610865;
+FS(9).p = [0.208356;0.104659];
+FS(9).d = [0.320705;-0.008776;-0.200705;0.058776];
+FS(9).D = [0.819152 0.573576;-0.573576 0.819152;-0.819152 -0.573576;0.573576 -0.819152];
+FS(9).v = [0.296419 0.135802; 0.267740 0.176760; 0.169442 0.107930; 0.198121 0.066973; 0.296419 0.135802];
+FS(9).type = 2;
+
+FS(10).a = 0.698132;
+FS(10).p = [0.294384;0.042819];
+FS(10).d = [0.343035;-0.131425;-0.223035;0.181425];
+FS(10).D = [0.766044 0.642788;-0.642788 0.766044;-0.766044 -0.642788;0.642788 -0.766044];
+FS(10).v = [0.379398 0.081519; 0.347258 0.119821; 0.255333 0.042686; 0.287472 0.004384; 0.379398 0.081519];
+FS(10).type = 2;
+
+FS(11).a = 0.698132;
+FS(11).p = [0.256917;0.141921];
+FS(11).d = [0.378035;-0.031425;-0.258035;0.081425];
+FS(11).D = [0.766044 0.642788;-0.642788 0.766044;-0.766044 -0.642788;0.642788 -0.766044];
+FS(11).v = [0.341930 0.180621; 0.309791 0.218923; 0.217866 0.141788; 0.250005 0.103486; 0.341930 0.180621];
+FS(11).type = 2;
+
+FS(12).a = 0.698132;
+FS(12).p = [0.321195;0.065316];
+FS(12).d = [0.378035;-0.131425;-0.258035;0.181425];
+FS(12).D = [0.766044 0.642788;-0.642788 0.766044;-0.766044 -0.642788;0.642788 -0.766044];
+FS(12).v = [0.406209 0.104016; 0.374070 0.142318; 0.282144 0.065184; 0.314284 0.026882; 0.406209 0.104016];
+FS(12).type = 2;
+
+hold on
+for i=1:length(FS)
+    if FS(i).type == 1;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','r','MarkerSize',2)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'c');
+    end
+    if FS(i).type == 2;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','g','MarkerSize',4)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'r');
+    end
+end
+grid on; %axis equal
@@ -0,0 +1,192 @@
+%
+% Footsteps generated using the c++ version of the WMG
+%
+
+cla;
+clear FS;
+
+FS(1).a = 0.000000;
+FS(1).p = [0.000000;0.000000];
+FS(1).d = [0.090000;0.075000;0.030000;0.025000];
+FS(1).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(1).v = [0.090000 -0.025000; 0.090000 0.075000; -0.030000 0.075000; -0.030000 -0.025000; 0.090000 -0.025000];
+FS(1).type = 1;
+
+FS(2).a = 0.000000;
+FS(2).p = [0.000000;-0.025000];
+FS(2).d = [0.070000;0.000000;0.025000;0.050000];
+FS(2).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(2).v = [0.070000 -0.050000; 0.070000 0.000000; -0.025000 0.000000; -0.025000 -0.050000; 0.070000 -0.050000];
+FS(2).type = 1;
+
+FS(3).a = 0.000000;
+FS(3).p = [0.000000;-0.050000];
+FS(3).d = [0.090000;-0.025000;0.030000;0.075000];
+FS(3).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(3).v = [0.090000 -0.075000; 0.090000 -0.025000; -0.030000 -0.025000; -0.030000 -0.075000; 0.090000 -0.075000];
+FS(3).type = 2;
+
+FS(4).a = 0.043633;
+FS(4).p = [0.017500;0.000000];
+FS(4).d = [0.087483;0.024237;0.007517;0.025763];
+FS(4).D = [0.999048 0.043619;-0.043619 0.999048;-0.999048 -0.043619;0.043619 -0.999048];
+FS(4).v = [0.088524 -0.021923; 0.086343 0.028030; -0.008567 0.023886; -0.006386 -0.026067; 0.088524 -0.021923];
+FS(4).type = 1;
+
+FS(5).a = 0.087266;
+FS(5).p = [0.035000;0.050000];
+FS(5).d = [0.129225;0.071759;-0.009225;-0.021759];
+FS(5).D = [0.996195 0.087156;-0.087156 0.996195;-0.996195 -0.087156;0.087156 -0.996195];
+FS(5).v = [0.126836 0.032939; 0.122479 0.082749; 0.002935 0.072290; 0.007293 0.022480; 0.126836 0.032939];
+FS(5).type = 2;
+
+FS(6).a = 0.130900;
+FS(6).p = [0.056791;0.001715];
+FS(6).d = [0.126529;0.019288;-0.031529;0.030712];
+FS(6).D = [0.991445 0.130526;-0.130526 0.991445;-0.991445 -0.130526;0.130526 -0.991445];
+FS(6).v = [0.129455 -0.013934; 0.122929 0.035638; 0.028742 0.023238; 0.035268 -0.026334; 0.129455 -0.013934];
+FS(6).type = 1;
+
+FS(7).a = 0.174533;
+FS(7).p = [0.078582;-0.046569];
+FS(7).d = [0.159302;-0.034507;-0.039302;0.084507];
+FS(7).D = [0.984808 0.173648;-0.173648 0.984808;-0.984808 -0.173648;0.173648 -0.984808];
+FS(7).v = [0.171556 -0.055561; 0.162874 -0.006320; 0.044697 -0.027158; 0.053379 -0.076399; 0.171556 -0.055561];
+FS(7).type = 2;
+
+FS(8).a = 0.218166;
+FS(8).p = [0.087134;0.005710];
+FS(8).d = [0.156305;0.011716;-0.061305;0.038284];
+FS(8).D = [0.976296 0.216440;-0.216440 0.976296;-0.976296 -0.216440;0.216440 -0.976296];
+FS(8).v = [0.160886 -0.003546; 0.150064 0.045268; 0.057316 0.024707; 0.068138 -0.024108; 0.160886 -0.003546];
+FS(8).type = 1;
+
+FS(9).a = 0.261799;
+FS(9).p = [0.095686;0.057989];
+FS(9).d = [0.197434;0.056248;-0.077434;-0.006248];
+FS(9).D = [0.965926 0.258819;-0.258819 0.965926;-0.965926 -0.258819;0.258819 -0.965926];
+FS(9).v = [0.189090 0.057135; 0.176149 0.105431; 0.060238 0.074373; 0.073179 0.026077; 0.189090 0.057135];
+FS(9).type = 2;
+
+FS(10).a = 0.305433;
+FS(10).p = [0.125530;0.014222];
+FS(10).d = [0.193997;0.000816;-0.098997;0.049184];
+FS(10).D = [0.953717 0.300706;-0.300706 0.953717;-0.953717 -0.300706;0.300706 -0.953717];
+FS(10).v = [0.199808 0.011429; 0.184773 0.059115; 0.094170 0.030548; 0.109205 -0.017138; 0.199808 0.011429];
+FS(10).type = 1;
+
+FS(11).a = 0.349066;
+FS(11).p = [0.155375;-0.029544];
+FS(11).d = [0.225900;-0.055904;-0.105900;0.105904];
+FS(11).D = [0.939693 0.342020;-0.342020 0.939693;-0.939693 -0.342020;0.342020 -0.939693];
+FS(11).v = [0.248498 -0.022255; 0.231397 0.024730; 0.118634 -0.016313; 0.135735 -0.063297; 0.248498 -0.022255];
+FS(11).type = 2;
+
+FS(12).a = 0.392699;
+FS(12).p = [0.154719;0.023426];
+FS(12).d = [0.221906;-0.012566;-0.126906;0.062566];
+FS(12).D = [0.923880 0.382683;-0.382683 0.923880;-0.923880 -0.382683;0.382683 -0.923880];
+FS(12).v = [0.228957 0.027116; 0.209823 0.073310; 0.122055 0.036955; 0.141189 -0.009239; 0.228957 0.027116];
+FS(12).type = 1;
+
+FS(13).a = 0.436332;
+FS(13).p = [0.154062;0.076395];
+FS(13).d = [0.261914;0.029128;-0.141914;0.020872];
+FS(13).D = [0.906308 0.422618;-0.422618 0.906308;-0.906308 -0.422618;0.422618 -0.906308];
+FS(13).v = [0.246196 0.091773; 0.225065 0.137089; 0.116308 0.086375; 0.137439 0.041059; 0.246196 0.091773];
+FS(13).type = 2;
+
+FS(14).a = 0.479966;
+FS(14).p = [0.191054;0.038476];
+FS(14).d = [0.257233;-0.029090;-0.162233;0.079090];
+FS(14).D = [0.887011 0.461749;-0.461749 0.887011;-0.887011 -0.461749;0.461749 -0.887011];
+FS(14).v = [0.264688 0.048623; 0.241601 0.092974; 0.157335 0.049107; 0.180422 0.004757; 0.264688 0.048623];
+FS(14).type = 1;
+
+FS(15).a = 0.523599;
+FS(15).p = [0.228045;0.000556];
+FS(15).d = [0.287771;-0.088541;-0.167771;0.138541];
+FS(15).D = [0.866025 0.500000;-0.500000 0.866025;-0.866025 -0.500000;0.500000 -0.866025];
+FS(15).v = [0.318487 0.023906; 0.293487 0.067207; 0.189564 0.007207; 0.214564 -0.036094; 0.318487 0.023906];
+FS(15).type = 2;
+
+FS(16).a = 0.523599;
+FS(16).p = [0.218200;0.052608];
+FS(16).d = [0.285271;-0.038541;-0.190271;0.088541];
+FS(16).D = [0.866025 0.500000;-0.500000 0.866025;-0.866025 -0.500000;0.500000 -0.866025];
+FS(16).v = [0.291322 0.065957; 0.266322 0.109258; 0.184050 0.061758; 0.209050 0.018457; 0.291322 0.065957];
+FS(16).type = 1;
+
+FS(17).a = 0.523599;
+FS(17).p = [0.208356;0.104659];
+FS(17).d = [0.322771;0.011459;-0.202771;0.038541];
+FS(17).D = [0.866025 0.500000;-0.500000 0.866025;-0.866025 -0.500000;0.500000 -0.866025];
+FS(17).v = [0.298798 0.128008; 0.273798 0.171310; 0.169875 0.111310; 0.194875 0.068008; 0.298798 0.128008];
+FS(17).type = 2;
+
+FS(18).a = 0.523599;
+FS(18).p = [0.233356;0.061358];
+FS(18).d = [0.322771;-0.038541;-0.202771;0.138541];
+FS(18).D = [0.866025 0.500000;-0.500000 0.866025;-0.866025 -0.500000;0.500000 -0.866025];
+FS(18).v = [0.348798 0.041406; 0.298798 0.128008; 0.194875 0.068008; 0.244875 -0.018594; 0.348798 0.041406];
+FS(18).type = 1;
+
+hold on
+for i=1:length(FS)
+    if FS(i).type == 1;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','r','MarkerSize',2)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'c');
+    end
+    if FS(i).type == 2;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','g','MarkerSize',4)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'r');
+    end
+end
+grid on; %axis equal
+
+
+CoM_ZMP = [
+0.000139818177088442 -0.000490778662609615 -0.00209214171404533 0.00734366971321299;
+0.00107289180597376 -0.00327046351841631 -0.00266224556642964 0.00193024551167571;
+0.00337204530295581 -0.00760908303683007 -0.00126259183455967 -0.011360621542832;
+0.00738488097717119 -0.0104201158441338 0.00230253948327425 -0.025;
+0.0132883079799226 -0.00829641414125874 0.00807222933473095 -0.0249999999999998;
+0.0211314822136959 -0.00113569701608376 0.0161133659766415 -0.000148871579527622;
+0.0308453411641031 0.00566683970088241 0.0262715782717949 0.0241408661097253;
+0.0421928962089666 0.00660801266249759 0.0394268786542028 0.0252918057584636;
+0.0544808812369198 0.00173564832813268 0.0551063458108748 0.00132970545301784;
+0.0665598457880575 -0.00297153900203227 0.070160662199846 -0.0226683311233939;
+0.0775236733262456 -0.00150391675727832 0.0802962128531669 -0.020881160078876;
+0.0876429599459839 0.00613938197011239 0.0864336477943888 0.00476095398532513;
+0.0982154486608251 0.0142687739484709 0.0930455554882122 0.0314000754781811;
+0.110431841471505 0.0170757528596128 0.10607858753593 0.034892265890296;
+0.123965778011674 0.0143720663398903 0.125516337483359 0.0139431333268925;
+0.136929343322688 0.0118408267566887 0.144185367983732 -0.00701277687834839;
+0.147590240965044 0.0152358069616738 0.153773763981923 -0.00352288614064959;
+0.15629795402501 0.0245973543247792 0.155487114116222 0.0232396124322448;
+0.165280822547907 0.0344618318187346 0.157948269207505 0.0506230665490825;
+0.176528104882192 0.03928417307867 0.1705216349249 0.056486123271888;
+0.189504534820042 0.0387531239650931 0.193260061290479 0.0392418797453714;
+0.201074650671436 0.0380520964368346 0.214508432273906 0.0216085400174665;
+0.208202316595232 0.0424914854263062 0.221627836871046 0.025718930178095;
+0.210807817735744 0.0523128193096006 0.215860640561383 0.0499329809855818;
+0.211533883389439 0.062996156214312 0.207899069490539 0.0755276495542801;
+0.213024669542608 0.0700350555330362 0.21030363745858 0.0804661810441788;
+0.215469819449936 0.0732868654439522 0.214753964141517 0.079485324826289;
+0.218267714384912 0.0740707922017848 0.218221192031879 0.0782413950912325;
+0.221091295866736 0.0732730475579954 0.221583198463304 0.0756408760565897;
+0.223741205593707 0.0715613208470766 0.224592492362696 0.0725095764110167;
+0.2260822055485 0.0694667405460011 0.227116376092395 0.0694174975611128;
+0.228043665784962 0.0673664304877063 0.229114404270624 0.0667066127125159;
+0.22960926518989 0.0654944710463876 0.230611387004909 0.064537755099573;
+0.230802214869025 0.0639678107339623 0.23167170951668 0.0629423777617829;
+0.231670168196014 0.0628173599716899 0.232378082953081 0.0618702608598268;
+0.232272208772861 0.0620179167976924 0.232815900833139 0.0612285058173386;
+0.232668978055015 0.0615133928584129 0.233063102880371 0.0609102508604118;
+0.232916103080617 0.0612359107331945 0.233184728291411 0.0608135524902679;
+0.233060548033305 0.0611187549853565 0.233231035455319 0.0608519914537612;
+0.233139257343166 0.0611039833478022 0.233238040412376 0.0609590071676241;
+0.233179397608715 0.0611458782573626 0.233229467241093 0.0610879612621491;
+0.233199565981709 0.061211481257048 0.233219321750375 0.0612096659977377;];
+plot (CoM_ZMP(:,1), CoM_ZMP(:,2), 'b');
+plot (CoM_ZMP(:,3), CoM_ZMP(:,4), 'ks','MarkerSize',5);
@@ -8,6 +8,7 @@
 
 #include <cstring> //strcmp
 #include "tests_common.h"
+#include "reference_data.h"
 
 ///@addtogroup gTEST
 ///@{
@@ -15,7 +16,7 @@
 int main(int argc, char **argv)
 {
     bool dump_to_stdout = false;
-    ifstream inFile;
+    reference_data ref;
     ofstream fs_out;
     string test_name = "";
 
@@ -31,14 +32,21 @@ int main(int argc, char **argv)
     }
     else
     {
-        // reference states generated using thr implementation of
-        // the algorithm in Octave/MATLAB
-        inFile.open ("./data/ip_states_inv.dat");
-        //inFile.open ("./data/states_chol_downdate.dat");
         test_name = "test_05";
     }
     init_01 test_05 (test_name);
 
+    if (!dump_to_stdout)
+    {
+        // reference states generated using thr implementation of
+        // the algorithm in Octave/MATLAB
+        if (!ref.open ("./data/ip_states_inv.ref", test_05.wmg->N))
+        {
+            cout << "Cannot open the reference data or it does not match the preview window." << endl;
+            return (1);
+        }
+    }
+
 
 
     smpc::solver_ip solver(
@@ -61,6 +69,7 @@ int main(int argc, char **argv)
     double err = 0;
     double max_err = 0;
     double max_err_first_state = 0;
+    unsigned int step = 0;
 
 
     fs_out.open(test_05.fs_out_filename.c_str(), fstream::app);
@@ -113,11 +122,17 @@ int main(int argc, char **argv)
 
             //------------------------------------------------------
             // compare with reference results
+            const double *step_ref = ref.get_step (step);
+            ++step;
+            if (step_ref == NULL)
+            {
+                cout << "No reference data for step " << step - 1 << endl;
+                max_err = numeric_limits<double>::infinity();
+                continue;
+            }
             for (unsigned int i = 0; i < test_05.wmg->N*SMPC_NUM_VAR; i++)
             {
-                double dataref;
-
-                inFile >> dataref;
+                const double dataref = step_ref[i];
                 err = abs(test_05.par->X[i] - dataref);
                 if ((i < 6) && (err > max_err_first_state))
                 {
@@ -134,13 +149,20 @@ int main(int argc, char **argv)
             //------------------------------------------------------
         }
     }
-    inFile.close();
+
+    bool failed = false;
+    if (!dump_to_stdout)
+    {
+        failed = !(max_err <= ref.header->tolerance);
+        cout << "Tolerance: " << ref.header->tolerance << (failed ? " FAILED" : " OK") << endl;
+    }
+    ref.close();
 
     fs_out << "];" << endl;
     fs_out << "plot (CoM_ZMP(:,1), CoM_ZMP(:,2), 'b');" << endl;
     fs_out << "plot (CoM_ZMP(:,3), CoM_ZMP(:,4), 'ks','MarkerSize',5);" << endl;
     fs_out.close();
 
-    return 0;
+    return (failed ? 1 : 0);
 }
 ///@}
@@ -0,0 +1,167 @@
+%
+% Footsteps generated using the c++ version of the WMG
+%
+
+cla;
+clear FS;
+
+FS(1).a = 0.000000;
+FS(1).p = [0.000000;0.050000];
+FS(1).d = [0.090000;0.075000;0.030000;0.025000];
+FS(1).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(1).v = [0.090000 -0.025000; 0.090000 0.075000; -0.030000 0.075000; -0.030000 -0.025000; 0.090000 -0.025000];
+FS(1).type = 1;
+
+FS(2).a = 0.000000;
+FS(2).p = [0.000000;-0.050000];
+FS(2).d = [0.090000;-0.025000;0.030000;0.075000];
+FS(2).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(2).v = [0.090000 -0.075000; 0.090000 -0.025000; -0.030000 -0.025000; -0.030000 -0.075000; 0.090000 -0.075000];
+FS(2).type = 2;
+
+FS(3).a = 0.087266;
+FS(3).p = [0.035000;0.050000];
+FS(3).d = [0.129225;0.071759;-0.009225;-0.021759];
+FS(3).D = [0.996195 0.087156;-0.087156 0.996195;-0.996195 -0.087156;0.087156 -0.996195];
+FS(3).v = [0.126836 0.032939; 0.122479 0.082749; 0.002935 0.072290; 0.007293 0.022480; 0.126836 0.032939];
+FS(3).type = 2;
+
+FS(4).a = 0.174533;
+FS(4).p = [0.078582;-0.046569];
+FS(4).d = [0.159302;-0.034507;-0.039302;0.084507];
+FS(4).D = [0.984808 0.173648;-0.173648 0.984808;-0.984808 -0.173648;0.173648 -0.984808];
+FS(4).v = [0.171556 -0.055561; 0.162874 -0.006320; 0.044697 -0.027158; 0.053379 -0.076399; 0.171556 -0.055561];
+FS(4).type = 2;
+
+FS(5).a = 0.261799;
+FS(5).p = [0.095686;0.057989];
+FS(5).d = [0.197434;0.056248;-0.077434;-0.006248];
+FS(5).D = [0.965926 0.258819;-0.258819 0.965926;-0.965926 -0.258819;0.258819 -0.965926];
+FS(5).v = [0.189090 0.057135; 0.176149 0.105431; 0.060238 0.074373; 0.073179 0.026077; 0.189090 0.057135];
+FS(5).type = 2;
+
+FS(6).a = 0.349066;
+FS(6).p = [0.155375;-0.029544];
+FS(6).d = [0.225900;-0.055904;-0.105900;0.105904];
+FS(6).D = [0.939693 0.342020;-0.342020 0.939693;-0.939693 -0.342020;0.342020 -0.939693];
+FS(6).v = [0.248498 -0.022255; 0.231397 0.024730; 0.118634 -0.016313; 0.135735 -0.063297; 0.248498 -0.022255];
+FS(6).type = 2;
+
+FS(7).a = 0.436332;
+FS(7).p = [0.154062;0.076395];
+FS(7).d = [0.261914;0.029128;-0.141914;0.020872];
+FS(7).D = [0.906308 0.422618;-0.422618 0.906308;-0.906308 -0.422618;0.422618 -0.906308];
+FS(7).v = [0.246196 0.091773; 0.225065 0.137089; 0.116308 0.086375; 0.137439 0.041059; 0.246196 0.091773];
+FS(7).type = 2;
+
+FS(8).a = 0.523599;
+FS(8).p = [0.228045;0.000556];
+FS(8).d = [0.287771;-0.088541;-0.167771;0.138541];
+FS(8).D = [0.866025 0.500000;-0.500000 0.866025;-0.866025 -0.500000;0.500000 -0.866025];
+FS(8).v = [0.318487 0.023906; 0.293487 0.067207; 0.189564 0.007207; 0.214564 -0.036094; 0.318487 0.023906];
+FS(8).type = 2;
+
+FS(9).a = 0.610865;
+FS(9).p = [0.208356;0.104659];
+FS(9).d = [0.320705;-0.008776;-0.200705;0.058776];
+FS(9).D = [0.819152 0.573576;-0.573576 0.819152;-0.819152 -0.573576;0.573576 -0.819152];
+FS(9).v = [0.296419 0.135802; 0.267740 0.176760; 0.169442 0.107930; 0.198121 0.066973; 0.296419 0.135802];
+FS(9).type = 2;
+
+FS(10).a = 0.698132;
+FS(10).p = [0.294384;0.042819];
+FS(10).d = [0.343035;-0.131425;-0.223035;0.181425];
+FS(10).D = [0.766044 0.642788;-0.642788 0.766044;-0.766044 -0.642788;0.642788 -0.766044];
+FS(10).v = [0.379398 0.081519; 0.347258 0.119821; 0.255333 0.042686; 0.287472 0.004384; 0.379398 0.081519];
+FS(10).type = 2;
+
+FS(11).a = 0.698132;
+FS(11).p = [0.256917;0.141921];
+FS(11).d = [0.378035;-0.031425;-0.258035;0.081425];
+FS(11).D = [0.766044 0.642788;-0.642788 0.766044;-0.766044 -0.642788;0.642788 -0.766044];
+FS(11).v = [0.341930 0.180621; 0.309791 0.218923; 0.217866 0.141788; 0.250005 0.103486; 0.341930 0.180621];
+FS(11).type = 2;
+
+FS(12).a = 0.698132;
+FS(12).p = [0.321195;0.065316];
+FS(12).d = [0.378035;-0.131425;-0.258035;0.181425];
+FS(12).D = [0.766044 0.642788;-0.642788 0.766044;-0.766044 -0.642788;0.642788 -0.766044];
+FS(12).v = [0.406209 0.104016; 0.374070 0.142318; 0.282144 0.065184; 0.314284 0.026882; 0.406209 0.104016];
+FS(12).type = 2;
+
+hold on
+for i=1:length(FS)
+    if FS(i).type == 1;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','r','MarkerSize',2)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'c');
+    end
+    if FS(i).type == 2;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','g','MarkerSize',4)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'r');
+    end
+end
+grid on; %axis equal
+
+
+CoM_ZMP = [
+1.11159065035524e-05 -0.000543273093387522 -0.000166330674377837 0.00812915977383575;
+0.000112518824361644 -0.00376611986329708 -0.000618973748973822 0.00431899451284585;
+0.000510928579103331 -0.00963429473809346 -0.00112686460333569 -0.00841901169246573;
+0.00153895068957576 -0.0157329104639885 -0.00122907665847513 -0.0250005599499993;
+0.00361118322770027 -0.0186710660364818 -0.000347961391305204 -0.0332671334033557;
+0.00716431755037149 -0.0162556737312048 0.00212883984127954 -0.0340640603495126;
+0.0125903582622422 -0.00735845761499719 0.00679364200011084 -0.0250001596556997;
+0.0201617356999097 0.00600532315129928 0.0141374187980151 0.0230793941606034;
+0.0298364044532048 0.0148026985213591 0.0261549122752896 0.0370430283542289;
+0.0408821083650899 0.0155369221262971 0.0397461446580269 0.0382160645497892;
+0.0523522963337964 0.00803531025612753 0.0538014758273976 0.0265495458365778;
+0.0631247660142613 -0.00437399815906861 0.0696019000179099 -0.0227670371393926;
+0.071857379689345 -0.0118770887949247 0.0770625031661266 -0.0351386082346592;
+0.0786947050782021 -0.0109470354337294 0.081652137883372 -0.034128749472993;
+0.0844517249190996 -0.00159084399913565 0.0846621147485922 -0.0201114615007956;
+0.0904164313919809 0.0128604843830416 0.083302074684953 0.0287894547698473;
+0.0985586244651398 0.0231364809074798 0.0920457836245636 0.0445933033986782;
+0.109069277336186 0.0256455444137288 0.104426556595235 0.0478751872882103;
+0.121259006411112 0.0200868764441616 0.119539128428702 0.0384991225275705;
+0.13358118639691 0.00958932334336791 0.142989065077476 -0.00744838525621002;
+0.143096041931537 0.00358945411944053 0.151998575329557 -0.0184698469756182;
+0.149373394901794 0.00558646314359027 0.156036616225551 -0.016795212424014;
+0.153223968866108 0.0157189575352045 0.156407958158084 -0.00256425505673256;
+0.156482438350976 0.0309348728479644 0.146535202925523 0.0453012116015052;
+0.162676753314608 0.0424470464676145 0.152415915512998 0.0623888540087995;
+0.172598297597449 0.0467439461256237 0.164089994179566 0.0677899798976422;
+0.185605325782651 0.04340269869218 0.180644863584919 0.0612068105504359;
+0.199629838147832 0.0352356665557253 0.211737582345995 0.0200086475821821;
+0.210155498946434 0.0310441198162057 0.222538211194261 0.0106862068737032;
+0.216191986183215 0.0342361402443523 0.226215429668705 0.0130286928985455;
+0.218582249835673 0.045136863677391 0.224311534625129 0.0272682061082657;
+0.219717249459969 0.0610938920097601 0.20681482653221 0.0730606437163052;
+0.224603723578616 0.0740800132252404 0.210598207379327 0.0915071537238885;
+0.234570375535213 0.0807537681241354 0.222398446397533 0.0998446690179921;
+0.24892957077332 0.0804963627668946 0.241503305267646 0.0973498282861776;
+0.264928449209379 0.0755488547100974 0.280630681063577 0.0639136210714187;
+0.276324528316495 0.0734590090648729 0.294417745601057 0.0575287478608482;
+0.281124964487576 0.0771079521216363 0.298338108529214 0.0608542090951864;
+0.279649997002967 0.086605186901176 0.292880372000166 0.0741923688570172;
+0.274448797025898 0.0992399641292874 0.263797130398033 0.115059439327957;
+0.272011962773271 0.107409842264162 0.257259847310247 0.127819295496447;
+0.27493592045663 0.108131402949333 0.259020104270575 0.129573861266081;
+0.28365470130641 0.101018725574194 0.269565564912057 0.119899753065323;
+0.296510575052166 0.0881902753062054 0.302741270402832 0.0824663201769253;
+0.308189788835329 0.0761229910944052 0.316139523046263 0.0679870599208253;
+0.316993744321078 0.0669766180757072 0.324862730819314 0.0586169082112508;
+0.3229046656155 0.0608920977713229 0.329661366080555 0.0535895865412249;
+0.326304171979811 0.0575153985617797 0.331498860487338 0.0518593854106131;
+0.327754478878725 0.0562575239668076 0.331334685574242 0.0523606490001964;
+0.32784751260868 0.0564754291451159 0.329998559832766 0.0541606228461249;
+0.327113314131502 0.0575834547518185 0.328134276708562 0.0565302930299269;
+0.32597497467572 0.0591098819569889 0.326191501939444 0.058958263755155;
+0.324736586269758 0.0607142487758951 0.324446626319597 0.0611297096546472;
+0.323592006151961 0.0621796475146707 0.323037828584233 0.0628878117375229;
+0.322644593495332 0.0633915470347756 0.32200381984086 0.064190114039715;
+0.321930739800731 0.0643116194208858 0.321319639565011 0.0650677120695692;
+0.321442507582104 0.064952157631277 0.32092601825105 0.0655915087082199;
+0.321146760772655 0.0653542541334969 0.320751115470474 0.0658470743533549;
+0.32099972085677 0.0655710871569896 0.320724938233247 0.0659178722004795;];
+plot (CoM_ZMP(:,1), CoM_ZMP(:,2), 'b');
+plot (CoM_ZMP(:,3), CoM_ZMP(:,4), 'ks','MarkerSize',5);
@@ -0,0 +1,193 @@
+%
+% Footsteps generated using the c++ version of the WMG
+%
+
+cla;
+clear FS;
+
+FS(1).a = 0.000000;
+FS(1).p = [0.000000;0.050000];
+FS(1).d = [0.030000;0.060000;0.010000;0.060000];
+FS(1).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(1).v = [0.030000 -0.060000; 0.030000 0.060000; -0.010000 0.060000; -0.010000 -0.060000; 0.030000 -0.060000];
+FS(1).type = 1;
+
+FS(2).a = 0.000000;
+FS(2).p = [0.000000;-0.050000];
+FS(2).d = [0.030000;-0.040000;0.010000;0.060000];
+FS(2).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(2).v = [0.030000 -0.060000; 0.030000 -0.040000; -0.010000 -0.040000; -0.010000 -0.060000; 0.030000 -0.060000];
+FS(2).type = 2;
+
+FS(3).a = 0.087266;
+FS(3).p = [0.035000;0.050000];
+FS(3).d = [0.069225;0.056759;-0.029225;-0.036759];
+FS(3).D = [0.996195 0.087156;-0.087156 0.996195;-0.996195 -0.087156;0.087156 -0.996195];
+FS(3).v = [0.065757 0.042653; 0.064014 0.062577; 0.024166 0.059090; 0.025910 0.039166; 0.065757 0.042653];
+FS(3).type = 2;
+
+FS(4).a = 0.174533;
+FS(4).p = [0.078582;-0.046569];
+FS(4).d = [0.099302;-0.049507;-0.059302;0.069507];
+FS(4).D = [0.984808 0.173648;-0.173648 0.984808;-0.984808 -0.173648;0.173648 -0.984808];
+FS(4).v = [0.109863 -0.051208; 0.106390 -0.031511; 0.066998 -0.038457; 0.070471 -0.058154; 0.109863 -0.051208];
+FS(4).type = 2;
+
+FS(5).a = 0.261799;
+FS(5).p = [0.095686;0.057989];
+FS(5).d = [0.137434;0.041248;-0.097434;-0.021248];
+FS(5).D = [0.965926 0.258819;-0.258819 0.965926;-0.965926 -0.258819;0.258819 -0.965926];
+FS(5).v = [0.127252 0.056095; 0.122075 0.075413; 0.083438 0.065061; 0.088615 0.045742; 0.127252 0.056095];
+FS(5).type = 2;
+
+FS(6).a = 0.349066;
+FS(6).p = [0.155375;-0.029544];
+FS(6).d = [0.165900;-0.070904;-0.125900;0.090904];
+FS(6).D = [0.939693 0.342020;-0.342020 0.939693;-0.939693 -0.342020;0.342020 -0.939693];
+FS(6).v = [0.186986 -0.028681; 0.180146 -0.009887; 0.142558 -0.023568; 0.149398 -0.042362; 0.186986 -0.028681];
+FS(6).type = 2;
+
+FS(7).a = 0.436332;
+FS(7).p = [0.154062;0.076395];
+FS(7).d = [0.201914;0.014128;-0.161914;0.005872];
+FS(7).D = [0.906308 0.422618;-0.422618 0.906308;-0.906308 -0.422618;0.422618 -0.906308];
+FS(7).v = [0.185478 0.080011; 0.177025 0.098137; 0.140773 0.081232; 0.149225 0.063106; 0.185478 0.080011];
+FS(7).type = 2;
+
+FS(8).a = 0.523599;
+FS(8).p = [0.228045;0.000556];
+FS(8).d = [0.227771;-0.103541;-0.187771;0.123541];
+FS(8).D = [0.866025 0.500000;-0.500000 0.866025;-0.866025 -0.500000;0.500000 -0.866025];
+FS(8).v = [0.259026 0.006896; 0.249026 0.024217; 0.214385 0.004217; 0.224385 -0.013104; 0.259026 0.006896];
+FS(8).type = 2;
+
+FS(9).a = 0.610865;
+FS(9).p = [0.208356;0.104659];
+FS(9).d = [0.260705;-0.023776;-0.220705;0.043776];
+FS(9).D = [0.819152 0.573576;-0.573576 0.819152;-0.819152 -0.573576;0.573576 -0.819152];
+FS(9).v = [0.238666 0.113675; 0.227195 0.130058; 0.194429 0.107115; 0.205900 0.090732; 0.238666 0.113675];
+FS(9).type = 2;
+
+FS(10).a = 0.698132;
+FS(10).p = [0.294384;0.042819];
+FS(10).d = [0.283035;-0.146425;-0.243035;0.166425];
+FS(10).D = [0.766044 0.642788;-0.642788 0.766044;-0.766044 -0.642788;0.642788 -0.766044];
+FS(10).v = [0.323793 0.054442; 0.310937 0.069763; 0.280296 0.044051; 0.293151 0.028731; 0.323793 0.054442];
+FS(10).type = 2;
+
+FS(11).a = 0.698132;
+FS(11).p = [0.256917;0.141921];
+FS(11).d = [0.318035;-0.046425;-0.278035;0.066425];
+FS(11).D = [0.766044 0.642788;-0.642788 0.766044;-0.766044 -0.642788;0.642788 -0.766044];
+FS(11).v = [0.286326 0.153544; 0.273470 0.168865; 0.242828 0.143153; 0.255684 0.127833; 0.286326 0.153544];
+FS(11).type = 2;
+
+FS(12).a = 0.698132;
+FS(12).p = [0.321195;0.065316];
+FS(12).d = [0.318035;-0.146425;-0.278035;0.166425];
+FS(12).D = [0.766044 0.642788;-0.642788 0.766044;-0.766044 -0.642788;0.642788 -0.766044];
+FS(12).v = [0.350605 0.076940; 0.337749 0.092261; 0.307107 0.066549; 0.319963 0.051228; 0.350605 0.076940];
+FS(12).type = 2;
+
+hold on
+for i=1:length(FS)
+    if FS(i).type == 1;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','r','MarkerSize',2)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'c');
+    end
+    if FS(i).type == 2;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','g','MarkerSize',4)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'r');
+    end
+end
+grid on; %axis equal
+
+
+CoM_ZMP = [
+7.49420637241355e-05 -0.000871122704322047 -0.00112138078841052 0.0130348727592759;
+0.000587510077396833 -0.00602994662174471 -0.00161315404533224 0.00679194409982575;
+0.00191811040378005 -0.0153809464857641 -0.00114140772212726 -0.0136535310092111;
+0.00439103293380397 -0.0250302427253543 0.000594534382774981 -0.0399999999999999;
+0.00828208636481228 -0.0295845058331395 0.00388954578005914 -0.0527664486270656;
+0.013812562555999 -0.025598626827052 0.00900862158630538 -0.0542299724879313;
+0.0211217633211463 -0.01118092135856 0.0163357488975991 -0.0400000000000001;
+0.0301999152825509 0.0104529682995131 0.0259096104465591 0.0391664955916062;
+0.0408317775506493 0.024461892492901 0.0379766633030365 0.0601464941544036;
+0.0525172871415301 0.0254824748721023 0.0514083577602717 0.0613673735640123;
+0.0645861499419099 0.01344618954546 0.065757398370229 0.042652725301512;
+0.07587100667582 -0.00634136099119004 0.0848102685425005 -0.0353166094467122;
+0.0843906067602487 -0.0184560203436274 0.0916049399486463 -0.0542462472365515;
+0.090264141570723 -0.0175161622373819 0.0947074880209732 -0.0537732206881188;
+0.0945009899187168 -0.00336737816733832 0.0956401924404341 -0.033407001664487;
+0.0988128823437674 0.0188982612761585 0.0886147744848457 0.0457419939926412;
+0.106234687833145 0.0341797992470664 0.0962434329680078 0.0683338181378808;
+0.117295228084111 0.0370372736006299 0.109372130769036 0.071906554258202;
+0.131215271055325 0.0272083008170907 0.127251807536408 0.0560947557967419;
+0.145758528805825 0.00964934787463784 0.159586913995114 -0.0173697391556637;
+0.1562499619397 -0.000818457173981525 0.169580387755842 -0.0348267047229691;
+0.161865614846561 0.00111667712239581 0.172549082310188 -0.0338231214337738;
+0.163572001328464 0.0157783321753963 0.169912509138756 -0.0136115298722937;
+0.163942279459528 0.0384484465034228 0.149225482869061 0.0631062332634538;
+0.16859145983719 0.0547829873838089 0.152812726378878 0.086678379445485;
+0.178984499416302 0.0595158064779958 0.16512526644072 0.0924782487922329;
+0.194397514280887 0.0522521096658439 0.185477794350527 0.0800109637330817;
+0.211766721956217 0.0374843005538507 0.230077536573429 0.0132768585001479;
+0.223914179749129 0.0289963381126659 0.242947015480443 -0.00217984138396041;
+0.229102529170916 0.0318786206567815 0.245750725442671 -0.000715882370989824;
+0.22821516565377 0.046626809408437 0.239577989915753 0.018761947794763;
+0.224609698937628 0.06904024023671 0.205900109895449 0.0907316097805311;
+0.226317543917261 0.0859788209807882 0.204975072607056 0.114474893836558;
+0.235779089276439 0.0925567934794628 0.216083896950206 0.122270658631916;
+0.252371258492528 0.0883155345957141 0.238666191667008 0.113674667234573;
+0.272173139075345 0.0771343290492537 0.295451004409358 0.0567684030035401;
+0.285323552211642 0.0711277945666026 0.312096546296621 0.044627525275242;
+0.288655721486022 0.0747721898815312 0.315017479075676 0.0470784788928409;
+0.282302223079869 0.0885189411897349 0.304697444178606 0.0645270872036187;
+0.269554549787271 0.10882134839168 0.255684057366235 0.127832555553189;
+0.259647487635937 0.124810339827117 0.247388700571817 0.14161372694453;
+0.254177310192183 0.134687396859223 0.246255617005553 0.146029300510611;
+0.251730571133333 0.140246809079716 0.247412068652874 0.146999678661353;
+0.251033897063599 0.143116294671727 0.248292782914597 0.147703025845717;
+0.251386007940969 0.144238472165208 0.249926895384767 0.147031486066005;
+0.252307860300083 0.144283599699227 0.251790468910271 0.145718087504277;
+0.25344436235425 0.143763306557124 0.253546522401891 0.144258322871468;
+0.254559351243951 0.143034532876513 0.255011523600716 0.142948017768273;
+0.255517137636525 0.142320875990426 0.256115759216871 0.141930606141421;
+0.256258593342155 0.141741604482397 0.256865286914288 0.141243964511212;
+0.256777162384909 0.141341579190831 0.257309773794984 0.140861047303986;
+0.257097955421297 0.141117958745637 0.25751797447562 0.140721722294611;
+0.257261375540706 0.141041659714858 0.257560879432089 0.140755401065573;
+0.257311532513511 0.141073039259562 0.257501551793577 0.14089540460737;
+0.257288971756037 0.141172220786418 0.257390205888299 0.141086674476177;
+0.257247561283031 0.141280341668403 0.256953509189749 0.141657459929238;
+0.257271318048417 0.141300568029714 0.257306007933316 0.141280728140371;
+0.257275293647003 0.141336172185027 0.257746358955091 0.140792933100268;
+0.257114527334919 0.141561225697013 0.257825401213683 0.140729784488588;
+0.256701150236418 0.142081384445919 0.257419091875347 0.141239534123644;
+0.256033264244415 0.142899673007272 0.256513426330049 0.142339379049233;
+0.255202066901585 0.143908095671902 0.255170465456241 0.14395595357216;
+0.254402688585946 0.144874760966084 0.253540995517353 0.145910208869699;
+0.253949965332962 0.145425089202782 0.251894579336899 0.147881554183708;
+0.254293775206594 0.145023524328514 0.250661712807047 0.149357574419384;
+0.256023560070621 0.142968130287585 0.2504824572861 0.149576040631063;
+0.259963129854329 0.138277595693933 0.250484137701682 0.149577450667159;
+0.267549640658621 0.129239578899542 0.252789488422401 0.146832423243715;
+0.280503540801557 0.113804050520792 0.263341880896855 0.134258232453354;
+0.297607511834368 0.0934220065599871 0.314765465630794 0.0729751602908349;
+0.310565997382966 0.077979897703126 0.325271481941717 0.0604554212062846;
+0.318172900189 0.0689152352020654 0.327621943681061 0.057654880494406;
+0.322147981732891 0.0641785867530656 0.327622185555693 0.0576550834513205;
+0.323935581149252 0.0620487243349143 0.327509161833001 0.0577901776286671;
+0.324356808733376 0.0615471322540532 0.326400089405789 0.0591122500240537;
+0.323984663591574 0.0619909662443281 0.324902809237538 0.0608969192671007;
+0.323243910988272 0.0628740296375623 0.323412240236681 0.0626735478393084;
+0.322420414032235 0.0638556562216771 0.322149824546388 0.0641782363356599;
+0.321683951825472 0.0647335193455659 0.32120861846783 0.0653000882181009;
+0.321116132752634 0.0654103679125402 0.320595954265106 0.0660303685380599;
+0.320737786032532 0.0658613834467424 0.320269228810383 0.0664198531457369;
+0.320532580176614 0.066106033266761 0.32016308751897 0.0665464322184711;
+0.320465432776637 0.0661861307998606 0.320208091699658 0.066492863268695;
+0.320495531717452 0.0661503175722495 0.320342015903416 0.0663333073106751;
+0.320584550762108 0.0660442722391293 0.320515395639398 0.0661267171797648;];
+plot (CoM_ZMP(:,1), CoM_ZMP(:,2), 'b');
+plot (CoM_ZMP(:,3), CoM_ZMP(:,4), 'ks','MarkerSize',5);
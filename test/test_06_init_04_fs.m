@@ -0,0 +1,244 @@
+%
+% Footsteps generated using the c++ version of the WMG
+%
+
+cla;
+clear FS;
+
+FS(1).a = 0.000000;
+FS(1).p = [0.000000;0.050000];
+FS(1).d = [0.090000;0.075000;0.030000;-0.025000];
+FS(1).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(1).v = [0.090000 0.025000; 0.090000 0.075000; -0.030000 0.075000; -0.030000 0.025000; 0.090000 0.025000];
+FS(1).type = 2;
+
+FS(2).a = 0.000000;
+FS(2).p = [0.000000;0.000000];
+FS(2).d = [0.090000;0.075000;0.030000;0.075000];
+FS(2).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(2).v = [0.090000 -0.075000; 0.090000 0.075000; -0.030000 0.075000; -0.030000 -0.075000; 0.090000 -0.075000];
+FS(2).type = 1;
+
+FS(3).a = 0.000000;
+FS(3).p = [0.000000;-0.016667];
+FS(3).d = [0.070000;0.008333;0.025000;0.041667];
+FS(3).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(3).v = [0.070000 -0.041667; 0.070000 0.008333; -0.025000 0.008333; -0.025000 -0.041667; 0.070000 -0.041667];
+FS(3).type = 1;
+
+FS(4).a = 0.000000;
+FS(4).p = [0.000000;-0.033333];
+FS(4).d = [0.070000;-0.008333;0.025000;0.058333];
+FS(4).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(4).v = [0.070000 -0.058333; 0.070000 -0.008333; -0.025000 -0.008333; -0.025000 -0.058333; 0.070000 -0.058333];
+FS(4).type = 1;
+
+FS(5).a = 0.000000;
+FS(5).p = [0.000000;-0.050000];
+FS(5).d = [0.090000;-0.025000;0.030000;0.075000];
+FS(5).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(5).v = [0.090000 -0.075000; 0.090000 -0.025000; -0.030000 -0.025000; -0.030000 -0.075000; 0.090000 -0.075000];
+FS(5).type = 2;
+
+FS(6).a = 0.000000;
+FS(6).p = [0.011667;-0.016667];
+FS(6).d = [0.081667;0.008333;0.013333;0.041667];
+FS(6).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(6).v = [0.081667 -0.041667; 0.081667 0.008333; -0.013333 0.008333; -0.013333 -0.041667; 0.081667 -0.041667];
+FS(6).type = 1;
+
+FS(7).a = 0.000000;
+FS(7).p = [0.023333;0.016667];
+FS(7).d = [0.093333;0.041667;0.001667;0.008333];
+FS(7).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(7).v = [0.093333 -0.008333; 0.093333 0.041667; -0.001667 0.041667; -0.001667 -0.008333; 0.093333 -0.008333];
+FS(7).type = 1;
+
+FS(8).a = 0.000000;
+FS(8).p = [0.035000;0.050000];
+FS(8).d = [0.125000;0.075000;-0.005000;-0.025000];
+FS(8).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(8).v = [0.125000 0.025000; 0.125000 0.075000; 0.005000 0.075000; 0.005000 0.025000; 0.125000 0.025000];
+FS(8).type = 2;
+
+FS(9).a = 0.000000;
+FS(9).p = [0.046667;0.016667];
+FS(9).d = [0.116667;0.041667;-0.021667;0.008333];
+FS(9).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(9).v = [0.116667 -0.008333; 0.116667 0.041667; 0.021667 0.041667; 0.021667 -0.008333; 0.116667 -0.008333];
+FS(9).type = 1;
+
+FS(10).a = 0.000000;
+FS(10).p = [0.058333;-0.016667];
+FS(10).d = [0.128333;0.008333;-0.033333;0.041667];
+FS(10).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(10).v = [0.128333 -0.041667; 0.128333 0.008333; 0.033333 0.008333; 0.033333 -0.041667; 0.128333 -0.041667];
+FS(10).type = 1;
+
+FS(11).a = 0.000000;
+FS(11).p = [0.070000;-0.050000];
+FS(11).d = [0.160000;-0.025000;-0.040000;0.075000];
+FS(11).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(11).v = [0.160000 -0.075000; 0.160000 -0.025000; 0.040000 -0.025000; 0.040000 -0.075000; 0.160000 -0.075000];
+FS(11).type = 2;
+
+FS(12).a = 0.000000;
+FS(12).p = [0.081667;-0.016667];
+FS(12).d = [0.151667;0.008333;-0.056667;0.041667];
+FS(12).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(12).v = [0.151667 -0.041667; 0.151667 0.008333; 0.056667 0.008333; 0.056667 -0.041667; 0.151667 -0.041667];
+FS(12).type = 1;
+
+FS(13).a = 0.000000;
+FS(13).p = [0.093333;0.016667];
+FS(13).d = [0.163333;0.041667;-0.068333;0.008333];
+FS(13).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(13).v = [0.163333 -0.008333; 0.163333 0.041667; 0.068333 0.041667; 0.068333 -0.008333; 0.163333 -0.008333];
+FS(13).type = 1;
+
+FS(14).a = 0.000000;
+FS(14).p = [0.105000;0.050000];
+FS(14).d = [0.195000;0.075000;-0.075000;-0.025000];
+FS(14).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(14).v = [0.195000 0.025000; 0.195000 0.075000; 0.075000 0.075000; 0.075000 0.025000; 0.195000 0.025000];
+FS(14).type = 2;
+
+FS(15).a = 0.000000;
+FS(15).p = [0.116667;0.016667];
+FS(15).d = [0.186667;0.041667;-0.091667;0.008333];
+FS(15).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(15).v = [0.186667 -0.008333; 0.186667 0.041667; 0.091667 0.041667; 0.091667 -0.008333; 0.186667 -0.008333];
+FS(15).type = 1;
+
+FS(16).a = 0.000000;
+FS(16).p = [0.128333;-0.016667];
+FS(16).d = [0.198333;0.008333;-0.103333;0.041667];
+FS(16).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(16).v = [0.198333 -0.041667; 0.198333 0.008333; 0.103333 0.008333; 0.103333 -0.041667; 0.198333 -0.041667];
+FS(16).type = 1;
+
+FS(17).a = 0.000000;
+FS(17).p = [0.140000;-0.050000];
+FS(17).d = [0.230000;-0.025000;-0.110000;0.075000];
+FS(17).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(17).v = [0.230000 -0.075000; 0.230000 -0.025000; 0.110000 -0.025000; 0.110000 -0.075000; 0.230000 -0.075000];
+FS(17).type = 2;
+
+FS(18).a = 0.000000;
+FS(18).p = [0.151667;-0.016667];
+FS(18).d = [0.221667;0.008333;-0.126667;0.041667];
+FS(18).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(18).v = [0.221667 -0.041667; 0.221667 0.008333; 0.126667 0.008333; 0.126667 -0.041667; 0.221667 -0.041667];
+FS(18).type = 1;
+
+FS(19).a = 0.000000;
+FS(19).p = [0.163333;0.016667];
+FS(19).d = [0.233333;0.041667;-0.138333;0.008333];
+FS(19).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(19).v = [0.233333 -0.008333; 0.233333 0.041667; 0.138333 0.041667; 0.138333 -0.008333; 0.233333 -0.008333];
+FS(19).type = 1;
+
+FS(20).a = 0.000000;
+FS(20).p = [0.175000;0.050000];
+FS(20).d = [0.265000;0.075000;-0.145000;-0.025000];
+FS(20).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(20).v = [0.265000 0.025000; 0.265000 0.075000; 0.145000 0.075000; 0.145000 0.025000; 0.265000 0.025000];
+FS(20).type = 2;
+
+FS(21).a = 0.000000;
+FS(21).p = [0.175000;0.000000];
+FS(21).d = [0.265000;0.075000;-0.145000;0.075000];
+FS(21).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(21).v = [0.265000 -0.075000; 0.265000 0.075000; 0.145000 0.075000; 0.145000 -0.075000; 0.265000 -0.075000];
+FS(21).type = 1;
+
+FS(22).a = 0.000000;
+FS(22).p = [0.175000;-0.050000];
+FS(22).d = [0.265000;-0.025000;-0.145000;0.075000];
+FS(22).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(22).v = [0.265000 -0.075000; 0.265000 -0.025000; 0.145000 -0.025000; 0.145000 -0.075000; 0.265000 -0.075000];
+FS(22).type = 2;
+
+hold on
+for i=1:length(FS)
+    if FS(i).type == 1;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','r','MarkerSize',2)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'c');
+    end
+    if FS(i).type == 2;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','g','MarkerSize',4)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'r');
+    end
+end
+grid on; %axis equal
+
+
+CoM_ZMP = [
+1.43504116873198e-05 -0.000375571901310576 -0.000214729554701695 0.00561979606464098;
+0.000112947392866904 -0.0026982868240499 -0.000315586236220572 0.00440307486513984;
+0.000372074388943415 -0.00747474047435913 -0.00024730035694811 -0.00270578101385738;
+0.000864147098660164 -0.0139203988066008 5.15967596238447e-05 -0.0134515786445781;
+0.00166207869473331 -0.0205004056366773 0.000649136794386989 -0.025;
+0.00284049301143237 -0.0255672461773484 0.00163105009048525 -0.032192820478412;
+0.00447168511941962 -0.028173488965417 0.00309456974171012 -0.0364508642742385;
+0.00661595612634736 -0.0277038382621499 0.00514342675853073 -0.0370701817617904;
+0.00930607624766802 -0.0237644068617828 0.00785975442652065 -0.0334108173062679;
+0.0125290959831403 -0.0162744886006201 0.0112800747582609 -0.0249999999999999;
+0.0162085839163861 -0.00578391472781 0.0153642505991979 -0.00913583266992963;
+0.0202020258132923 0.00592559788437417 0.0198166381347329 0.00860049291917085;
+0.0243471933922941 0.0166518682308591 0.02431103442513 0.025;
+0.0285215421217379 0.0244834139904142 0.0285857381297892 0.0346253568446957;
+0.032683121803873 0.0285640442524016 0.0326663329068711 0.0395251407520672;
+0.0368560354489455 0.0285741704708445 0.0366780675471579 0.0395665300194438;
+0.0410941502399465 0.024504703154526 0.0407819851118419 0.034697955162142;
+0.0454417131639816 0.0166706838089267 0.0451211878948937 0.025;
+0.0498972575694365 0.0059267015273369 0.0497677826943461 0.00886880410066875;
+0.0543970159037779 -0.00589301560606595 0.054529640340547 -0.00881846096980744;
+0.0588518838073613 -0.0166403126723319 0.0591674604722438 -0.025;
+0.0632014872434395 -0.0244741415341399 0.0634869247109908 -0.0346185218666727;
+0.067452970278786 -0.0285558219115197 0.0675619694067678 -0.0395152954822093;
+0.0716665845475255 -0.0285673821516659 0.0715496611542389 -0.0395576675252238;
+0.075920909097362 -0.0244999860474063 0.0756297330002552 -0.0346929860216001;
+0.0802756437751745 -0.016668067079467 0.0799543942846066 -0.025;
+0.0847378464398805 -0.00592543035758222 0.0845984764882952 -0.00886936743402138;
+0.0892474968701558 0.00589363056489221 0.0893688031203721 0.00881802638732373;
+0.0937162533366505 0.0166406718275683 0.094023201011931 0.025;
+0.0980828891884202 0.0244744072721849 0.0983639745271846 0.0346186815437364;
+0.102353039794443 0.0285560424104979 0.102461973953101 0.0395155302983492;
+0.106585398147483 0.0285675580557609 0.106471865350132 0.0395578819383677;
+0.110857264562728 0.0245001067623573 0.110571782435338 0.0346931075025989;
+0.115227472401048 0.0166681342060279 0.114913079798315 0.025;
+0.11970263030375 0.00592546352332148 0.119570333190497 0.00886935501911141;
+0.124222620219879 -0.00589361411128086 0.124350534272282 -0.00881803583067475;
+0.12869881320405 -0.0166406621344082 0.129018597792158 -0.0249999999999999;
+0.133067238571782 -0.0244726794994178 0.133380513255054 -0.0346444232453932;
+0.137325751573802 -0.0285434560072338 0.137507432622678 -0.0395389696854304;
+0.141517591286769 -0.0285322139717742 0.141541918306649 -0.0395409133597758;
+0.145695201592832 -0.0244340855276165 0.145643360794814 -0.034643979353672;
+0.149881113763465 -0.0165592295424704 0.149931624758125 -0.0249999999999999;
+0.154032567579342 -0.0057438955160777 0.154432433548041 -0.00871066106880904;
+0.158026974233506 0.00616739690167086 0.158883990752856 0.00898011396496418;
+0.16170265212913 0.0170625090260236 0.162962683751468 0.0249999999999999;
+0.164917934136921 0.0252451077134098 0.166370230071604 0.0339830999681888;
+0.167598385182712 0.0302163372913003 0.169066838389371 0.0385909346424332;
+0.169734826613965 0.0320892572454399 0.171092908029665 0.0393121301304205;
+0.171365585329358 0.0312802254817732 0.172537172749769 0.0368269438290878;
+0.172558051000245 0.0284083609179052 0.173510224466587 0.0319282391606444;
+0.173392657734955 0.0242272278926294 0.174124986989979 0.0255012454078632;
+0.173950701242431 0.0195295578396271 0.174484073282504 0.0191592464923043;
+0.174306242584796 0.0149332398520472 0.174673028539115 0.013522554021198;
+0.17452165495689 0.0108346906592302 0.174758060276351 0.00890171135850633;
+0.17464603429482 0.0074380143610157 0.174786814947478 0.00537640788458766;
+0.174715609781593 0.00479965386070562 0.174790932319525 0.00287383440335191;
+0.17475536118749 0.00287571785429245 0.174789381215414 0.0012360276704024;
+0.174781200918381 0.00156426260087895 0.174791874548677 0.000271627103705522;
+0.174802255398147 0.000738766978307092 0.174801929261491 -0.00020852156162345;
+0.174822948172894 0.000271824440929533 0.17481935309594 -0.000370077353904347;
+0.174844726930468 4.98155345989434e-05 0.174842097502299 -0.000345238452758375;
+0.174867381207551 -1.97698835929945e-05 0.174867517814193 -0.000230834427048383;
+0.174889967387339 -6.38955775949306e-06 0.174893137446678 -9.14846865276124e-05;
+0.174911397594861 4.19980305374632e-05 0.174917033886127 3.46115598317145e-05;
+0.174930766129946 9.54638206688646e-05 0.174937962006815 0.000129039958939318;
+0.174947488214403 0.000137912770036223 0.174955314508264 0.00018685985215037;];
+plot (CoM_ZMP(:,1), CoM_ZMP(:,2), 'b');
+plot (CoM_ZMP(:,3), CoM_ZMP(:,4), 'ks','MarkerSize',5);
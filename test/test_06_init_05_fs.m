@@ -0,0 +1,226 @@
+%
+% Footsteps generated using the c++ version of the WMG
+%
+
+cla;
+clear FS;
+
+FS(1).a = 0.000000;
+FS(1).p = [0.000000;0.000000];
+FS(1).d = [0.090000;0.075000;0.030000;0.025000];
+FS(1).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(1).v = [0.090000 -0.025000; 0.090000 0.075000; -0.030000 0.075000; -0.030000 -0.025000; 0.090000 -0.025000];
+FS(1).type = 1;
+
+FS(2).a = 0.000000;
+FS(2).p = [0.000000;-0.025000];
+FS(2).d = [0.070000;0.000000;0.025000;0.050000];
+FS(2).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(2).v = [0.070000 -0.050000; 0.070000 0.000000; -0.025000 0.000000; -0.025000 -0.050000; 0.070000 -0.050000];
+FS(2).type = 1;
+
+FS(3).a = 0.000000;
+FS(3).p = [0.000000;-0.050000];
+FS(3).d = [0.090000;-0.025000;0.030000;0.075000];
+FS(3).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(3).v = [0.090000 -0.075000; 0.090000 -0.025000; -0.030000 -0.025000; -0.030000 -0.075000; 0.090000 -0.075000];
+FS(3).type = 2;
+
+FS(4).a = 0.000000;
+FS(4).p = [0.015000;-0.010000];
+FS(4).d = [0.085000;0.015000;0.010000;0.035000];
+FS(4).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(4).v = [0.085000 -0.035000; 0.085000 0.015000; -0.010000 0.015000; -0.010000 -0.035000; 0.085000 -0.035000];
+FS(4).type = 1;
+
+FS(5).a = 0.000000;
+FS(5).p = [0.030000;0.030000];
+FS(5).d = [0.120000;0.055000;0.000000;-0.005000];
+FS(5).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(5).v = [0.120000 0.005000; 0.120000 0.055000; -0.000000 0.055000; -0.000000 0.005000; 0.120000 0.005000];
+FS(5).type = 2;
+
+FS(6).a = 0.000000;
+FS(6).p = [0.045000;-0.030000];
+FS(6).d = [0.115000;-0.005000;-0.020000;0.055000];
+FS(6).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(6).v = [0.115000 -0.055000; 0.115000 -0.005000; 0.020000 -0.005000; 0.020000 -0.055000; 0.115000 -0.055000];
+FS(6).type = 1;
+
+FS(7).a = 0.000000;
+FS(7).p = [0.060000;-0.090000];
+FS(7).d = [0.150000;-0.065000;-0.030000;0.115000];
+FS(7).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(7).v = [0.150000 -0.115000; 0.150000 -0.065000; 0.030000 -0.065000; 0.030000 -0.115000; 0.150000 -0.115000];
+FS(7).type = 2;
+
+FS(8).a = 0.000000;
+FS(8).p = [0.075000;-0.050000];
+FS(8).d = [0.145000;-0.025000;-0.050000;0.075000];
+FS(8).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(8).v = [0.145000 -0.075000; 0.145000 -0.025000; 0.050000 -0.025000; 0.050000 -0.075000; 0.145000 -0.075000];
+FS(8).type = 1;
+
+FS(9).a = 0.000000;
+FS(9).p = [0.090000;-0.010000];
+FS(9).d = [0.180000;0.015000;-0.060000;0.035000];
+FS(9).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(9).v = [0.180000 -0.035000; 0.180000 0.015000; 0.060000 0.015000; 0.060000 -0.035000; 0.180000 -0.035000];
+FS(9).type = 2;
+
+FS(10).a = 0.000000;
+FS(10).p = [0.105000;-0.070000];
+FS(10).d = [0.175000;-0.045000;-0.080000;0.095000];
+FS(10).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(10).v = [0.175000 -0.095000; 0.175000 -0.045000; 0.080000 -0.045000; 0.080000 -0.095000; 0.175000 -0.095000];
+FS(10).type = 1;
+
+FS(11).a = 0.000000;
+FS(11).p = [0.120000;-0.130000];
+FS(11).d = [0.210000;-0.105000;-0.090000;0.155000];
+FS(11).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(11).v = [0.210000 -0.155000; 0.210000 -0.105000; 0.090000 -0.105000; 0.090000 -0.155000; 0.210000 -0.155000];
+FS(11).type = 2;
+
+FS(12).a = 0.000000;
+FS(12).p = [0.135000;-0.090000];
+FS(12).d = [0.205000;-0.065000;-0.110000;0.115000];
+FS(12).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(12).v = [0.205000 -0.115000; 0.205000 -0.065000; 0.110000 -0.065000; 0.110000 -0.115000; 0.205000 -0.115000];
+FS(12).type = 1;
+
+FS(13).a = 0.000000;
+FS(13).p = [0.150000;-0.050000];
+FS(13).d = [0.240000;-0.025000;-0.120000;0.075000];
+FS(13).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(13).v = [0.240000 -0.075000; 0.240000 -0.025000; 0.120000 -0.025000; 0.120000 -0.075000; 0.240000 -0.075000];
+FS(13).type = 2;
+
+FS(14).a = 0.000000;
+FS(14).p = [0.165000;-0.110000];
+FS(14).d = [0.235000;-0.085000;-0.140000;0.135000];
+FS(14).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(14).v = [0.235000 -0.135000; 0.235000 -0.085000; 0.140000 -0.085000; 0.140000 -0.135000; 0.235000 -0.135000];
+FS(14).type = 1;
+
+FS(15).a = 0.000000;
+FS(15).p = [0.180000;-0.170000];
+FS(15).d = [0.270000;-0.145000;-0.150000;0.195000];
+FS(15).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(15).v = [0.270000 -0.195000; 0.270000 -0.145000; 0.150000 -0.145000; 0.150000 -0.195000; 0.270000 -0.195000];
+FS(15).type = 2;
+
+FS(16).a = 0.000000;
+FS(16).p = [0.195000;-0.130000];
+FS(16).d = [0.265000;-0.105000;-0.170000;0.155000];
+FS(16).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(16).v = [0.265000 -0.155000; 0.265000 -0.105000; 0.170000 -0.105000; 0.170000 -0.155000; 0.265000 -0.155000];
+FS(16).type = 1;
+
+FS(17).a = 0.000000;
+FS(17).p = [0.210000;-0.090000];
+FS(17).d = [0.300000;-0.065000;-0.180000;0.115000];
+FS(17).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(17).v = [0.300000 -0.115000; 0.300000 -0.065000; 0.180000 -0.065000; 0.180000 -0.115000; 0.300000 -0.115000];
+FS(17).type = 2;
+
+FS(18).a = 0.000000;
+FS(18).p = [0.225000;-0.150000];
+FS(18).d = [0.295000;-0.125000;-0.200000;0.175000];
+FS(18).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(18).v = [0.295000 -0.175000; 0.295000 -0.125000; 0.200000 -0.125000; 0.200000 -0.175000; 0.295000 -0.175000];
+FS(18).type = 1;
+
+FS(19).a = 0.000000;
+FS(19).p = [0.240000;-0.210000];
+FS(19).d = [0.330000;-0.185000;-0.210000;0.235000];
+FS(19).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(19).v = [0.330000 -0.235000; 0.330000 -0.185000; 0.210000 -0.185000; 0.210000 -0.235000; 0.330000 -0.235000];
+FS(19).type = 2;
+
+FS(20).a = 0.000000;
+FS(20).p = [0.255000;-0.170000];
+FS(20).d = [0.325000;-0.145000;-0.230000;0.195000];
+FS(20).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(20).v = [0.325000 -0.195000; 0.325000 -0.145000; 0.230000 -0.145000; 0.230000 -0.195000; 0.325000 -0.195000];
+FS(20).type = 1;
+
+FS(21).a = 0.000000;
+FS(21).p = [0.270000;-0.130000];
+FS(21).d = [0.360000;-0.105000;-0.240000;0.155000];
+FS(21).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(21).v = [0.360000 -0.155000; 0.360000 -0.105000; 0.240000 -0.105000; 0.240000 -0.155000; 0.360000 -0.155000];
+FS(21).type = 2;
+
+FS(22).a = 0.000000;
+FS(22).p = [0.270000;-0.180000];
+FS(22).d = [0.360000;-0.155000;-0.240000;0.255000];
+FS(22).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(22).v = [0.360000 -0.255000; 0.360000 -0.155000; 0.240000 -0.155000; 0.240000 -0.255000; 0.360000 -0.255000];
+FS(22).type = 1;
+
+hold on
+for i=1:length(FS)
+    if FS(i).type == 1;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','r','MarkerSize',2)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'c');
+    end
+    if FS(i).type == 2;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','g','MarkerSize',4)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'r');
+    end
+end
+grid on; %axis equal
+
+
+CoM_ZMP = [
+0.000140660188513571 -0.000541447597559858 -0.00210474098596845 0.00810184432692051;
+0.00106270461008452 -0.00367611065715279 -0.00242916377012486 0.00314700516719677;
+0.00325253278699932 -0.00898013714106176 -0.000772608428664896 -0.0102856872408508;
+0.00692395627418477 -0.0136750119489906 0.00286523502285191 -0.025;
+0.0120976271584909 -0.0148121417571533 0.00837682337040316 -0.025;
+0.0186500426557545 -0.0129221442123053 0.0155826613846972 -0.00916867359580329;
+0.0263506505628749 -0.012426101681001 0.0240120363787606 0.00499999999999991;
+0.0349371615343062 -0.0179706999083858 0.0332170607170467 0.00499999999999955;
+0.0441712293504994 -0.0304005530965189 0.0430531008413969 -0.0297980449457828;
+0.0538332457093077 -0.0430450072219816 0.0531943884148129 -0.0649999999999998;
+0.0637480170360355 -0.0492384790200768 0.0633867706480645 -0.065;
+0.0738005572948308 -0.0501011127260844 0.0736851529687675 -0.0501978184158145;
+0.0839021072942323 -0.0509514097635302 0.0839426136593403 -0.0350000000000001;
+0.0939974514109425 -0.057182246211174 0.094049896660832 -0.035;
+0.10407096418825 -0.0699807390915097 0.104169177103942 -0.0698196456915698;
+0.114109291861033 -0.0828197211467877 0.11422566542429 -0.105;
+0.124109591592653 -0.0891159418590939 0.124152935961767 -0.105;
+0.134088931171765 -0.090033078707959 0.134133773392281 -0.0901845115332612;
+0.144050780721303 -0.0909141557447416 0.144107266107363 -0.0750000000000001;
+0.153994910271252 -0.0971617233394294 0.154006996224702 -0.0750000000000002;
+0.16392808643691 -0.109963099258098 0.163998109426645 -0.109903721904364;
+0.173832609687678 -0.1227754158049 0.173997826930418 -0.145;
+0.183676740860874 -0.129021586581512 0.183909905918298 -0.145;
+0.193424965676442 -0.129866774106094 0.193858070426717 -0.129946067049348;
+0.203006378638793 -0.130672957971501 0.203703662695842 -0.115;
+0.212326271242557 -0.136764851956447 0.213278758924097 -0.115;
+0.221279814952709 -0.14924652493739 0.22262071847121 -0.149976914101347;
+0.229726963667877 -0.161432240077046 0.231494598529489 -0.184999999999999;
+0.237514277488651 -0.166508330062408 0.239635978709445 -0.185;
+0.244502692687568 -0.165074927323017 0.24700131351186 -0.171453490778803;
+0.250559636813003 -0.161278115932307 0.253312807046049 -0.155;
+0.255599128527813 -0.159035081738332 0.258329727638197 -0.152965566210609;
+0.259624963003461 -0.158953884815385 0.262130713724685 -0.155;
+0.262716638284141 -0.160403770981916 0.264875302336955 -0.157847682874919;
+0.265000201574056 -0.16281869321032 0.266759931007932 -0.161591767631124;
+0.266622225431422 -0.165710690438509 0.267984997887466 -0.165558788205189;
+0.267729670201776 -0.168679846532278 0.268733232699706 -0.169282670713477;
+0.26845632768631 -0.171441849365787 0.269157927966296 -0.172489305083967;
+0.268915278320861 -0.173826325553004 0.269378800198149 -0.1750602506509;
+0.269196155590689 -0.175758908028873 0.269483106834742 -0.176989468045221;
+0.269365815383716 -0.177236599132973 0.269529886783722 -0.178342002656639;
+0.269471091881255 -0.17830279121475 0.269555625075262 -0.179219500579353;
+0.26954255479927 -0.179025629131602 0.269580127030319 -0.179734454635483;
+0.269598470233122 -0.179481370646718 0.269611837311647 -0.179993099991558;
+0.269648446923635 -0.179743012352723 0.269652208336365 -0.180085743486485;
+0.269696486612937 -0.179873612550895 0.269698994820266 -0.180082813933665;
+0.269743336844078 -0.179923335940295 0.269748530282769 -0.180034860259516;
+0.269788166361904 -0.179929140882354 0.269797141658243 -0.179974925694006;];
+plot (CoM_ZMP(:,1), CoM_ZMP(:,2), 'b');
+plot (CoM_ZMP(:,3), CoM_ZMP(:,4), 'ks','MarkerSize',5);
@@ -0,0 +1,157 @@
+%
+% Footsteps generated using the c++ version of the WMG
+%
+
+cla;
+clear FS;
+
+FS(1).a = 0.000000;
+FS(1).p = [0.000000;0.000000];
+FS(1).d = [0.090000;0.075000;0.030000;0.025000];
+FS(1).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(1).v = [0.090000 -0.025000; 0.090000 0.075000; -0.030000 0.075000; -0.030000 -0.025000; 0.090000 -0.025000];
+FS(1).type = 1;
+
+FS(2).a = 0.000000;
+FS(2).p = [0.000000;-0.050000];
+FS(2).d = [0.090000;-0.025000;0.030000;0.075000];
+FS(2).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(2).v = [0.090000 -0.075000; 0.090000 -0.025000; -0.030000 -0.025000; -0.030000 -0.075000; 0.090000 -0.075000];
+FS(2).type = 2;
+
+FS(3).a = 0.000000;
+FS(3).p = [0.000000;0.030000];
+FS(3).d = [0.090000;0.055000;0.030000;-0.005000];
+FS(3).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(3).v = [0.090000 0.005000; 0.090000 0.055000; -0.030000 0.055000; -0.030000 0.005000; 0.090000 0.005000];
+FS(3).type = 2;
+
+FS(4).a = 0.000000;
+FS(4).p = [0.000000;-0.090000];
+FS(4).d = [0.090000;-0.065000;0.030000;0.115000];
+FS(4).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(4).v = [0.090000 -0.115000; 0.090000 -0.065000; -0.030000 -0.065000; -0.030000 -0.115000; 0.090000 -0.115000];
+FS(4).type = 2;
+
+FS(5).a = 0.000000;
+FS(5).p = [0.000000;-0.010000];
+FS(5).d = [0.090000;0.015000;0.030000;0.035000];
+FS(5).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(5).v = [0.090000 -0.035000; 0.090000 0.015000; -0.030000 0.015000; -0.030000 -0.035000; 0.090000 -0.035000];
+FS(5).type = 2;
+
+FS(6).a = 0.000000;
+FS(6).p = [0.000000;-0.130000];
+FS(6).d = [0.090000;-0.105000;0.030000;0.155000];
+FS(6).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(6).v = [0.090000 -0.155000; 0.090000 -0.105000; -0.030000 -0.105000; -0.030000 -0.155000; 0.090000 -0.155000];
+FS(6).type = 2;
+
+FS(7).a = 0.000000;
+FS(7).p = [0.000000;-0.050000];
+FS(7).d = [0.090000;-0.025000;0.030000;0.075000];
+FS(7).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(7).v = [0.090000 -0.075000; 0.090000 -0.025000; -0.030000 -0.025000; -0.030000 -0.075000; 0.090000 -0.075000];
+FS(7).type = 2;
+
+FS(8).a = 0.000000;
+FS(8).p = [0.000000;-0.170000];
+FS(8).d = [0.090000;-0.145000;0.030000;0.195000];
+FS(8).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(8).v = [0.090000 -0.195000; 0.090000 -0.145000; -0.030000 -0.145000; -0.030000 -0.195000; 0.090000 -0.195000];
+FS(8).type = 2;
+
+FS(9).a = 0.000000;
+FS(9).p = [0.000000;-0.090000];
+FS(9).d = [0.090000;-0.065000;0.030000;0.115000];
+FS(9).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(9).v = [0.090000 -0.115000; 0.090000 -0.065000; -0.030000 -0.065000; -0.030000 -0.115000; 0.090000 -0.115000];
+FS(9).type = 2;
+
+FS(10).a = 0.000000;
+FS(10).p = [0.000000;-0.210000];
+FS(10).d = [0.090000;-0.185000;0.030000;0.235000];
+FS(10).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(10).v = [0.090000 -0.235000; 0.090000 -0.185000; -0.030000 -0.185000; -0.030000 -0.235000; 0.090000 -0.235000];
+FS(10).type = 2;
+
+FS(11).a = 0.000000;
+FS(11).p = [0.000000;-0.130000];
+FS(11).d = [0.090000;-0.105000;0.030000;0.155000];
+FS(11).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(11).v = [0.090000 -0.155000; 0.090000 -0.105000; -0.030000 -0.105000; -0.030000 -0.155000; 0.090000 -0.155000];
+FS(11).type = 2;
+
+FS(12).a = 0.000000;
+FS(12).p = [0.000000;-0.180000];
+FS(12).d = [0.090000;-0.155000;0.030000;0.255000];
+FS(12).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(12).v = [0.090000 -0.255000; 0.090000 -0.155000; -0.030000 -0.155000; -0.030000 -0.255000; 0.090000 -0.255000];
+FS(12).type = 1;
+
+hold on
+for i=1:length(FS)
+    if FS(i).type == 1;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','r','MarkerSize',2)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'c');
+    end
+    if FS(i).type == 2;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','g','MarkerSize',4)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'r');
+    end
+end
+grid on; %axis equal
+
+
+CoM_ZMP = [
+0 -0.000547925305395967 0 0.00819877223031062;
+0 -0.00375937576883438 0 0.00377249257445442;
+0 -0.00940607024475672 0 -0.00940570370653882;
+0 -0.0148914433317393 0 -0.0249999999999999;
+0 -0.0171265826620183 0 -0.0285771880011643;
+0 -0.0152483750226213 0 -0.0249999999999993;
+0 -0.0112257920139215 0 0.00499999999999966;
+0 -0.0122163414647792 0 0.0126582666460104;
+0 -0.0221575295272857 0 0.00499999999999907;
+0 -0.0388220623937632 0 -0.0649999999999992;
+0 -0.049162804125253 0 -0.0725571756575374;
+0 -0.0511329421235954 0 -0.0649999999999998;
+0 -0.0490425111471682 0 -0.0350000000000002;
+0 -0.0510766543602048 0 -0.0275378145618288;
+0 -0.0615520267593833 0 -0.0350000000000006;
+0 -0.0784948447216602 0 -0.105;
+0 -0.088983922745215 0 -0.112538332917638;
+0 -0.0910357060558804 0 -0.105;
+0 -0.0889891898401997 0 -0.0750000000000007;
+0 -0.0910426832340231 0 -0.0675854539668476;
+0 -0.101511049040775 0 -0.0750000000000004;
+0 -0.118427245374997 0 -0.144999999999999;
+0 -0.128878869446712 0 -0.152294824177951;
+0 -0.130916169347101 0 -0.145;
+0 -0.1288235115023 0 -0.115;
+0 -0.130760917476814 0 -0.107638003974434;
+0 -0.140986165448226 0 -0.115000000000001;
+0 -0.157445263677126 0 -0.185;
+0 -0.167027575698003 0 -0.192571016056159;
+0 -0.167379398145623 0 -0.185;
+0 -0.162164626869828 0 -0.155;
+0 -0.158150894976304 0 -0.150016245324602;
+0 -0.157030177257379 0 -0.150551341598246;
+0 -0.15824580549131 0 -0.155;
+0 -0.16078267495158 0 -0.159153358871104;
+0 -0.163951361500666 0 -0.163628543841033;
+0 -0.167265540894872 0 -0.167863581278932;
+0 -0.170378237632732 0 -0.171525222398707;
+0 -0.173079209762136 0 -0.174465714889525;
+0 -0.175273323548976 0 -0.176671451448332;
+0 -0.176951136827543 0 -0.178213981427453;
+0 -0.178159155700093 0 -0.179209119735662;
+0 -0.178974085818139 0 -0.179786379872632;
+0 -0.179483016929688 0 -0.180068631458774;
+0 -0.179769847957519 0 -0.180160546664367;
+0 -0.179907277116338 0 -0.180143815026664;
+0 -0.179953203820249 0 -0.180077034862383;
+0 -0.17995026711477 0 -0.179998426433499;
+0 -0.179927345844511 0 -0.179929897185409;];
+plot (CoM_ZMP(:,1), CoM_ZMP(:,2), 'b');
+plot (CoM_ZMP(:,3), CoM_ZMP(:,4), 'ks','MarkerSize',5);
@@ -0,0 +1,1883 @@
+%
+% Footsteps generated using the c++ version of the WMG
+%
+
+cla;
+clear FS;
+
+FS(1).a = 0.000000;
+FS(1).p = [0.000000;0.050000];
+FS(1).d = [0.090000;0.075000;0.030000;-0.025000];
+FS(1).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(1).v = [0.090000 0.025000; 0.090000 0.075000; -0.030000 0.075000; -0.030000 0.025000; 0.090000 0.025000];
+FS(1).type = 2;
+
+FS(2).a = 0.000000;
+FS(2).p = [0.000000;0.000000];
+FS(2).d = [0.090000;0.075000;0.030000;0.075000];
+FS(2).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(2).v = [0.090000 -0.075000; 0.090000 0.075000; -0.030000 0.075000; -0.030000 -0.075000; 0.090000 -0.075000];
+FS(2).type = 1;
+
+FS(3).a = 0.000000;
+FS(3).p = [0.000000;-0.016667];
+FS(3).d = [0.070000;0.008333;0.025000;0.041667];
+FS(3).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(3).v = [0.070000 -0.041667; 0.070000 0.008333; -0.025000 0.008333; -0.025000 -0.041667; 0.070000 -0.041667];
+FS(3).type = 1;
+
+FS(4).a = 0.000000;
+FS(4).p = [0.000000;-0.033333];
+FS(4).d = [0.070000;-0.008333;0.025000;0.058333];
+FS(4).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(4).v = [0.070000 -0.058333; 0.070000 -0.008333; -0.025000 -0.008333; -0.025000 -0.058333; 0.070000 -0.058333];
+FS(4).type = 1;
+
+FS(5).a = 0.000000;
+FS(5).p = [0.000000;-0.050000];
+FS(5).d = [0.090000;-0.025000;0.030000;0.075000];
+FS(5).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(5).v = [0.090000 -0.075000; 0.090000 -0.025000; -0.030000 -0.025000; -0.030000 -0.075000; 0.090000 -0.075000];
+FS(5).type = 2;
+
+FS(6).a = 0.000000;
+FS(6).p = [0.013333;-0.016667];
+FS(6).d = [0.083333;0.008333;0.011667;0.041667];
+FS(6).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(6).v = [0.083333 -0.041667; 0.083333 0.008333; -0.011667 0.008333; -0.011667 -0.041667; 0.083333 -0.041667];
+FS(6).type = 1;
+
+FS(7).a = 0.000000;
+FS(7).p = [0.026667;0.016667];
+FS(7).d = [0.096667;0.041667;-0.001667;0.008333];
+FS(7).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(7).v = [0.096667 -0.008333; 0.096667 0.041667; 0.001667 0.041667; 0.001667 -0.008333; 0.096667 -0.008333];
+FS(7).type = 1;
+
+FS(8).a = 0.000000;
+FS(8).p = [0.040000;0.050000];
+FS(8).d = [0.130000;0.075000;-0.010000;-0.025000];
+FS(8).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(8).v = [0.130000 0.025000; 0.130000 0.075000; 0.010000 0.075000; 0.010000 0.025000; 0.130000 0.025000];
+FS(8).type = 2;
+
+FS(9).a = 0.000000;
+FS(9).p = [0.053333;0.016667];
+FS(9).d = [0.123333;0.041667;-0.028333;0.008333];
+FS(9).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(9).v = [0.123333 -0.008333; 0.123333 0.041667; 0.028333 0.041667; 0.028333 -0.008333; 0.123333 -0.008333];
+FS(9).type = 1;
+
+FS(10).a = 0.000000;
+FS(10).p = [0.066667;-0.016667];
+FS(10).d = [0.136667;0.008333;-0.041667;0.041667];
+FS(10).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(10).v = [0.136667 -0.041667; 0.136667 0.008333; 0.041667 0.008333; 0.041667 -0.041667; 0.136667 -0.041667];
+FS(10).type = 1;
+
+FS(11).a = 0.000000;
+FS(11).p = [0.080000;-0.050000];
+FS(11).d = [0.170000;-0.025000;-0.050000;0.075000];
+FS(11).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(11).v = [0.170000 -0.075000; 0.170000 -0.025000; 0.050000 -0.025000; 0.050000 -0.075000; 0.170000 -0.075000];
+FS(11).type = 2;
+
+FS(12).a = 0.000000;
+FS(12).p = [0.093333;-0.016667];
+FS(12).d = [0.163333;0.008333;-0.068333;0.041667];
+FS(12).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(12).v = [0.163333 -0.041667; 0.163333 0.008333; 0.068333 0.008333; 0.068333 -0.041667; 0.163333 -0.041667];
+FS(12).type = 1;
+
+FS(13).a = 0.000000;
+FS(13).p = [0.106667;0.016667];
+FS(13).d = [0.176667;0.041667;-0.081667;0.008333];
+FS(13).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(13).v = [0.176667 -0.008333; 0.176667 0.041667; 0.081667 0.041667; 0.081667 -0.008333; 0.176667 -0.008333];
+FS(13).type = 1;
+
+FS(14).a = 0.000000;
+FS(14).p = [0.120000;0.050000];
+FS(14).d = [0.210000;0.075000;-0.090000;-0.025000];
+FS(14).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(14).v = [0.210000 0.025000; 0.210000 0.075000; 0.090000 0.075000; 0.090000 0.025000; 0.210000 0.025000];
+FS(14).type = 2;
+
+FS(15).a = 0.000000;
+FS(15).p = [0.133333;0.016667];
+FS(15).d = [0.203333;0.041667;-0.108333;0.008333];
+FS(15).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(15).v = [0.203333 -0.008333; 0.203333 0.041667; 0.108333 0.041667; 0.108333 -0.008333; 0.203333 -0.008333];
+FS(15).type = 1;
+
+FS(16).a = 0.000000;
+FS(16).p = [0.146667;-0.016667];
+FS(16).d = [0.216667;0.008333;-0.121667;0.041667];
+FS(16).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(16).v = [0.216667 -0.041667; 0.216667 0.008333; 0.121667 0.008333; 0.121667 -0.041667; 0.216667 -0.041667];
+FS(16).type = 1;
+
+FS(17).a = 0.000000;
+FS(17).p = [0.160000;-0.050000];
+FS(17).d = [0.250000;-0.025000;-0.130000;0.075000];
+FS(17).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(17).v = [0.250000 -0.075000; 0.250000 -0.025000; 0.130000 -0.025000; 0.130000 -0.075000; 0.250000 -0.075000];
+FS(17).type = 2;
+
+FS(18).a = 0.000000;
+FS(18).p = [0.173333;-0.016667];
+FS(18).d = [0.243333;0.008333;-0.148333;0.041667];
+FS(18).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(18).v = [0.243333 -0.041667; 0.243333 0.008333; 0.148333 0.008333; 0.148333 -0.041667; 0.243333 -0.041667];
+FS(18).type = 1;
+
+FS(19).a = 0.000000;
+FS(19).p = [0.186667;0.016667];
+FS(19).d = [0.256667;0.041667;-0.161667;0.008333];
+FS(19).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(19).v = [0.256667 -0.008333; 0.256667 0.041667; 0.161667 0.041667; 0.161667 -0.008333; 0.256667 -0.008333];
+FS(19).type = 1;
+
+FS(20).a = 0.000000;
+FS(20).p = [0.200000;0.050000];
+FS(20).d = [0.290000;0.075000;-0.170000;-0.025000];
+FS(20).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(20).v = [0.290000 0.025000; 0.290000 0.075000; 0.170000 0.075000; 0.170000 0.025000; 0.290000 0.025000];
+FS(20).type = 2;
+
+FS(21).a = 0.000000;
+FS(21).p = [0.213333;0.016667];
+FS(21).d = [0.283333;0.041667;-0.188333;0.008333];
+FS(21).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(21).v = [0.283333 -0.008333; 0.283333 0.041667; 0.188333 0.041667; 0.188333 -0.008333; 0.283333 -0.008333];
+FS(21).type = 1;
+
+FS(22).a = 0.000000;
+FS(22).p = [0.226667;-0.016667];
+FS(22).d = [0.296667;0.008333;-0.201667;0.041667];
+FS(22).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(22).v = [0.296667 -0.041667; 0.296667 0.008333; 0.201667 0.008333; 0.201667 -0.041667; 0.296667 -0.041667];
+FS(22).type = 1;
+
+FS(23).a = 0.000000;
+FS(23).p = [0.240000;-0.050000];
+FS(23).d = [0.330000;-0.025000;-0.210000;0.075000];
+FS(23).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(23).v = [0.330000 -0.075000; 0.330000 -0.025000; 0.210000 -0.025000; 0.210000 -0.075000; 0.330000 -0.075000];
+FS(23).type = 2;
+
+FS(24).a = 0.000000;
+FS(24).p = [0.253333;-0.016667];
+FS(24).d = [0.323333;0.008333;-0.228333;0.041667];
+FS(24).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(24).v = [0.323333 -0.041667; 0.323333 0.008333; 0.228333 0.008333; 0.228333 -0.041667; 0.323333 -0.041667];
+FS(24).type = 1;
+
+FS(25).a = 0.000000;
+FS(25).p = [0.266667;0.016667];
+FS(25).d = [0.336667;0.041667;-0.241667;0.008333];
+FS(25).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(25).v = [0.336667 -0.008333; 0.336667 0.041667; 0.241667 0.041667; 0.241667 -0.008333; 0.336667 -0.008333];
+FS(25).type = 1;
+
+FS(26).a = 0.000000;
+FS(26).p = [0.280000;0.050000];
+FS(26).d = [0.370000;0.075000;-0.250000;-0.025000];
+FS(26).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(26).v = [0.370000 0.025000; 0.370000 0.075000; 0.250000 0.075000; 0.250000 0.025000; 0.370000 0.025000];
+FS(26).type = 2;
+
+FS(27).a = 0.000000;
+FS(27).p = [0.293333;0.016667];
+FS(27).d = [0.363333;0.041667;-0.268333;0.008333];
+FS(27).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(27).v = [0.363333 -0.008333; 0.363333 0.041667; 0.268333 0.041667; 0.268333 -0.008333; 0.363333 -0.008333];
+FS(27).type = 1;
+
+FS(28).a = 0.000000;
+FS(28).p = [0.306667;-0.016667];
+FS(28).d = [0.376667;0.008333;-0.281667;0.041667];
+FS(28).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(28).v = [0.376667 -0.041667; 0.376667 0.008333; 0.281667 0.008333; 0.281667 -0.041667; 0.376667 -0.041667];
+FS(28).type = 1;
+
+FS(29).a = 0.000000;
+FS(29).p = [0.320000;-0.050000];
+FS(29).d = [0.410000;-0.025000;-0.290000;0.075000];
+FS(29).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(29).v = [0.410000 -0.075000; 0.410000 -0.025000; 0.290000 -0.025000; 0.290000 -0.075000; 0.410000 -0.075000];
+FS(29).type = 2;
+
+FS(30).a = 0.000000;
+FS(30).p = [0.333333;-0.016667];
+FS(30).d = [0.403333;0.008333;-0.308333;0.041667];
+FS(30).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(30).v = [0.403333 -0.041667; 0.403333 0.008333; 0.308333 0.008333; 0.308333 -0.041667; 0.403333 -0.041667];
+FS(30).type = 1;
+
+FS(31).a = 0.000000;
+FS(31).p = [0.346667;0.016667];
+FS(31).d = [0.416667;0.041667;-0.321667;0.008333];
+FS(31).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(31).v = [0.416667 -0.008333; 0.416667 0.041667; 0.321667 0.041667; 0.321667 -0.008333; 0.416667 -0.008333];
+FS(31).type = 1;
+
+FS(32).a = 0.000000;
+FS(32).p = [0.360000;0.050000];
+FS(32).d = [0.450000;0.075000;-0.330000;-0.025000];
+FS(32).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(32).v = [0.450000 0.025000; 0.450000 0.075000; 0.330000 0.075000; 0.330000 0.025000; 0.450000 0.025000];
+FS(32).type = 2;
+
+FS(33).a = 0.000000;
+FS(33).p = [0.360000;0.000000];
+FS(33).d = [0.450000;0.075000;-0.330000;0.075000];
+FS(33).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(33).v = [0.450000 -0.075000; 0.450000 0.075000; 0.330000 0.075000; 0.330000 -0.075000; 0.450000 -0.075000];
+FS(33).type = 1;
+
+FS(34).a = 0.000000;
+FS(34).p = [0.360000;-0.050000];
+FS(34).d = [0.450000;-0.025000;-0.330000;0.075000];
+FS(34).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(34).v = [0.450000 -0.075000; 0.450000 -0.025000; 0.330000 -0.025000; 0.330000 -0.075000; 0.450000 -0.075000];
+FS(34).type = 2;
+
+hold on
+for i=1:length(FS)
+    if FS(i).type == 1;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','r','MarkerSize',2)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'c');
+    end
+    if FS(i).type == 2;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','g','MarkerSize',4)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'r');
+    end
+end
+grid on; %axis equal
+hold on
+LFP = [
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000519 0.051390 0.002534;
+0.001956 0.052667 0.005033;
+0.004100 0.053789 0.007464;
+0.006732 0.054737 0.009790;
+0.009655 0.055506 0.011979;
+0.012705 0.056104 0.013994;
+0.015758 0.056545 0.015802;
+0.018726 0.056847 0.017369;
+0.021552 0.057024 0.018659;
+0.024202 0.057093 0.019638;
+0.026657 0.057065 0.020271;
+0.028912 0.056949 0.020525;
+0.030965 0.056747 0.020364;
+0.032821 0.056462 0.019753;
+0.034483 0.056085 0.018659;
+0.035955 0.055606 0.017046;
+0.037235 0.055000 0.014881;
+0.038315 0.054231 0.012128;
+0.039174 0.053232 0.008754;
+0.039767 0.051893 0.004722;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.040000 0.050000 0.000000;
+0.041039 0.051390 0.002534;
+0.043912 0.052667 0.005033;
+0.048199 0.053789 0.007464;
+0.053464 0.054737 0.009790;
+0.059310 0.055506 0.011979;
+0.065409 0.056104 0.013994;
+0.071515 0.056545 0.015802;
+0.077452 0.056847 0.017369;
+0.083104 0.057024 0.018659;
+0.088404 0.057093 0.019638;
+0.093315 0.057065 0.020271;
+0.097823 0.056949 0.020525;
+0.101930 0.056747 0.020364;
+0.105641 0.056462 0.019753;
+0.108966 0.056085 0.018659;
+0.111909 0.055606 0.017046;
+0.114469 0.055000 0.014881;
+0.116630 0.054231 0.012128;
+0.118348 0.053232 0.008754;
+0.119534 0.051893 0.004722;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.120000 0.050000 0.000000;
+0.121039 0.051390 0.002534;
+0.123912 0.052667 0.005033;
+0.128199 0.053789 0.007464;
+0.133464 0.054737 0.009790;
+0.139310 0.055506 0.011979;
+0.145409 0.056104 0.013994;
+0.151515 0.056545 0.015802;
+0.157452 0.056847 0.017369;
+0.163104 0.057024 0.018659;
+0.168404 0.057093 0.019638;
+0.173315 0.057065 0.020271;
+0.177823 0.056949 0.020525;
+0.181930 0.056747 0.020364;
+0.185641 0.056462 0.019753;
+0.188966 0.056085 0.018659;
+0.191909 0.055606 0.017046;
+0.194469 0.055000 0.014881;
+0.196630 0.054231 0.012128;
+0.198348 0.053232 0.008754;
+0.199534 0.051893 0.004722;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.200000 0.050000 0.000000;
+0.201039 0.051390 0.002534;
+0.203912 0.052667 0.005033;
+0.208199 0.053789 0.007464;
+0.213464 0.054737 0.009790;
+0.219310 0.055506 0.011979;
+0.225409 0.056104 0.013994;
+0.231515 0.056545 0.015802;
+0.237452 0.056847 0.017369;
+0.243104 0.057024 0.018659;
+0.248404 0.057093 0.019638;
+0.253315 0.057065 0.020271;
+0.257823 0.056949 0.020525;
+0.261930 0.056747 0.020364;
+0.265641 0.056462 0.019753;
+0.268966 0.056085 0.018659;
+0.271909 0.055606 0.017046;
+0.274469 0.055000 0.014881;
+0.276630 0.054231 0.012128;
+0.278348 0.053232 0.008754;
+0.279534 0.051893 0.004722;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.280000 0.050000 0.000000;
+0.281039 0.051390 0.002534;
+0.283912 0.052667 0.005033;
+0.288199 0.053789 0.007464;
+0.293464 0.054737 0.009790;
+0.299310 0.055506 0.011979;
+0.305409 0.056104 0.013994;
+0.311515 0.056545 0.015802;
+0.317452 0.056847 0.017369;
+0.323104 0.057024 0.018659;
+0.328404 0.057093 0.019638;
+0.333315 0.057065 0.020271;
+0.337823 0.056949 0.020525;
+0.341930 0.056747 0.020364;
+0.345641 0.056462 0.019753;
+0.348966 0.056085 0.018659;
+0.351909 0.055606 0.017046;
+0.354469 0.055000 0.014881;
+0.356630 0.054231 0.012128;
+0.358348 0.053232 0.008754;
+0.359534 0.051893 0.004722;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+0.360000 0.050000 0.000000;
+];
+
+ plot3(LFP(:,1), LFP(:,2), LFP(:,3), 'r')
+RFP = [
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.001039 -0.051390 0.002534;
+0.003912 -0.052667 0.005033;
+0.008199 -0.053789 0.007464;
+0.013464 -0.054737 0.009790;
+0.019310 -0.055506 0.011979;
+0.025409 -0.056104 0.013994;
+0.031515 -0.056545 0.015802;
+0.037452 -0.056847 0.017369;
+0.043104 -0.057024 0.018659;
+0.048404 -0.057093 0.019638;
+0.053315 -0.057065 0.020271;
+0.057823 -0.056949 0.020525;
+0.061930 -0.056747 0.020364;
+0.065641 -0.056462 0.019753;
+0.068966 -0.056085 0.018659;
+0.071909 -0.055606 0.017046;
+0.074469 -0.055000 0.014881;
+0.076630 -0.054231 0.012128;
+0.078348 -0.053232 0.008754;
+0.079534 -0.051893 0.004722;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.080000 -0.050000 0.000000;
+0.081039 -0.051390 0.002534;
+0.083912 -0.052667 0.005033;
+0.088199 -0.053789 0.007464;
+0.093464 -0.054737 0.009790;
+0.099310 -0.055506 0.011979;
+0.105409 -0.056104 0.013994;
+0.111515 -0.056545 0.015802;
+0.117452 -0.056847 0.017369;
+0.123104 -0.057024 0.018659;
+0.128404 -0.057093 0.019638;
+0.133315 -0.057065 0.020271;
+0.137823 -0.056949 0.020525;
+0.141930 -0.056747 0.020364;
+0.145641 -0.056462 0.019753;
+0.148966 -0.056085 0.018659;
+0.151909 -0.055606 0.017046;
+0.154469 -0.055000 0.014881;
+0.156630 -0.054231 0.012128;
+0.158348 -0.053232 0.008754;
+0.159534 -0.051893 0.004722;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.160000 -0.050000 0.000000;
+0.161039 -0.051390 0.002534;
+0.163912 -0.052667 0.005033;
+0.168199 -0.053789 0.007464;
+0.173464 -0.054737 0.009790;
+0.179310 -0.055506 0.011979;
+0.185409 -0.056104 0.013994;
+0.191515 -0.056545 0.015802;
+0.197452 -0.056847 0.017369;
+0.203104 -0.057024 0.018659;
+0.208404 -0.057093 0.019638;
+0.213315 -0.057065 0.020271;
+0.217823 -0.056949 0.020525;
+0.221930 -0.056747 0.020364;
+0.225641 -0.056462 0.019753;
+0.228966 -0.056085 0.018659;
+0.231909 -0.055606 0.017046;
+0.234469 -0.055000 0.014881;
+0.236630 -0.054231 0.012128;
+0.238348 -0.053232 0.008754;
+0.239534 -0.051893 0.004722;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.240000 -0.050000 0.000000;
+0.241039 -0.051390 0.002534;
+0.243912 -0.052667 0.005033;
+0.248199 -0.053789 0.007464;
+0.253464 -0.054737 0.009790;
+0.259310 -0.055506 0.011979;
+0.265409 -0.056104 0.013994;
+0.271515 -0.056545 0.015802;
+0.277452 -0.056847 0.017369;
+0.283104 -0.057024 0.018659;
+0.288404 -0.057093 0.019638;
+0.293315 -0.057065 0.020271;
+0.297823 -0.056949 0.020525;
+0.301930 -0.056747 0.020364;
+0.305641 -0.056462 0.019753;
+0.308966 -0.056085 0.018659;
+0.311909 -0.055606 0.017046;
+0.314469 -0.055000 0.014881;
+0.316630 -0.054231 0.012128;
+0.318348 -0.053232 0.008754;
+0.319534 -0.051893 0.004722;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320000 -0.050000 0.000000;
+0.320519 -0.051390 0.002534;
+0.321956 -0.052667 0.005033;
+0.324100 -0.053789 0.007464;
+0.326732 -0.054737 0.009790;
+0.329655 -0.055506 0.011979;
+0.332705 -0.056104 0.013994;
+0.335758 -0.056545 0.015802;
+0.338726 -0.056847 0.017369;
+0.341552 -0.057024 0.018659;
+0.344202 -0.057093 0.019638;
+0.346657 -0.057065 0.020271;
+0.348912 -0.056949 0.020525;
+0.350965 -0.056747 0.020364;
+0.352821 -0.056462 0.019753;
+0.354483 -0.056085 0.018659;
+0.355955 -0.055606 0.017046;
+0.357235 -0.055000 0.014881;
+0.358315 -0.054231 0.012128;
+0.359174 -0.053232 0.008754;
+0.359767 -0.051893 0.004722;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+0.360000 -0.050000 0.000000;
+];
+
+ plot3(RFP(:,1), RFP(:,2), RFP(:,3), 'r')
+ZMP = [
+0.019979 -0.000065;
+0.019861 -0.000059;
+0.019582 -0.000007;
+0.019443 0.000033;
+0.019468 0.000055;
+0.019669 0.000060;
+0.020046 0.000047;
+0.020587 0.000009;
+0.021272 -0.000061;
+0.022074 -0.000172;
+0.022949 -0.000383;
+0.023870 -0.000635;
+0.024810 -0.000910;
+0.025744 -0.001246;
+0.026647 -0.001700;
+0.027498 -0.002340;
+0.028283 -0.003237;
+0.028993 -0.004467;
+0.029623 -0.006098;
+0.030163 -0.008179;
+0.030630 -0.010800;
+0.031049 -0.014080;
+0.031465 -0.018067;
+0.031924 -0.022874;
+0.032517 -0.027949;
+0.033248 -0.033067;
+0.034174 -0.037860;
+0.035353 -0.041556;
+0.036832 -0.042932;
+0.038678 -0.040963;
+0.040952 -0.034586;
+0.043741 -0.023390;
+0.047190 -0.008249;
+0.051086 0.025000;
+0.055252 0.031023;
+0.059618 0.034288;
+0.064126 0.035088;
+0.068721 0.033887;
+0.073385 0.031354;
+0.078118 0.027949;
+0.082947 0.020794;
+0.088001 0.006355;
+0.093077 -0.025000;
+0.098013 -0.031848;
+0.102768 -0.036299;
+0.107327 -0.038351;
+0.111687 -0.037990;
+0.115886 -0.035201;
+0.119979 -0.029909;
+0.124070 -0.020721;
+0.128344 -0.006199;
+0.132659 0.025000;
+0.136879 0.031666;
+0.140995 0.035854;
+0.145020 0.037625;
+0.148968 0.037075;
+0.152885 0.034340;
+0.156829 0.029470;
+0.160897 0.020737;
+0.165263 0.006233;
+0.169760 -0.025000;
+0.174244 -0.031709;
+0.178689 -0.035957;
+0.183087 -0.037792;
+0.187431 -0.037285;
+0.191751 -0.034537;
+0.196087 -0.029571;
+0.200516 -0.020733;
+0.205202 -0.006225;
+0.209968 0.025000;
+0.214668 0.031699;
+0.219272 0.035934;
+0.223774 0.037755;
+0.228169 0.037238;
+0.232492 0.034493;
+0.236788 0.029548;
+0.241145 0.020734;
+0.245734 0.006227;
+0.250389 -0.025000;
+0.254967 -0.031701;
+0.259448 -0.035940;
+0.263830 -0.037763;
+0.268114 -0.037249;
+0.272339 -0.034503;
+0.276553 -0.029553;
+0.280847 -0.020734;
+0.285392 -0.006226;
+0.290022 0.025000;
+0.294594 0.031701;
+0.299084 0.035938;
+0.303490 0.037761;
+0.307825 0.037216;
+0.312118 0.034440;
+0.316409 0.029518;
+0.320778 0.020732;
+0.325388 0.006238;
+0.330059 -0.025000;
+0.334648 -0.031621;
+0.339125 -0.035769;
+0.343479 -0.037510;
+0.347715 -0.036940;
+0.351850 -0.034239;
+0.355913 -0.029445;
+0.359953 -0.021122;
+0.364110 -0.007630;
+0.368145 0.025000;
+0.371915 0.032564;
+0.375359 0.037518;
+0.378427 0.039965;
+0.381088 0.040069;
+0.383322 0.038043;
+0.385126 0.034133;
+0.386519 0.028747;
+0.387527 0.022237;
+0.388188 0.015207;
+0.388546 0.008062;
+0.388650 0.001162;
+0.388552 -0.005188;
+0.388306 -0.010747;
+0.387962 -0.015340;
+0.387567 -0.018856;
+0.387162 -0.021249;
+0.386783 -0.022529;
+0.386459 -0.022758;
+];
+
+ plot(ZMP(:,1), ZMP(:,2), 'k')
+ZMPref = [
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.070000 0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.110000 -0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.150000 0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.190000 -0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.230000 0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.270000 -0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.310000 0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.350000 -0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.050000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+0.390000 0.000000;
+];
+
+ plot(ZMPref(:,1), ZMPref(:,2), 'ko')
+CoM = [
+0.019979 -0.000065;
+0.019981 -0.000065;
+0.019987 -0.000066;
+0.019997 -0.000067;
+0.020013 -0.000069;
+0.020037 -0.000072;
+0.020070 -0.000076;
+0.020111 -0.000083;
+0.020163 -0.000091;
+0.020226 -0.000101;
+0.020300 -0.000113;
+0.020386 -0.000128;
+0.020485 -0.000146;
+0.020595 -0.000167;
+0.020718 -0.000192;
+0.020852 -0.000220;
+0.020999 -0.000252;
+0.021158 -0.000289;
+0.021329 -0.000330;
+0.021510 -0.000377;
+0.021702 -0.000429;
+0.021905 -0.000486;
+0.022117 -0.000551;
+0.022337 -0.000622;
+0.022566 -0.000701;
+0.022802 -0.000787;
+0.023045 -0.000882;
+0.023294 -0.000986;
+0.023548 -0.001098;
+0.023807 -0.001220;
+0.024069 -0.001353;
+0.024334 -0.001496;
+0.024602 -0.001651;
+0.024871 -0.001819;
+0.025141 -0.002000;
+0.025411 -0.002197;
+0.025681 -0.002409;
+0.025950 -0.002639;
+0.026218 -0.002888;
+0.026484 -0.003158;
+0.026747 -0.003450;
+0.027007 -0.003765;
+0.027264 -0.004105;
+0.027518 -0.004472;
+0.027768 -0.004867;
+0.028014 -0.005292;
+0.028256 -0.005747;
+0.028494 -0.006235;
+0.028728 -0.006757;
+0.028958 -0.007312;
+0.029184 -0.007904;
+0.029407 -0.008531;
+0.029627 -0.009195;
+0.029843 -0.009896;
+0.030058 -0.010634;
+0.030271 -0.011410;
+0.030483 -0.012222;
+0.030696 -0.013069;
+0.030909 -0.013951;
+0.031124 -0.014864;
+0.031343 -0.015807;
+0.031566 -0.016776;
+0.031794 -0.017767;
+0.032030 -0.018775;
+0.032274 -0.019794;
+0.032528 -0.020816;
+0.032794 -0.021833;
+0.033073 -0.022835;
+0.033366 -0.023811;
+0.033675 -0.024751;
+0.034002 -0.025643;
+0.034347 -0.026474;
+0.034714 -0.027232;
+0.035102 -0.027902;
+0.035514 -0.028469;
+0.035951 -0.028919;
+0.036416 -0.029234;
+0.036908 -0.029399;
+0.037431 -0.029397;
+0.037984 -0.029212;
+0.038571 -0.028830;
+0.039191 -0.028238;
+0.039848 -0.027426;
+0.040541 -0.026384;
+0.041272 -0.025106;
+0.042042 -0.023591;
+0.042852 -0.021837;
+0.043703 -0.019852;
+0.044595 -0.017646;
+0.045529 -0.015232;
+0.046504 -0.012630;
+0.047521 -0.009867;
+0.048579 -0.006969;
+0.049676 -0.003970;
+0.050811 -0.000906;
+0.051982 0.002168;
+0.053186 0.005109;
+0.054421 0.007780;
+0.055687 0.010156;
+0.056980 0.012245;
+0.058299 0.014052;
+0.059643 0.015582;
+0.061009 0.016844;
+0.062397 0.017843;
+0.063804 0.018587;
+0.065229 0.019083;
+0.066671 0.019338;
+0.068128 0.019359;
+0.069600 0.019153;
+0.071085 0.018725;
+0.072582 0.018079;
+0.074091 0.017219;
+0.075611 0.016146;
+0.077140 0.014861;
+0.078679 0.013360;
+0.080226 0.011640;
+0.081781 0.009695;
+0.083343 0.007526;
+0.084911 0.005157;
+0.086484 0.002618;
+0.088060 -0.000056;
+0.089637 -0.002827;
+0.091213 -0.005640;
+0.092786 -0.008359;
+0.094355 -0.010854;
+0.095919 -0.013099;
+0.097475 -0.015092;
+0.099024 -0.016833;
+0.100564 -0.018322;
+0.102094 -0.019560;
+0.103614 -0.020546;
+0.105124 -0.021281;
+0.106624 -0.021766;
+0.108113 -0.022002;
+0.109592 -0.021990;
+0.111061 -0.021731;
+0.112521 -0.021229;
+0.113972 -0.020484;
+0.115415 -0.019500;
+0.116852 -0.018280;
+0.118282 -0.016828;
+0.119707 -0.015147;
+0.121128 -0.013245;
+0.122546 -0.011127;
+0.123961 -0.008804;
+0.125375 -0.006302;
+0.126788 -0.003649;
+0.128199 -0.000879;
+0.129608 0.001972;
+0.131015 0.004850;
+0.132418 0.007621;
+0.133818 0.010157;
+0.135214 0.012433;
+0.136606 0.014448;
+0.137994 0.016205;
+0.139379 0.017705;
+0.140759 0.018949;
+0.142136 0.019938;
+0.143510 0.020676;
+0.144882 0.021164;
+0.146251 0.021404;
+0.147620 0.021400;
+0.148987 0.021153;
+0.150356 0.020667;
+0.151725 0.019945;
+0.153097 0.018989;
+0.154472 0.017802;
+0.155852 0.016387;
+0.157236 0.014746;
+0.158627 0.012885;
+0.160025 0.010805;
+0.161430 0.008517;
+0.162843 0.006045;
+0.164264 0.003417;
+0.165693 0.000668;
+0.167129 -0.002165;
+0.168570 -0.005028;
+0.170015 -0.007788;
+0.171465 -0.010315;
+0.172918 -0.012584;
+0.174374 -0.014594;
+0.175831 -0.016348;
+0.177291 -0.017845;
+0.178751 -0.019088;
+0.180213 -0.020077;
+0.181675 -0.020814;
+0.183139 -0.021301;
+0.184603 -0.021541;
+0.186069 -0.021535;
+0.187536 -0.021285;
+0.189004 -0.020796;
+0.190475 -0.020068;
+0.191948 -0.019106;
+0.193424 -0.017911;
+0.194904 -0.016488;
+0.196388 -0.014838;
+0.197876 -0.012967;
+0.199369 -0.010879;
+0.200868 -0.008583;
+0.202371 -0.006103;
+0.203880 -0.003470;
+0.205393 -0.000716;
+0.206909 0.002121;
+0.208427 0.004988;
+0.209946 0.007750;
+0.211465 0.010279;
+0.212982 0.012550;
+0.214497 0.014561;
+0.216010 0.016316;
+0.217521 0.017814;
+0.219027 0.019057;
+0.220531 0.020046;
+0.222030 0.020783;
+0.223526 0.021270;
+0.225018 0.021510;
+0.226507 0.021504;
+0.227993 0.021256;
+0.229477 0.020767;
+0.230958 0.020041;
+0.232439 0.019080;
+0.233918 0.017887;
+0.235397 0.016465;
+0.236877 0.014817;
+0.238359 0.012948;
+0.239842 0.010862;
+0.241328 0.008568;
+0.242816 0.006090;
+0.244307 0.003458;
+0.245801 0.000706;
+0.247295 -0.002131;
+0.248790 -0.004997;
+0.250284 -0.007759;
+0.251776 -0.010287;
+0.253267 -0.012557;
+0.254754 -0.014569;
+0.256239 -0.016323;
+0.257720 -0.017821;
+0.259198 -0.019064;
+0.260672 -0.020053;
+0.262142 -0.020790;
+0.263609 -0.021278;
+0.265073 -0.021517;
+0.266534 -0.021511;
+0.267992 -0.021263;
+0.269449 -0.020773;
+0.270905 -0.020047;
+0.272361 -0.019086;
+0.273817 -0.017892;
+0.275274 -0.016470;
+0.276733 -0.014822;
+0.278195 -0.012953;
+0.279660 -0.010866;
+0.281130 -0.008571;
+0.282603 -0.006093;
+0.284080 -0.003461;
+0.285562 -0.000708;
+0.287046 0.002129;
+0.288532 0.004995;
+0.290018 0.007757;
+0.291505 0.010286;
+0.292991 0.012555;
+0.294476 0.014567;
+0.295959 0.016321;
+0.297440 0.017819;
+0.298919 0.019062;
+0.300395 0.020051;
+0.301869 0.020789;
+0.303341 0.021276;
+0.304811 0.021516;
+0.306279 0.021510;
+0.307745 0.021262;
+0.309210 0.020774;
+0.310675 0.020049;
+0.312139 0.019090;
+0.313604 0.017901;
+0.315070 0.016483;
+0.316537 0.014841;
+0.318006 0.012978;
+0.319478 0.010898;
+0.320952 0.008611;
+0.322428 0.006141;
+0.323907 0.003517;
+0.325388 0.000774;
+0.326868 -0.002052;
+0.328348 -0.004907;
+0.329825 -0.007657;
+0.331298 -0.010171;
+0.332767 -0.012426;
+0.334231 -0.014421;
+0.335689 -0.016158;
+0.337139 -0.017638;
+0.338583 -0.018862;
+0.340018 -0.019831;
+0.341444 -0.020549;
+0.342862 -0.021016;
+0.344271 -0.021236;
+0.345670 -0.021210;
+0.347060 -0.020941;
+0.348440 -0.020431;
+0.349810 -0.019683;
+0.351170 -0.018700;
+0.352519 -0.017482;
+0.353859 -0.016033;
+0.355188 -0.014354;
+0.356506 -0.012448;
+0.357813 -0.010319;
+0.359107 -0.007972;
+0.360389 -0.005427;
+0.361658 -0.002707;
+0.362910 0.000160;
+0.364145 0.003145;
+0.365360 0.006196;
+0.366552 0.009173;
+0.367721 0.011939;
+0.368864 0.014466;
+0.369979 0.016754;
+0.371066 0.018805;
+0.372121 0.020620;
+0.373145 0.022201;
+0.374136 0.023552;
+0.375092 0.024677;
+0.376013 0.025580;
+0.376897 0.026267;
+0.377745 0.026743;
+0.378555 0.027016;
+0.379327 0.027093;
+0.380060 0.026981;
+0.380755 0.026689;
+0.381411 0.026227;
+0.382029 0.025603;
+0.382609 0.024829;
+0.383151 0.023914;
+0.383656 0.022870;
+0.384124 0.021708;
+0.384556 0.020440;
+0.384952 0.019079;
+0.385315 0.017636;
+0.385644 0.016125;
+0.385941 0.014555;
+0.386207 0.012941;
+0.386444 0.011292;
+0.386652 0.009620;
+0.386832 0.007936;
+0.386987 0.006250;
+0.387118 0.004572;
+0.387226 0.002912;
+0.387312 0.001277;
+0.387378 -0.000323;
+0.387426 -0.001880;
+0.387458 -0.003388;
+0.387473 -0.004840;
+0.387475 -0.006229;
+0.387464 -0.007551;
+0.387442 -0.008800;
+0.387411 -0.009971;
+0.387371 -0.011063;
+0.387324 -0.012070;
+0.387271 -0.012991;
+0.387214 -0.013825;
+0.387154 -0.014569;
+0.387092 -0.015222;
+0.387028 -0.015785;
+0.386965 -0.016258;
+0.386902 -0.016641;
+0.386841 -0.016936;
+0.386783 -0.017144;
+0.386728 -0.017267;
+0.386677 -0.017308;
+0.386631 -0.017268;
+0.386590 -0.017152;
+];
+
+ plot(CoM(:,1), CoM(:,2), 'b')
+hold off
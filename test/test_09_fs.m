@@ -0,0 +1,1583 @@
+%
+% Footsteps generated using the c++ version of the WMG
+%
+
+cla;
+clear FS;
+
+FS(1).a = 0.000000;
+FS(1).p = [0.000000;0.050000];
+FS(1).d = [0.090000;0.075000;0.030000;-0.025000];
+FS(1).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(1).v = [0.090000 0.025000; 0.090000 0.075000; -0.030000 0.075000; -0.030000 0.025000; 0.090000 0.025000];
+FS(1).type = 2;
+
+FS(6).a = 0.000000;
+FS(6).p = [0.000000;-0.050000];
+FS(6).d = [0.090000;-0.025000;0.030000;0.075000];
+FS(6).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(6).v = [0.090000 -0.075000; 0.090000 -0.025000; -0.030000 -0.025000; -0.030000 -0.075000; 0.090000 -0.075000];
+FS(6).type = 2;
+
+FS(10).a = 0.000000;
+FS(10).p = [0.035000;0.050000];
+FS(10).d = [0.125000;0.075000;-0.005000;-0.025000];
+FS(10).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(10).v = [0.125000 0.025000; 0.125000 0.075000; 0.005000 0.075000; 0.005000 0.025000; 0.125000 0.025000];
+FS(10).type = 2;
+
+FS(14).a = 0.000000;
+FS(14).p = [0.070000;-0.050000];
+FS(14).d = [0.160000;-0.025000;-0.040000;0.075000];
+FS(14).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(14).v = [0.160000 -0.075000; 0.160000 -0.025000; 0.040000 -0.025000; 0.040000 -0.075000; 0.160000 -0.075000];
+FS(14).type = 2;
+
+FS(18).a = 0.000000;
+FS(18).p = [0.105000;0.050000];
+FS(18).d = [0.195000;0.075000;-0.075000;-0.025000];
+FS(18).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(18).v = [0.195000 0.025000; 0.195000 0.075000; 0.075000 0.075000; 0.075000 0.025000; 0.195000 0.025000];
+FS(18).type = 2;
+
+FS(22).a = 0.000000;
+FS(22).p = [0.140000;-0.050000];
+FS(22).d = [0.230000;-0.025000;-0.110000;0.075000];
+FS(22).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(22).v = [0.230000 -0.075000; 0.230000 -0.025000; 0.110000 -0.025000; 0.110000 -0.075000; 0.230000 -0.075000];
+FS(22).type = 2;
+
+FS(26).a = 0.000000;
+FS(26).p = [0.175000;0.050000];
+FS(26).d = [0.265000;0.075000;-0.145000;-0.025000];
+FS(26).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(26).v = [0.265000 0.025000; 0.265000 0.075000; 0.145000 0.075000; 0.145000 0.025000; 0.265000 0.025000];
+FS(26).type = 2;
+
+FS(30).a = 0.000000;
+FS(30).p = [0.210000;-0.050000];
+FS(30).d = [0.300000;-0.025000;-0.180000;0.075000];
+FS(30).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(30).v = [0.300000 -0.075000; 0.300000 -0.025000; 0.180000 -0.025000; 0.180000 -0.075000; 0.300000 -0.075000];
+FS(30).type = 2;
+
+FS(34).a = 0.000000;
+FS(34).p = [0.245000;0.050000];
+FS(34).d = [0.335000;0.075000;-0.215000;-0.025000];
+FS(34).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(34).v = [0.335000 0.025000; 0.335000 0.075000; 0.215000 0.075000; 0.215000 0.025000; 0.335000 0.025000];
+FS(34).type = 2;
+
+FS(38).a = 0.000000;
+FS(38).p = [0.280000;-0.050000];
+FS(38).d = [0.370000;-0.025000;-0.250000;0.075000];
+FS(38).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(38).v = [0.370000 -0.075000; 0.370000 -0.025000; 0.250000 -0.025000; 0.250000 -0.075000; 0.370000 -0.075000];
+FS(38).type = 2;
+
+FS(42).a = 0.000000;
+FS(42).p = [0.315000;0.050000];
+FS(42).d = [0.405000;0.075000;-0.285000;-0.025000];
+FS(42).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(42).v = [0.405000 0.025000; 0.405000 0.075000; 0.285000 0.075000; 0.285000 0.025000; 0.405000 0.025000];
+FS(42).type = 2;
+
+FS(44).a = 0.000000;
+FS(44).p = [0.315000;-0.050000];
+FS(44).d = [0.405000;-0.025000;-0.285000;0.075000];
+FS(44).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(44).v = [0.405000 -0.075000; 0.405000 -0.025000; 0.285000 -0.025000; 0.285000 -0.075000; 0.405000 -0.075000];
+FS(44).type = 2;
+
+hold on
+for i=1:length(FS)
+    if FS(i).type == 1;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','r','MarkerSize',2)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'c');
+    end
+    if FS(i).type == 2;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','g','MarkerSize',4)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'r');
+    end
+end
+grid on; %axis equal
+hold on
+LFP = [
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000500 0.051457 0.001995;
+0.001874 0.052787 0.003960;
+0.003910 0.053943 0.005865;
+0.006387 0.054905 0.007680;
+0.009110 0.055671 0.009375;
+0.011922 0.056252 0.010920;
+0.014708 0.056666 0.012285;
+0.017391 0.056932 0.013440;
+0.019922 0.057068 0.014355;
+0.022273 0.057091 0.015000;
+0.024432 0.057012 0.015345;
+0.026397 0.056838 0.015360;
+0.028169 0.056571 0.015015;
+0.029754 0.056208 0.014280;
+0.031154 0.055736 0.013125;
+0.032370 0.055133 0.011520;
+0.033395 0.054359 0.009435;
+0.034212 0.053345 0.006840;
+0.034777 0.051970 0.003705;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035999 0.051457 0.001995;
+0.038749 0.052787 0.003960;
+0.042820 0.053943 0.005865;
+0.047774 0.054905 0.007680;
+0.053219 0.055671 0.009375;
+0.058844 0.056252 0.010920;
+0.064417 0.056666 0.012285;
+0.069783 0.056932 0.013440;
+0.074844 0.057068 0.014355;
+0.079545 0.057091 0.015000;
+0.083864 0.057012 0.015345;
+0.087793 0.056838 0.015360;
+0.091338 0.056571 0.015015;
+0.094507 0.056208 0.014280;
+0.097308 0.055736 0.013125;
+0.099740 0.055133 0.011520;
+0.101791 0.054359 0.009435;
+0.103423 0.053345 0.006840;
+0.104553 0.051970 0.003705;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105000 0.050000 0.000000;
+0.105999 0.051457 0.001995;
+0.108749 0.052787 0.003960;
+0.112820 0.053943 0.005865;
+0.117774 0.054905 0.007680;
+0.123219 0.055671 0.009375;
+0.128844 0.056252 0.010920;
+0.134417 0.056666 0.012285;
+0.139783 0.056932 0.013440;
+0.144844 0.057068 0.014355;
+0.149545 0.057091 0.015000;
+0.153864 0.057012 0.015345;
+0.157793 0.056838 0.015360;
+0.161338 0.056571 0.015015;
+0.164507 0.056208 0.014280;
+0.167308 0.055736 0.013125;
+0.169740 0.055133 0.011520;
+0.171791 0.054359 0.009435;
+0.173423 0.053345 0.006840;
+0.174553 0.051970 0.003705;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175000 0.050000 0.000000;
+0.175999 0.051457 0.001995;
+0.178749 0.052787 0.003960;
+0.182820 0.053943 0.005865;
+0.187774 0.054905 0.007680;
+0.193219 0.055671 0.009375;
+0.198844 0.056252 0.010920;
+0.204417 0.056666 0.012285;
+0.209783 0.056932 0.013440;
+0.214844 0.057068 0.014355;
+0.219545 0.057091 0.015000;
+0.223864 0.057012 0.015345;
+0.227793 0.056838 0.015360;
+0.231338 0.056571 0.015015;
+0.234507 0.056208 0.014280;
+0.237308 0.055736 0.013125;
+0.239740 0.055133 0.011520;
+0.241791 0.054359 0.009435;
+0.243423 0.053345 0.006840;
+0.244553 0.051970 0.003705;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245000 0.050000 0.000000;
+0.245999 0.051457 0.001995;
+0.248749 0.052787 0.003960;
+0.252820 0.053943 0.005865;
+0.257774 0.054905 0.007680;
+0.263219 0.055671 0.009375;
+0.268844 0.056252 0.010920;
+0.274417 0.056666 0.012285;
+0.279783 0.056932 0.013440;
+0.284844 0.057068 0.014355;
+0.289545 0.057091 0.015000;
+0.293864 0.057012 0.015345;
+0.297793 0.056838 0.015360;
+0.301338 0.056571 0.015015;
+0.304507 0.056208 0.014280;
+0.307308 0.055736 0.013125;
+0.309740 0.055133 0.011520;
+0.311791 0.054359 0.009435;
+0.313423 0.053345 0.006840;
+0.314553 0.051970 0.003705;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+0.315000 0.050000 0.000000;
+];
+
+ plot3(LFP(:,1), LFP(:,2), LFP(:,3), 'r')
+RFP = [
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000999 -0.051457 0.001995;
+0.003749 -0.052787 0.003960;
+0.007820 -0.053943 0.005865;
+0.012774 -0.054905 0.007680;
+0.018219 -0.055671 0.009375;
+0.023844 -0.056252 0.010920;
+0.029417 -0.056666 0.012285;
+0.034783 -0.056932 0.013440;
+0.039844 -0.057068 0.014355;
+0.044545 -0.057091 0.015000;
+0.048864 -0.057012 0.015345;
+0.052793 -0.056838 0.015360;
+0.056338 -0.056571 0.015015;
+0.059507 -0.056208 0.014280;
+0.062308 -0.055736 0.013125;
+0.064740 -0.055133 0.011520;
+0.066791 -0.054359 0.009435;
+0.068423 -0.053345 0.006840;
+0.069553 -0.051970 0.003705;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070000 -0.050000 0.000000;
+0.070999 -0.051457 0.001995;
+0.073749 -0.052787 0.003960;
+0.077820 -0.053943 0.005865;
+0.082774 -0.054905 0.007680;
+0.088219 -0.055671 0.009375;
+0.093844 -0.056252 0.010920;
+0.099417 -0.056666 0.012285;
+0.104783 -0.056932 0.013440;
+0.109844 -0.057068 0.014355;
+0.114545 -0.057091 0.015000;
+0.118864 -0.057012 0.015345;
+0.122793 -0.056838 0.015360;
+0.126338 -0.056571 0.015015;
+0.129507 -0.056208 0.014280;
+0.132308 -0.055736 0.013125;
+0.134740 -0.055133 0.011520;
+0.136791 -0.054359 0.009435;
+0.138423 -0.053345 0.006840;
+0.139553 -0.051970 0.003705;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140000 -0.050000 0.000000;
+0.140999 -0.051457 0.001995;
+0.143749 -0.052787 0.003960;
+0.147820 -0.053943 0.005865;
+0.152774 -0.054905 0.007680;
+0.158219 -0.055671 0.009375;
+0.163844 -0.056252 0.010920;
+0.169417 -0.056666 0.012285;
+0.174783 -0.056932 0.013440;
+0.179844 -0.057068 0.014355;
+0.184545 -0.057091 0.015000;
+0.188864 -0.057012 0.015345;
+0.192793 -0.056838 0.015360;
+0.196338 -0.056571 0.015015;
+0.199507 -0.056208 0.014280;
+0.202308 -0.055736 0.013125;
+0.204740 -0.055133 0.011520;
+0.206791 -0.054359 0.009435;
+0.208423 -0.053345 0.006840;
+0.209553 -0.051970 0.003705;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210000 -0.050000 0.000000;
+0.210999 -0.051457 0.001995;
+0.213749 -0.052787 0.003960;
+0.217820 -0.053943 0.005865;
+0.222774 -0.054905 0.007680;
+0.228219 -0.055671 0.009375;
+0.233844 -0.056252 0.010920;
+0.239417 -0.056666 0.012285;
+0.244783 -0.056932 0.013440;
+0.249844 -0.057068 0.014355;
+0.254545 -0.057091 0.015000;
+0.258864 -0.057012 0.015345;
+0.262793 -0.056838 0.015360;
+0.266338 -0.056571 0.015015;
+0.269507 -0.056208 0.014280;
+0.272308 -0.055736 0.013125;
+0.274740 -0.055133 0.011520;
+0.276791 -0.054359 0.009435;
+0.278423 -0.053345 0.006840;
+0.279553 -0.051970 0.003705;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280000 -0.050000 0.000000;
+0.280500 -0.051457 0.001995;
+0.281874 -0.052787 0.003960;
+0.283910 -0.053943 0.005865;
+0.286387 -0.054905 0.007680;
+0.289110 -0.055671 0.009375;
+0.291922 -0.056252 0.010920;
+0.294708 -0.056666 0.012285;
+0.297391 -0.056932 0.013440;
+0.299922 -0.057068 0.014355;
+0.302273 -0.057091 0.015000;
+0.304432 -0.057012 0.015345;
+0.306397 -0.056838 0.015360;
+0.308169 -0.056571 0.015015;
+0.309754 -0.056208 0.014280;
+0.311154 -0.055736 0.013125;
+0.312370 -0.055133 0.011520;
+0.313395 -0.054359 0.009435;
+0.314212 -0.053345 0.006840;
+0.314777 -0.051970 0.003705;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+0.315000 -0.050000 0.000000;
+];
+
+ plot3(RFP(:,1), RFP(:,2), RFP(:,3), 'r')
+ZMP = [
+0.019979 -0.000065;
+0.019724 0.000673;
+0.019290 0.001962;
+0.018978 0.002930;
+0.018805 0.003513;
+0.018783 0.003616;
+0.018916 0.003157;
+0.019207 0.002061;
+0.019654 0.000265;
+0.020251 -0.002265;
+0.020994 -0.005411;
+0.021873 -0.009099;
+0.022884 -0.013337;
+0.024016 -0.017830;
+0.025267 -0.025000;
+0.026631 -0.028052;
+0.028108 -0.030830;
+0.029699 -0.033229;
+0.031407 -0.035110;
+0.033235 -0.036277;
+0.035188 -0.036459;
+0.037270 -0.035319;
+0.039487 -0.032587;
+0.041843 -0.027904;
+0.044343 -0.020384;
+0.047047 -0.009429;
+0.049811 0.002760;
+0.052565 0.025000;
+0.055306 0.030261;
+0.058023 0.034394;
+0.060712 0.037362;
+0.063374 0.039123;
+0.066015 0.039621;
+0.068642 0.038799;
+0.071269 0.036628;
+0.073907 0.033124;
+0.076572 0.027984;
+0.079282 0.020061;
+0.082111 0.008702;
+0.084925 -0.003524;
+0.087674 -0.025000;
+0.090358 -0.030836;
+0.092981 -0.035505;
+0.095548 -0.038924;
+0.098071 -0.041001;
+0.100562 -0.041634;
+0.103039 -0.040729;
+0.105521 -0.038249;
+0.108024 -0.034249;
+0.110569 -0.028357;
+0.113177 -0.020011;
+0.115925 -0.008595;
+0.118680 0.003638;
+0.121390 0.025000;
+0.124059 0.030856;
+0.126685 0.035532;
+0.129275 0.038945;
+0.131837 0.041008;
+0.134383 0.041624;
+0.136927 0.040703;
+0.139485 0.038216;
+0.142073 0.034219;
+0.144707 0.028345;
+0.147408 0.020007;
+0.150247 0.008586;
+0.153093 -0.003648;
+0.155890 -0.025000;
+0.158640 -0.030866;
+0.161343 -0.035551;
+0.164003 -0.038973;
+0.166628 -0.041043;
+0.169230 -0.041662;
+0.171823 -0.040740;
+0.174422 -0.038247;
+0.177045 -0.034241;
+0.179705 -0.028353;
+0.182426 -0.020006;
+0.185280 -0.008584;
+0.188135 0.003650;
+0.190936 0.025000;
+0.193687 0.030866;
+0.196387 0.035551;
+0.199042 0.038972;
+0.201660 0.041041;
+0.204253 0.041661;
+0.206835 0.040738;
+0.209424 0.038245;
+0.212036 0.034240;
+0.214686 0.028352;
+0.217398 0.020006;
+0.220244 0.008584;
+0.223091 -0.003650;
+0.225886 -0.025000;
+0.228632 -0.030867;
+0.231329 -0.035551;
+0.233982 -0.038973;
+0.236599 -0.041042;
+0.239192 -0.041661;
+0.241776 -0.040739;
+0.244367 -0.038246;
+0.246982 -0.034240;
+0.249636 -0.028352;
+0.252351 -0.020006;
+0.255201 -0.008583;
+0.258057 0.003649;
+0.260865 0.025000;
+0.263626 0.030855;
+0.266339 0.035532;
+0.269006 0.038950;
+0.271635 0.041021;
+0.274236 0.041647;
+0.276823 0.040735;
+0.279411 0.038253;
+0.282017 0.034253;
+0.284655 0.028358;
+0.287347 0.020014;
+0.290165 0.008604;
+0.292980 -0.003623;
+0.295735 -0.025000;
+0.298434 -0.030795;
+0.301073 -0.035405;
+0.303652 -0.038760;
+0.306178 -0.040778;
+0.308656 -0.041373;
+0.311098 -0.040472;
+0.313513 -0.038062;
+0.315913 -0.034158;
+0.318306 -0.028343;
+0.320704 -0.020299;
+0.323169 -0.009510;
+0.325564 0.002575;
+0.327811 0.025000;
+0.329915 0.030767;
+0.331864 0.035285;
+0.333647 0.038576;
+0.335259 0.040681;
+0.336698 0.041660;
+0.337964 0.041586;
+0.339063 0.040548;
+0.340001 0.038641;
+0.340786 0.035971;
+0.341433 0.032649;
+0.341953 0.028896;
+0.342358 0.024910;
+0.342663 0.020821;
+0.342880 0.016745;
+0.343025 0.012785;
+0.343109 0.009026;
+0.343146 0.005537;
+0.343147 0.002373;
+0.343122 -0.000427;
+0.343082 -0.002839;
+0.343034 -0.004852;
+0.342985 -0.006464;
+0.342941 -0.007688;
+0.342907 -0.008541;
+0.342885 -0.009050;
+0.342879 -0.009247;
+0.342890 -0.009167;
+0.342917 -0.008848;
+0.342962 -0.008331;
+0.343024 -0.007654;
+];
+
+ plot(ZMP(:,1), ZMP(:,2), 'k')
+ZMPref = [
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 0.000000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.030000 -0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.065000 0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.100000 -0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.135000 0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.170000 -0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.205000 0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.240000 -0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.275000 0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.310000 -0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.050000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+0.345000 0.000000;
+];
+
+ plot(ZMPref(:,1), ZMPref(:,2), 'ko')
+CoM = [
+0.019979 -0.000067;
+0.019984 -0.000080;
+0.019996 -0.000114;
+0.020018 -0.000179;
+0.020054 -0.000284;
+0.020106 -0.000438;
+0.020176 -0.000647;
+0.020267 -0.000919;
+0.020380 -0.001258;
+0.020518 -0.001671;
+0.020680 -0.002161;
+0.020870 -0.002731;
+0.021086 -0.003382;
+0.021331 -0.004114;
+0.021604 -0.004927;
+0.021907 -0.005817;
+0.022240 -0.006781;
+0.022602 -0.007812;
+0.022994 -0.008903;
+0.023417 -0.010047;
+0.023869 -0.011233;
+0.024352 -0.012450;
+0.024864 -0.013686;
+0.025406 -0.014927;
+0.025978 -0.016157;
+0.026579 -0.017359;
+0.027209 -0.018499;
+0.027869 -0.019547;
+0.028557 -0.020488;
+0.029275 -0.021316;
+0.030021 -0.022021;
+0.030796 -0.022594;
+0.031600 -0.023023;
+0.032432 -0.023299;
+0.033292 -0.023410;
+0.034181 -0.023345;
+0.035098 -0.023092;
+0.036043 -0.022642;
+0.037016 -0.021983;
+0.038016 -0.021106;
+0.039043 -0.020005;
+0.040096 -0.018674;
+0.041176 -0.017110;
+0.042281 -0.015315;
+0.043411 -0.013293;
+0.044564 -0.011052;
+0.045739 -0.008605;
+0.046935 -0.005982;
+0.048150 -0.003224;
+0.049382 -0.000375;
+0.050628 0.002519;
+0.051886 0.005396;
+0.053154 0.008144;
+0.054432 0.010660;
+0.055717 0.012918;
+0.057008 0.014915;
+0.058304 0.016648;
+0.059604 0.018115;
+0.060908 0.019312;
+0.062214 0.020238;
+0.063524 0.020890;
+0.064835 0.021268;
+0.066148 0.021372;
+0.067464 0.021201;
+0.068781 0.020757;
+0.070100 0.020042;
+0.071422 0.019059;
+0.072745 0.017812;
+0.074072 0.016306;
+0.075400 0.014548;
+0.076731 0.012547;
+0.078065 0.010314;
+0.079400 0.007865;
+0.080737 0.005234;
+0.082075 0.002465;
+0.083412 -0.000397;
+0.084748 -0.003302;
+0.086081 -0.006192;
+0.087410 -0.008960;
+0.088736 -0.011505;
+0.090057 -0.013802;
+0.091373 -0.015842;
+0.092685 -0.017619;
+0.093993 -0.019127;
+0.095296 -0.020361;
+0.096595 -0.021316;
+0.097891 -0.021987;
+0.099185 -0.022373;
+0.100476 -0.022471;
+0.101766 -0.022281;
+0.103055 -0.021804;
+0.104345 -0.021042;
+0.105635 -0.020001;
+0.106928 -0.018685;
+0.108222 -0.017103;
+0.109520 -0.015264;
+0.110820 -0.013182;
+0.112125 -0.010872;
+0.113434 -0.008353;
+0.114746 -0.005660;
+0.116061 -0.002837;
+0.117379 0.000071;
+0.118697 0.003017;
+0.120015 0.005941;
+0.121334 0.008739;
+0.122651 0.011310;
+0.123967 0.013629;
+0.125282 0.015690;
+0.126595 0.017484;
+0.127907 0.019008;
+0.129217 0.020255;
+0.130527 0.021220;
+0.131836 0.021901;
+0.133145 0.022295;
+0.134455 0.022400;
+0.135765 0.022216;
+0.137078 0.021744;
+0.138392 0.020987;
+0.139709 0.019950;
+0.141030 0.018638;
+0.142354 0.017060;
+0.143683 0.015224;
+0.145016 0.013146;
+0.146353 0.010838;
+0.147696 0.008322;
+0.149042 0.005631;
+0.150392 0.002810;
+0.151743 -0.000097;
+0.153096 -0.003041;
+0.154449 -0.005965;
+0.155801 -0.008762;
+0.157152 -0.011333;
+0.158501 -0.013652;
+0.159847 -0.015712;
+0.161192 -0.017507;
+0.162534 -0.019031;
+0.163874 -0.020278;
+0.165212 -0.021244;
+0.166548 -0.021925;
+0.167883 -0.022318;
+0.169218 -0.022423;
+0.170552 -0.022238;
+0.171886 -0.021765;
+0.173222 -0.021007;
+0.174558 -0.019969;
+0.175897 -0.018656;
+0.177238 -0.017076;
+0.178582 -0.015239;
+0.179930 -0.013159;
+0.181280 -0.010850;
+0.182634 -0.008332;
+0.183991 -0.005640;
+0.185350 -0.002818;
+0.186711 0.000090;
+0.188071 0.003035;
+0.189430 0.005959;
+0.190787 0.008757;
+0.192142 0.011328;
+0.193495 0.013648;
+0.194844 0.015709;
+0.196191 0.017504;
+0.197534 0.019028;
+0.198875 0.020275;
+0.200213 0.021241;
+0.201549 0.021922;
+0.202884 0.022316;
+0.204217 0.022421;
+0.205549 0.022236;
+0.206882 0.021763;
+0.208215 0.021006;
+0.209549 0.019967;
+0.210886 0.018654;
+0.212224 0.017074;
+0.213566 0.015238;
+0.214911 0.013157;
+0.216259 0.010849;
+0.217610 0.008331;
+0.218964 0.005639;
+0.220321 0.002817;
+0.221678 -0.000091;
+0.223036 -0.003036;
+0.224393 -0.005960;
+0.225749 -0.008757;
+0.227102 -0.011329;
+0.228453 -0.013649;
+0.229801 -0.015709;
+0.231146 -0.017504;
+0.232488 -0.019028;
+0.233828 -0.020276;
+0.235166 -0.021242;
+0.236501 -0.021923;
+0.237835 -0.022316;
+0.239168 -0.022421;
+0.240501 -0.022237;
+0.241834 -0.021764;
+0.243167 -0.021006;
+0.244502 -0.019968;
+0.245839 -0.018655;
+0.247179 -0.017075;
+0.248521 -0.015238;
+0.249867 -0.013158;
+0.251216 -0.010849;
+0.252569 -0.008331;
+0.253925 -0.005640;
+0.255283 -0.002817;
+0.256642 0.000090;
+0.258001 0.003036;
+0.259360 0.005960;
+0.260717 0.008757;
+0.262071 0.011329;
+0.263423 0.013648;
+0.264772 0.015709;
+0.266117 0.017505;
+0.267459 0.019030;
+0.268798 0.020278;
+0.270134 0.021246;
+0.271467 0.021929;
+0.272797 0.022325;
+0.274125 0.022432;
+0.275451 0.022251;
+0.276776 0.021782;
+0.278100 0.021028;
+0.279424 0.019994;
+0.280749 0.018685;
+0.282073 0.017110;
+0.283399 0.015278;
+0.284725 0.013204;
+0.286053 0.010901;
+0.287381 0.008391;
+0.288710 0.005706;
+0.290038 0.002893;
+0.291364 -0.000006;
+0.292687 -0.002941;
+0.294006 -0.005853;
+0.295319 -0.008638;
+0.296625 -0.011195;
+0.297925 -0.013499;
+0.299217 -0.015543;
+0.300501 -0.017320;
+0.301776 -0.018825;
+0.303043 -0.020054;
+0.304300 -0.021001;
+0.305548 -0.021663;
+0.306786 -0.022038;
+0.308014 -0.022124;
+0.309233 -0.021920;
+0.310442 -0.021429;
+0.311642 -0.020651;
+0.312831 -0.019590;
+0.314010 -0.018252;
+0.315178 -0.016644;
+0.316335 -0.014773;
+0.317480 -0.012652;
+0.318613 -0.010295;
+0.319732 -0.007721;
+0.320837 -0.004958;
+0.321925 -0.002044;
+0.322995 0.000980;
+0.324043 0.004071;
+0.325069 0.007171;
+0.326069 0.010172;
+0.327044 0.012969;
+0.327992 0.015539;
+0.328910 0.017881;
+0.329798 0.019994;
+0.330655 0.021876;
+0.331481 0.023530;
+0.332274 0.024959;
+0.333034 0.026164;
+0.333760 0.027152;
+0.334453 0.027927;
+0.335112 0.028496;
+0.335737 0.028866;
+0.336329 0.029045;
+0.336888 0.029042;
+0.337414 0.028866;
+0.337907 0.028528;
+0.338370 0.028038;
+0.338802 0.027407;
+0.339204 0.026648;
+0.339577 0.025773;
+0.339922 0.024794;
+0.340240 0.023724;
+0.340533 0.022577;
+0.340801 0.021365;
+0.341045 0.020099;
+0.341268 0.018791;
+0.341469 0.017453;
+0.341651 0.016095;
+0.341814 0.014727;
+0.341960 0.013358;
+0.342090 0.011998;
+0.342205 0.010655;
+0.342306 0.009336;
+0.342396 0.008049;
+0.342473 0.006799;
+0.342541 0.005592;
+0.342600 0.004434;
+0.342650 0.003329;
+0.342693 0.002280;
+0.342730 0.001290;
+0.342762 0.000362;
+0.342790 -0.000502;
+0.342813 -0.001300;
+0.342834 -0.002032;
+0.342853 -0.002698;
+0.342869 -0.003297;
+0.342885 -0.003831;
+0.342900 -0.004299;
+0.342915 -0.004704;
+0.342931 -0.005046;
+0.342947 -0.005329;
+0.342964 -0.005553;
+0.342982 -0.005722;
+0.343002 -0.005838;
+0.343024 -0.005904;
+0.343047 -0.005923;
+0.343072 -0.005898;
+0.343100 -0.005833;
+0.343129 -0.005729;
+0.343161 -0.005592;
+0.343194 -0.005423;
+0.343230 -0.005227;
+0.343267 -0.005006;
+];
+
+ plot(CoM(:,1), CoM(:,2), 'b')
+hold off
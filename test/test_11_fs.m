@@ -0,0 +1,103 @@
+%
+% Footsteps generated using the c++ version of the WMG
+%
+
+cla;
+clear FS;
+
+FS(1).a = 0.000000;
+FS(1).p = [0.000000;0.050000];
+FS(1).d = [0.030000;0.060000;0.010000;0.060000];
+FS(1).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(1).v = [0.030000 -0.060000; 0.030000 0.060000; -0.010000 0.060000; -0.010000 -0.060000; 0.030000 -0.060000];
+FS(1).type = 1;
+
+FS(2).a = 0.000000;
+FS(2).p = [0.000000;-0.050000];
+FS(2).d = [0.030000;-0.040000;0.010000;0.060000];
+FS(2).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(2).v = [0.030000 -0.060000; 0.030000 -0.040000; -0.010000 -0.040000; -0.010000 -0.060000; 0.030000 -0.060000];
+FS(2).type = 2;
+
+FS(3).a = 0.087266;
+FS(3).p = [0.035000;0.050000];
+FS(3).d = [0.069225;0.056759;-0.029225;-0.036759];
+FS(3).D = [0.996195 0.087156;-0.087156 0.996195;-0.996195 -0.087156;0.087156 -0.996195];
+FS(3).v = [0.065757 0.042653; 0.064014 0.062577; 0.024166 0.059090; 0.025910 0.039166; 0.065757 0.042653];
+FS(3).type = 2;
+
+FS(4).a = 0.174533;
+FS(4).p = [0.078582;-0.046569];
+FS(4).d = [0.099302;-0.049507;-0.059302;0.069507];
+FS(4).D = [0.984808 0.173648;-0.173648 0.984808;-0.984808 -0.173648;0.173648 -0.984808];
+FS(4).v = [0.109863 -0.051208; 0.106390 -0.031511; 0.066998 -0.038457; 0.070471 -0.058154; 0.109863 -0.051208];
+FS(4).type = 2;
+
+FS(5).a = 0.261799;
+FS(5).p = [0.095686;0.057989];
+FS(5).d = [0.137434;0.041248;-0.097434;-0.021248];
+FS(5).D = [0.965926 0.258819;-0.258819 0.965926;-0.965926 -0.258819;0.258819 -0.965926];
+FS(5).v = [0.127252 0.056095; 0.122075 0.075413; 0.083438 0.065061; 0.088615 0.045742; 0.127252 0.056095];
+FS(5).type = 2;
+
+FS(6).a = 0.349066;
+FS(6).p = [0.155375;-0.029544];
+FS(6).d = [0.165900;-0.070904;-0.125900;0.090904];
+FS(6).D = [0.939693 0.342020;-0.342020 0.939693;-0.939693 -0.342020;0.342020 -0.939693];
+FS(6).v = [0.186986 -0.028681; 0.180146 -0.009887; 0.142558 -0.023568; 0.149398 -0.042362; 0.186986 -0.028681];
+FS(6).type = 2;
+
+FS(7).a = 0.436332;
+FS(7).p = [0.154062;0.076395];
+FS(7).d = [0.201914;0.014128;-0.161914;0.005872];
+FS(7).D = [0.906308 0.422618;-0.422618 0.906308;-0.906308 -0.422618;0.422618 -0.906308];
+FS(7).v = [0.185478 0.080011; 0.177025 0.098137; 0.140773 0.081232; 0.149225 0.063106; 0.185478 0.080011];
+FS(7).type = 2;
+
+FS(8).a = 0.523599;
+FS(8).p = [0.228045;0.000556];
+FS(8).d = [0.227771;-0.103541;-0.187771;0.123541];
+FS(8).D = [0.866025 0.500000;-0.500000 0.866025;-0.866025 -0.500000;0.500000 -0.866025];
+FS(8).v = [0.259026 0.006896; 0.249026 0.024217; 0.214385 0.004217; 0.224385 -0.013104; 0.259026 0.006896];
+FS(8).type = 2;
+
+FS(9).a = 0.610865;
+FS(9).p = [0.208356;0.104659];
+FS(9).d = [0.260705;-0.023776;-0.220705;0.043776];
+FS(9).D = [0.819152 0.573576;-0.573576 0.819152;-0.819152 -0.573576;0.573576 -0.819152];
+FS(9).v = [0.238666 0.113675; 0.227195 0.130058; 0.194429 0.107115; 0.205900 0.090732; 0.238666 0.113675];
+FS(9).type = 2;
+
+FS(10).a = 0.698132;
+FS(10).p = [0.294384;0.042819];
+FS(10).d = [0.283035;-0.146425;-0.243035;0.166425];
+FS(10).D = [0.766044 0.642788;-0.642788 0.766044;-0.766044 -0.642788;0.642788 -0.766044];
+FS(10).v = [0.323793 0.054442; 0.310937 0.069763; 0.280296 0.044051; 0.293151 0.028731; 0.323793 0.054442];
+FS(10).type = 2;
+
+FS(11).a = 0.698132;
+FS(11).p = [0.256917;0.141921];
+FS(11).d = [0.318035;-0.046425;-0.278035;0.066425];
+FS(11).D = [0.766044 0.642788;-0.642788 0.766044;-0.766044 -0.642788;0.642788 -0.766044];
+FS(11).v = [0.286326 0.153544; 0.273470 0.168865; 0.242828 0.143153; 0.255684 0.127833; 0.286326 0.153544];
+FS(11).type = 2;
+
+FS(12).a = 0.698132;
+FS(12).p = [0.321195;0.065316];
+FS(12).d = [0.318035;-0.146425;-0.278035;0.166425];
+FS(12).D = [0.766044 0.642788;-0.642788 0.766044;-0.766044 -0.642788;0.642788 -0.766044];
+FS(12).v = [0.350605 0.076940; 0.337749 0.092261; 0.307107 0.066549; 0.319963 0.051228; 0.350605 0.076940];
+FS(12).type = 2;
+
+hold on
+for i=1:length(FS)
+    if FS(i).type == 1;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','r','MarkerSize',2)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'c');
+    end
+    if FS(i).type == 2;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','g','MarkerSize',4)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'r');
+    end
+end
+grid on; %axis equal
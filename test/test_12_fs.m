@@ -0,0 +1,1583 @@
+%
+% Footsteps generated using the c++ version of the WMG
+%
+
+cla;
+clear FS;
+
+FS(1).a = 0.000000;
+FS(1).p = [0.000000;0.050000];
+FS(1).d = [0.070000;0.079000;0.029000;-0.031000];
+FS(1).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(1).v = [0.070000 0.031000; 0.070000 0.079000; -0.029000 0.079000; -0.029000 0.031000; 0.070000 0.031000];
+FS(1).type = 2;
+
+FS(6).a = 0.000000;
+FS(6).p = [0.000000;-0.050000];
+FS(6).d = [0.070000;-0.031000;0.029000;0.079000];
+FS(6).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(6).v = [0.070000 -0.079000; 0.070000 -0.031000; -0.029000 -0.031000; -0.029000 -0.079000; 0.070000 -0.079000];
+FS(6).type = 2;
+
+FS(10).a = 0.087266;
+FS(10).p = [0.035000;0.050000];
+FS(10).d = [0.109225;0.075759;-0.010225;-0.027759];
+FS(10).D = [0.996195 0.087156;-0.087156 0.996195;-0.996195 -0.087156;0.087156 -0.996195];
+FS(10).v = [0.106390 0.037173; 0.102206 0.084991; 0.003583 0.076362; 0.007766 0.028545; 0.106390 0.037173];
+FS(10).type = 2;
+
+FS(14).a = 0.174533;
+FS(14).p = [0.078582;-0.046569];
+FS(14).d = [0.139302;-0.040507;-0.040302;0.088507];
+FS(14).D = [0.984808 0.173648;-0.173648 0.984808;-0.984808 -0.173648;0.173648 -0.984808];
+FS(14).v = [0.152555 -0.062973; 0.144220 -0.015702; 0.046724 -0.032893; 0.055059 -0.080164; 0.152555 -0.062973];
+FS(14).type = 2;
+
+FS(18).a = 0.261799;
+FS(18).p = [0.095686;0.057989];
+FS(18).d = [0.177434;0.060248;-0.078434;-0.012248];
+FS(18).D = [0.965926 0.258819;-0.258819 0.965926;-0.965926 -0.258819;0.258819 -0.965926];
+FS(18).v = [0.168218 0.057754; 0.155795 0.104119; 0.060168 0.078496; 0.072592 0.032131; 0.168218 0.057754];
+FS(18).type = 2;
+
+FS(22).a = 0.349066;
+FS(22).p = [0.155375;-0.029544];
+FS(22).d = [0.205900;-0.061904;-0.106900;0.109904];
+FS(22).D = [0.939693 0.342020;-0.342020 0.939693;-0.939693 -0.342020;0.342020 -0.939693];
+FS(22).v = [0.231072 -0.032854; 0.214655 0.012251; 0.121626 -0.021609; 0.138043 -0.066714; 0.231072 -0.032854];
+FS(22).type = 2;
+
+FS(26).a = 0.436332;
+FS(26).p = [0.154062;0.076395];
+FS(26).d = [0.241914;0.033128;-0.142914;0.014872];
+FS(26).D = [0.906308 0.422618;-0.422618 0.906308;-0.906308 -0.422618;0.422618 -0.906308];
+FS(26).v = [0.225534 0.088759; 0.205248 0.132262; 0.115524 0.090422; 0.135809 0.046920; 0.225534 0.088759];
+FS(26).type = 2;
+
+FS(30).a = 0.523599;
+FS(30).p = [0.228045;0.000556];
+FS(30).d = [0.267771;-0.094541;-0.168771;0.142541];
+FS(30).D = [0.866025 0.500000;-0.500000 0.866025;-0.866025 -0.500000;0.500000 -0.866025];
+FS(30).v = [0.303167 0.010442; 0.279167 0.052011; 0.193430 0.002511; 0.217430 -0.039058; 0.303167 0.010442];
+FS(30).type = 2;
+
+FS(34).a = 0.610865;
+FS(34).p = [0.208356;0.104659];
+FS(34).d = [0.300705;-0.004776;-0.201705;0.052776];
+FS(34).D = [0.819152 0.573576;-0.573576 0.819152;-0.819152 -0.573576;0.573576 -0.819152];
+FS(34).v = [0.276594 0.129245; 0.249063 0.168565; 0.167967 0.111781; 0.195498 0.072461; 0.276594 0.129245];
+FS(34).type = 2;
+
+FS(38).a = 0.698132;
+FS(38).p = [0.294384;0.042819];
+FS(38).d = [0.323035;-0.137425;-0.224035;0.185425];
+FS(38).D = [0.766044 0.642788;-0.642788 0.766044;-0.766044 -0.642788;0.642788 -0.766044];
+FS(38).v = [0.366648 0.065599; 0.335794 0.102369; 0.259956 0.038733; 0.290809 0.001963; 0.366648 0.065599];
+FS(38).type = 2;
+
+FS(42).a = 0.785398;
+FS(42).p = [0.256917;0.141921];
+FS(42).d = [0.352021;-0.052314;-0.253021;0.100314];
+FS(42).D = [0.707107 0.707107;-0.707107 0.707107;-0.707107 -0.707107;0.707107 -0.707107];
+FS(42).v = [0.319849 0.177983; 0.285908 0.211924; 0.215904 0.141921; 0.249846 0.107980; 0.319849 0.177983];
+FS(42).type = 2;
+
+FS(44).a = 0.785398;
+FS(44).p = [0.327627;0.071210];
+FS(44).d = [0.352021;-0.162314;-0.253021;0.210314];
+FS(44).D = [0.707107 0.707107;-0.707107 0.707107;-0.707107 -0.707107;0.707107 -0.707107];
+FS(44).v = [0.397631 0.100202; 0.363690 0.134143; 0.293686 0.064139; 0.327627 0.030198; 0.397631 0.100202];
+FS(44).type = 2;
+
+hold on
+for i=1:length(FS)
+    if FS(i).type == 1;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','r','MarkerSize',2)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'c');
+    end
+    if FS(i).type == 2;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','g','MarkerSize',4)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'r');
+    end
+end
+grid on; %axis equal
+hold on
+LFP = [
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000000 0.050000 0.000000;
+0.000490 0.051457 0.001995;
+0.001838 0.052785 0.003960;
+0.003834 0.053940 0.005865;
+0.006265 0.054900 0.007680;
+0.008938 0.055664 0.009375;
+0.011700 0.056243 0.010920;
+0.014440 0.056654 0.012285;
+0.017079 0.056918 0.013440;
+0.019573 0.057053 0.014355;
+0.021892 0.057074 0.015000;
+0.024028 0.056994 0.015345;
+0.025976 0.056820 0.015360;
+0.027741 0.056553 0.015015;
+0.029327 0.056190 0.014280;
+0.030740 0.055718 0.013125;
+0.031983 0.055116 0.011520;
+0.033053 0.054344 0.009435;
+0.033939 0.053333 0.006840;
+0.034610 0.051963 0.003705;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035000 0.050000 0.000000;
+0.035720 0.051562 0.001995;
+0.037935 0.053191 0.003960;
+0.041287 0.054794 0.005865;
+0.045406 0.056302 0.007680;
+0.049962 0.057669 0.009375;
+0.054689 0.058873 0.010920;
+0.059392 0.059905 0.012285;
+0.063936 0.060767 0.013440;
+0.068238 0.061467 0.014355;
+0.072251 0.062016 0.015000;
+0.075955 0.062422 0.015345;
+0.079344 0.062691 0.015360;
+0.082425 0.062828 0.015015;
+0.085208 0.062828 0.014280;
+0.087702 0.062682 0.013125;
+0.089916 0.062368 0.011520;
+0.091850 0.061846 0.009435;
+0.093490 0.061047 0.006840;
+0.094799 0.059844 0.003705;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.095686 0.057989 0.000000;
+0.096123 0.059653 0.001995;
+0.098022 0.061642 0.003960;
+0.101045 0.063803 0.005865;
+0.104839 0.066003 0.007680;
+0.109089 0.068140 0.009375;
+0.113535 0.070147 0.010920;
+0.117987 0.071979 0.012285;
+0.122313 0.073618 0.013440;
+0.126428 0.075054 0.014355;
+0.130285 0.076292 0.015000;
+0.133861 0.077334 0.015345;
+0.137152 0.078188 0.015360;
+0.140163 0.078858 0.015015;
+0.142903 0.079341 0.014280;
+0.145385 0.079631 0.013125;
+0.147620 0.079706 0.011520;
+0.149615 0.079528 0.009435;
+0.151369 0.079026 0.006840;
+0.152867 0.078068 0.003705;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154062 0.076395 0.000000;
+0.154204 0.078110 0.001995;
+0.155729 0.080398 0.003960;
+0.158330 0.083051 0.005865;
+0.161685 0.085876 0.007680;
+0.165499 0.088720 0.009375;
+0.169530 0.091467 0.010920;
+0.173596 0.094045 0.012285;
+0.177571 0.096410 0.013440;
+0.181374 0.098539 0.014355;
+0.184957 0.100428 0.015000;
+0.188299 0.102075 0.015345;
+0.191391 0.103488 0.015360;
+0.194240 0.104670 0.015015;
+0.196855 0.105622 0.014280;
+0.199249 0.106338 0.013125;
+0.201437 0.106800 0.011520;
+0.203432 0.106971 0.009435;
+0.205247 0.106781 0.006840;
+0.206888 0.106098 0.003705;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208356 0.104659 0.000000;
+0.208198 0.106372 0.001995;
+0.209302 0.108890 0.003960;
+0.211403 0.111954 0.005865;
+0.214217 0.115320 0.007680;
+0.217479 0.118782 0.009375;
+0.220971 0.122188 0.010920;
+0.224528 0.125433 0.012285;
+0.228032 0.128451 0.013440;
+0.231407 0.131209 0.014355;
+0.234608 0.133691 0.015000;
+0.237613 0.135894 0.015345;
+0.240413 0.137822 0.015360;
+0.243013 0.139481 0.015015;
+0.245423 0.140872 0.014280;
+0.247656 0.141993 0.013125;
+0.249731 0.142828 0.011520;
+0.251666 0.143343 0.009435;
+0.253486 0.143471 0.006840;
+0.255222 0.143083 0.003705;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+0.256917 0.141921 0.000000;
+];
+
+ plot3(LFP(:,1), LFP(:,2), LFP(:,3), 'r')
+RFP = [
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.000000 -0.050000 0.000000;
+0.001141 -0.051407 0.001995;
+0.004281 -0.052597 0.003960;
+0.008930 -0.053547 0.005865;
+0.014583 -0.054258 0.007680;
+0.020795 -0.054748 0.009375;
+0.027209 -0.055045 0.010920;
+0.033559 -0.055177 0.012285;
+0.039668 -0.055172 0.013440;
+0.045424 -0.055054 0.014355;
+0.050765 -0.054841 0.015000;
+0.055661 -0.054546 0.015345;
+0.060104 -0.054177 0.015360;
+0.064099 -0.053735 0.015015;
+0.067653 -0.053217 0.014280;
+0.070771 -0.052610 0.013125;
+0.073448 -0.051892 0.011520;
+0.075661 -0.051025 0.009435;
+0.077355 -0.049944 0.006840;
+0.078412 -0.048532 0.003705;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.078582 -0.046569 0.000000;
+0.079951 -0.047756 0.001995;
+0.083250 -0.048383 0.003960;
+0.087992 -0.048511 0.005865;
+0.093683 -0.048230 0.007680;
+0.099886 -0.047634 0.009375;
+0.106254 -0.046813 0.010920;
+0.112531 -0.045840 0.012285;
+0.118546 -0.044775 0.013440;
+0.124194 -0.043659 0.014355;
+0.129417 -0.042522 0.015000;
+0.134187 -0.041381 0.015345;
+0.138499 -0.040246 0.015360;
+0.142357 -0.039117 0.015015;
+0.145767 -0.037989 0.014280;
+0.148732 -0.036850 0.013125;
+0.151243 -0.035678 0.011520;
+0.153272 -0.034440 0.009435;
+0.154753 -0.033081 0.006840;
+0.155548 -0.031508 0.003705;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.155375 -0.029544 0.000000;
+0.156929 -0.030476 0.001995;
+0.160286 -0.030520 0.003960;
+0.164979 -0.029823 0.005865;
+0.170535 -0.028558 0.007680;
+0.176541 -0.026894 0.009375;
+0.182668 -0.024979 0.010920;
+0.188681 -0.022932 0.012285;
+0.194420 -0.020838 0.013440;
+0.199789 -0.018758 0.014355;
+0.204734 -0.016731 0.015000;
+0.209234 -0.014780 0.015345;
+0.213283 -0.012913 0.015360;
+0.216886 -0.011131 0.015015;
+0.220049 -0.009429 0.014280;
+0.222771 -0.007792 0.013125;
+0.225041 -0.006202 0.011520;
+0.226824 -0.004630 0.009435;
+0.228046 -0.003035 0.006840;
+0.228556 -0.001347 0.003705;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.228045 0.000556 0.000000;
+0.229737 -0.000091 0.001995;
+0.233051 0.000448 0.003960;
+0.237552 0.001950 0.005865;
+0.242803 0.004161 0.007680;
+0.248429 0.006842 0.009375;
+0.254131 0.009792 0.010920;
+0.259697 0.012852 0.012285;
+0.264985 0.015911 0.013440;
+0.269911 0.018891 0.014355;
+0.274429 0.021746 0.015000;
+0.278522 0.024449 0.015345;
+0.282185 0.026991 0.015360;
+0.285424 0.029371 0.015015;
+0.288243 0.031597 0.014280;
+0.290640 0.033682 0.013125;
+0.292599 0.035642 0.011520;
+0.294082 0.037499 0.009435;
+0.295009 0.039283 0.006840;
+0.295218 0.041033 0.003705;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.294384 0.042819 0.000000;
+0.295802 0.042114 0.001995;
+0.297983 0.042229 0.003960;
+0.300688 0.043021 0.005865;
+0.303693 0.044325 0.007680;
+0.306809 0.045980 0.009375;
+0.309890 0.047850 0.010920;
+0.312837 0.049825 0.012285;
+0.315588 0.051827 0.013440;
+0.318107 0.053801 0.014355;
+0.320377 0.055711 0.015000;
+0.322395 0.057540 0.015345;
+0.324162 0.059278 0.015360;
+0.325680 0.060925 0.015015;
+0.326950 0.062487 0.014280;
+0.327967 0.063976 0.013125;
+0.328714 0.065406 0.011520;
+0.329157 0.066801 0.009435;
+0.329230 0.068192 0.006840;
+0.328804 0.069632 0.003705;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+0.327627 0.071210 0.000000;
+];
+
+ plot3(RFP(:,1), RFP(:,2), RFP(:,3), 'r')
+ZMP = [
+0.019979 -0.000065;
+0.019912 0.000809;
+0.019784 0.002383;
+0.019675 0.003604;
+0.019598 0.004346;
+0.019560 0.004495;
+0.019562 0.003946;
+0.019609 0.002604;
+0.019701 0.000392;
+0.019841 -0.002734;
+0.020031 -0.006739;
+0.020272 -0.011339;
+0.020571 -0.016521;
+0.020927 -0.021967;
+0.021361 -0.031000;
+0.021871 -0.034485;
+0.022458 -0.037634;
+0.023127 -0.040350;
+0.023891 -0.042491;
+0.024768 -0.043846;
+0.025770 -0.044100;
+0.026904 -0.042846;
+0.028171 -0.039731;
+0.029586 -0.034370;
+0.031119 -0.025296;
+0.032920 -0.011767;
+0.034691 0.006161;
+0.035926 0.031008;
+0.038955 0.036957;
+0.042214 0.041608;
+0.045680 0.044970;
+0.049329 0.047046;
+0.053141 0.047820;
+0.057102 0.047265;
+0.061199 0.045352;
+0.065421 0.042056;
+0.069767 0.037118;
+0.074473 0.028436;
+0.079577 0.015191;
+0.084624 0.000811;
+0.091428 -0.025011;
+0.094590 -0.031534;
+0.097287 -0.036681;
+0.099531 -0.040367;
+0.101343 -0.042500;
+0.102746 -0.042973;
+0.103760 -0.041680;
+0.104420 -0.038577;
+0.104785 -0.033705;
+0.104852 -0.026665;
+0.104438 -0.016455;
+0.103589 -0.002293;
+0.102307 0.014595;
+0.099044 0.039219;
+0.100561 0.046491;
+0.102553 0.052436;
+0.105022 0.056994;
+0.107970 0.060096;
+0.111402 0.061663;
+0.115331 0.061617;
+0.119755 0.059930;
+0.124648 0.056640;
+0.130074 0.051385;
+0.136402 0.042992;
+0.143792 0.030713;
+0.151321 0.017394;
+0.162531 -0.006720;
+0.166885 -0.012623;
+0.170549 -0.017217;
+0.173518 -0.020424;
+0.175795 -0.022154;
+0.177381 -0.022305;
+0.178279 -0.020777;
+0.178516 -0.017532;
+0.178157 -0.012608;
+0.177128 -0.005617;
+0.175067 0.004413;
+0.171883 0.018260;
+0.167806 0.034672;
+0.160408 0.058390;
+0.160709 0.065868;
+0.161696 0.072117;
+0.163384 0.077075;
+0.165786 0.080675;
+0.168925 0.082836;
+0.172827 0.083483;
+0.177497 0.082588;
+0.182903 0.080185;
+0.189174 0.075925;
+0.196865 0.068742;
+0.206267 0.057929;
+0.215982 0.046116;
+0.231192 0.024313;
+0.236489 0.019249;
+0.240878 0.015354;
+0.244341 0.012704;
+0.246868 0.011388;
+0.248440 0.011508;
+0.249045 0.013161;
+0.248702 0.016390;
+0.247485 0.021168;
+0.245251 0.027866;
+0.241475 0.037378;
+0.235932 0.050457;
+0.229069 0.065911;
+0.217677 0.087991;
+0.216705 0.095417;
+0.216621 0.101756;
+0.217440 0.106946;
+0.219187 0.110920;
+0.221897 0.113602;
+0.225611 0.114921;
+0.230342 0.114846;
+0.236054 0.113400;
+0.242942 0.110256;
+0.251723 0.104481;
+0.262801 0.095433;
+0.274359 0.085443;
+0.293077 0.066525;
+0.299028 0.062453;
+0.303869 0.059372;
+0.307577 0.057349;
+0.310128 0.056456;
+0.311495 0.056775;
+0.311660 0.058373;
+0.310647 0.061276;
+0.308500 0.065493;
+0.304964 0.071395;
+0.299602 0.079558;
+0.292083 0.090542;
+0.281479 0.104903;
+0.265945 0.124080;
+0.263271 0.130402;
+0.261654 0.135614;
+0.261033 0.139729;
+0.261333 0.142776;
+0.262468 0.144803;
+0.264347 0.145872;
+0.266871 0.146056;
+0.269941 0.145440;
+0.273456 0.144114;
+0.277300 0.142183;
+0.281319 0.139816;
+0.285360 0.137171;
+0.289326 0.134361;
+0.293133 0.131485;
+0.296709 0.128632;
+0.299999 0.125879;
+0.302962 0.123289;
+0.305567 0.120914;
+0.307800 0.118793;
+0.309655 0.116951;
+0.311137 0.115406;
+0.312260 0.114162;
+0.313045 0.113216;
+0.313518 0.112559;
+0.313711 0.112173;
+0.313658 0.112036;
+0.313394 0.112122;
+0.312957 0.112404;
+0.312381 0.112849;
+0.311703 0.113429;
+];
+
+ plot(ZMP(:,1), ZMP(:,2), 'k')
+ZMPref = [
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 0.000000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.020500 -0.050000;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.055422 0.051787;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.098771 -0.043009;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.115487 0.063295;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.174639 -0.022533;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.172642 0.085059;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.245798 0.010806;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.225148 0.116417;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.310088 0.055996;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.271412 0.156417;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+0.306768 0.121061;
+];
+
+ plot(ZMPref(:,1), ZMPref(:,2), 'ko')
+CoM = [
+0.019979 -0.000067;
+0.019980 -0.000082;
+0.019983 -0.000123;
+0.019989 -0.000202;
+0.020000 -0.000329;
+0.020014 -0.000515;
+0.020035 -0.000770;
+0.020062 -0.001101;
+0.020097 -0.001517;
+0.020140 -0.002022;
+0.020191 -0.002623;
+0.020252 -0.003322;
+0.020323 -0.004121;
+0.020404 -0.005022;
+0.020497 -0.006021;
+0.020602 -0.007116;
+0.020720 -0.008302;
+0.020851 -0.009571;
+0.020995 -0.010913;
+0.021155 -0.012318;
+0.021329 -0.013772;
+0.021519 -0.015262;
+0.021726 -0.016772;
+0.021951 -0.018285;
+0.022193 -0.019783;
+0.022455 -0.021244;
+0.022736 -0.022625;
+0.023038 -0.023887;
+0.023361 -0.025015;
+0.023707 -0.026000;
+0.024076 -0.026834;
+0.024470 -0.027504;
+0.024888 -0.028001;
+0.025333 -0.028312;
+0.025806 -0.028425;
+0.026308 -0.028325;
+0.026839 -0.028001;
+0.027402 -0.027438;
+0.027996 -0.026625;
+0.028625 -0.025549;
+0.029287 -0.024200;
+0.029986 -0.022572;
+0.030722 -0.020659;
+0.031496 -0.018461;
+0.032309 -0.015980;
+0.033164 -0.013222;
+0.034062 -0.010203;
+0.035003 -0.006959;
+0.035990 -0.003540;
+0.037024 -0.000003;
+0.038106 0.003576;
+0.039240 0.007108;
+0.040434 0.010466;
+0.041693 0.013537;
+0.043017 0.016299;
+0.044402 0.018750;
+0.045844 0.020889;
+0.047341 0.022717;
+0.048890 0.024234;
+0.050486 0.025438;
+0.052128 0.026331;
+0.053812 0.026912;
+0.055534 0.027182;
+0.057293 0.027141;
+0.059084 0.026791;
+0.060906 0.026134;
+0.062753 0.025170;
+0.064624 0.023904;
+0.066515 0.022337;
+0.068422 0.020474;
+0.070342 0.018322;
+0.072270 0.015887;
+0.074202 0.013184;
+0.076129 0.010253;
+0.078042 0.007148;
+0.079932 0.003923;
+0.081789 0.000638;
+0.083601 -0.002634;
+0.085345 -0.005764;
+0.087002 -0.008627;
+0.088568 -0.011192;
+0.090044 -0.013451;
+0.091429 -0.015397;
+0.092727 -0.017023;
+0.093938 -0.018322;
+0.095066 -0.019290;
+0.096112 -0.019923;
+0.097079 -0.020215;
+0.097970 -0.020166;
+0.098790 -0.019774;
+0.099542 -0.019039;
+0.100230 -0.017965;
+0.100860 -0.016553;
+0.101437 -0.014811;
+0.101965 -0.012746;
+0.102452 -0.010366;
+0.102902 -0.007686;
+0.103323 -0.004721;
+0.103723 -0.001491;
+0.104112 0.001962;
+0.104504 0.005586;
+0.104909 0.009325;
+0.105345 0.013111;
+0.105829 0.016864;
+0.106391 0.020466;
+0.107058 0.023806;
+0.107835 0.026856;
+0.108721 0.029612;
+0.109716 0.032067;
+0.110818 0.034215;
+0.112027 0.036052;
+0.113341 0.037574;
+0.114759 0.038779;
+0.116279 0.039662;
+0.117899 0.040224;
+0.119617 0.040463;
+0.121429 0.040380;
+0.123333 0.039979;
+0.125325 0.039262;
+0.127401 0.038234;
+0.129555 0.036902;
+0.131783 0.035275;
+0.134077 0.033364;
+0.136432 0.031181;
+0.138838 0.028746;
+0.141279 0.026099;
+0.143738 0.023290;
+0.146196 0.020370;
+0.148633 0.017396;
+0.151024 0.014436;
+0.153326 0.011613;
+0.155497 0.009045;
+0.157529 0.006760;
+0.159419 0.004767;
+0.161169 0.003073;
+0.162778 0.001684;
+0.164246 0.000605;
+0.165574 -0.000157;
+0.166765 -0.000598;
+0.167820 -0.000716;
+0.168741 -0.000507;
+0.169533 0.000030;
+0.170199 0.000895;
+0.170743 0.002085;
+0.171171 0.003597;
+0.171489 0.005427;
+0.171703 0.007568;
+0.171821 0.010011;
+0.171850 0.012744;
+0.171800 0.015753;
+0.171681 0.019018;
+0.171513 0.022502;
+0.171315 0.026155;
+0.171110 0.029922;
+0.170924 0.033741;
+0.170790 0.037536;
+0.170757 0.041195;
+0.170870 0.044615;
+0.171140 0.047769;
+0.171567 0.050651;
+0.172151 0.053254;
+0.172892 0.055574;
+0.173789 0.057605;
+0.174844 0.059344;
+0.176054 0.060786;
+0.177418 0.061929;
+0.178935 0.062771;
+0.180602 0.063311;
+0.182417 0.063550;
+0.184376 0.063489;
+0.186475 0.063132;
+0.188708 0.062482;
+0.191071 0.061546;
+0.193556 0.060331;
+0.196155 0.058846;
+0.198858 0.057105;
+0.201655 0.055124;
+0.204522 0.052940;
+0.207434 0.050599;
+0.210362 0.048149;
+0.213278 0.045642;
+0.216147 0.043140;
+0.218902 0.040758;
+0.221484 0.038604;
+0.223878 0.036705;
+0.226083 0.035068;
+0.228097 0.033700;
+0.229919 0.032609;
+0.231548 0.031799;
+0.232984 0.031277;
+0.234229 0.031046;
+0.235284 0.031111;
+0.236151 0.031474;
+0.236833 0.032137;
+0.237335 0.033101;
+0.237660 0.034365;
+0.237815 0.035926;
+0.237807 0.037781;
+0.237643 0.039923;
+0.237331 0.042347;
+0.236882 0.045041;
+0.236308 0.047993;
+0.235622 0.051187;
+0.234849 0.054586;
+0.234018 0.058147;
+0.233161 0.061820;
+0.232313 0.065548;
+0.231521 0.069261;
+0.230852 0.072857;
+0.230369 0.076244;
+0.230086 0.079396;
+0.230004 0.082307;
+0.230125 0.084971;
+0.230448 0.087382;
+0.230975 0.089536;
+0.231705 0.091429;
+0.232638 0.093055;
+0.233774 0.094413;
+0.235110 0.095500;
+0.236645 0.096315;
+0.238376 0.096857;
+0.240299 0.097128;
+0.242408 0.097130;
+0.244699 0.096865;
+0.247164 0.096338;
+0.249795 0.095556;
+0.252582 0.094527;
+0.255514 0.093262;
+0.258576 0.091774;
+0.261740 0.090097;
+0.264971 0.088271;
+0.268234 0.086339;
+0.271490 0.084345;
+0.274694 0.082347;
+0.277761 0.080445;
+0.280612 0.078734;
+0.283230 0.077240;
+0.285610 0.075967;
+0.287749 0.074923;
+0.289646 0.074113;
+0.291299 0.073542;
+0.292708 0.073214;
+0.293871 0.073134;
+0.294790 0.073304;
+0.295466 0.073728;
+0.295901 0.074406;
+0.296098 0.075340;
+0.296061 0.076529;
+0.295796 0.077972;
+0.295307 0.079665;
+0.294602 0.081604;
+0.293688 0.083786;
+0.292577 0.086199;
+0.291280 0.088836;
+0.289811 0.091681;
+0.288196 0.094707;
+0.286465 0.097879;
+0.284653 0.101158;
+0.282809 0.104489;
+0.280992 0.107807;
+0.279285 0.111023;
+0.277763 0.114059;
+0.276441 0.116894;
+0.275317 0.119527;
+0.274388 0.121955;
+0.273650 0.124177;
+0.273099 0.126195;
+0.272729 0.128010;
+0.272534 0.129624;
+0.272507 0.131041;
+0.272641 0.132264;
+0.272928 0.133299;
+0.273359 0.134151;
+0.273926 0.134828;
+0.274618 0.135335;
+0.275427 0.135682;
+0.276342 0.135876;
+0.277353 0.135926;
+0.278449 0.135843;
+0.279621 0.135635;
+0.280856 0.135314;
+0.282146 0.134888;
+0.283478 0.134371;
+0.284842 0.133772;
+0.286230 0.133101;
+0.287630 0.132368;
+0.289035 0.131585;
+0.290435 0.130760;
+0.291823 0.129902;
+0.293192 0.129020;
+0.294534 0.128123;
+0.295843 0.127218;
+0.297114 0.126312;
+0.298342 0.125413;
+0.299523 0.124527;
+0.300651 0.123659;
+0.301725 0.122815;
+0.302741 0.121999;
+0.303697 0.121216;
+0.304592 0.120470;
+0.305423 0.119763;
+0.306191 0.119098;
+0.306896 0.118478;
+0.307536 0.117903;
+0.308114 0.117377;
+0.308629 0.116898;
+0.309083 0.116468;
+0.309478 0.116087;
+0.309815 0.115754;
+0.310096 0.115470;
+0.310324 0.115233;
+0.310501 0.115041;
+0.310629 0.114894;
+0.310712 0.114790;
+0.310753 0.114727;
+0.310754 0.114704;
+0.310718 0.114717;
+0.310648 0.114765;
+0.310548 0.114846;
+0.310420 0.114956;
+0.310268 0.115094;
+0.310094 0.115258;
+0.309902 0.115443;
+0.309693 0.115649;
+];
+
+ plot(CoM(:,1), CoM(:,2), 'b')
+hold off
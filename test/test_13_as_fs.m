@@ -0,0 +1,397 @@
+%
+% Footsteps generated using the c++ version of the WMG
+%
+
+cla;
+clear FS;
+
+FS(1).a = 0.000000;
+FS(1).p = [0.000000;-0.050000];
+FS(1).d = [0.090000;-0.025000;0.030000;0.075000];
+FS(1).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(1).v = [0.090000 -0.075000; 0.090000 -0.025000; -0.030000 -0.025000; -0.030000 -0.075000; 0.090000 -0.075000];
+FS(1).type = 2;
+
+FS(2).a = 0.000000;
+FS(2).p = [0.000000;0.000000];
+FS(2).d = [0.090000;0.075000;0.030000;0.075000];
+FS(2).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(2).v = [0.090000 -0.075000; 0.090000 0.075000; -0.030000 0.075000; -0.030000 -0.075000; 0.090000 -0.075000];
+FS(2).type = 1;
+
+FS(3).a = 0.000000;
+FS(3).p = [0.000000;0.050000];
+FS(3).d = [0.090000;0.075000;0.030000;-0.025000];
+FS(3).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(3).v = [0.090000 0.025000; 0.090000 0.075000; -0.030000 0.075000; -0.030000 0.025000; 0.090000 0.025000];
+FS(3).type = 2;
+
+FS(4).a = 0.000000;
+FS(4).p = [0.010000;0.025000];
+FS(4).d = [0.080000;0.050000;0.015000;0.000000];
+FS(4).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(4).v = [0.080000 0.000000; 0.080000 0.050000; -0.015000 0.050000; -0.015000 -0.000000; 0.080000 0.000000];
+FS(4).type = 1;
+
+FS(5).a = 0.000000;
+FS(5).p = [0.020000;0.000000];
+FS(5).d = [0.090000;0.025000;0.005000;0.025000];
+FS(5).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(5).v = [0.090000 -0.025000; 0.090000 0.025000; -0.005000 0.025000; -0.005000 -0.025000; 0.090000 -0.025000];
+FS(5).type = 1;
+
+FS(6).a = 0.000000;
+FS(6).p = [0.030000;-0.025000];
+FS(6).d = [0.100000;0.000000;-0.005000;0.050000];
+FS(6).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(6).v = [0.100000 -0.050000; 0.100000 0.000000; 0.005000 0.000000; 0.005000 -0.050000; 0.100000 -0.050000];
+FS(6).type = 1;
+
+FS(7).a = 0.000000;
+FS(7).p = [0.040000;-0.050000];
+FS(7).d = [0.130000;-0.025000;-0.010000;0.075000];
+FS(7).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(7).v = [0.130000 -0.075000; 0.130000 -0.025000; 0.010000 -0.025000; 0.010000 -0.075000; 0.130000 -0.075000];
+FS(7).type = 2;
+
+FS(8).a = 0.000000;
+FS(8).p = [0.050000;-0.025000];
+FS(8).d = [0.120000;0.000000;-0.025000;0.050000];
+FS(8).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(8).v = [0.120000 -0.050000; 0.120000 0.000000; 0.025000 0.000000; 0.025000 -0.050000; 0.120000 -0.050000];
+FS(8).type = 1;
+
+FS(9).a = 0.000000;
+FS(9).p = [0.060000;0.000000];
+FS(9).d = [0.130000;0.025000;-0.035000;0.025000];
+FS(9).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(9).v = [0.130000 -0.025000; 0.130000 0.025000; 0.035000 0.025000; 0.035000 -0.025000; 0.130000 -0.025000];
+FS(9).type = 1;
+
+FS(10).a = 0.000000;
+FS(10).p = [0.070000;0.025000];
+FS(10).d = [0.140000;0.050000;-0.045000;0.000000];
+FS(10).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(10).v = [0.140000 0.000000; 0.140000 0.050000; 0.045000 0.050000; 0.045000 0.000000; 0.140000 0.000000];
+FS(10).type = 1;
+
+FS(11).a = 0.000000;
+FS(11).p = [0.080000;0.050000];
+FS(11).d = [0.170000;0.075000;-0.050000;-0.025000];
+FS(11).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(11).v = [0.170000 0.025000; 0.170000 0.075000; 0.050000 0.075000; 0.050000 0.025000; 0.170000 0.025000];
+FS(11).type = 2;
+
+FS(12).a = 0.000000;
+FS(12).p = [0.090000;0.025000];
+FS(12).d = [0.160000;0.050000;-0.065000;0.000000];
+FS(12).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(12).v = [0.160000 0.000000; 0.160000 0.050000; 0.065000 0.050000; 0.065000 0.000000; 0.160000 0.000000];
+FS(12).type = 1;
+
+FS(13).a = 0.000000;
+FS(13).p = [0.100000;0.000000];
+FS(13).d = [0.170000;0.025000;-0.075000;0.025000];
+FS(13).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(13).v = [0.170000 -0.025000; 0.170000 0.025000; 0.075000 0.025000; 0.075000 -0.025000; 0.170000 -0.025000];
+FS(13).type = 1;
+
+FS(14).a = 0.000000;
+FS(14).p = [0.110000;-0.025000];
+FS(14).d = [0.180000;0.000000;-0.085000;0.050000];
+FS(14).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(14).v = [0.180000 -0.050000; 0.180000 0.000000; 0.085000 0.000000; 0.085000 -0.050000; 0.180000 -0.050000];
+FS(14).type = 1;
+
+FS(15).a = 0.000000;
+FS(15).p = [0.120000;-0.050000];
+FS(15).d = [0.210000;-0.025000;-0.090000;0.075000];
+FS(15).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(15).v = [0.210000 -0.075000; 0.210000 -0.025000; 0.090000 -0.025000; 0.090000 -0.075000; 0.210000 -0.075000];
+FS(15).type = 2;
+
+FS(16).a = 0.000000;
+FS(16).p = [0.130000;-0.025000];
+FS(16).d = [0.200000;0.000000;-0.105000;0.050000];
+FS(16).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(16).v = [0.200000 -0.050000; 0.200000 0.000000; 0.105000 0.000000; 0.105000 -0.050000; 0.200000 -0.050000];
+FS(16).type = 1;
+
+FS(17).a = 0.000000;
+FS(17).p = [0.140000;0.000000];
+FS(17).d = [0.210000;0.025000;-0.115000;0.025000];
+FS(17).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(17).v = [0.210000 -0.025000; 0.210000 0.025000; 0.115000 0.025000; 0.115000 -0.025000; 0.210000 -0.025000];
+FS(17).type = 1;
+
+FS(18).a = 0.000000;
+FS(18).p = [0.150000;0.025000];
+FS(18).d = [0.220000;0.050000;-0.125000;0.000000];
+FS(18).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(18).v = [0.220000 0.000000; 0.220000 0.050000; 0.125000 0.050000; 0.125000 0.000000; 0.220000 0.000000];
+FS(18).type = 1;
+
+FS(19).a = 0.000000;
+FS(19).p = [0.160000;0.050000];
+FS(19).d = [0.250000;0.075000;-0.130000;-0.025000];
+FS(19).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(19).v = [0.250000 0.025000; 0.250000 0.075000; 0.130000 0.075000; 0.130000 0.025000; 0.250000 0.025000];
+FS(19).type = 2;
+
+FS(20).a = 0.000000;
+FS(20).p = [0.170000;0.025000];
+FS(20).d = [0.240000;0.050000;-0.145000;0.000000];
+FS(20).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(20).v = [0.240000 0.000000; 0.240000 0.050000; 0.145000 0.050000; 0.145000 0.000000; 0.240000 0.000000];
+FS(20).type = 1;
+
+FS(21).a = 0.000000;
+FS(21).p = [0.180000;0.000000];
+FS(21).d = [0.250000;0.025000;-0.155000;0.025000];
+FS(21).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(21).v = [0.250000 -0.025000; 0.250000 0.025000; 0.155000 0.025000; 0.155000 -0.025000; 0.250000 -0.025000];
+FS(21).type = 1;
+
+FS(22).a = 0.000000;
+FS(22).p = [0.190000;-0.025000];
+FS(22).d = [0.260000;0.000000;-0.165000;0.050000];
+FS(22).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(22).v = [0.260000 -0.050000; 0.260000 0.000000; 0.165000 0.000000; 0.165000 -0.050000; 0.260000 -0.050000];
+FS(22).type = 1;
+
+FS(23).a = 0.000000;
+FS(23).p = [0.200000;-0.050000];
+FS(23).d = [0.290000;-0.025000;-0.170000;0.075000];
+FS(23).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(23).v = [0.290000 -0.075000; 0.290000 -0.025000; 0.170000 -0.025000; 0.170000 -0.075000; 0.290000 -0.075000];
+FS(23).type = 2;
+
+FS(24).a = 0.000000;
+FS(24).p = [0.210000;-0.025000];
+FS(24).d = [0.280000;0.000000;-0.185000;0.050000];
+FS(24).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(24).v = [0.280000 -0.050000; 0.280000 0.000000; 0.185000 0.000000; 0.185000 -0.050000; 0.280000 -0.050000];
+FS(24).type = 1;
+
+FS(25).a = 0.000000;
+FS(25).p = [0.220000;0.000000];
+FS(25).d = [0.290000;0.025000;-0.195000;0.025000];
+FS(25).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(25).v = [0.290000 -0.025000; 0.290000 0.025000; 0.195000 0.025000; 0.195000 -0.025000; 0.290000 -0.025000];
+FS(25).type = 1;
+
+FS(26).a = 0.000000;
+FS(26).p = [0.230000;0.025000];
+FS(26).d = [0.300000;0.050000;-0.205000;0.000000];
+FS(26).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(26).v = [0.300000 0.000000; 0.300000 0.050000; 0.205000 0.050000; 0.205000 0.000000; 0.300000 0.000000];
+FS(26).type = 1;
+
+FS(27).a = 0.000000;
+FS(27).p = [0.240000;0.050000];
+FS(27).d = [0.330000;0.075000;-0.210000;-0.025000];
+FS(27).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(27).v = [0.330000 0.025000; 0.330000 0.075000; 0.210000 0.075000; 0.210000 0.025000; 0.330000 0.025000];
+FS(27).type = 2;
+
+FS(28).a = 0.000000;
+FS(28).p = [0.250000;0.025000];
+FS(28).d = [0.320000;0.050000;-0.225000;0.000000];
+FS(28).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(28).v = [0.320000 0.000000; 0.320000 0.050000; 0.225000 0.050000; 0.225000 0.000000; 0.320000 0.000000];
+FS(28).type = 1;
+
+FS(29).a = 0.000000;
+FS(29).p = [0.260000;0.000000];
+FS(29).d = [0.330000;0.025000;-0.235000;0.025000];
+FS(29).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(29).v = [0.330000 -0.025000; 0.330000 0.025000; 0.235000 0.025000; 0.235000 -0.025000; 0.330000 -0.025000];
+FS(29).type = 1;
+
+FS(30).a = 0.000000;
+FS(30).p = [0.270000;-0.025000];
+FS(30).d = [0.340000;0.000000;-0.245000;0.050000];
+FS(30).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(30).v = [0.340000 -0.050000; 0.340000 0.000000; 0.245000 0.000000; 0.245000 -0.050000; 0.340000 -0.050000];
+FS(30).type = 1;
+
+FS(31).a = 0.000000;
+FS(31).p = [0.280000;-0.050000];
+FS(31).d = [0.370000;-0.025000;-0.250000;0.075000];
+FS(31).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(31).v = [0.370000 -0.075000; 0.370000 -0.025000; 0.250000 -0.025000; 0.250000 -0.075000; 0.370000 -0.075000];
+FS(31).type = 2;
+
+FS(32).a = 0.000000;
+FS(32).p = [0.280000;0.000000];
+FS(32).d = [0.370000;0.075000;-0.250000;0.075000];
+FS(32).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(32).v = [0.370000 -0.075000; 0.370000 0.075000; 0.250000 0.075000; 0.250000 -0.075000; 0.370000 -0.075000];
+FS(32).type = 1;
+
+FS(33).a = 0.000000;
+FS(33).p = [0.280000;0.050000];
+FS(33).d = [0.370000;0.075000;-0.250000;-0.025000];
+FS(33).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(33).v = [0.370000 0.025000; 0.370000 0.075000; 0.250000 0.075000; 0.250000 0.025000; 0.370000 0.025000];
+FS(33).type = 2;
+
+hold on
+for i=1:length(FS)
+    if FS(i).type == 1;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','r','MarkerSize',2)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'c');
+    end
+    if FS(i).type == 2;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','g','MarkerSize',4)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'r');
+    end
+end
+grid on; %axis equal
+
+
+CoM_ZMP = [
+2.34206907436486e-05 -1.01313443659482e-06 -0.0022327635652216 9.65850956882943e-05;
+0.0001781898165552 -7.88815052173833e-06 -0.00345025552735621 0.000166411286949401;
+0.000551848793213813 -2.54493287324584e-05 -0.00376449086566401 0.000209184224401981;
+0.00118887720372204 -5.73947034786905e-05 -0.00328847359914062 0.000215443747555222;
+0.00210072840749805 -0.000106123402876036 -0.00214801941937828 0.00018467643211787;
+0.00327438219601637 -0.00017225432967618 -0.000473491278297704 6.81158002017632e-05;
+0.00467966202832988 -0.000252707129265789 0.0016066834087261 -0.000125319213227332;
+0.00627536741823724 -0.000340473810961136 0.00397089944895765 -0.000385827758006926;
+0.00801429779443808 -0.000424619840092833 0.00650786269482239 -0.000719380114196667;
+0.00984726232731814 -0.000489790087206376 0.00911888288096703 -0.00109338812449798;
+0.0117261817065252 -0.000516961397192127 0.0117191686290923 -0.00146835872494349;
+0.0136063936033357 -0.000484633719807388 0.0142383133244493 -0.00180715941066805;
+0.0154482745019309 -0.000369825937044523 0.0166201468705285 -0.00207387780148219;
+0.0172182876422818 -0.000148896811578782 0.018822111685194 -0.00223314577714284;
+0.0188895608350631 0.000202024168051756 0.0208143028326846 -0.00227942703197832;
+0.0204421703663335 0.000707405634191706 0.0225705990310556 -0.00216217508944727;
+0.0218632833023258 0.00139113289973565 0.0240922817246134 -0.00182967017307082;
+0.0231465069155518 0.00227483854546391 0.0253853699448035 -0.00123687595285776;
+0.0242911133087401 0.00337629500102073 0.0264600686448103 -0.000332622041536071;
+0.0253013563066965 0.00470762808288353 0.0273302943116061 0.000910316957519253;
+0.0261858675354269 0.00627414351053415 0.028013272552446 0.00251649564505152;
+0.0269571190669607 0.00807302209091694 0.0285292018622733 0.00451669645555746;
+0.0276309400459536 0.0100916304929378 0.0289009764983009 0.00690735874385397;
+0.0282260744118695 0.0123066456293678 0.0291539594547455 0.0096796179253773;
+0.0287637662893446 0.0146831722480527 0.0293157940937053 0.0128166770951447;
+0.0292673589570117 0.0171736460485154 0.029416240206626 0.0162897860779201;
+0.0297618926530395 0.0197166904362824 0.0294870173219568 0.0200543456568642;
+0.0302736859774724 0.0222360184348608 0.0295616351133873 0.0240539272824535;
+0.0308299661646066 0.0246394528380426 0.0296674941843449 0.0281945342820792;
+0.0314585996884432 0.0268188990911755 0.0298505280290749 0.0323581039669396;
+0.0321871827789402 0.0286510095683827 0.030153504682211 0.0363989889275875;
+0.033042083750132 0.0300029768659162 0.0306162935760331 0.0397254639880397;
+0.0340475920117671 0.0307521857020191 0.0312759860639623 0.0421797592264809;
+0.0352251132916197 0.0307928256136714 0.0321668055896048 0.0436185799222458;
+0.0365923665745952 0.0300382958316641 0.0333197595572006 0.0439087482646289;
+0.0381625544674191 0.0284239975094681 0.0347620003980345 0.0429404741823926;
+0.0399434951681449 0.0259102322098736 0.0365158785315762 0.0406221814082773;
+0.0419367210328329 0.0224854326670118 0.0385976853355559 0.0368837763805173;
+0.0441365659707602 0.0181697951801668 0.0410161003240387 0.0316815191957369;
+0.0465292816323784 0.0130192828553033 0.0437703739283124 0.0249999999999999;
+0.0490922406106771 0.00717424531571722 0.04684829597783 0.0126453162482133;
+0.0517933843295758 0.000994402916697767 0.0502163267101945 -0.000617857816805838;
+0.0545945492994313 -0.00508952591774551 0.0535113821352818 -0.0133511906387377;
+0.0574648132450368 -0.010664863920575 0.0567180312711955 -0.025;
+0.0603830104989427 -0.0153846830350134 0.0598357485152685 -0.0321971332115325;
+0.0633364556860429 -0.019064272688818 0.0628767481706817 -0.0376877096357273;
+0.0663194020623665 -0.0215905289580297 0.0658635574895613 -0.0413883394988349;
+0.0693312897515251 -0.0228901361569406 0.0688263734848104 -0.0432421819156271;
+0.0723748395800337 -0.0229284373899602 0.0718002418989463 -0.043227769711003;
+0.0754540497352945 -0.0217086979797921 0.0748220922141882 -0.0413500906613705;
+0.0785721554313972 -0.0192719944707123 0.0779276609641274 -0.0376408344161071;
+0.0817296164519888 -0.0156977799585082 0.0811483372937821 -0.032160819300839;
+0.084922204031545 -0.0111050568322278 0.0845079700457218 -0.025;
+0.0881392671133468 -0.00569138676109579 0.0880196848546058 -0.0127328166181506;
+0.0913623492481963 0.000155159928638427 0.0916750791262509 0.000515540403748675;
+0.0945677965756227 0.00598405216493306 0.0951352723626965 0.0132846657213632;
+0.0977394996378598 0.0113645171804175 0.0984075512588495 0.025;
+0.100870915349534 0.015934136120091 0.101512232449028 0.032202786630527;
+0.103963401841475 0.0194976885624786 0.104480248442179 0.0377049583576172;
+0.107024383941366 0.0219340926218968 0.107350591497034 0.0414178929560449;
+0.110065394452494 0.0231636413954363 0.110167639712122 0.0432811014671085;
+0.113100036047426 0.0231467030650646 0.112978383945503 0.0432708436340788;
+0.116141909868971 0.0218828162728006 0.115829571284587 0.0413910190915137;
+0.119202560084989 0.0194104149112504 0.118764781034503 0.0376732379369191;
+0.122289488855956 0.0158072338090499 0.12182145289411 0.0321790883147453;
+0.125404303537493 0.0111913263907549 0.125027894376928 0.025;
+0.12854106745105 0.0057596743775446 0.128400305761037 0.0127362095791397;
+0.131685017810691 -0.000100745033426882 0.131932182172289 -0.000511130697750335;
+0.134815284639619 -0.00594033883523601 0.135285563777805 -0.0132815237691848;
+0.137917747880542 -0.011328932303162 0.138467868649103 -0.025;
+0.140987174497773 -0.0159045354776445 0.141498927738919 -0.032196833913018;
+0.144025664718938 -0.01947256766941 0.144408725314305 -0.037694592408242;
+0.147040922478466 -0.0219125049971526 0.147234978445979 -0.0414048149445242;
+0.150044393298104 -0.0231450334517533 0.150020579536349 -0.0432670288209182;
+0.153049313168705 -0.0231307724392646 0.152810920892718 -0.0432573897427071;
+0.156068713844811 -0.0218693922882502 0.155651117982365 -0.0413795946551979;
+0.15911343359038 -0.0193993598870758 0.15858314863638 -0.0376649711909592;
+0.162190188005524 -0.0157983640531308 0.161642929427371 -0.0321747615007186;
+0.165299763220467 -0.0111843519243028 0.164857357985843 -0.0250000000000001;
+0.168435403469738 -0.00575420196200566 0.168241361309993 -0.0127361781866089;
+0.171581557462111 0.000105057893563307 0.17178731143575 0.000511188514011399;
+0.174716618297176 0.00594376029270123 0.175156281142594 0.0132815744797138;
+0.177825795090649 0.0113316749611174 0.178354875847549 0.025;
+0.180903259065577 0.0159067683506043 0.181402262589646 0.0321971264994501;
+0.183950594186495 0.0194744135516382 0.184327900752472 0.0376951129609987;
+0.186975068274337 0.0219140481420258 0.187169109267111 0.0414054833176453;
+0.189987768642624 0.0231463298209944 0.189968495255367 0.0432677586486934;
+0.19300164654323 0.0231318585788949 0.192771263936237 0.0432580962336947;
+0.196029516470183 0.0218702928973049 0.195622427095894 0.0413802010695139;
+0.199082059907865 0.019400094146156 0.198563927910291 0.0376654141533357;
+0.202165888614038 0.0157989507751585 0.201631703739901 0.0321749953005017;
+0.205281730101071 0.0111848135796645 0.20485271594291 0.0249999999999999;
+0.208422807627925 0.00575451779671749 0.208241986945474 0.0127406928608726;
+0.211573498643048 -0.000105129474330137 0.211799699836048 -0.000504320258155305;
+0.214711839977611 -0.00594461955536059 0.21517753706106 -0.0132758330831443;
+0.217822744241695 -0.011333688928988 0.21837684868295 -0.025;
+0.220900465816713 -0.0159101773991773 0.221414937330223 -0.0321920359987038;
+0.223947181839007 -0.0194797249925422 0.224322047737315 -0.0376875657412446;
+0.226971258576489 -0.0219220519323227 0.227138232585709 -0.0413973224031074;
+0.229985290834294 -0.0231579811635314 0.229910143268415 -0.0432649099617992;
+0.233003992633502 -0.0231480443950942 0.232687778184264 -0.0432630071152619;
+0.236042010836121 -0.0218917348674339 0.235521210054326 -0.0413917212171439;
+0.239111729923194 -0.0194274599558208 0.238457307748621 -0.037679422063025;
+0.24222113592983 -0.0158331460594659 0.241536467329621 -0.0321853015046174;
+0.245371810637203 -0.0112274111314246 0.244789371483664 -0.0249999999999999;
+0.24855713343175 -0.00580793314916193 0.248233806159844 -0.0127556920548915;
+0.2517607775573 3.84192835424166e-05 0.251871577915464 0.000479968227357977;
+0.254959070438739 0.00586179999194262 0.255354697415111 0.0132562971130578;
+0.25813408328146 0.0112306226882365 0.258683409848511 0.0249999999999999;
+0.261275989115033 0.0157810520223427 0.261872351762752 0.0321472933691341;
+0.26438155599882 0.0193191040091313 0.26494741711259 0.0376100587738772;
+0.267452348062183 0.0217245575168949 0.267942502033761 0.0413010509729829;
+0.270492725513208 0.0229170855927758 0.270896177875287 0.0431648432843846;
+0.273507726746569 0.0228547314181165 0.273848329261379 0.0431737176352254;
+0.276500910543856 0.0215330365319327 0.276836786124329 0.0413253411150956;
+0.279472234256616 0.0189849121880065 0.27989397587294 0.0376422765813703;
+0.282416044835653 0.0152812722911025 0.283043624154928 0.0321737333605666;
+0.285319263537536 0.0105323529272503 0.286297539959566 0.0250000000000001;
+0.288159851893714 0.0049253067834761 0.289652532914866 0.0128281425238138;
+0.290905655734792 -0.0011683403614892 0.293087527283479 -0.000371619956365976;
+0.293517206225438 -0.0073163834107867 0.296230060447638 -0.0131659827811184;
+0.295961350786886 -0.0131063419758272 0.299054769535804 -0.025;
+0.298214258196773 -0.0182024710706626 0.30155016814289 -0.0316168800077591;
+0.30026066607525 -0.0224698904506242 0.303716316797239 -0.0367506490929864;
+0.302092940087297 -0.0258538617492828 0.305562574530411 -0.0404215790315037;
+0.303710026501727 -0.0283357872791263 0.307105494319336 -0.0426808904178733;
+0.305116364182295 -0.0299288770445973 0.308366905936013 -0.0436049194059021;
+0.306320807909975 -0.0306742227086331 0.309372213362378 -0.0432906411678731;
+0.307335602287311 -0.0306373135985478 0.3101489203112 -0.0418525082798963;
+0.308175434418433 -0.0299049754692032 0.31072538637413 -0.0394205079698202;
+0.308856584091807 -0.0285826631470259 0.311129807683079 -0.0361392935141715;
+0.309396182267173 -0.0267919933095052 0.311389409478039 -0.0321682009487914;
+0.309811582196045 -0.0246640247659706 0.311529833363658 -0.0280955435839461;
+0.310119842372229 -0.022319656476188 0.311574699044214 -0.0240637997324933;
+0.310337316582983 -0.0198639102376381 0.311545318693087 -0.0201851848830331;
+0.310479343471178 -0.0173854509326542 0.31146054159138 -0.0165442258125808;
+0.310560026079164 -0.0149568158066508 0.311336707032018 -0.0132007314459877;
+0.310592090683462 -0.0126351822225225 0.311187684522341 -0.0101929704870122;
+0.310586813709364 -0.0104635238435728 0.311024981845584 -0.00754090104447751;
+0.310554005508984 -0.00847202602994363 0.310857903399378 -0.00524933003784555;
+0.310502040179297 -0.0066796516586138 0.310693743281846 -0.00331090960246743;
+0.310437921284988 -0.00509576802984322 0.310537999730449 -0.0017089037450516;];
+plot (CoM_ZMP(:,1), CoM_ZMP(:,2), 'b');
+plot (CoM_ZMP(:,3), CoM_ZMP(:,4), 'ks','MarkerSize',5);
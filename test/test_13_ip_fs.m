@@ -0,0 +1,397 @@
+%
+% Footsteps generated using the c++ version of the WMG
+%
+
+cla;
+clear FS;
+
+FS(1).a = 0.000000;
+FS(1).p = [0.000000;-0.050000];
+FS(1).d = [0.090000;-0.025000;0.030000;0.075000];
+FS(1).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(1).v = [0.090000 -0.075000; 0.090000 -0.025000; -0.030000 -0.025000; -0.030000 -0.075000; 0.090000 -0.075000];
+FS(1).type = 2;
+
+FS(2).a = 0.000000;
+FS(2).p = [0.000000;0.000000];
+FS(2).d = [0.090000;0.075000;0.030000;0.075000];
+FS(2).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(2).v = [0.090000 -0.075000; 0.090000 0.075000; -0.030000 0.075000; -0.030000 -0.075000; 0.090000 -0.075000];
+FS(2).type = 1;
+
+FS(3).a = 0.000000;
+FS(3).p = [0.000000;0.050000];
+FS(3).d = [0.090000;0.075000;0.030000;-0.025000];
+FS(3).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(3).v = [0.090000 0.025000; 0.090000 0.075000; -0.030000 0.075000; -0.030000 0.025000; 0.090000 0.025000];
+FS(3).type = 2;
+
+FS(4).a = 0.000000;
+FS(4).p = [0.010000;0.025000];
+FS(4).d = [0.080000;0.050000;0.015000;0.000000];
+FS(4).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(4).v = [0.080000 0.000000; 0.080000 0.050000; -0.015000 0.050000; -0.015000 -0.000000; 0.080000 0.000000];
+FS(4).type = 1;
+
+FS(5).a = 0.000000;
+FS(5).p = [0.020000;0.000000];
+FS(5).d = [0.090000;0.025000;0.005000;0.025000];
+FS(5).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(5).v = [0.090000 -0.025000; 0.090000 0.025000; -0.005000 0.025000; -0.005000 -0.025000; 0.090000 -0.025000];
+FS(5).type = 1;
+
+FS(6).a = 0.000000;
+FS(6).p = [0.030000;-0.025000];
+FS(6).d = [0.100000;0.000000;-0.005000;0.050000];
+FS(6).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(6).v = [0.100000 -0.050000; 0.100000 0.000000; 0.005000 0.000000; 0.005000 -0.050000; 0.100000 -0.050000];
+FS(6).type = 1;
+
+FS(7).a = 0.000000;
+FS(7).p = [0.040000;-0.050000];
+FS(7).d = [0.130000;-0.025000;-0.010000;0.075000];
+FS(7).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(7).v = [0.130000 -0.075000; 0.130000 -0.025000; 0.010000 -0.025000; 0.010000 -0.075000; 0.130000 -0.075000];
+FS(7).type = 2;
+
+FS(8).a = 0.000000;
+FS(8).p = [0.050000;-0.025000];
+FS(8).d = [0.120000;0.000000;-0.025000;0.050000];
+FS(8).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(8).v = [0.120000 -0.050000; 0.120000 0.000000; 0.025000 0.000000; 0.025000 -0.050000; 0.120000 -0.050000];
+FS(8).type = 1;
+
+FS(9).a = 0.000000;
+FS(9).p = [0.060000;0.000000];
+FS(9).d = [0.130000;0.025000;-0.035000;0.025000];
+FS(9).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(9).v = [0.130000 -0.025000; 0.130000 0.025000; 0.035000 0.025000; 0.035000 -0.025000; 0.130000 -0.025000];
+FS(9).type = 1;
+
+FS(10).a = 0.000000;
+FS(10).p = [0.070000;0.025000];
+FS(10).d = [0.140000;0.050000;-0.045000;0.000000];
+FS(10).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(10).v = [0.140000 0.000000; 0.140000 0.050000; 0.045000 0.050000; 0.045000 0.000000; 0.140000 0.000000];
+FS(10).type = 1;
+
+FS(11).a = 0.000000;
+FS(11).p = [0.080000;0.050000];
+FS(11).d = [0.170000;0.075000;-0.050000;-0.025000];
+FS(11).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(11).v = [0.170000 0.025000; 0.170000 0.075000; 0.050000 0.075000; 0.050000 0.025000; 0.170000 0.025000];
+FS(11).type = 2;
+
+FS(12).a = 0.000000;
+FS(12).p = [0.090000;0.025000];
+FS(12).d = [0.160000;0.050000;-0.065000;0.000000];
+FS(12).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(12).v = [0.160000 0.000000; 0.160000 0.050000; 0.065000 0.050000; 0.065000 0.000000; 0.160000 0.000000];
+FS(12).type = 1;
+
+FS(13).a = 0.000000;
+FS(13).p = [0.100000;0.000000];
+FS(13).d = [0.170000;0.025000;-0.075000;0.025000];
+FS(13).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(13).v = [0.170000 -0.025000; 0.170000 0.025000; 0.075000 0.025000; 0.075000 -0.025000; 0.170000 -0.025000];
+FS(13).type = 1;
+
+FS(14).a = 0.000000;
+FS(14).p = [0.110000;-0.025000];
+FS(14).d = [0.180000;0.000000;-0.085000;0.050000];
+FS(14).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(14).v = [0.180000 -0.050000; 0.180000 0.000000; 0.085000 0.000000; 0.085000 -0.050000; 0.180000 -0.050000];
+FS(14).type = 1;
+
+FS(15).a = 0.000000;
+FS(15).p = [0.120000;-0.050000];
+FS(15).d = [0.210000;-0.025000;-0.090000;0.075000];
+FS(15).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(15).v = [0.210000 -0.075000; 0.210000 -0.025000; 0.090000 -0.025000; 0.090000 -0.075000; 0.210000 -0.075000];
+FS(15).type = 2;
+
+FS(16).a = 0.000000;
+FS(16).p = [0.130000;-0.025000];
+FS(16).d = [0.200000;0.000000;-0.105000;0.050000];
+FS(16).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(16).v = [0.200000 -0.050000; 0.200000 0.000000; 0.105000 0.000000; 0.105000 -0.050000; 0.200000 -0.050000];
+FS(16).type = 1;
+
+FS(17).a = 0.000000;
+FS(17).p = [0.140000;0.000000];
+FS(17).d = [0.210000;0.025000;-0.115000;0.025000];
+FS(17).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(17).v = [0.210000 -0.025000; 0.210000 0.025000; 0.115000 0.025000; 0.115000 -0.025000; 0.210000 -0.025000];
+FS(17).type = 1;
+
+FS(18).a = 0.000000;
+FS(18).p = [0.150000;0.025000];
+FS(18).d = [0.220000;0.050000;-0.125000;0.000000];
+FS(18).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(18).v = [0.220000 0.000000; 0.220000 0.050000; 0.125000 0.050000; 0.125000 0.000000; 0.220000 0.000000];
+FS(18).type = 1;
+
+FS(19).a = 0.000000;
+FS(19).p = [0.160000;0.050000];
+FS(19).d = [0.250000;0.075000;-0.130000;-0.025000];
+FS(19).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(19).v = [0.250000 0.025000; 0.250000 0.075000; 0.130000 0.075000; 0.130000 0.025000; 0.250000 0.025000];
+FS(19).type = 2;
+
+FS(20).a = 0.000000;
+FS(20).p = [0.170000;0.025000];
+FS(20).d = [0.240000;0.050000;-0.145000;0.000000];
+FS(20).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(20).v = [0.240000 0.000000; 0.240000 0.050000; 0.145000 0.050000; 0.145000 0.000000; 0.240000 0.000000];
+FS(20).type = 1;
+
+FS(21).a = 0.000000;
+FS(21).p = [0.180000;0.000000];
+FS(21).d = [0.250000;0.025000;-0.155000;0.025000];
+FS(21).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(21).v = [0.250000 -0.025000; 0.250000 0.025000; 0.155000 0.025000; 0.155000 -0.025000; 0.250000 -0.025000];
+FS(21).type = 1;
+
+FS(22).a = 0.000000;
+FS(22).p = [0.190000;-0.025000];
+FS(22).d = [0.260000;0.000000;-0.165000;0.050000];
+FS(22).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(22).v = [0.260000 -0.050000; 0.260000 0.000000; 0.165000 0.000000; 0.165000 -0.050000; 0.260000 -0.050000];
+FS(22).type = 1;
+
+FS(23).a = 0.000000;
+FS(23).p = [0.200000;-0.050000];
+FS(23).d = [0.290000;-0.025000;-0.170000;0.075000];
+FS(23).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(23).v = [0.290000 -0.075000; 0.290000 -0.025000; 0.170000 -0.025000; 0.170000 -0.075000; 0.290000 -0.075000];
+FS(23).type = 2;
+
+FS(24).a = 0.000000;
+FS(24).p = [0.210000;-0.025000];
+FS(24).d = [0.280000;0.000000;-0.185000;0.050000];
+FS(24).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(24).v = [0.280000 -0.050000; 0.280000 0.000000; 0.185000 0.000000; 0.185000 -0.050000; 0.280000 -0.050000];
+FS(24).type = 1;
+
+FS(25).a = 0.000000;
+FS(25).p = [0.220000;0.000000];
+FS(25).d = [0.290000;0.025000;-0.195000;0.025000];
+FS(25).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(25).v = [0.290000 -0.025000; 0.290000 0.025000; 0.195000 0.025000; 0.195000 -0.025000; 0.290000 -0.025000];
+FS(25).type = 1;
+
+FS(26).a = 0.000000;
+FS(26).p = [0.230000;0.025000];
+FS(26).d = [0.300000;0.050000;-0.205000;0.000000];
+FS(26).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(26).v = [0.300000 0.000000; 0.300000 0.050000; 0.205000 0.050000; 0.205000 0.000000; 0.300000 0.000000];
+FS(26).type = 1;
+
+FS(27).a = 0.000000;
+FS(27).p = [0.240000;0.050000];
+FS(27).d = [0.330000;0.075000;-0.210000;-0.025000];
+FS(27).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(27).v = [0.330000 0.025000; 0.330000 0.075000; 0.210000 0.075000; 0.210000 0.025000; 0.330000 0.025000];
+FS(27).type = 2;
+
+FS(28).a = 0.000000;
+FS(28).p = [0.250000;0.025000];
+FS(28).d = [0.320000;0.050000;-0.225000;0.000000];
+FS(28).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(28).v = [0.320000 0.000000; 0.320000 0.050000; 0.225000 0.050000; 0.225000 0.000000; 0.320000 0.000000];
+FS(28).type = 1;
+
+FS(29).a = 0.000000;
+FS(29).p = [0.260000;0.000000];
+FS(29).d = [0.330000;0.025000;-0.235000;0.025000];
+FS(29).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(29).v = [0.330000 -0.025000; 0.330000 0.025000; 0.235000 0.025000; 0.235000 -0.025000; 0.330000 -0.025000];
+FS(29).type = 1;
+
+FS(30).a = 0.000000;
+FS(30).p = [0.270000;-0.025000];
+FS(30).d = [0.340000;0.000000;-0.245000;0.050000];
+FS(30).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(30).v = [0.340000 -0.050000; 0.340000 0.000000; 0.245000 0.000000; 0.245000 -0.050000; 0.340000 -0.050000];
+FS(30).type = 1;
+
+FS(31).a = 0.000000;
+FS(31).p = [0.280000;-0.050000];
+FS(31).d = [0.370000;-0.025000;-0.250000;0.075000];
+FS(31).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(31).v = [0.370000 -0.075000; 0.370000 -0.025000; 0.250000 -0.025000; 0.250000 -0.075000; 0.370000 -0.075000];
+FS(31).type = 2;
+
+FS(32).a = 0.000000;
+FS(32).p = [0.280000;0.000000];
+FS(32).d = [0.370000;0.075000;-0.250000;0.075000];
+FS(32).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(32).v = [0.370000 -0.075000; 0.370000 0.075000; 0.250000 0.075000; 0.250000 -0.075000; 0.370000 -0.075000];
+FS(32).type = 1;
+
+FS(33).a = 0.000000;
+FS(33).p = [0.280000;0.050000];
+FS(33).d = [0.370000;0.075000;-0.250000;-0.025000];
+FS(33).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(33).v = [0.370000 0.025000; 0.370000 0.075000; 0.250000 0.075000; 0.250000 0.025000; 0.370000 0.025000];
+FS(33).type = 2;
+
+hold on
+for i=1:length(FS)
+    if FS(i).type == 1;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','r','MarkerSize',2)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'c');
+    end
+    if FS(i).type == 2;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','g','MarkerSize',4)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'r');
+    end
+end
+grid on; %axis equal
+
+
+CoM_ZMP = [
+2.35041758832578e-05 -1.04917471877119e-06 -0.00224072243260371 0.000100020921951784;
+0.000179381661400262 -8.28258849642387e-06 -0.00351562347015625 0.000183183023567663;
+0.000557460999190801 -2.70839303501748e-05 -0.00380365202639167 0.000220356173892499;
+0.00120186527520015 -6.11085548651169e-05 -0.00331454472675977 0.000224169159817151;
+0.00212363147177606 -0.000112745244463731 -0.00216870782377406 0.000195325996172237;
+0.00330979348791099 -0.000182825780657785 -0.000474468879834811 7.63617138037887e-05;
+0.0047297821104324 -0.000268307339796347 0.00163396384605949 -0.000129502568283297;
+0.00634159182664569 -0.00036173825518348 0.00403043522141464 -0.000410359889142273;
+0.00809704240183215 -0.000451383253802152 0.00660013924967471 -0.000760410024177825;
+0.00994594958293626 -0.000521176313577458 0.00924176814983689 -0.00114884345119147;
+0.0118393303390099 -0.000551484858052487 0.0118686885021199 -0.00153544941790636;
+0.0137317818793713 -0.000520480795886081 0.0144080447524376 -0.00186337975408873;
+0.0155831526278474 -0.000405418306934172 0.0168061768866736 -0.0021474542290178;
+0.0173594992709776 -0.000181834844618926 0.0190184328324157 -0.00232493781486062;
+0.0190336990381145 0.000175277881773538 0.0210150505390748 -0.00237354237885312;
+0.0205857384653482 0.000691083357975532 0.0227694649474853 -0.00225787353141874;
+0.0220028604252231 0.00139015394533703 0.0242836007780271 -0.00191966722306775;
+0.0232788876409271 0.00229478208288879 0.0255642728338939 -0.00131894177868623;
+0.0244134058678803 0.00342351297065525 0.0266231032306993 -0.000400249685854866;
+0.0254110204929657 0.00478923946646311 0.0274751738292073 0.000867527640139448;
+0.0262807022661877 0.0063978095843926 0.0281385407171856 0.00251457677862926;
+0.027035218869815 0.00824659993012606 0.0286339123776088 0.00456011952851479;
+0.027689475914757 0.0103282207108 0.0290951625936558 0.0065281322261439;
+0.0282582129302102 0.0126372152017774 0.0292751695225444 0.00962046903192581;
+0.0287634983379671 0.015133433068567 0.02940246590885 0.0129647259323544;
+0.0292296754470664 0.0177612974971121 0.0294242663927705 0.0167709704193068;
+0.0296838429041579 0.0204486754307507 0.0294234367701597 0.0208455793061847;
+0.0301542857220149 0.0231089838330575 0.0294334657785934 0.0251193832464784;
+0.030669706247038 0.0256415133564697 0.029480556891122 0.0295123283137301;
+0.0312591023565346 0.0279304499912254 0.0296102333650642 0.0339028125765048;
+0.0319509632522373 0.0298450481720307 0.0298648533356092 0.0381459108412207;
+0.0327723869466494 0.0312457393776907 0.030284528858433 0.0415761016070689;
+0.0337470758804554 0.0320087594639264 0.0310201253427487 0.0438151886262127;
+0.0348926474313835 0.0320354202933449 0.0318266808751494 0.0454150016710908;
+0.03622830901753 0.0312334124265388 0.0329071917187843 0.04573675872149;
+0.0377698197436718 0.0295333787122186 0.0342902003634477 0.0446498921832239;
+0.0395269095298528 0.0268969620610525 0.0359991373070834 0.0421320935189365;
+0.0415024278812957 0.0233169052372264 0.0380512678629621 0.038163508515486;
+0.0436914574103571 0.0188207804631211 0.0404557078803058 0.0324467649188492;
+0.0460804414327036 0.0134844352567128 0.0432123931535927 0.0250748079467827;
+0.0486463630436296 0.00747121433623576 0.0463093856268832 0.01268917416479;
+0.0513557316529091 0.00113743498946349 0.0497530169250562 -0.000444437818494962;
+0.0541665374610583 -0.00509838408933296 0.0531426290744467 -0.0134256543927211;
+0.0570407507661308 -0.0108084776856517 0.0566308677399383 -0.0265622108475252;
+0.0599460514848569 -0.0155945719536683 0.0596147496786856 -0.0332639510844351;
+0.0628729240079425 -0.0192853551008767 0.0625299386851238 -0.0383686580254334;
+0.0658218293132632 -0.0217924776339255 0.0654025894777821 -0.0418154068374853;
+0.0687972212784555 -0.0230585115693434 0.0682656278320614 -0.0434412189773744;
+0.0718057819807926 -0.0230602051630834 0.0711561532712649 -0.0433040825963042;
+0.0748545366157162 -0.0218060651806212 0.0741126447588263 -0.0414260024936765;
+0.0779487870439338 -0.0193347219687605 0.0771832391537882 -0.0378678744172297;
+0.0810899736976222 -0.0157174350106248 0.080372552001117 -0.0323570307478904;
+0.084274633427173 -0.0110715511436759 0.0837219784134323 -0.0250677914252249;
+0.0874922550935718 -0.00559751366417713 0.0872449761966481 -0.0127514382351646;
+0.0907236731137971 0.000315686691386209 0.0909364002363537 0.000621769411193003;
+0.0939428961041386 0.00621521477228533 0.0945140497274773 0.0134618990247857;
+0.09712610586397 0.0116561177023784 0.0980980250181101 0.0265440121855311;
+0.100254397946603 0.016227934481216 0.101085949618563 0.0331513059757156;
+0.103331691198744 0.0197510005066525 0.103946433200144 0.0381988750565086;
+0.106371189849728 0.0221300782781186 0.106721535633788 0.0416189730858519;
+0.109389045260232 0.0233012804378595 0.109457877352989 0.0432560488583315;
+0.112402465003634 0.0232348650146073 0.112204091748593 0.0431502505889209;
+0.115427763192907 0.0219332103977346 0.115008138376076 0.0413111364846418;
+0.118478294666013 0.019429541034244 0.117924370489851 0.0377960788830342;
+0.121562366978187 0.0157903844538263 0.120966600492992 0.0323311414725902;
+0.124682155629539 0.0111290129656847 0.12417848539071 0.0250724257303391;
+0.127831691975084 0.00564312244115293 0.127576456247186 0.0127570663529331;
+0.130995373106113 -0.000279396100588229 0.131157377327791 -0.000616919096575946;
+0.134149910917395 -0.00618625616649006 0.134637932732916 -0.0134585352905166;
+0.13727353728365 -0.0116328161895451 0.138137236521281 -0.0265482382021148;
+0.140348815110783 -0.0162086952371393 0.141063553798246 -0.0331499958644271;
+0.143380303639051 -0.0197346855465374 0.143876002035049 -0.0381929414780479;
+0.146381360516835 -0.0221160222551506 0.146615398943887 -0.0416095572120486;
+0.149367979596011 -0.0232891584185502 0.149326963238412 -0.0432462866726766;
+0.152356977447486 -0.0232245140202559 0.152057850295632 -0.0431415203251466;
+0.155364111390535 -0.0219245220108563 0.1548545331322 -0.0413040495151901;
+0.158402075075366 -0.0194224091441235 0.157769595252586 -0.0377911425503089;
+0.1614784645012 -0.0157846639236449 0.160816297024767 -0.0323290187599785;
+0.164594708449852 -0.0111244846910613 0.164036554381695 -0.0250724176009764;
+0.167744099976061 -0.00563952707069434 0.167445679758837 -0.0127567766619053;
+0.170910335958313 0.00028226902746194 0.171039494734472 0.000617260592248115;
+0.174069484486753 0.0061885671153096 0.174534024941929 0.0134588195160476;
+0.177199194548322 0.0116347018588036 0.178047768340656 0.0265475936276195;
+0.180281515292782 0.0162102972122369 0.180987832434904 0.0331501062054393;
+0.183320582925901 0.0197360991863361 0.183813440422668 0.0381936656963535;
+0.186329406995035 0.0221172926502162 0.186565111633939 0.0416107332260217;
+0.189323699843441 0.0232902956838952 0.189287859167065 0.043247516466489;
+0.192320058485132 0.0232255142249861 0.192028712586867 0.0431426234808328;
+0.195334076869783 0.0219253795300393 0.19483408598642 0.0413049445599009;
+0.198378334130937 0.0194231223057381 0.197756643353461 0.0377917637274577;
+0.201460352423467 0.015785239381527 0.200809474828201 0.0323292836543596;
+0.204581526915997 0.0111249410581932 0.204034695775744 0.0250724151595362;
+0.207735147395971 0.00563984818285132 0.207447731831166 0.0127608007198583;
+0.210904839959222 -0.000282377832979443 0.211053062146372 -0.000603336652064465;
+0.214066955182946 -0.00618922183453774 0.214491429478538 -0.0135081339228344;
+0.217202034764616 -0.0116398140207636 0.217960338575928 -0.0259952906545844;
+0.220294362931422 -0.0162443916779135 0.220955043346478 -0.0330026492886262;
+0.223346495440816 -0.0198119840390172 0.223817636267969 -0.038319330745454;
+0.226369920884727 -0.0222334689728904 0.226590113496656 -0.041853735245948;
+0.229379483022844 -0.0234387009150821 0.229363064904077 -0.0436155290531008;
+0.232389478590752 -0.0233954475414329 0.232193204885236 -0.0433381435567397;
+0.235412000844981 -0.0221119231527984 0.235006781123884 -0.0416432779579449;
+0.238459180679474 -0.0196052299057438 0.237900995798849 -0.039368580459499;
+0.241540445986039 -0.0158791104492447 0.240894851114209 -0.034765278792891;
+0.24466084326888 -0.0110153895083322 0.244031708881671 -0.0252958737110155;
+0.247818470393419 -0.00529627376313214 0.247394142296426 -0.0116908744439629;
+0.251000359909241 0.000822927686755779 0.250989538932163 0.00214037799545721;
+0.254184246399421 0.00687133411631857 0.254459483970654 0.0148160268023841;
+0.257349214901027 0.0124233965003467 0.25808151126083 0.0271414620955886;
+0.260473927537906 0.017100989178816 0.261147470774187 0.0345242814683494;
+0.263557259152676 0.0207015555031475 0.264117145825995 0.0400434478240469;
+0.266605991866363 0.0231048977848757 0.267025916182115 0.04364616133305;
+0.269628171627835 0.0242357795122745 0.269946511937955 0.0453087133178453;
+0.272630329768088 0.0240637154807556 0.272865786067712 0.044747326758505;
+0.275617471099058 0.0226032863592331 0.275803919145394 0.0429079186102054;
+0.278591891776326 0.0198875018801909 0.278836061403532 0.0389174478310724;
+0.281549701992824 0.0159937750797161 0.281986710141344 0.0330440190391924;
+0.284479714739678 0.0110429567106779 0.285165324801605 0.025644785269674;
+0.28736366421956 0.00522631215537053 0.288621626267547 0.0131763455922226;
+0.29016733047946 -0.00108013542271327 0.292183791727818 -0.000297927103108394;
+0.292847016321163 -0.00744054175316022 0.29546660884109 -0.0133214026162237;
+0.295365154433142 -0.0134417362077313 0.298432692647971 -0.0253044411304955;
+0.297693921967922 -0.0187476992773608 0.3010468031359 -0.0323897097165128;
+0.299815231206673 -0.0232116768067178 0.303321238200456 -0.0378918819798934;
+0.301719359370925 -0.0267680232687251 0.305264144050703 -0.0418399713359252;
+0.303403698218065 -0.0293914645411653 0.306891506036143 -0.0442929770791812;
+0.304871605186893 -0.0310918360807596 0.308225110777585 -0.0453358692712382;
+0.306131262553876 -0.0319094042093513 0.309290731078314 -0.045074816706465;
+0.307194586870203 -0.0319107566613981 0.310116549343776 -0.0436335383129564;
+0.308076219228147 -0.0311852317256089 0.31073182334712 -0.0411509364580708;
+0.3087926168377 -0.0298418117552869 0.311165788818973 -0.0377798633040758;
+0.309361257940168 -0.0280063667824263 0.311446786265081 -0.03368667634898;
+0.309799966307791 -0.0258146514634281 0.31160148481437 -0.0294759354718716;
+0.310126355035383 -0.0233921753112555 0.311654835070464 -0.0252966017592191;
+0.310357374156771 -0.0208482684754628 0.311629171119751 -0.0212670547803176;
+0.310508973877507 -0.0182755967465358 0.311544011225446 -0.0174670321218905;
+0.310595873637124 -0.0157505901689791 0.311416665470937 -0.0139743376679942;
+0.310631401698007 -0.0133337207560044 0.311261984356712 -0.0108301232001867;
+0.310627400035015 -0.0110705380462173 0.311092292521567 -0.00805608711193112;
+0.310594192226086 -0.0089931350902741 0.310917553847899 -0.00565782444570338;
+0.310540603940609 -0.00712178277356768 0.310745576418414 -0.00362801013874018;
+0.310474024575039 -0.00546663576138473 0.310582242124611 -0.00194934192326398;];
+plot (CoM_ZMP(:,1), CoM_ZMP(:,2), 'b');
+plot (CoM_ZMP(:,3), CoM_ZMP(:,4), 'ks','MarkerSize',5);
@@ -0,0 +1,543 @@
+%
+% Footsteps generated using the c++ version of the WMG
+%
+
+cla;
+clear FS;
+
+FS(1).a = 0.000000;
+FS(1).p = [0.000000;-0.050000];
+FS(1).d = [0.090000;-0.025000;0.030000;0.075000];
+FS(1).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(1).v = [0.090000 -0.075000; 0.090000 -0.025000; -0.030000 -0.025000; -0.030000 -0.075000; 0.090000 -0.075000];
+FS(1).type = 2;
+
+FS(2).a = 0.000000;
+FS(2).p = [0.000000;0.000000];
+FS(2).d = [0.090000;0.075000;0.030000;0.075000];
+FS(2).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(2).v = [0.090000 -0.075000; 0.090000 0.075000; -0.030000 0.075000; -0.030000 -0.075000; 0.090000 -0.075000];
+FS(2).type = 1;
+
+FS(3).a = 0.000000;
+FS(3).p = [0.000000;0.050000];
+FS(3).d = [0.090000;0.075000;0.030000;-0.025000];
+FS(3).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(3).v = [0.090000 0.025000; 0.090000 0.075000; -0.030000 0.075000; -0.030000 0.025000; 0.090000 0.025000];
+FS(3).type = 2;
+
+FS(4).a = 0.000000;
+FS(4).p = [0.010000;0.025000];
+FS(4).d = [0.080000;0.050000;0.015000;0.000000];
+FS(4).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(4).v = [0.080000 0.000000; 0.080000 0.050000; -0.015000 0.050000; -0.015000 -0.000000; 0.080000 0.000000];
+FS(4).type = 1;
+
+FS(5).a = 0.000000;
+FS(5).p = [0.020000;0.000000];
+FS(5).d = [0.090000;0.025000;0.005000;0.025000];
+FS(5).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(5).v = [0.090000 -0.025000; 0.090000 0.025000; -0.005000 0.025000; -0.005000 -0.025000; 0.090000 -0.025000];
+FS(5).type = 1;
+
+FS(6).a = 0.000000;
+FS(6).p = [0.030000;-0.025000];
+FS(6).d = [0.100000;0.000000;-0.005000;0.050000];
+FS(6).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(6).v = [0.100000 -0.050000; 0.100000 0.000000; 0.005000 0.000000; 0.005000 -0.050000; 0.100000 -0.050000];
+FS(6).type = 1;
+
+FS(7).a = 0.000000;
+FS(7).p = [0.040000;-0.050000];
+FS(7).d = [0.130000;-0.025000;-0.010000;0.075000];
+FS(7).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(7).v = [0.130000 -0.075000; 0.130000 -0.025000; 0.010000 -0.025000; 0.010000 -0.075000; 0.130000 -0.075000];
+FS(7).type = 2;
+
+FS(8).a = 0.000000;
+FS(8).p = [0.050000;-0.025000];
+FS(8).d = [0.120000;0.000000;-0.025000;0.050000];
+FS(8).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(8).v = [0.120000 -0.050000; 0.120000 0.000000; 0.025000 0.000000; 0.025000 -0.050000; 0.120000 -0.050000];
+FS(8).type = 1;
+
+FS(9).a = 0.000000;
+FS(9).p = [0.060000;0.000000];
+FS(9).d = [0.130000;0.025000;-0.035000;0.025000];
+FS(9).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(9).v = [0.130000 -0.025000; 0.130000 0.025000; 0.035000 0.025000; 0.035000 -0.025000; 0.130000 -0.025000];
+FS(9).type = 1;
+
+FS(10).a = 0.000000;
+FS(10).p = [0.070000;0.025000];
+FS(10).d = [0.140000;0.050000;-0.045000;0.000000];
+FS(10).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(10).v = [0.140000 0.000000; 0.140000 0.050000; 0.045000 0.050000; 0.045000 0.000000; 0.140000 0.000000];
+FS(10).type = 1;
+
+FS(11).a = 0.000000;
+FS(11).p = [0.080000;0.050000];
+FS(11).d = [0.170000;0.075000;-0.050000;-0.025000];
+FS(11).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(11).v = [0.170000 0.025000; 0.170000 0.075000; 0.050000 0.075000; 0.050000 0.025000; 0.170000 0.025000];
+FS(11).type = 2;
+
+FS(12).a = 0.000000;
+FS(12).p = [0.090000;0.025000];
+FS(12).d = [0.160000;0.050000;-0.065000;0.000000];
+FS(12).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(12).v = [0.160000 0.000000; 0.160000 0.050000; 0.065000 0.050000; 0.065000 0.000000; 0.160000 0.000000];
+FS(12).type = 1;
+
+FS(13).a = 0.000000;
+FS(13).p = [0.100000;0.000000];
+FS(13).d = [0.170000;0.025000;-0.075000;0.025000];
+FS(13).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(13).v = [0.170000 -0.025000; 0.170000 0.025000; 0.075000 0.025000; 0.075000 -0.025000; 0.170000 -0.025000];
+FS(13).type = 1;
+
+FS(14).a = 0.000000;
+FS(14).p = [0.110000;-0.025000];
+FS(14).d = [0.180000;0.000000;-0.085000;0.050000];
+FS(14).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(14).v = [0.180000 -0.050000; 0.180000 0.000000; 0.085000 0.000000; 0.085000 -0.050000; 0.180000 -0.050000];
+FS(14).type = 1;
+
+FS(15).a = 0.000000;
+FS(15).p = [0.120000;-0.050000];
+FS(15).d = [0.210000;-0.025000;-0.090000;0.075000];
+FS(15).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(15).v = [0.210000 -0.075000; 0.210000 -0.025000; 0.090000 -0.025000; 0.090000 -0.075000; 0.210000 -0.075000];
+FS(15).type = 2;
+
+FS(16).a = 0.000000;
+FS(16).p = [0.130000;-0.025000];
+FS(16).d = [0.200000;0.000000;-0.105000;0.050000];
+FS(16).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(16).v = [0.200000 -0.050000; 0.200000 0.000000; 0.105000 0.000000; 0.105000 -0.050000; 0.200000 -0.050000];
+FS(16).type = 1;
+
+FS(17).a = 0.000000;
+FS(17).p = [0.140000;0.000000];
+FS(17).d = [0.210000;0.025000;-0.115000;0.025000];
+FS(17).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(17).v = [0.210000 -0.025000; 0.210000 0.025000; 0.115000 0.025000; 0.115000 -0.025000; 0.210000 -0.025000];
+FS(17).type = 1;
+
+FS(18).a = 0.000000;
+FS(18).p = [0.150000;0.025000];
+FS(18).d = [0.220000;0.050000;-0.125000;0.000000];
+FS(18).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(18).v = [0.220000 0.000000; 0.220000 0.050000; 0.125000 0.050000; 0.125000 0.000000; 0.220000 0.000000];
+FS(18).type = 1;
+
+FS(19).a = 0.000000;
+FS(19).p = [0.160000;0.050000];
+FS(19).d = [0.250000;0.075000;-0.130000;-0.025000];
+FS(19).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(19).v = [0.250000 0.025000; 0.250000 0.075000; 0.130000 0.075000; 0.130000 0.025000; 0.250000 0.025000];
+FS(19).type = 2;
+
+FS(20).a = 0.000000;
+FS(20).p = [0.170000;0.025000];
+FS(20).d = [0.240000;0.050000;-0.145000;0.000000];
+FS(20).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(20).v = [0.240000 0.000000; 0.240000 0.050000; 0.145000 0.050000; 0.145000 0.000000; 0.240000 0.000000];
+FS(20).type = 1;
+
+FS(21).a = 0.000000;
+FS(21).p = [0.180000;0.000000];
+FS(21).d = [0.250000;0.025000;-0.155000;0.025000];
+FS(21).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(21).v = [0.250000 -0.025000; 0.250000 0.025000; 0.155000 0.025000; 0.155000 -0.025000; 0.250000 -0.025000];
+FS(21).type = 1;
+
+FS(22).a = 0.000000;
+FS(22).p = [0.190000;-0.025000];
+FS(22).d = [0.260000;0.000000;-0.165000;0.050000];
+FS(22).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(22).v = [0.260000 -0.050000; 0.260000 0.000000; 0.165000 0.000000; 0.165000 -0.050000; 0.260000 -0.050000];
+FS(22).type = 1;
+
+FS(23).a = 0.000000;
+FS(23).p = [0.200000;-0.050000];
+FS(23).d = [0.290000;-0.025000;-0.170000;0.075000];
+FS(23).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(23).v = [0.290000 -0.075000; 0.290000 -0.025000; 0.170000 -0.025000; 0.170000 -0.075000; 0.290000 -0.075000];
+FS(23).type = 2;
+
+FS(24).a = 0.000000;
+FS(24).p = [0.210000;-0.025000];
+FS(24).d = [0.280000;0.000000;-0.185000;0.050000];
+FS(24).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(24).v = [0.280000 -0.050000; 0.280000 0.000000; 0.185000 0.000000; 0.185000 -0.050000; 0.280000 -0.050000];
+FS(24).type = 1;
+
+FS(25).a = 0.000000;
+FS(25).p = [0.220000;0.000000];
+FS(25).d = [0.290000;0.025000;-0.195000;0.025000];
+FS(25).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(25).v = [0.290000 -0.025000; 0.290000 0.025000; 0.195000 0.025000; 0.195000 -0.025000; 0.290000 -0.025000];
+FS(25).type = 1;
+
+FS(26).a = 0.000000;
+FS(26).p = [0.230000;0.025000];
+FS(26).d = [0.300000;0.050000;-0.205000;0.000000];
+FS(26).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(26).v = [0.300000 0.000000; 0.300000 0.050000; 0.205000 0.050000; 0.205000 0.000000; 0.300000 0.000000];
+FS(26).type = 1;
+
+FS(27).a = 0.000000;
+FS(27).p = [0.240000;0.050000];
+FS(27).d = [0.330000;0.075000;-0.210000;-0.025000];
+FS(27).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(27).v = [0.330000 0.025000; 0.330000 0.075000; 0.210000 0.075000; 0.210000 0.025000; 0.330000 0.025000];
+FS(27).type = 2;
+
+FS(28).a = 0.000000;
+FS(28).p = [0.250000;0.025000];
+FS(28).d = [0.320000;0.050000;-0.225000;0.000000];
+FS(28).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(28).v = [0.320000 0.000000; 0.320000 0.050000; 0.225000 0.050000; 0.225000 0.000000; 0.320000 0.000000];
+FS(28).type = 1;
+
+FS(29).a = 0.000000;
+FS(29).p = [0.260000;0.000000];
+FS(29).d = [0.330000;0.025000;-0.235000;0.025000];
+FS(29).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(29).v = [0.330000 -0.025000; 0.330000 0.025000; 0.235000 0.025000; 0.235000 -0.025000; 0.330000 -0.025000];
+FS(29).type = 1;
+
+FS(30).a = 0.000000;
+FS(30).p = [0.270000;-0.025000];
+FS(30).d = [0.340000;0.000000;-0.245000;0.050000];
+FS(30).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(30).v = [0.340000 -0.050000; 0.340000 0.000000; 0.245000 0.000000; 0.245000 -0.050000; 0.340000 -0.050000];
+FS(30).type = 1;
+
+FS(31).a = 0.000000;
+FS(31).p = [0.280000;-0.050000];
+FS(31).d = [0.370000;-0.025000;-0.250000;0.075000];
+FS(31).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(31).v = [0.370000 -0.075000; 0.370000 -0.025000; 0.250000 -0.025000; 0.250000 -0.075000; 0.370000 -0.075000];
+FS(31).type = 2;
+
+FS(32).a = 0.000000;
+FS(32).p = [0.280000;0.000000];
+FS(32).d = [0.370000;0.075000;-0.250000;0.075000];
+FS(32).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(32).v = [0.370000 -0.075000; 0.370000 0.075000; 0.250000 0.075000; 0.250000 -0.075000; 0.370000 -0.075000];
+FS(32).type = 1;
+
+FS(33).a = 0.000000;
+FS(33).p = [0.280000;0.050000];
+FS(33).d = [0.370000;0.075000;-0.250000;-0.025000];
+FS(33).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(33).v = [0.370000 0.025000; 0.370000 0.075000; 0.250000 0.075000; 0.250000 0.025000; 0.370000 0.025000];
+FS(33).type = 2;
+
+hold on
+for i=1:length(FS)
+    if FS(i).type == 1;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','r','MarkerSize',2)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'c');
+    end
+    if FS(i).type == 2;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','g','MarkerSize',4)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'r');
+    end
+end
+grid on; %axis equal
+
+
+CoM_ZMP = [
+0.0199794454036977 -6.49793546052249e-05 0.0197457828996487 -3.63565303426003e-05 18.0628024021877;
+0.0199836176597654 -6.5495140863015e-05 0.0195442272209993 -9.86041262727555e-06 18.6181641833558;
+0.0199945614140843 -6.68739091008197e-05 0.0193765120348027 1.44987569750592e-05 18.2982760558724;
+0.0200150610176437 -6.95135170971047e-05 0.0192444763464993 3.52027494821678e-05 18.8878324305932;
+0.0200474944255662 -7.37810762429429e-05 0.0191494081225709 5.32825449003775e-05 19.7151528642252;
+0.0200938498449081 -8.00172835397657e-05 0.0190921859458209 6.55947092614308e-05 20.4420930680747;
+0.0201557480988891 -8.85210516986052e-05 0.0190713414831181 7.57306743866693e-05 57.1557526175807;
+0.0202344740736297 -9.95681955009627e-05 0.0190895084352981 7.78564327646087e-05 58.2614396312856;
+0.020330977105423 -0.000113376060447175 0.0191451808024508 7.64673600825692e-05 72.9390970115926;
+0.020445892508264 -0.000130123908059234 0.0192391712050165 6.5946606949046e-05 74.5246825505222;
+0.0205795510823924 -0.000149923540640195 0.0193698925840306 5.19007871327766e-05 80.7170667623034;
+0.0207320005005928 -0.000172846196962941 0.0195366459476247 2.71863502027188e-05 82.8669240518838;
+0.0209030218786178 -0.00019884340357253 0.0197377318013951 -1.60759105257782e-05 80.7702421353728;
+0.0210921507900962 -0.000227668156142114 0.0199712571149062 -6.92272889676992e-05 82.9372672775947;
+0.0212986989218786 -0.000258914969880312 0.0202353841114343 -0.0001421487314087 80.6373260298876;
+0.0215217745863567 -0.000291963841801674 0.0205273435094533 -0.000223079331723014 82.8163391152925;
+0.021760307598922 -0.000326033228269011 0.0208451388890838 -0.000325100795858827 82.6028238802097;
+0.0220130692401439 -0.000360104551715814 0.0211854320032236 -0.000431972411753492 84.7877365108597;
+0.0222786986514836 -0.000392979892896765 0.021546055232665 -0.000567290889386383 90.4076299448028;
+0.0225557222565804 -0.000423135452397502 0.0219233879300774 -0.000702041988585885 92.576624175112;
+0.0228425801708624 -0.000448872250875003 0.0223150887933735 -0.000861624267010607 102.137934372888;
+0.0231376451222621 -0.000468184633050417 0.0227175125382126 -0.00101380195662747 104.306052745836;
+0.0234392475982407 -0.000478931304750834 0.0231281531707138 -0.00118435066786922 112.197472101902;
+0.023745694316581 -0.000478705209787653 0.0235435639612915 -0.00133956641000007 114.373363645799;
+0.0240552910767402 -0.000465009325303468 0.0239610956271422 -0.00150648346029245 119.839400859601;
+0.0243663608236308 -0.000435117483716065 0.0243776843425018 -0.00164917711733015 122.02319841252;
+0.0246772634208654 -0.000386260336921124 0.0247905728733697 -0.00179648294045252 125.451769886625;
+0.024986413321256 -0.000315475794650585 0.025197221830413 -0.00190984860877628 127.639403672249;
+0.0252922957357825 -0.000219808455007194 0.0255948184697788 -0.00202022780135034 129.589508151293;
+0.0255934838648175 -9.61492152445238e-05 0.0259814419181516 -0.00208626839815426 131.775312986135;
+0.0258886512022413 5.85762067484112e-05 0.026354298749414 -0.00215131576586726 139.948076049421;
+0.0261765881792957 0.000247653800537986 0.0267121277438169 -0.00215964346385209 142.134850181915;
+0.0264562153400528 0.00047428274618156 0.0270504460418954 -0.00215636638702404 181.005856453647;
+0.0267266112959703 0.000741799155971419 0.0273712257408962 -0.00208354738053606 183.198267584046;
+0.0269869984110932 0.00105336126667508 0.0276710346117854 -0.00198681285792679 198.775781340358;
+0.0272367574787279 0.00141217073564166 0.0279513229456423 -0.00180769603823023 200.967577902961;
+0.0274754182288627 0.00182115530519799 0.028209654867422 -0.00159326551236059 204.512972951772;
+0.0277026709431159 0.00228319702715535 0.0284470379713677 -0.00128386119368313 206.705778070403;
+0.0279183611026843 0.00280079572198646 0.0286620764099641 -0.000924419174795506 204.874965142626;
+0.0281224974393183 0.00337627332789251 0.0288553246195829 -0.000458394097711306 207.068194285235;
+0.0283152505428104 0.00401146345428822 0.0290265482796474 6.62147952802883e-05 205.262868173661;
+0.0284969564700079 0.0047079393822265 0.0291757667161547 0.000708232958267228 207.467710437487;
+0.0286681195256541 0.0054666834100201 0.0293040845214417 0.00141687849743819 208.109291469619;
+0.028829410284382 0.00628832040894073 0.0294108500389752 0.0022525844430642 210.338472846309;
+0.0289816730490736 0.00717275983612017 0.0294987222660432 0.00316573561822383 219.022748309758;
+0.0291259169656505 0.00811940491447617 0.0295661975554654 0.00421342194785951 221.285015932182;
+0.029263328893429 0.00912682350075643 0.0296177398876267 0.00533981412394161 233.147420525724;
+0.0293952561396454 0.0101929979895878 0.0296507538151892 0.00660650051956435 235.457434947972;
+0.0295232257616522 0.0113149602699227 0.0296718225430611 0.00795114917272261 244.814214022908;
+0.0296489171606024 0.0124890616905806 0.0296769041602234 0.00943993453534767 247.180107107768;
+0.0297741893941968 0.0137105710363011 0.0296751623561677 0.0110031094536877 253.486244271949;
+0.0299010411676129 0.0149739675166588 0.0296605153925902 0.0127124958372321 255.908571215694;
+0.0300316489183694 0.0162724970075516 0.0296454815296674 0.0144879789674772 259.642258848072;
+0.0301683102019207 0.0175985010992746 0.0296208868172377 0.0164112074241801 262.117614261717;
+0.0303134976171883 0.0189429115099537 0.0296039688282397 0.0183840641619168 263.822390500617;
+0.0304697786272492 0.0202956490651155 0.0295806022706902 0.0205096185085122 266.362167895912;
+0.0306398944860053 0.0216449922820547 0.0295751214889839 0.0226559083472879 275.023031430221;
+0.0308266444331416 0.022978106471187 0.0295652694899692 0.0249740333230404 277.721641945783;
+0.0410324051277599 -0.00563834240145493 0.0398172322707814 -0.0340679219116864 4561.30570422609;
+0.0412571190235371 -0.00379165354515246 0.0400759141933827 -0.070530964178266 20258.0522959189;
+0.0415022029336304 -0.00124650084855226 0.0395929807429635 0.0249999999998892 2802529.3115868;
+0.0417769935701795 0.00113746810417013 0.0391481406593268 0.0249999999998463 2682966.35257683;
+0.0420927728991139 0.00314890683158873 0.0387231599411867 0.0249999999999599 4154141.39256643;
+0.0424610080341038 0.00481921700491703 0.038355422388865 0.0249999999999271 4070089.03927747;
+0.0428931860946472 0.00617447468475821 0.0380458987565171 0.0249999999999673 6164128.13136182;
+0.0434008503492801 0.00723583748108772 0.0378083539792933 0.0249999999998818 6128003.53143435;
+0.0439924914077686 0.00801987485175105 0.0388508308744047 0.0249999999999857 949.261557810028;
+0.0446642259232234 0.00853882682183665 0.0399608081426497 0.0250000000000017 950.047907581095;
+0.0454093389047924 0.00880079501571693 0.0410896138238919 0.0249999999999797 937.048126143943;
+0.0462217470944284 0.00880986915258582 0.0422730812549655 0.025000000000007 940.495442779693;
+0.0470957608871676 0.00856619089183476 0.0434715511244069 0.0249999999999882 940.049217503458;
+0.0480262387264681 0.00806595604829703 0.0447143506857897 0.0249999999999994 944.924758182574;
+0.0490083807242983 0.00730135519646903 0.0459722992174038 0.0250000000000023 947.128040288655;
+0.0500378258284425 0.00626045176645175 0.0472666485977442 0.0249999999999975 952.663262225998;
+0.051110485625408 0.00492699568361473 0.0485792804927862 0.0249999999999962 951.767685953147;
+0.0522225810053357 0.00328016968425713 0.0499227944337624 0.0249999999999908 957.375821475812;
+0.053370519676628 0.00129426432263278 0.0512893109606377 0.0249999999999923 952.689865184468;
+0.0545508761025219 -0.00106172337971738 0.0526839056748724 0.0249999999999965 957.822937366301;
+0.0557603076930948 -0.00382457395043657 0.0541058124481686 0.024999999999999 949.546396536895;
+0.0569954945215975 -0.0070374196601572 0.0555561336280508 0.0249999999999961 1064.58272856251;
+0.0582530768642208 -0.0107135241399541 0.0570353118170875 0.0108205608281896 1044.71604712249;
+0.0595294270164877 -0.0147345477411941 0.0586080141526001 5.48172618408671e-16 952.050322199726;
+0.0608200824926756 -0.0189776408163756 0.0602112027141747 -0.0138794854971784 864.458397299468;
+0.0621202673335951 -0.0233075024138584 0.0618052320054491 -0.025 806.469122197818;
+0.0634255181009526 -0.0276053686035009 0.0633424766183858 -0.0382623818353559 759.969001337736;
+0.0647321089866839 -0.0317408517750215 0.0648629200161206 -0.0499916426531718 651.692759728245;
+0.0660368185536502 -0.0355961180510843 0.0663215478732543 -0.0599124233388084 573.651975636592;
+0.0673371369626637 -0.0390779061029911 0.0677594614699397 -0.0674749318863296 515.14670911057;
+0.0686310265417131 -0.0421234337125482 0.0691342318419804 -0.0723240487827334 478.50737331463;
+0.0699171168636123 -0.0447039641111296 0.0704872729882891 -0.0746826922886285 482.915627404575;
+0.0711944629663776 -0.046821792668912 0.0717800589012527 -0.0750000000000001 478.482234182842;
+0.0724627196478469 -0.0485005424560178 0.0730526228921763 -0.0750000000000002 479.955144333156;
+0.0737219059290481 -0.0497655956831236 0.0742718107178149 -0.0750000000000003 468.023095515039;
+0.074972550732882 -0.0506367017422549 0.0754743312177148 -0.0750000000000001 471.190464706386;
+0.0762154734656413 -0.0511274599146589 0.076634006317335 -0.0750000000000001 464.673310232212;
+0.0774518925906767 -0.0512455316767744 0.0777820275980216 -0.0749999999999998 470.141639923254;
+0.078683233495359 -0.0509927603071985 0.0789009604254781 -0.0750000000000001 472.934090645605;
+0.0799111906730831 -0.0503651996628739 0.0800140055596612 -0.0750000000000002 479.557589461427;
+0.0811375755289726 -0.0493530525743309 0.0811144546618013 -0.0750000000000002 485.593773080248;
+0.0823643217693131 -0.0479421349929087 0.0822147374289875 -0.0743784984149415 488.192698748919;
+0.0835933874677272 -0.0461207581754375 0.0833210847315891 -0.0728913550931593 490.411926733177;
+0.0848266919728169 -0.0438844789415068 0.0844321402334708 -0.0702408246222769 495.561340810648;
+0.0860660879261178 -0.041238908569983 0.0855693688898264 -0.066755821449819 497.852197984282;
+0.0873132173120055 -0.0381985683980533 0.0867147076645478 -0.0618919306558104 509.091354044818;
+0.0885695688897825 -0.0347898481239395 0.0879067226756211 -0.0564480556530316 507.225817263128;
+0.0898362121638998 -0.0310465123486199 0.0891203887481724 -0.0496583147857374 528.602960377156;
+0.0911138938627348 -0.0270134481178109 0.0903865776268716 -0.0425496193556888 514.02817826693;
+0.0924026754275161 -0.0227419803055937 0.0917506324143474 -0.0338499750855697 563.688172300214;
+0.0937014886954882 -0.0182974910646531 0.0931714426933698 -0.025 535.482024181168;
+0.0950085658381715 -0.0137579438583449 0.0945964591069375 -0.0124687706643913 608.762535119061;
+0.0963221531315506 -0.00923836008051108 0.0959920579450917 0 513.995729576525;
+0.0976408911738321 -0.00486328121442019 0.0973886312829067 0.0125764436356203 581.384994135727;
+0.0989636498549904 -0.000760064995801026 0.0987535045724501 0.0249999999999991 465.958193675435;
+0.100289690359068 0.00296451936021586 0.100117940633135 0.0283834332972874 334.990657921201;
+0.101618493609211 0.00629343112779687 0.101451063869254 0.0313229427755099 337.779808994574;
+0.102949910790298 0.00923257427327421 0.102784148749655 0.0338858601654769 338.510268667495;
+0.104283989467277 0.011787979515161 0.104088908355188 0.0360117430618227 336.150572176594;
+0.105621108474385 0.013966157335921 0.105395659069197 0.0377755400640138 337.318032408316;
+0.106961806463931 0.0157737500952654 0.106679589436843 0.0391106659869753 335.321797329684;
+0.108306896306128 0.0172179227917778 0.107968893313242 0.0400981850198726 336.682098858938;
+0.109657301858483 0.0183059915022111 0.109243218671046 0.0406662181603398 337.30922834976;
+0.111014146573007 0.0190458486072448 0.110527268338546 0.0409016859354101 338.704220490278;
+0.112378605375203 0.0194455656286258 0.111806251360467 0.0407287817964732 347.309342870254;
+0.113751961606954 0.0195138359385089 0.113099793315734 0.0402420933037753 348.633537381834;
+0.115135482104388 0.01925948975727 0.11439989444991 0.0393776387646721 360.511242068392;
+0.116530435926129 0.0186918125453092 0.115719331350928 0.0382273705276926 361.716611044763;
+0.11793800180204 0.0178199810244353 0.117058182167825 0.0367599287251275 371.090617879887;
+0.119359241683883 0.0166531768815481 0.118420595418738 0.0350201607580721 372.250547944772;
+0.120795049970704 0.0152002904553429 0.119815784889645 0.0330290096570087 378.50216444292;
+0.12224607580652 0.0134702176934567 0.121237976785052 0.0305970678395171 380.0050346668;
+0.123712721278325 0.0114733975544658 0.122705639927636 0.0279235258718499 383.240596929324;
+0.125194993911231 0.00922041650211776 0.12420977615185 0.0249999999999999 403.911656288935;
+0.126692521933142 0.00672677913777081 0.125762087751825 0.0198908477682924 404.257685394243;
+0.128204292940163 0.00402968488672263 0.127422972273941 0.0139922360926011 427.055223215018;
+0.129728132316586 0.00117707975435339 0.12913352260604 0.00808609480848212 413.202704131901;
+0.131261226117074 -0.00178219290836071 0.130854961703411 0.00172158760340319 414.064554993112;
+0.132800763303775 -0.00479693626324961 0.132537589033581 -0.00434645147686854 422.83617662092;
+0.134344413669979 -0.00780742560986474 0.134218436284896 -0.0147523499409658 524.869007288367;
+0.135890125872466 -0.0107099059467825 0.135862718588401 -0.025 434.125797614369;
+0.137436280854242 -0.0134063612719023 0.137501270432302 -0.0286890502413546 333.451749640443;
+0.138981521615588 -0.0158650414702313 0.139101248796213 -0.0320665101663582 334.498814363308;
+0.140524912886775 -0.018071394199799 0.140693681966086 -0.03521262924948 335.415418319437;
+0.142065767127912 -0.0200111235015675 0.142248561996791 -0.0379832011111753 331.117242066277;
+0.143603786876537 -0.021670981001888 0.143796058435734 -0.040484941731783 332.88829672883;
+0.145138892298808 -0.0230382841545452 0.145309993825083 -0.0425408582532772 328.860249670539;
+0.146671340909402 -0.0241019249656411 0.14681841728256 -0.0442884258119103 331.261612999509;
+0.148201563095959 -0.0248517896184987 0.148300068068369 -0.0455111453395116 329.866067317337;
+0.149730253488603 -0.0252800466887284 0.149779406138144 -0.0463817530404247 332.752149108641;
+0.151258221982684 -0.0253804619055176 0.151241276887386 -0.0466421736796349 339.545608560463;
+0.152786450542502 -0.0251499968220836 0.152704866674904 -0.0465001464625045 342.80948367768;
+0.154315968423016 -0.0245879558034216 0.154162432718317 -0.0456923988435362 353.508538339266;
+0.155847867584422 -0.0236976266191363 0.155626011008478 -0.0444295760030801 357.024235758505;
+0.1573832119142 -0.0224852411779928 0.157096640977496 -0.0425515191374797 365.810392778805;
+0.158923003987853 -0.0209609404600437 0.158577287138401 -0.0401547556305252 369.642912613397;
+0.16046813849752 -0.0191381356399187 0.160078966323832 -0.0373197212704226 374.912541422521;
+0.162019313723177 -0.0170338353683927 0.16159403927534 -0.033582827870582 381.374683554549;
+0.163577037637928 -0.0146719974802963 0.163143889419113 -0.0295318763024657 380.879453171302;
+0.165141463638843 -0.0120794257648303 0.164716804008008 -0.0249999999999999 393.495654532938;
+0.166712418381085 -0.00928674041020745 0.166328473447949 -0.0198547142654089 387.504736607282;
+0.168289118142942 -0.00633103620132733 0.168035818732254 -0.0139549158062226 409.068117592886;
+0.169869664078833 -0.00325633067208637 0.169784753474514 -0.00804783184137329 398.091114542727;
+0.171451538812179 -0.000107921041017057 0.171532452719791 -0.00171857130214619 398.984696778337;
+0.173032268788242 0.00306633453469463 0.173234635151233 0.00434117225344306 410.634962391133;
+0.174609866390423 0.00620938403326794 0.174926490310484 0.0147453774198525 516.336562253278;
+0.176182637725872 0.00921956298309013 0.17657348975 0.0249999999999995 429.017636964939;
+0.177749341457323 0.0120009051183655 0.178207350236771 0.0285212663049044 330.487236045044;
+0.17930901362193 0.0145251700504601 0.179795612819397 0.0317233108257576 332.172144994858;
+0.180861125088131 0.016781581880196 0.181370097077111 0.0346809768100976 333.154529100914;
+0.182405403343195 0.0187595189800901 0.182901301570764 0.0372689685780267 329.547415969699;
+0.183941972246744 0.0204492045273235 0.184420065676539 0.0395845020807268 331.275338556354;
+0.18547117624852 0.0218412661536962 0.185900835190688 0.0414745887626808 327.971332747699;
+0.18699369715485 0.0229276093201259 0.187372177182352 0.0430620671065673 330.210810329354;
+0.188510387330287 0.0237008951650091 0.188813574333146 0.0441606839661769 329.536091275675;
+0.190022357726559 0.0241556489220539 0.190249810709499 0.0449225800597402 332.128981872858;
+0.191530827778803 0.0242876520193992 0.19166662272339 0.0451262326996088 339.565708745787;
+0.193037178329471 0.0240953134609423 0.193083256935618 0.0449532150354986 342.396946244191;
+0.194542827246444 0.0235789176380354 0.194493079654421 0.0441783010620189 353.540597703584;
+0.196049240041919 0.0227420245125417 0.195907805121642 0.0429843931178002 356.499375951517;
+0.197557841585728 0.0215905649197769 0.197329934515458 0.0412341714706257 365.538393118146;
+0.199069976443149 0.0201336706211074 0.198761541534669 0.0390105821247905 368.683218886971;
+0.20058686781786 0.0183831362994253 0.200215677132471 0.0363807236167637 374.304487445173;
+0.202109519819366 0.0163538418148103 0.201682964752986 0.0329017375919502 379.421216427776;
+0.203638733501605 0.014067049450925 0.203187720176619 0.0291000014423272 379.889914667703;
+0.205174926457574 0.0115463460610943 0.204716198684831 0.025 393.775708242088;
+0.206718172377753 0.00881824242541044 0.206286365369012 0.019888585623191 390.184532384958;
+0.208267906834886 0.0059193116137544 0.207953622990985 0.014009428795532 412.060087208151;
+0.20982243157751 0.00289410883952168 0.209665524610734 0.00811990008914057 409.379946486166;
+0.211379403818216 -0.000211545207510086 0.211378216677339 0.001795606716203 410.492191179815;
+0.212936500325587 -0.00334922497424864 0.213050271957352 -0.00426309556218699 388.815337083971;
+0.214491843490205 -0.00646123439964753 0.214713562830547 -0.0147045029147448 496.09060148646;
+0.216043833128995 -0.00944493359862618 0.216335404294158 -0.0249999999999999 391.907160478408;
+0.217591302027155 -0.0122034306523053 0.217945283169568 -0.0285174455133291 291.539339471347;
+0.219133356925626 -0.0147080653911491 0.219512047459748 -0.0317181633618763 287.812198989116;
+0.220669533066094 -0.0169477728650754 0.221066062215032 -0.034678267113796 288.766358987722;
+0.222199626392383 -0.0189116362921965 0.22257872102563 -0.0372710455869572 284.737910776816;
+0.223723830935001 -0.0205895828301291 0.224080058889899 -0.0395943221831761 286.441885853244;
+0.225242568696679 -0.0219719419535934 0.22554508680727 -0.041492806989884 282.875032229176;
+0.22675660449457 -0.023050332803371 0.2270021202866 -0.0430907766518419 285.099543278083;
+0.228266880880215 -0.0238171366478811 0.228430920705466 -0.0441988791452987 282.301920271236;
+0.229774604730702 -0.0242666239583167 0.229856502615696 -0.0449713627223937 284.891740937195;
+0.231281095509514 -0.0243943310632339 0.231264605877555 -0.0451857806854117 282.968301112222;
+0.232787837394169 -0.0241984333814406 0.232675138969603 -0.0450231124657049 285.81261540238;
+0.23429635033825 -0.0236790033276751 0.234081188143864 -0.0442561500028095 284.760818434628;
+0.235808200741739 -0.0228394301928075 0.235495518688863 -0.0430674754791361 287.754862258262;
+0.237324906025629 -0.0216855258233455 0.236920056606741 -0.0413180197613414 287.226132823463;
+0.238847896037363 -0.0202263746520456 0.238358270246052 -0.0390896545275893 290.434018599882;
+0.240378462583909 -0.0184738063297365 0.239822335339467 -0.03645115309765 289.408642027768;
+0.241917663846825 -0.0164428253563164 0.241304567777104 -0.0329514075831385 294.667996053923;
+0.243466329020721 -0.0141549679394561 0.242828094650006 -0.0291259556915383 290.632404721394;
+0.245024880800722 -0.011634172676436 0.244381290585135 -0.0249999999999999 304.313745346262;
+0.246593360946566 -0.0089072588782173 0.245980241055789 -0.0198969889156332 297.603825984271;
+0.248171142396133 -0.00601078056877061 0.247683124028773 -0.0140246320866122 319.638301851415;
+0.24975641574534 -0.00298921908553892 0.249434741899595 -0.00814260805029794 297.614786477848;
+0.251346688949605 0.000111653506819561 0.251194799529485 -0.00182203191844564 298.850603212397;
+0.252939429107424 0.00324340245207611 0.252918064969397 0.00423389238228849 267.916172283149;
+0.25453250645169 0.00634824190986356 0.254639923761754 0.0146890489571529 376.195433742696;
+0.256124003349678 0.00932324398182217 0.256324694464008 0.0249999999999999 268.167811237815;
+0.257712378929184 0.0120712471271535 0.258004940443601 0.0284933219800518 167.081944908774;
+0.259296289275445 0.0145636957956098 0.259645948486748 0.0316719080284142 162.808824186924;
+0.260874755261891 0.0167896913571368 0.261281441893145 0.0346076240263555 163.747999659668;
+0.262446972048746 0.0187384675491448 0.262878581665801 0.0371799644773158 159.952961672069;
+0.264012462789708 0.0204000502170782 0.264471097089985 0.0394809286362406 161.637984061636;
+0.265570883646588 0.0217648404095411 0.266028988017802 0.0413634098851575 158.109734634431;
+0.267122158560657 0.0228244547407088 0.267584665812424 0.0429432636768161 160.308894959086;
+0.268666286851187 0.023571232924642 0.269111974815624 0.0440431447548658 156.96738599679;
+0.270203454009689 0.0239992963443844 0.270640540463994 0.0448037752285607 159.52350083582;
+0.271733849700177 0.0241039771242833 0.272149077906191 0.0450237658383826 156.430000233396;
+0.273257749392363 0.0238830677602551 0.27366286486062 0.0448596716359829 159.236566527052;
+0.274775351116494 0.0233361661780697 0.275166468430722 0.0441251315657423 156.507943006401;
+0.276286822885445 0.0224658465176705 0.276679304850542 0.0429566527083091 159.494140593181;
+0.277792166424097 0.0212769744590281 0.278192523288166 0.0412731546826215 156.985664702292;
+0.279291226400425 0.0197772479854235 0.279718573386096 0.0390838134846835 160.296385079378;
+0.280783587442662 0.0179771553555638 0.281255154996569 0.0364953460785035 157.354540572544;
+0.282268544689265 0.0158902994827156 0.282807845417592 0.0330099689052634 162.747566352267;
+0.283745034534752 0.0135371040102564 0.284379023016435 0.0291693540687493 157.22573906117;
+0.285211565947099 0.0109407208544625 0.285973612302054 0.025 168.160563768583;
+0.286666155141018 0.00812650080678254 0.287585697813279 0.0201966167560136 159.932709005131;
+0.288106147653801 0.00512563085473931 0.289290496089624 0.0147080323170444 181.192500261604;
+0.289527612596816 0.00197559338788959 0.291009938067394 0.00905485921055788 162.886299458276;
+0.290925958364124 -0.00128359981580122 0.292720861737657 0.00287811247709441 165.987964544044;
+0.292296483309921 -0.00460803717713108 0.294354791693626 -0.00319350319715545 137.32798546685;
+0.293634997267798 -0.00794182171924329 0.295941712090704 -0.0141599039028088 265.292073541233;
+0.294937651879019 -0.0111788612403081 0.297470230952068 -0.0249999999999991 149.772507728848;
+0.296200916955265 -0.0142192033351996 0.29894192641979 -0.0285103402442924 39.1315932654396;
+0.297421564866357 -0.0170371810819703 0.300346697078665 -0.0317355501458378 36.3841744378961;
+0.298596715303837 -0.019626522449461 0.30168680058782 -0.0346427778422434 35.7232127487432;
+0.29972381451799 -0.0219822120960426 0.302954005751656 -0.0372522606548724 33.8691244112727;
+0.300800669189587 -0.0241003757151765 0.304150639209255 -0.0395302588053209 33.9192634913692;
+0.301825424355501 -0.0259784453380467 0.305270949570644 -0.0415047171961411 32.6318148888854;
+0.302796583823467 -0.0276150095475155 0.30631663993417 -0.0431397557140265 33.1342304137802;
+0.303712990976732 -0.0290099964513166 0.307285049532201 -0.0444721589950065 32.1688584606127;
+0.304573833130413 -0.0301644857319554 0.308176504341242 -0.0454624724493655 32.9521793055354;
+0.30537862963732 -0.0310809180263859 0.308992056433509 -0.0461577366304732 32.1323654160233;
+0.306127217529343 -0.0317628633684679 0.309729806121549 -0.0465128826629835 33.1004898353155;
+0.306819751742038 -0.0322152682879953 0.310395235969477 -0.0465875976834354 32.297360869248;
+0.30745666892603 -0.0324441704223205 0.310983153443505 -0.0463275650288836 33.4161183486192;
+0.308038705632003 -0.0324570022094451 0.311504476949439 -0.045809871127157 32.5208019022412;
+0.30856683575155 -0.0322622297573548 0.311949188174383 -0.0449638755511876 33.8095368292317;
+0.309042314797041 -0.0318697489801624 0.312335267152203 -0.0438936025228882 32.6947774793351;
+0.309466583323021 -0.0312904030462719 0.312645463360263 -0.0424984310714156 34.2321804916447;
+0.309841349828758 -0.0305365398243241 0.312907580100076 -0.0409276356632148 32.6957617948516;
+0.310168399174137 -0.0296211808683815 0.313111537548023 -0.0390782120519646 35.4521362025471;
+0.310449644670965 -0.0285588526263178 0.313260540509259 -0.0369715722493412 37.3445440784981;
+0.310687142122003 -0.0273655224520043 0.313357933813057 -0.0347368237058069 33.488466596937;
+0.310883069774564 -0.0260573872646947 0.313407172623386 -0.0323974854116531 29.9307421823688;
+0.311039708460824 -0.0246504862890303 0.313411793646162 -0.0299763918668165 26.6857237226112;
+0.311159422063926 -0.0231605952870949 0.313375387390745 -0.0274955713932132 23.7605202470766;
+0.311244638437539 -0.0216031292285118 0.313301571625701 -0.0249761377296204 21.1554671864486;
+0.311297830895147 -0.0199930535717365 0.313193966151332 -0.0224381948635524 18.8647393129694;
+0.311321500373581 -0.0183448042573058 0.313056168994241 -0.019900754963036 16.8770718410554;
+0.311318158363802 -0.0166722164461638 0.312891734112225 -0.0173816691861937 15.1765563168653;
+0.311290310690335 -0.0149884619710778 0.312704150681301 -0.0148975710684192 13.7434798552123;
+0.31124044220927 -0.0133059954098276 0.312496824020661 -0.0124638321156464 12.5551788553907;
+0.311171002483725 -0.0116365086324868 0.312273058195965 -0.0100945291681257 11.5868813846093;
+0.311084392484588 -0.00999089362389903 0.312036040326658 -0.00780242304190067 10.8125158301135;
+0.310982952353934 -0.00837921333619835 0.311788826609014 -0.00559894790512905 10.2054670401665;
+0.310868950258226 -0.00681068028315782 0.311534330053406 -0.00349421080325232 9.73926488156064;
+0.310744572348833 -0.00529364255171988 0.31127530992194 -0.00149700071062503 9.38819382623609;
+0.310611913838005 -0.00383557687246444 0.311014362841117 0.000385193543312226 9.1278157324884;
+0.310472971189917 -0.00244308836261898 0.310753915553559 0.00214615714849268 8.93540133976153;
+0.310329635418075 -0.00112191653198453 0.31049621926319 0.00378091568138851 8.79026906738886;
+0.310183686472912 0.000123052878212419 0.310243345519517 0.00528569466789946 8.67403245332487;
+0.310036788696351 0.00128777066783841 0.309997183578817 0.0066578730502176 8.57075995077811;
+0.309890487313758 0.00236900201743391 0.3097594391732 0.00789593126588099 8.46705279502714;
+0.309746205927922 0.00336429985780941 0.309531634612538 0.00899939464196854 8.35204824932476;
+0.309605244965702 0.0042719742899337 0.309315113544615 0.00996875190315322 8.21668486019149;];
+plot (CoM_ZMP(:,1), CoM_ZMP(:,2), 'b');
+plot (CoM_ZMP(:,3), CoM_ZMP(:,4), 'ks','MarkerSize',5);
+hold off; figure;
+plot (CoM_ZMP(:,5));
@@ -0,0 +1,543 @@
+%
+% Footsteps generated using the c++ version of the WMG
+%
+
+cla;
+clear FS;
+
+FS(1).a = 0.000000;
+FS(1).p = [0.000000;-0.050000];
+FS(1).d = [0.090000;-0.025000;0.030000;0.075000];
+FS(1).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(1).v = [0.090000 -0.075000; 0.090000 -0.025000; -0.030000 -0.025000; -0.030000 -0.075000; 0.090000 -0.075000];
+FS(1).type = 2;
+
+FS(2).a = 0.000000;
+FS(2).p = [0.000000;0.000000];
+FS(2).d = [0.090000;0.075000;0.030000;0.075000];
+FS(2).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(2).v = [0.090000 -0.075000; 0.090000 0.075000; -0.030000 0.075000; -0.030000 -0.075000; 0.090000 -0.075000];
+FS(2).type = 1;
+
+FS(3).a = 0.000000;
+FS(3).p = [0.000000;0.050000];
+FS(3).d = [0.090000;0.075000;0.030000;-0.025000];
+FS(3).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(3).v = [0.090000 0.025000; 0.090000 0.075000; -0.030000 0.075000; -0.030000 0.025000; 0.090000 0.025000];
+FS(3).type = 2;
+
+FS(4).a = 0.000000;
+FS(4).p = [0.010000;0.025000];
+FS(4).d = [0.080000;0.050000;0.015000;0.000000];
+FS(4).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(4).v = [0.080000 0.000000; 0.080000 0.050000; -0.015000 0.050000; -0.015000 -0.000000; 0.080000 0.000000];
+FS(4).type = 1;
+
+FS(5).a = 0.000000;
+FS(5).p = [0.020000;0.000000];
+FS(5).d = [0.090000;0.025000;0.005000;0.025000];
+FS(5).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(5).v = [0.090000 -0.025000; 0.090000 0.025000; -0.005000 0.025000; -0.005000 -0.025000; 0.090000 -0.025000];
+FS(5).type = 1;
+
+FS(6).a = 0.000000;
+FS(6).p = [0.030000;-0.025000];
+FS(6).d = [0.100000;0.000000;-0.005000;0.050000];
+FS(6).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(6).v = [0.100000 -0.050000; 0.100000 0.000000; 0.005000 0.000000; 0.005000 -0.050000; 0.100000 -0.050000];
+FS(6).type = 1;
+
+FS(7).a = 0.000000;
+FS(7).p = [0.040000;-0.050000];
+FS(7).d = [0.130000;-0.025000;-0.010000;0.075000];
+FS(7).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(7).v = [0.130000 -0.075000; 0.130000 -0.025000; 0.010000 -0.025000; 0.010000 -0.075000; 0.130000 -0.075000];
+FS(7).type = 2;
+
+FS(8).a = 0.000000;
+FS(8).p = [0.050000;-0.025000];
+FS(8).d = [0.120000;0.000000;-0.025000;0.050000];
+FS(8).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(8).v = [0.120000 -0.050000; 0.120000 0.000000; 0.025000 0.000000; 0.025000 -0.050000; 0.120000 -0.050000];
+FS(8).type = 1;
+
+FS(9).a = 0.000000;
+FS(9).p = [0.060000;0.000000];
+FS(9).d = [0.130000;0.025000;-0.035000;0.025000];
+FS(9).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(9).v = [0.130000 -0.025000; 0.130000 0.025000; 0.035000 0.025000; 0.035000 -0.025000; 0.130000 -0.025000];
+FS(9).type = 1;
+
+FS(10).a = 0.000000;
+FS(10).p = [0.070000;0.025000];
+FS(10).d = [0.140000;0.050000;-0.045000;0.000000];
+FS(10).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(10).v = [0.140000 0.000000; 0.140000 0.050000; 0.045000 0.050000; 0.045000 0.000000; 0.140000 0.000000];
+FS(10).type = 1;
+
+FS(11).a = 0.000000;
+FS(11).p = [0.080000;0.050000];
+FS(11).d = [0.170000;0.075000;-0.050000;-0.025000];
+FS(11).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(11).v = [0.170000 0.025000; 0.170000 0.075000; 0.050000 0.075000; 0.050000 0.025000; 0.170000 0.025000];
+FS(11).type = 2;
+
+FS(12).a = 0.000000;
+FS(12).p = [0.090000;0.025000];
+FS(12).d = [0.160000;0.050000;-0.065000;0.000000];
+FS(12).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(12).v = [0.160000 0.000000; 0.160000 0.050000; 0.065000 0.050000; 0.065000 0.000000; 0.160000 0.000000];
+FS(12).type = 1;
+
+FS(13).a = 0.000000;
+FS(13).p = [0.100000;0.000000];
+FS(13).d = [0.170000;0.025000;-0.075000;0.025000];
+FS(13).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(13).v = [0.170000 -0.025000; 0.170000 0.025000; 0.075000 0.025000; 0.075000 -0.025000; 0.170000 -0.025000];
+FS(13).type = 1;
+
+FS(14).a = 0.000000;
+FS(14).p = [0.110000;-0.025000];
+FS(14).d = [0.180000;0.000000;-0.085000;0.050000];
+FS(14).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(14).v = [0.180000 -0.050000; 0.180000 0.000000; 0.085000 0.000000; 0.085000 -0.050000; 0.180000 -0.050000];
+FS(14).type = 1;
+
+FS(15).a = 0.000000;
+FS(15).p = [0.120000;-0.050000];
+FS(15).d = [0.210000;-0.025000;-0.090000;0.075000];
+FS(15).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(15).v = [0.210000 -0.075000; 0.210000 -0.025000; 0.090000 -0.025000; 0.090000 -0.075000; 0.210000 -0.075000];
+FS(15).type = 2;
+
+FS(16).a = 0.000000;
+FS(16).p = [0.130000;-0.025000];
+FS(16).d = [0.200000;0.000000;-0.105000;0.050000];
+FS(16).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(16).v = [0.200000 -0.050000; 0.200000 0.000000; 0.105000 0.000000; 0.105000 -0.050000; 0.200000 -0.050000];
+FS(16).type = 1;
+
+FS(17).a = 0.000000;
+FS(17).p = [0.140000;0.000000];
+FS(17).d = [0.210000;0.025000;-0.115000;0.025000];
+FS(17).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(17).v = [0.210000 -0.025000; 0.210000 0.025000; 0.115000 0.025000; 0.115000 -0.025000; 0.210000 -0.025000];
+FS(17).type = 1;
+
+FS(18).a = 0.000000;
+FS(18).p = [0.150000;0.025000];
+FS(18).d = [0.220000;0.050000;-0.125000;0.000000];
+FS(18).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(18).v = [0.220000 0.000000; 0.220000 0.050000; 0.125000 0.050000; 0.125000 0.000000; 0.220000 0.000000];
+FS(18).type = 1;
+
+FS(19).a = 0.000000;
+FS(19).p = [0.160000;0.050000];
+FS(19).d = [0.250000;0.075000;-0.130000;-0.025000];
+FS(19).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(19).v = [0.250000 0.025000; 0.250000 0.075000; 0.130000 0.075000; 0.130000 0.025000; 0.250000 0.025000];
+FS(19).type = 2;
+
+FS(20).a = 0.000000;
+FS(20).p = [0.170000;0.025000];
+FS(20).d = [0.240000;0.050000;-0.145000;0.000000];
+FS(20).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(20).v = [0.240000 0.000000; 0.240000 0.050000; 0.145000 0.050000; 0.145000 0.000000; 0.240000 0.000000];
+FS(20).type = 1;
+
+FS(21).a = 0.000000;
+FS(21).p = [0.180000;0.000000];
+FS(21).d = [0.250000;0.025000;-0.155000;0.025000];
+FS(21).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(21).v = [0.250000 -0.025000; 0.250000 0.025000; 0.155000 0.025000; 0.155000 -0.025000; 0.250000 -0.025000];
+FS(21).type = 1;
+
+FS(22).a = 0.000000;
+FS(22).p = [0.190000;-0.025000];
+FS(22).d = [0.260000;0.000000;-0.165000;0.050000];
+FS(22).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(22).v = [0.260000 -0.050000; 0.260000 0.000000; 0.165000 0.000000; 0.165000 -0.050000; 0.260000 -0.050000];
+FS(22).type = 1;
+
+FS(23).a = 0.000000;
+FS(23).p = [0.200000;-0.050000];
+FS(23).d = [0.290000;-0.025000;-0.170000;0.075000];
+FS(23).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(23).v = [0.290000 -0.075000; 0.290000 -0.025000; 0.170000 -0.025000; 0.170000 -0.075000; 0.290000 -0.075000];
+FS(23).type = 2;
+
+FS(24).a = 0.000000;
+FS(24).p = [0.210000;-0.025000];
+FS(24).d = [0.280000;0.000000;-0.185000;0.050000];
+FS(24).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(24).v = [0.280000 -0.050000; 0.280000 0.000000; 0.185000 0.000000; 0.185000 -0.050000; 0.280000 -0.050000];
+FS(24).type = 1;
+
+FS(25).a = 0.000000;
+FS(25).p = [0.220000;0.000000];
+FS(25).d = [0.290000;0.025000;-0.195000;0.025000];
+FS(25).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(25).v = [0.290000 -0.025000; 0.290000 0.025000; 0.195000 0.025000; 0.195000 -0.025000; 0.290000 -0.025000];
+FS(25).type = 1;
+
+FS(26).a = 0.000000;
+FS(26).p = [0.230000;0.025000];
+FS(26).d = [0.300000;0.050000;-0.205000;0.000000];
+FS(26).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(26).v = [0.300000 0.000000; 0.300000 0.050000; 0.205000 0.050000; 0.205000 0.000000; 0.300000 0.000000];
+FS(26).type = 1;
+
+FS(27).a = 0.000000;
+FS(27).p = [0.240000;0.050000];
+FS(27).d = [0.330000;0.075000;-0.210000;-0.025000];
+FS(27).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(27).v = [0.330000 0.025000; 0.330000 0.075000; 0.210000 0.075000; 0.210000 0.025000; 0.330000 0.025000];
+FS(27).type = 2;
+
+FS(28).a = 0.000000;
+FS(28).p = [0.250000;0.025000];
+FS(28).d = [0.320000;0.050000;-0.225000;0.000000];
+FS(28).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(28).v = [0.320000 0.000000; 0.320000 0.050000; 0.225000 0.050000; 0.225000 0.000000; 0.320000 0.000000];
+FS(28).type = 1;
+
+FS(29).a = 0.000000;
+FS(29).p = [0.260000;0.000000];
+FS(29).d = [0.330000;0.025000;-0.235000;0.025000];
+FS(29).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(29).v = [0.330000 -0.025000; 0.330000 0.025000; 0.235000 0.025000; 0.235000 -0.025000; 0.330000 -0.025000];
+FS(29).type = 1;
+
+FS(30).a = 0.000000;
+FS(30).p = [0.270000;-0.025000];
+FS(30).d = [0.340000;0.000000;-0.245000;0.050000];
+FS(30).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(30).v = [0.340000 -0.050000; 0.340000 0.000000; 0.245000 0.000000; 0.245000 -0.050000; 0.340000 -0.050000];
+FS(30).type = 1;
+
+FS(31).a = 0.000000;
+FS(31).p = [0.280000;-0.050000];
+FS(31).d = [0.370000;-0.025000;-0.250000;0.075000];
+FS(31).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(31).v = [0.370000 -0.075000; 0.370000 -0.025000; 0.250000 -0.025000; 0.250000 -0.075000; 0.370000 -0.075000];
+FS(31).type = 2;
+
+FS(32).a = 0.000000;
+FS(32).p = [0.280000;0.000000];
+FS(32).d = [0.370000;0.075000;-0.250000;0.075000];
+FS(32).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(32).v = [0.370000 -0.075000; 0.370000 0.075000; 0.250000 0.075000; 0.250000 -0.075000; 0.370000 -0.075000];
+FS(32).type = 1;
+
+FS(33).a = 0.000000;
+FS(33).p = [0.280000;0.050000];
+FS(33).d = [0.370000;0.075000;-0.250000;-0.025000];
+FS(33).D = [1.000000 0.000000;-0.000000 1.000000;-1.000000 -0.000000;0.000000 -1.000000];
+FS(33).v = [0.370000 0.025000; 0.370000 0.075000; 0.250000 0.075000; 0.250000 0.025000; 0.370000 0.025000];
+FS(33).type = 2;
+
+hold on
+for i=1:length(FS)
+    if FS(i).type == 1;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','r','MarkerSize',2)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'c');
+    end
+    if FS(i).type == 2;
+        plot (FS(i).p(1),FS(i).p(2),'gs','MarkerFaceColor','g','MarkerSize',4)
+        plot (FS(i).v(:,1), FS(i).v(:,2), 'r');
+    end
+end
+grid on; %axis equal
+
+
+CoM_ZMP = [
+0.0199794474664889 -6.49823543952345e-05 0.0197449901040033 -3.52036156314183e-05 18.1072548949906;
+0.0199836337869354 -6.55171741042343e-05 0.0195427981727005 -8.32782376437501e-06 18.6504930484162;
+0.0199946137544845 -6.6940222634194e-05 0.0193746052963915 1.67864507656647e-05 18.3410172619821;
+0.0200151797430162 -6.96594082290578e-05 0.0192422504352523 3.76873825611595e-05 18.9268031388954;
+0.0200477293745371 -7.40573418024996e-05 0.0191417762703774 5.97038080430746e-05 21.1985271120525;
+0.0200943203824672 -8.05264484360155e-05 0.0190804732068148 7.51710156505466e-05 22.0878863590027;
+0.0201566299167648 -8.94097761088948e-05 0.0190611236053375 8.43153657146735e-05 57.1801929842202;
+0.020235940959945 -0.000100984895206381 0.0190805912928445 8.56499189967497e-05 58.3131247138627;
+0.0203331938370646 -0.000115465835572624 0.0191365395556172 8.39751185781587e-05 73.2715167508948;
+0.0204490275365362 -0.000133034656412895 0.0192312125380703 7.24252683199945e-05 74.886006735943;
+0.0205837819673159 -0.000153807975065 0.0193609367028225 5.97062944614016e-05 82.9044297449906;
+0.0207375307007353 -0.000177883583747833 0.0195276178600753 3.5076789078423e-05 85.0069234037902;
+0.0209100765758124 -0.000205234984322987 0.0197294366908812 -8.3239440846611e-06 82.802192573109;
+0.021100967505933 -0.000235628287089663 0.0199645067210611 -6.40911609013302e-05 84.3175745098886;
+0.0213095186079226 -0.0002686457474643 0.0202309757412779 -0.000140533905965796 81.9824645670044;
+0.0215348332455456 -0.000303642360039375 0.0205259420812577 -0.000224996563719483 84.9450624816669;
+0.0217758290859614 -0.000339802922235265 0.0208474704369551 -0.000333991140948622 84.3770879086034;
+0.0220312581817241 -0.000376038455461925 0.0211919916162211 -0.000449042654139033 86.3733747145275;
+0.0222997350226694 -0.000411064283869441 0.0215574487344779 -0.00059099701267005 92.8508748300733;
+0.0225797557820802 -0.000443279737047085 0.0219399285739562 -0.000733471581125616 94.9453642454189;
+0.02286972663988 -0.000470903065227824 0.0223372323938291 -0.000899694771667286 104.815138891164;
+0.0231679823004753 -0.000491848930690653 0.0227453884857623 -0.00105952901171632 106.865017966922;
+0.0234728131463668 -0.000503888415575336 0.0231620546383017 -0.00123628808443297 114.858796699483;
+0.0237824831157836 -0.000504531560829526 0.0235834427651295 -0.00139862491815369 116.694486673866;
+0.0240952543848897 -0.000491207107931855 0.0240071448881805 -0.00156459381166146 121.65476983484;
+0.024409402207681 -0.000461210388691557 0.0244304506332142 -0.00169792468734882 128.799515083284;
+0.0247232335764292 -0.000411848234813746 0.0248490891768661 -0.00185372220605267 128.204989822978;
+0.0250351173466508 -0.000340061976239682 0.025261118176606 -0.00197657250537198 130.006107250153;
+0.0253434968923503 -0.000242735439256733 0.0256639271251668 -0.00209630091941599 132.918275500882;
+0.0256469038751715 -0.000116584515882189 0.0260552687422487 -0.00217276488164799 135.094997798073;
+0.0259439722441381 4.16468918435055e-05 0.026432552057115 -0.0022416970743062 141.270814976867;
+0.0262334518505766 0.000235379097547503 0.0267949592876257 -0.00225465122071254 144.266910179238;
+0.0265142205380443 0.000467950919098081 0.0271362050945608 -0.00225472309333407 183.269380160342;
+0.0267853265523714 0.000742849019390231 0.0274592161708807 -0.00218608595818124 185.51662524489;
+0.0270459688373744 0.00106340016120921 0.0277604335120768 -0.00208975477764055 200.784590492482;
+0.0272955099413205 0.00143296275732365 0.0280413997378848 -0.00191115463185947 202.929082010913;
+0.0275334658416608 0.00185462863448236 0.0282995893971391 -0.00169279816000396 206.655822774295;
+0.0277595177539639 0.00233142624942285 0.0285361189201076 -0.00137876118215838 208.744375120957;
+0.0279735056274234 0.00286600442337315 0.0287496352628738 -0.00101050610902061 206.737605780242;
+0.0281754354275129 0.00346081923516234 0.0289406748892377 -0.000534043542884704 208.84656902282;
+0.0283654773894373 0.00411783390237012 0.0291091520323908 6.21303149205842e-06 207.200332032257;
+0.02854396845979 0.00483872515894122 0.0292549563115774 0.000666389989680849 209.395278926555;
+0.0287114154816318 0.00562456130918135 0.0293794125762473 0.0014001897985454 210.580605000915;
+0.0288684918544712 0.00647600570527543 0.0294816565084528 0.00226488317155274 212.582152657311;
+0.0290160459897681 0.00739298411379544 0.0295646112595359 0.00320950650435825 223.354776782472;
+0.0291550909947248 0.00837491137127378 0.029626503807422 0.00429308719458381 225.824032141292;
+0.0292867203803658 0.00942098605758682 0.0297099778275185 0.00521371588578668 289.174371036054;
+0.0294118009827998 0.0105322979403394 0.0297708128217 0.00630523618934801 291.76562674214;
+0.0295314273173431 0.0117085916930617 0.0297738254102319 0.0077845276640389 249.792274028816;
+0.0296473148682443 0.0129457368290707 0.0297593829031294 0.00942108138321052 252.834724413665;
+0.0297614449687214 0.0142378156233924 0.0297479762775305 0.0110928157685293 257.16914829611;
+0.0298758246769984 0.0155785761042864 0.0297214495837925 0.0129246288473499 260.516274263344;
+0.0299926498539246 0.0169604372111882 0.0296813020693328 0.0148838477147645 264.820262040804;
+0.0301143636193819 0.0183743093216176 0.0296304012143393 0.0169997568113363 267.721418464848;
+0.0302436134696623 0.0198095109067344 0.0295869177096024 0.0191653854866448 270.588485379413;
+0.0303831347268976 0.021254339281156 0.0295359803994303 0.021495885394207 273.174699256598;
+0.0305358341922298 0.0226953511483133 0.0295031645632426 0.0238439137364907 280.887741214991;
+0.0307046692114356 0.0241179652616208 0.029464959956627 0.0263714084678734 284.09303402237;
+0.0408918179351123 -0.00442124556053054 0.0398264717878744 -0.0292936525254991 3751.85002518166;
+0.0410956358178465 -0.00256290089576022 0.0401735725465836 -0.0585174846833339 15293.5853700787;
+0.0413140207990184 -0.00012440203199366 0.040454453684294 0.0250144779649143 13451.4350433517;
+0.041545852411508 0.00213894125280246 0.0407247694590079 0.0250310291351162 996.211937642239;
+0.0417906633992983 0.00404493356419468 0.0409331962179067 0.0250363855215138 976.562610574304;
+0.0420488686472117 0.00562321673602885 0.0411385859136632 0.0250420695806368 977.49271885943;
+0.0423214182137549 0.00689833922367271 0.0412926941454174 0.0250489278030488 954.459287885108;
+0.042610008865187 0.00789010486712967 0.0414540476821426 0.0250553032332903 962.122313911279;
+0.0429167395968209 0.00861389050894474 0.0415793585653249 0.025063725101221 943.380524509968;
+0.0432442983592379 0.00908086862385888 0.0417240809817507 0.025072434832038 951.622888146518;
+0.0435956335702057 0.00929818885905821 0.0418520622936832 0.0250832118671961 948.720238755903;
+0.0439741040816583 0.00926908432690695 0.0420125122721554 0.0250927257877538 961.615826912094;
+0.0443831822232157 0.00899294341404782 0.0421790274030661 0.0251043307964735 971.093136582286;
+0.0448265527775827 0.00846526935615015 0.0423908065675445 0.0251198002808971 978.770383468055;
+0.0453078661205654 0.00767758940157194 0.0426344425822316 0.0251366169002862 983.95475830653;
+0.0458307685787888 0.00661735376743293 0.0429346001314349 0.0251510836200943 999.453192443687;
+0.0463987282411954 0.00526776203627104 0.043294851778949 0.0251719197602744 1000.87280471184;
+0.0470149748608695 0.00360743217248359 0.0437201487907538 0.0251943557478323 1012.06805887046;
+0.0476824244345703 0.00161008301041511 0.0442354785170827 0.0252224835549939 1008.40191433627;
+0.0484035033663027 -0.000755900086408252 0.044821015811157 0.0252539557791493 1019.60975817121;
+0.0491801973953538 -0.00352793868183041 0.0455268277434677 0.0252863322581439 1012.50817983008;
+0.0500137037399771 -0.00674930740804417 0.0463180778373541 0.0251249409548397 1132.2637139917;
+0.0509045814919906 -0.0104294882092076 0.0472334268251553 0.0100541364974035 1117.03874701807;
+0.0518522536063229 -0.0144432503098834 0.048347824081036 0.000287485808781657 993.545241254466;
+0.0528542771503062 -0.0186744706416095 0.0495998154573062 -0.0142874684974808 930.435822248284;
+0.0539068756365066 -0.022984897436678 0.0509410182009945 -0.0247428718572387 800.886304053074;
+0.0550057878940568 -0.0272611327203655 0.0522775102575698 -0.0377913150748845 740.487776158406;
+0.0561471520637245 -0.031377925763015 0.0536680481534919 -0.0489373875451474 637.429119036738;
+0.0573270898831677 -0.0352211807684157 0.0551081290900601 -0.0598560576275165 608.106216555947;
+0.0585417036032511 -0.0386890489236125 0.0565349233188146 -0.0672385710639403 494.068527830064;
+0.0597875319699222 -0.0417181070589411 0.0580056178083742 -0.0719725996527845 529.119944935797;
+0.061061140612196 -0.044282456913113 0.0594909538272569 -0.0737818437778438 530.78510877266;
+0.062359466774712 -0.04638891845501 0.0608976814014488 -0.0745758083514542 462.479240974395;
+0.0636804844271532 -0.0480578143683961 0.0623540599631572 -0.0744188208980428 493.583847871004;
+0.0650222706206268 -0.0493150356494812 0.063786974448724 -0.0743154489096051 483.171675481122;
+0.0663834682466956 -0.0501805356790792 0.065171235053911 -0.0747605326335981 458.721475405862;
+0.0677635948502077 -0.0506633724823242 0.0665538867623876 -0.0747952824783488 454.491402706514;
+0.0691623969402394 -0.0507719118422785 0.0680172035712991 -0.0738929843204657 525.080916328435;
+0.0705791210823801 -0.050518225622236 0.0694636659655118 -0.0734790619029354 538.572972674522;
+0.0720133301237495 -0.0499031700415968 0.0708828561932191 -0.0741858601442184 481.239985345478;
+0.0734651601191194 -0.04891066164892 0.0723125969587435 -0.0742636382512998 486.362928308194;
+0.0749349148389058 -0.0475243619329342 0.0737686750134181 -0.0735700865611296 489.136084698011;
+0.0764228221440724 -0.0457332805170712 0.0752455761237319 -0.0721726680770727 492.589439432981;
+0.0779290330748916 -0.0435322933056977 0.0767512878817376 -0.0696787581414264 497.854215443725;
+0.0794535479275654 -0.0409252639448039 0.0782886914963975 -0.0663609710931676 500.550169244535;
+0.0809961650578405 -0.0379246673120443 0.0798579526770536 -0.0616893608555555 512.851454369042;
+0.0825564445930071 -0.0345546869276141 0.081468264195445 -0.0563955131312312 511.481337407454;
+0.084133611714094 -0.0308473536652784 0.0831172217418298 -0.049712148402111 533.746907665145;
+0.085726534242178 -0.0268464263607303 0.0848092151227087 -0.0426775432734543 521.68911412872;
+0.0873334738000223 -0.0226032254207923 0.0866179328907782 -0.0337697000772388 575.621810227214;
+0.0889514823634169 -0.0181860073404086 0.0884657252327734 -0.024743330511694 541.656826562681;
+0.0905768966936197 -0.0136750515019078 0.090381788643508 -0.012399423615348 637.581289009824;
+0.0922054712899402 -0.00918419935357068 0.0922539095676577 1.72034708902054e-05 542.96651989255;
+0.093833356874948 -0.00483732234321624 0.0941002097899353 0.0125596381603509 589.078863724806;
+0.0954573640414111 -0.000761790645407354 0.0958359921038856 0.0250069434223743 471.356074975237;
+0.0970755005327392 0.00293514714335152 0.0975562932175381 0.0283475245672711 340.985339056194;
+0.0986862623024679 0.00623657400096797 0.0992261782799362 0.0312212707669219 342.84057672047;
+0.100288640065914 0.00914900196886029 0.100878807745307 0.033691481589431 344.195606560187;
+0.101881931929727 0.0116793649359566 0.102482431330356 0.035746545687207 341.100630404877;
+0.103465892654186 0.0138349659176412 0.10406931213978 0.0374314753567985 342.794345939176;
+0.1050405481232 0.0156231982256532 0.105611981641427 0.0387288136238419 340.098252006213;
+0.106606175986798 0.0170517543442317 0.107195645921503 0.0396274583528933 348.431462888582;
+0.108162859192178 0.0181287354078402 0.108680207235122 0.0401933542161966 342.482989537963;
+0.109711494052041 0.0188621010520191 0.11015391542204 0.0404338713777838 343.730698488033;
+0.111253289075652 0.0192596626577541 0.111601862004941 0.0403039385748451 353.48857226389;
+0.112789657084437 0.0193294812764017 0.113044145406017 0.0398704038453046 355.03978172315;
+0.114322083916384 0.0190794932091308 0.114474218490375 0.0391032142520819 366.516991030083;
+0.115852136346868 0.018517637476624 0.115904042117571 0.0380543609126813 368.794115841572;
+0.117381369894994 0.0176515600508163 0.117337153652835 0.0367072392366927 378.884032878262;
+0.118911281506753 0.0164887325437378 0.118774961228802 0.0350765366417421 380.272230879059;
+0.120443272474679 0.01503613834846 0.120231527769462 0.0332855635550925 384.93188869901;
+0.121978555407722 0.0133000195334629 0.121693355650701 0.0309655678840776 387.139783627698;
+0.123518180177791 0.0112891794287999 0.123197676012787 0.0282364110501291 391.440535987086;
+0.125062756749488 0.00901475331698825 0.124721886508771 0.0251283501692048 413.116189805562;
+0.126612545108447 0.0064939625026831 0.126288262844581 0.0200244988468465 413.014056365481;
+0.128167142898829 0.00376417517949973 0.127951915312815 0.0140614347472612 437.013671235895;
+0.129724977830757 0.000873758434898424 0.129662796833698 0.00804980866335105 422.487857403879;
+0.131283780897754 -0.00212737000189199 0.131374679235725 0.00153190552322705 424.380872941175;
+0.132841082767671 -0.00518542544860118 0.133118129390744 -0.00506279027459587 483.289611131079;
+0.134394171803538 -0.0082363736542796 0.134818425932154 -0.0151248359139506 511.973087891728;
+0.135940663342655 -0.0111802229965482 0.136508825528211 -0.0250176073963643 455.04486771151;
+0.137478585492242 -0.0139234287799607 0.138083740950889 -0.0289997734784809 341.064548740252;
+0.139007183589896 -0.0164322241631872 0.139611253325096 -0.0326152434269601 341.699496647328;
+0.140526390873303 -0.0186891292994898 0.141123535872313 -0.0359420308656152 342.864450305648;
+0.142036390038441 -0.0206777062739461 0.142591921128599 -0.0388784554772733 337.6048632312;
+0.143537749610475 -0.0223828825562193 0.144047590256832 -0.0415302842377716 339.091733724884;
+0.145031247356766 -0.0237903516976692 0.145465765173253 -0.0437160254854642 335.796220826066;
+0.146517983885742 -0.0248876200785365 0.146875384045354 -0.0455677420024361 337.445149264171;
+0.147999214786211 -0.0256634706149745 0.148256590093436 -0.0468698270398447 335.846084179931;
+0.149476435984495 -0.0261092993078475 0.149634600375536 -0.047771664143143 339.25262618568;
+0.150951232071515 -0.0262184404311573 0.15099567169272 -0.0480990533360469 347.422356394049;
+0.152425327126424 -0.0259872441378502 0.152359534212343 -0.0479452584939989 350.690173242607;
+0.153900458244345 -0.0254148201583557 0.153719962258765 -0.0471880297961845 361.795538637101;
+0.155378384423221 -0.024503884817359 0.155089135394035 -0.045892225614607 366.229440711624;
+0.156860795941762 -0.0232605394276021 0.156469944020085 -0.0440221304314252 374.567665730779;
+0.158349272758438 -0.021694656402073 0.157864777199751 -0.0415439607225983 379.605632718862;
+0.159845246871347 -0.0198200936811146 0.159285134348425 -0.0386053893943619 380.853860258181;
+0.161349928599577 -0.01765384074408 0.160719553113453 -0.0350608708415498 393.157111232376;
+0.16286431935663 -0.0152174108386033 0.162204736247197 -0.0309117734205488 392.988221627667;
+0.164388930974002 -0.012537941378346 0.163719216337018 -0.0260043310888848 408.930965520514;
+0.165923874212565 -0.00964926080377335 0.165281213646937 -0.0207050356213599 401.246570278108;
+0.167468574679096 -0.00659008285779376 0.166949161308046 -0.0145986536053489 425.071405078588;
+0.169021250293658 -0.00340600631151801 0.16866848616715 -0.00844335149350378 412.020371482064;
+0.170579409743029 -0.000144484207638474 0.170396783653087 -0.00182876913879218 413.581376660552;
+0.172140484422895 0.00314381667976042 0.172100421897444 0.00459958456829427 421.090687230668;
+0.173702105825748 0.00639933967483068 0.173834312251357 0.0148909174579376 512.24399135953;
+0.175261908774846 0.0095227297618989 0.175473853670867 0.0250156625628201 429.853899382832;
+0.176818429124493 0.0124203307899358 0.1771033330739 0.0289607273148994 338.254304285692;
+0.178370612649731 0.0150607023012537 0.178690168329184 0.0325248972199545 339.876587585775;
+0.179917836266113 0.0174291989070086 0.180265920236616 0.0357940705930401 340.656130151494;
+0.181459731797319 0.0195120302600244 0.181800920914664 0.0386642558513585 336.284085200228;
+0.182996327009164 0.0212967208946937 0.18332586817694 0.0412060477479657 337.684953494623;
+0.184527870849323 0.0227717562133142 0.184814971223653 0.0433022648872511 334.581139875627;
+0.1860549515234 0.0239272150434102 0.186296808703948 0.0450388383947025 336.572038999961;
+0.187578329591318 0.0247543912098773 0.187750532401769 0.0462751402328862 336.194667711403;
+0.189099027461381 0.0252466309573583 0.189201124515027 0.0471136661587806 339.432105092154;
+0.190618177854809 0.0253989803869783 0.190633878798685 0.0473806399815771 347.204078287492;
+0.192137078417413 0.0252093443035152 0.192068445344114 0.0471935655281104 350.367151843251;
+0.193657064451486 0.0246780601838892 0.193497629121705 0.0464073699041333 361.727463359019;
+0.195179521449482 0.0238088533600233 0.194933754861235 0.0451197585947547 365.816197872871;
+0.196705792433404 0.0226084039103655 0.196378644037417 0.0432737918672625 374.462132392875;
+0.198237140382409 0.0210868037510061 0.197835184428764 0.0408639291276824 378.976986444306;
+0.199774704351727 0.0192575817345114 0.19931444623974 0.0380201775162933 380.33754557286;
+0.20131942300161 0.0171370088554624 0.20080548543129 0.0345762539135308 392.208560155839;
+0.20287204872338 0.0147457588200765 0.202341210834267 0.0305266998083247 392.259576428052;
+0.204432894376941 0.012110037964447 0.203902782371147 0.0257494111784211 408.378838640469;
+0.206001903637904 0.0092626405209321 0.205507491976507 0.0204899282775468 401.360446166333;
+0.207578365961656 0.00624207671104851 0.207214222474176 0.0144200608601788 425.005888203861;
+0.209160390151939 0.00309397105759714 0.208968211689962 0.00830067541596888 419.915399861284;
+0.210745402281826 -0.000134211687333181 0.210726911467269 0.00171723681935911 421.243757893533;
+0.212330808446622 -0.00339205412662131 0.212445115981244 -0.00457572895002229 397.97522291496;
+0.21391423459457 -0.00662103565165794 0.214238458733787 -0.0148588130126607 512.415102444713;
+0.215492951961874 -0.0097217536864441 0.215896190825596 -0.0250109715272189 389.896977007547;
+0.217065315975969 -0.0125995355138852 0.217576285428972 -0.029109297810547 299.094925440828;
+0.218629937313122 -0.0152210497643503 0.219166320306757 -0.0326408305679948 292.701676531386;
+0.220186228194981 -0.0175713290498148 0.220739716154301 -0.0358979020008186 293.909953486125;
+0.221733997765374 -0.0196365551703486 0.222267195239524 -0.0387505329068212 289.415735887942;
+0.223273482441183 -0.021404149499819 0.223779637973233 -0.0413086606581545 291.222954140583;
+0.224805170983924 -0.0228622639194653 0.225251449407179 -0.0433826935955519 287.107664211879;
+0.226329922052536 -0.0240008533441857 0.226711882247704 -0.045137766270725 289.379012386118;
+0.227848793620098 -0.0248108761914731 0.228140233153155 -0.0463499469312758 286.549334744326;
+0.229363125315361 -0.0252856550347803 0.229564764174708 -0.0471726360629758 288.743639121818;
+0.230874360515269 -0.0254203207873385 0.230969543691824 -0.0473897168706264 286.530554805389;
+0.232384038354543 -0.0252137919084201 0.232401767369995 -0.0469223695102434 292.631838751438;
+0.233893488999667 -0.0246692891717817 0.233814934891704 -0.0460976590771166 292.656960331202;
+0.235404147955262 -0.0237907984929912 0.235235034916174 -0.045064917636858 337.462276781112;
+0.236917461229744 -0.0225811770119923 0.236649674009565 -0.043651559993543 333.032370252688;
+0.238434976385314 -0.0210456957034207 0.238056119879042 -0.0410541998883068 298.860887241544;
+0.239958338167695 -0.0191988277704726 0.239488660159205 -0.0380815978715219 296.663166733477;
+0.241488990302153 -0.0170592875821657 0.240937354321337 -0.0342956312353734 304.138878219601;
+0.243028140114675 -0.0146513730152213 0.242429936434191 -0.0302364118209847 299.815755269283;
+0.244576554085531 -0.0120019612877656 0.243951229938424 -0.0254819990316573 315.048655324335;
+0.246134602117194 -0.00914353838837506 0.245521792339301 -0.0201770005873194 304.955738268143;
+0.247701929591456 -0.00611465760400823 0.247202828495609 -0.0141836154530809 328.759222230236;
+0.249276888573535 -0.00296006046989881 0.248945440063273 -0.00809327472716909 307.009987501719;
+0.250857024443766 0.000273285389376353 0.250687099931171 -0.00146928798042276 308.759924323173;
+0.252439899841783 0.00353465656416454 0.252395419210583 0.00483911876820912 275.79041834127;
+0.254023352772307 0.00676557718545145 0.25414865816769 0.0150238684796316 359.110634110895;
+0.255604941452776 0.00986806338612634 0.255866555343264 0.025020303041177 262.320525352454;
+0.25718260414042 0.0127495079274577 0.257523653073218 0.0290566394305335 173.44779378764;
+0.258754782172484 0.015377319468876 0.259242384794745 0.0327294152826592 188.505979227673;
+0.260319666479815 0.0177350631550273 0.26083871115621 0.0360852823416187 168.943911601944;
+0.261876551423147 0.0198073880964369 0.262395179470179 0.0390353354150101 163.49348582325;
+0.263425354909415 0.0215803124703846 0.263945840465568 0.0416868648677773 165.526735244219;
+0.264966124445259 0.0230406821485489 0.265461290786336 0.0438237901404491 160.859668417805;
+0.266499169761094 0.0241773863916992 0.266974406476183 0.045656988061546 163.885857710493;
+0.268024868800085 0.0249802221063452 0.268459509712762 0.0469288699102141 159.826577867245;
+0.269543776725476 0.0254415043726874 0.269946808408046 0.0477787179809345 163.23102020525;
+0.271056441377127 0.0255556346904458 0.271415405672751 0.0480268191531688 159.154609666213;
+0.27256348330086 0.0253202906268277 0.272891210326444 0.0477619331154586 163.169891875525;
+0.274065429337396 0.024736055246938 0.274359164341935 0.0469372212199767 158.780026493747;
+0.275562758192949 0.0238067047311253 0.275839237828054 0.0455442363599023 163.06534910441;
+0.277055760996277 0.0225393515249155 0.277323072965305 0.0436312455549228 160.890653119859;
+0.278544676221673 0.0209427425007172 0.278774022494404 0.0417103731963473 186.170933729371;
+0.280029825804911 0.0190248249949262 0.280296150422655 0.0386727851195518 164.319440911184;
+0.281510761989559 0.0168022280510167 0.281839673739139 0.0348454344654487 171.788975205936;
+0.282986679287607 0.0142957282100072 0.283338644291839 0.0318717579973424 179.486229921691;
+0.28445682262028 0.0115202164821511 0.284944943353791 0.0268317266792077 189.340047222082;
+0.285919285952691 0.00850644925812439 0.286574186369928 0.021491798919844 176.563511589688;
+0.287371257786422 0.00529173487384379 0.288306243497224 0.0154701577836862 197.98829353365;
+0.288808578198785 0.00191834357996911 0.290059393575737 0.00936256217737867 176.843364365523;
+0.290226369964593 -0.00157003676379252 0.291813131364521 0.00278360406161747 176.610810468344;
+0.291619581245806 -0.00512688410536322 0.293493362733883 -0.00360315426576754 145.887246669818;
+0.292983649223268 -0.00869601516483376 0.295131603685417 -0.0144112681830119 249.578444457025;
+0.294314325183712 -0.0121763837427563 0.296715732011171 -0.0250421086671312 145.765163694323;
+0.295607672718667 -0.0154729499020058 0.298237920502982 -0.0291197148039418 47.9673871870909;
+0.296860128960158 -0.0185572636830165 0.299694446885802 -0.0328920710137968 44.8698254081191;
+0.298068502960931 -0.0214186458728729 0.301087272821377 -0.0363352838940694 43.804532599539;
+0.299229938060138 -0.024047998579478 0.302407592318402 -0.0394549785874074 41.8282916004355;
+0.30034194836815 -0.0264377363693827 0.303657505438487 -0.04222442647829 41.6338949556957;
+0.301402397399274 -0.0285818927980035 0.30483071471367 -0.0446584614174639 40.3700692064049;
+0.302409520804823 -0.0304760194924728 0.305928754003597 -0.0467274634945527 40.7123704288442;
+0.303361907460932 -0.0321173175732438 0.306948467771283 -0.0484578788326282 39.8598347094612;
+0.304258505756162 -0.033504485932567 0.307890061077794 -0.0498150609826132 40.51628823391;
+0.305098611638041 -0.0346378879703873 0.308754153600316 -0.0508392610435437 39.8588832914647;
+0.305881855766829 -0.0355193390311689 0.309538774512096 -0.0514879962567902 40.7064274704826;
+0.306608203364985 -0.0361523237402693 0.310249029221011 -0.0518183093699573 40.0906069619759;
+0.307277919187702 -0.0365417095320844 0.310879721225536 -0.0517755201012304 41.0915229915863;
+0.30789158495887 -0.0366940374988372 0.311441418444736 -0.0514387290419744 40.3950796312929;
+0.308450037799312 -0.0366171379194543 0.311924200034231 -0.0507332251177482 41.5860252099192;
+0.308954413234442 -0.0363205346141102 0.312345674964879 -0.0497703274128777 40.6735869299209;
+0.309406049715704 -0.035814914118486 0.312688836802806 -0.04844062678777 42.1687334626586;
+0.309806569516748 -0.035112717662365 0.312981042067635 -0.0469070437198216 40.8259492671477;
+0.310157689372415 -0.0342272080544744 0.313212382159922 -0.0450605786707469 44.9005825718141;
+0.310461270917593 -0.0331733280908544 0.313386050174045 -0.0429239725231443 48.1173856200094;
+0.31071933357412 -0.0319676377440574 0.313505399250385 -0.040629058266487 43.2035928635069;
+0.310934033810236 -0.0306270756255667 0.313573911546022 -0.0382011322531096 38.624817399188;
+0.311107644523036 -0.0291685527782861 0.313595168051651 -0.0356649261722369 34.4048947699739;
+0.311242534693132 -0.0276088309585549 0.313572819425932 -0.0330444634214486 30.5590510335769;
+0.311341149448502 -0.0259644096082276 0.313510558000333 -0.0303629293061863 27.094262024686;
+0.311405990663178 -0.0242514217799598 0.313412091089178 -0.0276425551870481 24.0098079674972;
+0.311439598204338 -0.0224855391983937 0.31328111572164 -0.024904516576713 21.2979848963769;
+0.311444531928953 -0.020681886567136 0.313121294894717 -0.0221688450790332 18.9449345699941;
+0.311423354519807 -0.0188549651578069 0.312936235428837 -0.0194543539631308 16.9315557993923;
+0.311378615238118 -0.0170185856525335 0.312729467491043 -0.0167785770751902 15.2344622321998;
+0.311312834659002 -0.0151858101449448 0.312504425834408 -0.0141577207105915 13.826954443708;
+0.311228490444049 -0.0133689031471095 0.312264432786863 -0.0116066279970905 12.6799775956461;
+0.311128004194383 -0.0115792913946171 0.31201268300781 -0.00913875527627 11.7630397089088;
+0.311013729417161 -0.00982753219340634 0.311752230016882 -0.00676615991609607 11.0450695974869;
+0.310887940627807 -0.00812329000506169 0.311485974486069 -0.00449949893944554 10.4951976799875;
+0.310752823600667 -0.00647532092841361 0.311216654274187 -0.00234803781372988 10.0834469757683;
+0.310610466771536 -0.00489146470007556 0.310946836171235 -0.000319668714003958 9.78132556664423;
+0.310462853787144 -0.00337864380547369 0.310678909309886 0.00157906245402041 9.5623155599551;
+0.310311857187691 -0.00194286926664831 0.310415080191817 0.00334292100385176 9.40225702211683;
+0.31015923320218 -0.000589252651973313 0.31015736926807 0.00496794113682108 9.27962843467139;
+0.310006617628533 0.000677976164012249 0.30990760900522 0.00645137708184465 9.17572788617144;
+0.309855522764627 0.0018554459734086 0.309667443362391 0.00779164846018025 9.07476146753834;
+0.309707335341815 0.00294061649074945 0.309438332055911 0.00898825837555514 8.96307826084194;];
+plot (CoM_ZMP(:,1), CoM_ZMP(:,2), 'b');
+plot (CoM_ZMP(:,3), CoM_ZMP(:,4), 'ks','MarkerSize',5);
+hold off; figure;
+plot (CoM_ZMP(:,5));
@@ -0,0 +1,2619 @@
+
+
+OBJ0= [
+18.0628024021877;
+18.6181641833558;
+18.2982760558724;
+18.8878324305932;
+19.7151528642252;
+20.4420930680747;
+57.1557526175807;
+58.2614396312856;
+72.9390970115926;
+74.5246825505222;
+80.7170667623034;
+82.8669240518838;
+80.7702421353728;
+82.9372672775947;
+80.6373260298876;
+82.8163391152925;
+82.6028238802097;
+84.7877365108597;
+90.4076299448028;
+92.576624175112;
+102.137934372888;
+104.306052745836;
+112.197472101902;
+114.373363645799;
+119.839400859601;
+122.02319841252;
+125.451769886625;
+127.639403672249;
+129.589508151293;
+131.775312986135;
+139.948076049421;
+142.134850181915;
+181.005856453647;
+183.198267584046;
+198.775781340358;
+200.967577902961;
+204.512972951772;
+206.705778070403;
+204.874965142626;
+207.068194285235;
+205.262868173661;
+207.467710437487;
+208.109291469619;
+210.338472846309;
+219.022748309758;
+221.285015932182;
+233.147420525724;
+235.457434947972;
+244.814214022908;
+247.180107107768;
+253.486244271949;
+255.908571215694;
+259.642258848072;
+262.117614261717;
+263.822390500617;
+266.362167895912;
+275.023031430221;
+277.721641945783;
+4561.30570422609;
+20258.0522959189;
+17428.5995259668;
+1038.10640583029;
+1004.35501029189;
+991.935526409974;
+966.652822724349;
+962.238445709252;
+943.934497878903;
+944.092662652161;
+931.707041974567;
+934.484673756307;
+934.67941418488;
+938.889992638998;
+941.782302942768;
+946.703692071571;
+946.570671529179;
+951.658184552182;
+947.836805723197;
+952.575582324533;
+945.297268185137;
+1059.92828955742;
+1041.3836659794;
+951.039514314312;
+865.135660637598;
+807.053327767631;
+759.867203782152;
+650.858424882008;
+572.782474901928;
+513.59782790984;
+476.955378047084;
+480.767805475938;
+476.394306433893;
+477.374404673339;
+465.585521354785;
+468.371513914536;
+462.091387161713;
+467.288133398995;
+470.413772852373;
+476.865248262638;
+483.326242148379;
+485.835892617909;
+488.561357090528;
+493.683359803499;
+496.546503558999;
+507.798346262841;
+506.549886997729;
+527.990323815043;
+514.017107093819;
+564.833128009861;
+537.148122421257;
+610.230122038227;
+514.996501287545;
+582.224925257611;
+466.527245647642;
+335.497666463164;
+338.096120444872;
+338.837103717938;
+336.345394323783;
+337.571668333165;
+335.48149781777;
+336.927638991245;
+337.480308310198;
+338.970599455759;
+347.504846419115;
+348.920241014159;
+360.717859198533;
+362.000762045849;
+371.275930953401;
+372.493835574045;
+378.62166762959;
+380.160074685583;
+383.244315854232;
+403.938377019786;
+404.097183910346;
+426.410483010831;
+412.353538105322;
+413.269996984789;
+422.280649996476;
+524.438985048621;
+433.809232499824;
+333.228683533629;
+334.366209311942;
+335.345341325716;
+331.114434702093;
+332.920180246086;
+328.938115850883;
+331.350941583262;
+329.983457999884;
+332.863293063112;
+339.671136342918;
+342.916981104416;
+353.621364541407;
+357.113144540744;
+365.900210804334;
+369.708406237545;
+374.978964485643;
+381.421061671473;
+380.930998141428;
+393.522691454933;
+387.557825619177;
+409.218155592205;
+398.292962189504;
+399.18909318866;
+410.786922588035;
+516.439421858972;
+429.110502331252;
+330.531199797469;
+332.20524528751;
+333.142420497083;
+329.526980541282;
+331.215819168139;
+327.908456174314;
+330.116372976794;
+329.444796938419;
+332.014104993329;
+339.461215388161;
+342.276495250248;
+353.437847962531;
+356.387300532357;
+365.450863103763;
+368.591567453765;
+374.243261685484;
+379.35947164041;
+379.862983841473;
+393.752508543353;
+390.196027688158;
+412.14662252908;
+409.495655107835;
+410.593074589664;
+388.883239285963;
+496.14774745351;
+391.944499925007;
+291.573335303847;
+287.832066226047;
+288.788388106483;
+284.749846701291;
+286.459669930415;
+282.885237780607;
+285.117652323756;
+282.313618829192;
+284.912023667771;
+282.982200691185;
+285.834697281754;
+284.775626022308;
+287.776667379815;
+287.239082480979;
+290.452280459805;
+289.416010452826;
+294.6787292555;
+290.630002225785;
+304.313777227352;
+297.587523623634;
+319.580005780916;
+297.538312276488;
+298.77878355168;
+267.866065637138;
+376.156769453199;
+268.138930895655;
+167.061761475669;
+162.796196771275;
+163.741401656032;
+159.951825128323;
+161.640457587388;
+158.115827077058;
+160.31655064411;
+156.977150304049;
+159.533232859332;
+156.440708317452;
+159.246134186858;
+156.517748861445;
+159.502182045223;
+156.993598687966;
+160.302374258293;
+157.360458665903;
+162.751724402493;
+157.230239865661;
+168.163005282754;
+159.936996466878;
+181.202023703581;
+162.899554569585;
+166.001744470953;
+137.338618810294;
+265.300697772819;
+149.779736547758;
+39.136637208459;
+36.3878074374433;
+35.7247328335363;
+33.8694091255945;
+33.9176767459887;
+32.6292892174838;
+33.1301699061879;
+32.1642160080317;
+32.9463683882877;
+32.1263428629643;
+33.093641349674;
+32.2906521464637;
+33.4088612894836;
+32.5140007197904;
+33.8023698433013;
+32.6883469509821;
+34.2254491196247;
+32.6900276544618;
+35.4467756675475;
+37.33958147765;
+33.4839124545393;
+29.9265949424643;
+26.6819715745796;
+23.7571429883336;
+21.1524380648451;
+18.8620267986953;
+16.8746412887306;
+15.1743714838346;
+13.7415042542737;
+12.5533769227738;
+11.5852194566751;
+10.8109629248301;
+10.2039954471113;
+9.7378505698514;
+9.38681668075833;
+9.12645963659993;
+8.93405412052717;
+8.78892232430925;
+8.67268129063118;
+8.56940263371585;
+8.46569035085464;
+8.35068403189115;
+8.21532424951158;];
+figure;semilogy (OBJ0(:,1));
+legend ('Limit = 0');
+
+
+OBJ1= [
+18.0628024021877;
+18.6181641833558;
+18.2982760558724;
+18.8878324305932;
+19.7151528642252;
+20.4420930680747;
+57.1557526175807;
+58.2614396312856;
+72.9390970115926;
+74.5246825505222;
+80.7170667623034;
+82.8669240518838;
+80.7702421353728;
+82.9372672775947;
+80.6373260298876;
+82.8163391152925;
+82.6028238802097;
+84.7877365108597;
+90.4076299448028;
+92.576624175112;
+102.137934372888;
+104.306052745836;
+112.197472101902;
+114.373363645799;
+119.839400859601;
+122.02319841252;
+125.451769886625;
+127.639403672249;
+129.589508151293;
+131.775312986135;
+139.948076049421;
+142.134850181915;
+181.005856453647;
+183.198267584046;
+198.775781340358;
+200.967577902961;
+204.512972951772;
+206.705778070403;
+204.874965142626;
+207.068194285235;
+205.262868173661;
+207.467710437487;
+208.109291469619;
+210.338472846309;
+219.022748309758;
+221.285015932182;
+233.147420525724;
+235.457434947972;
+244.814214022908;
+247.180107107768;
+253.486244271949;
+255.908571215694;
+259.642258848072;
+262.117614261717;
+263.822390500617;
+266.362167895912;
+275.023031430221;
+277.721641945783;
+4561.30570422609;
+20258.0522959189;
+2802529.3115868;
+2682966.35257683;
+4154141.39256643;
+4070089.03927747;
+6164128.13136182;
+6128003.53143435;
+949.261557810028;
+950.047907581095;
+937.048126143943;
+940.495442779693;
+940.049217503458;
+944.924758182574;
+947.128040288655;
+952.663262225998;
+951.767685953147;
+957.375821475812;
+952.689865184468;
+957.822937366301;
+949.546396536895;
+1064.58272856251;
+1044.71604712249;
+952.050322199726;
+864.458397299468;
+806.469122197818;
+759.969001337736;
+651.692759728245;
+573.651975636592;
+515.14670911057;
+478.50737331463;
+482.915627404575;
+478.482234182842;
+479.955144333156;
+468.023095515039;
+471.190464706386;
+464.673310232212;
+470.141639923254;
+472.934090645605;
+479.557589461427;
+485.593773080248;
+488.192698748919;
+490.411926733177;
+495.561340810648;
+497.852197984282;
+509.091354044818;
+507.225817263128;
+528.602960377156;
+514.02817826693;
+563.688172300214;
+535.482024181168;
+608.762535119061;
+513.995729576525;
+581.384994135727;
+465.958193675435;
+334.990657921201;
+337.779808994574;
+338.510268667495;
+336.150572176594;
+337.318032408316;
+335.321797329684;
+336.682098858938;
+337.30922834976;
+338.704220490278;
+347.309342870254;
+348.633537381834;
+360.511242068392;
+361.716611044763;
+371.090617879887;
+372.250547944772;
+378.50216444292;
+380.0050346668;
+383.240596929324;
+403.911656288935;
+404.257685394243;
+427.055223215018;
+413.202704131901;
+414.064554993112;
+422.83617662092;
+524.869007288367;
+434.125797614369;
+333.451749640443;
+334.498814363308;
+335.415418319437;
+331.117242066277;
+332.88829672883;
+328.860249670539;
+331.261612999509;
+329.866067317337;
+332.752149108641;
+339.545608560463;
+342.80948367768;
+353.508538339266;
+357.024235758505;
+365.810392778805;
+369.642912613397;
+374.912541422521;
+381.374683554549;
+380.879453171302;
+393.495654532938;
+387.504736607282;
+409.068117592886;
+398.091114542727;
+398.984696778337;
+410.634962391133;
+516.336562253278;
+429.017636964939;
+330.487236045044;
+332.172144994858;
+333.154529100914;
+329.547415969699;
+331.275338556354;
+327.971332747699;
+330.210810329354;
+329.536091275675;
+332.128981872858;
+339.565708745787;
+342.396946244191;
+353.540597703584;
+356.499375951517;
+365.538393118146;
+368.683218886971;
+374.304487445173;
+379.421216427776;
+379.889914667703;
+393.775708242088;
+390.184532384958;
+412.060087208151;
+409.379946486166;
+410.492191179815;
+388.815337083971;
+496.09060148646;
+391.907160478408;
+291.539339471347;
+287.812198989116;
+288.766358987722;
+284.737910776816;
+286.441885853244;
+282.875032229176;
+285.099543278083;
+282.301920271236;
+284.891740937195;
+282.968301112222;
+285.81261540238;
+284.760818434628;
+287.754862258262;
+287.226132823463;
+290.434018599882;
+289.408642027768;
+294.667996053923;
+290.632404721394;
+304.313745346262;
+297.603825984271;
+319.638301851415;
+297.614786477848;
+298.850603212397;
+267.916172283149;
+376.195433742696;
+268.167811237815;
+167.081944908774;
+162.808824186924;
+163.747999659668;
+159.952961672069;
+161.637984061636;
+158.109734634431;
+160.308894959086;
+156.96738599679;
+159.52350083582;
+156.430000233396;
+159.236566527052;
+156.507943006401;
+159.494140593181;
+156.985664702292;
+160.296385079378;
+157.354540572544;
+162.747566352267;
+157.22573906117;
+168.160563768583;
+159.932709005131;
+181.192500261604;
+162.886299458276;
+165.987964544044;
+137.32798546685;
+265.292073541233;
+149.772507728848;
+39.1315932654396;
+36.3841744378961;
+35.7232127487432;
+33.8691244112727;
+33.9192634913692;
+32.6318148888854;
+33.1342304137802;
+32.1688584606127;
+32.9521793055354;
+32.1323654160233;
+33.1004898353155;
+32.297360869248;
+33.4161183486192;
+32.5208019022412;
+33.8095368292317;
+32.6947774793351;
+34.2321804916447;
+32.6957617948516;
+35.4521362025471;
+37.3445440784981;
+33.488466596937;
+29.9307421823688;
+26.6857237226112;
+23.7605202470766;
+21.1554671864486;
+18.8647393129694;
+16.8770718410554;
+15.1765563168653;
+13.7434798552123;
+12.5551788553907;
+11.5868813846093;
+10.8125158301135;
+10.2054670401665;
+9.73926488156064;
+9.38819382623609;
+9.1278157324884;
+8.93540133976153;
+8.79026906738886;
+8.67403245332487;
+8.57075995077811;
+8.46705279502714;
+8.35204824932476;
+8.21668486019149;];
+figure;semilogy (OBJ1(:,1));
+legend ('Limit = 30');
+
+
+OBJ2= [
+18.0628024021877;
+18.6181641833558;
+18.2982760558724;
+18.8878324305932;
+19.7151528642252;
+20.4420930680747;
+57.1557526175807;
+58.2614396312856;
+72.9390970115926;
+74.5246825505222;
+80.7170667623034;
+82.8669240518838;
+80.7702421353728;
+82.9372672775947;
+80.6373260298876;
+82.8163391152925;
+82.6028238802097;
+84.7877365108597;
+90.4076299448028;
+92.576624175112;
+102.137934372888;
+104.306052745836;
+112.197472101902;
+114.373363645799;
+119.839400859601;
+122.02319841252;
+125.451769886625;
+127.639403672249;
+129.589508151293;
+131.775312986135;
+139.948076049421;
+142.134850181915;
+181.005856453647;
+183.198267584046;
+198.775781340358;
+200.967577902961;
+204.512972951772;
+206.705778070403;
+204.874965142626;
+207.068194285235;
+205.262868173661;
+207.467710437487;
+208.109291469619;
+210.338472846309;
+219.022748309758;
+221.285015932182;
+233.147420525724;
+235.457434947972;
+244.814214022908;
+247.180107107768;
+253.486244271949;
+255.908571215694;
+259.642258848072;
+262.117614261717;
+263.822390500617;
+266.362167895912;
+275.023031430221;
+277.721641945783;
+4561.30570422609;
+20540.7680667207;
+2040225.47038658;
+1932131.84413195;
+2780183.18346649;
+2700333.68696125;
+4201371.10897543;
+4145174.29554685;
+807.562443727914;
+813.268701034394;
+801.744664764736;
+809.220656647005;
+808.463966310156;
+816.824643636908;
+818.940488927066;
+827.609668123273;
+826.799025287268;
+835.308373309298;
+830.854172639056;
+838.743135965522;
+830.836214246613;
+957.160015040366;
+938.209075919234;
+913.146751747234;
+777.27408011965;
+751.437332975384;
+664.206532718208;
+597.063880149588;
+541.506777344616;
+500.379828486525;
+468.394497205473;
+459.789453513825;
+455.491317876433;
+461.672358542321;
+450.14333862091;
+452.488472315408;
+446.565838231327;
+451.385512513916;
+454.899571949604;
+460.870050017729;
+466.207452282763;
+469.0275483588;
+472.419364347992;
+478.962051462773;
+481.273865146029;
+493.359433293248;
+489.989738066847;
+510.434774584039;
+494.806814888535;
+539.095553661351;
+517.839532979451;
+575.412601760358;
+498.718826269537;
+579.156828378543;
+462.393576411094;
+332.199754447937;
+334.716824705959;
+335.863403902364;
+333.287076857173;
+334.965315514393;
+332.799499114925;
+334.717685512717;
+335.219037973862;
+337.176601563915;
+345.702332363439;
+347.549525998234;
+359.39666208263;
+361.039319201038;
+370.326039316629;
+371.881040044529;
+377.813762724735;
+380.2088412643;
+382.392800675883;
+401.567237543131;
+400.744613092501;
+423.102168015209;
+409.705858916008;
+410.28871981416;
+419.744831320682;
+518.958090594332;
+431.088001799537;
+333.278760806839;
+334.353536473211;
+335.303029396667;
+331.04144252299;
+332.841488049957;
+328.856418016467;
+331.279347371901;
+329.931848969543;
+332.828898564179;
+339.671960499282;
+342.932422499175;
+353.670629182685;
+357.165061735105;
+365.967147393516;
+369.761731338064;
+375.029984919361;
+381.442607375318;
+380.92470242787;
+393.577979995656;
+387.719326853809;
+409.279934587041;
+398.248616412781;
+399.104551255319;
+410.72584301815;
+516.123480514448;
+428.926095235898;
+330.541241883122;
+332.212233427377;
+333.188372812337;
+329.567029399868;
+331.291841954644;
+327.973943878752;
+330.213649132863;
+329.526292782031;
+332.122907287415;
+339.549793603183;
+342.38818864788;
+353.526919754696;
+356.49566738696;
+365.533880355239;
+368.691549993912;
+374.309907198341;
+379.454868834781;
+379.901432508577;
+393.749842647858;
+390.130914559329;
+412.012036571521;
+409.344211250143;
+410.449063360858;
+388.77744551739;
+496.013512595442;
+391.86911149597;
+291.542093805308;
+287.813197473655;
+288.767922913085;
+284.738555510105;
+286.443634397363;
+282.876419783297;
+285.102253444704;
+282.304558241391;
+284.895643660624;
+282.972118164922;
+285.817407216346;
+284.765154915959;
+287.759716937244;
+287.229903231387;
+290.437761550707;
+289.410859534991;
+294.669085615302;
+290.632369793259;
+304.317018014295;
+297.606139068528;
+319.633608511462;
+297.605830530655;
+298.841874812233;
+267.910360001217;
+376.18734463579;
+268.162364578703;
+167.079518465923;
+162.807413593664;
+163.74759107686;
+159.953213147665;
+161.638878168017;
+158.110974922739;
+160.310479994145;
+156.969070636631;
+159.525308712668;
+156.431752383462;
+159.238301881342;
+156.509565448764;
+159.495683096592;
+156.987088025878;
+160.297757103966;
+157.355754375474;
+162.74905685131;
+157.226791049565;
+168.160562944711;
+159.932374270428;
+181.192911280954;
+162.887441584772;
+165.98911919164;
+137.328798729797;
+265.292004546767;
+149.772904157137;
+39.1323104093733;
+36.3846669527845;
+35.7233734080515;
+33.8690860517663;
+33.9189307692926;
+32.6313283714181;
+33.1335029249982;
+32.1680325162992;
+32.9511711832264;
+32.1313167048502;
+33.0993143651274;
+32.2961998711647;
+33.4148757935648;
+32.5196231832346;
+33.8083064882246;
+32.6936542635868;
+34.2310166100926;
+32.6947443919435;
+35.4511519256153;
+37.3435942580823;
+33.4875985838002;
+29.9299558846555;
+26.6850171653749;
+23.7598898806304;
+21.1549081970201;
+18.8642459273871;
+16.8766376173142;
+15.1761744150953;
+13.7431432837064;
+12.5548806878816;
+11.5866149461742;
+10.8122748517639;
+10.2052457803315;
+9.73905821653886;
+9.38799731038669;
+9.12762563036279;
+8.93521463348216;
+8.7900834416283;
+8.67384626149449;
+8.57057216590819;
+8.46686294825083;
+8.35185636022766;
+8.21649138539196;];
+figure;semilogy (OBJ2(:,1));
+legend ('Limit = 25');
+
+
+OBJ3= [
+18.0628024021877;
+18.6181641833558;
+18.2982760558724;
+18.8878324305932;
+19.7151528642252;
+20.4420930680747;
+57.1557526175807;
+58.2614396312856;
+72.9390970115926;
+74.5246825505222;
+80.7170667623034;
+82.8669240518838;
+80.7702421353728;
+82.9372672775947;
+80.6373260298876;
+82.8163391152925;
+82.6028238802097;
+84.7877365108597;
+90.4076299448028;
+92.576624175112;
+102.137934372888;
+104.306052745836;
+112.197472101902;
+114.373363645799;
+119.839400859601;
+122.02319841252;
+125.451769886625;
+127.639403672249;
+129.589508151293;
+131.775312986135;
+139.948076049421;
+142.134850181915;
+181.005856453647;
+183.198267584046;
+198.775781340358;
+200.967577902961;
+204.512972951772;
+206.705778070403;
+204.874965142626;
+207.068194285235;
+205.262868173661;
+207.467710437487;
+208.109291469619;
+210.338472846309;
+219.022748309758;
+221.285015932182;
+233.147420525724;
+235.457434947972;
+244.814214022908;
+247.180107107768;
+253.486244271949;
+255.908571215694;
+259.642258848072;
+262.117614261717;
+263.822390500617;
+266.362167895912;
+275.023031430221;
+277.721641945783;
+4561.30570422609;
+21555.2002205232;
+743482.579963457;
+668804.539529734;
+420957.444262395;
+381475.734490024;
+388900.697232725;
+352947.369076195;
+543752.13013272;
+696.001094471631;
+686.256321165801;
+694.043785588264;
+694.19151727069;
+702.582141089121;
+705.836055508044;
+714.402488438162;
+714.910859395705;
+723.289457718236;
+720.326225733903;
+728.464001108985;
+721.905026287201;
+830.257884842237;
+813.61434461761;
+847.401034202394;
+714.172357266754;
+704.134533687652;
+619.573060886791;
+573.965183211923;
+540.128950792283;
+501.342375928026;
+471.548839530602;
+457.877742231849;
+441.70535255661;
+448.202598065489;
+442.255966033028;
+443.981321136772;
+437.915497308401;
+442.285835669862;
+446.005639262294;
+451.52050391751;
+456.839777088814;
+460.603481538516;
+464.641893650092;
+471.932602967836;
+474.267143964477;
+486.876630708305;
+482.645482897246;
+502.69489053005;
+486.448677271545;
+528.868355449121;
+507.844047046934;
+549.949840929536;
+487.576125316018;
+580.522950111122;
+462.385918064873;
+331.801751344121;
+334.05841206239;
+335.356055780735;
+332.555969575405;
+334.455685743296;
+332.096834219889;
+334.283363555992;
+334.621192110697;
+336.872733605949;
+345.269999696949;
+347.413845049847;
+359.175620722643;
+361.089803167229;
+370.280064807361;
+372.091713846691;
+377.803437838339;
+380.722367973375;
+382.262749115993;
+400.605257332053;
+399.059844781516;
+421.045322645595;
+407.797244575344;
+408.293866893346;
+418.149048167904;
+516.456861329423;
+429.74682920346;
+333.058779889562;
+334.191528216076;
+335.17707984307;
+330.969349401776;
+332.791408904326;
+328.855471387183;
+331.286567445605;
+329.983418921016;
+332.875369872246;
+339.756573316259;
+342.999284316488;
+353.764055509579;
+357.229357259679;
+366.043759112577;
+369.800182325414;
+375.076990958454;
+381.43633914932;
+380.928836724901;
+393.599832009588;
+387.870635264972;
+409.474722571733;
+398.436744420167;
+399.285785342979;
+410.865844881638;
+516.180382702771;
+428.975978623599;
+330.578800516666;
+332.240222206072;
+333.196990939124;
+329.566775088822;
+331.275716160783;
+327.950818903327;
+330.178787127489;
+329.487229942319;
+332.076506529155;
+339.502888171931;
+342.338235148155;
+353.481148689774;
+356.450576748856;
+365.49734482258;
+368.65890121415;
+374.287392615596;
+379.443675965765;
+379.894580371574;
+393.728499970085;
+390.111164588687;
+412.022146504968;
+409.370730210662;
+410.468087568465;
+388.78678709188;
+496.009948280042;
+391.870471608875;
+291.554587201242;
+287.820101557484;
+288.775902705383;
+284.742743654585;
+286.450402369707;
+282.880526467407;
+285.10972284341;
+282.309885928649;
+284.904505882739;
+282.97879599754;
+285.82730765039;
+284.772323472264;
+287.769456298023;
+287.236026623568;
+290.445583880158;
+289.414197587235;
+294.672714083078;
+290.631200759539;
+304.318668198942;
+297.601983042012;
+319.611373790498;
+297.575136076675;
+298.813099369847;
+267.890532225764;
+376.171597486126;
+268.150460535537;
+167.0711765497;
+162.802251342861;
+163.745009732923;
+159.952897457419;
+161.640113104622;
+158.11367347849;
+160.313863208597;
+156.97326638875;
+159.529521424212;
+156.436303907444;
+159.242415523113;
+156.513731267917;
+159.499165260886;
+156.990502222696;
+160.300440850203;
+157.358374909155;
+162.751156069831;
+157.228867146545;
+168.161442459281;
+159.93381647199;
+181.196653397019;
+162.892883627006;
+165.99475863583;
+137.333112824616;
+265.295295973161;
+149.77581382753;
+39.1344919798863;
+36.3862309664734;
+35.7240251879317;
+33.8691980324624;
+33.9182370248815;
+32.6302238859321;
+33.1317395883266;
+32.1660129599792;
+32.9486519307245;
+32.1287009791263;
+33.0963473478947;
+32.2932875181141;
+33.411732140065;
+32.5166696833576;
+33.805200345572;
+32.6908579874069;
+34.2280954220368;
+32.6922437254624;
+35.4487951603893;
+37.3413904412673;
+33.4855798502711;
+29.9281213594068;
+26.6833614508457;
+23.7584038699366;
+21.1535798800178;
+18.8630611676933;
+16.8755808826275;
+15.1752294456112;
+13.7422936888424;
+12.5541104632028;
+11.5859089074876;
+10.8116189832323;
+10.2046274995908;
+9.73846655942902;
+9.38742304034984;
+9.12706128067974;
+8.934654488041;
+8.78952346432856;
+8.67328398254784;
+8.57000653415271;
+8.46629415847192;
+8.351285663524;
+8.21592095641882;];
+figure;semilogy (OBJ3(:,1));
+legend ('Limit = 24');
+
+
+OBJ4= [
+18.0628024021877;
+18.6181641833558;
+18.2982760558724;
+18.8878324305932;
+19.7151528642252;
+20.4420930680747;
+57.1557526175807;
+58.2614396312856;
+72.9390970115926;
+74.5246825505222;
+80.7170667623034;
+82.8669240518838;
+80.7702421353728;
+82.9372672775947;
+80.6373260298876;
+82.8163391152925;
+82.6028238802097;
+84.7877365108597;
+90.4076299448028;
+92.576624175112;
+102.137934372888;
+104.306052745836;
+112.197472101902;
+114.373363645799;
+119.839400859601;
+122.02319841252;
+125.451769886625;
+127.639403672249;
+129.589508151293;
+131.775312986135;
+139.948076049421;
+142.134850181915;
+181.005856453647;
+183.198267584046;
+198.775781340358;
+200.967577902961;
+204.512972951772;
+206.705778070403;
+204.874965142626;
+207.068194285235;
+205.262868173661;
+207.467710437487;
+208.109291469619;
+210.338472846309;
+219.022748309758;
+221.285015932182;
+233.147420525724;
+235.457434947972;
+244.814214022908;
+247.180107107768;
+253.486244271949;
+255.908571215694;
+259.642258848072;
+262.117614261717;
+263.822390500617;
+266.362167895912;
+275.023031430221;
+277.721641945783;
+4561.30570422609;
+22773.1204908764;
+184129.515299662;
+137979.422793331;
+13208.7178432274;
+7116.93331569176;
+683.084310044237;
+687.573601049498;
+640.458343835363;
+645.712524456111;
+637.486595821078;
+643.900135655354;
+645.386112353345;
+652.409156180488;
+657.0641693922;
+664.297356079558;
+666.272056824524;
+673.380437997179;
+671.961422975181;
+679.553937375652;
+674.012024910382;
+762.16676378133;
+747.263106553821;
+782.55927806412;
+678.796425552154;
+678.050377853847;
+611.405269793486;
+576.849387162026;
+546.909356225429;
+513.738007875819;
+481.314921655007;
+465.044153341868;
+445.179810750017;
+444.67692934279;
+439.332237071767;
+443.926945100922;
+437.395568497695;
+441.474431840011;
+445.04432888811;
+450.481864471021;
+455.907968227016;
+460.006348591077;
+464.237962952353;
+471.842970737644;
+474.162505052098;
+487.077564449853;
+482.462946974272;
+502.553976851531;
+485.93805753634;
+528.228301784293;
+507.062925680677;
+545.662364742763;
+486.127557367235;
+581.422069997858;
+462.692196038299;
+331.896281525988;
+334.011234253847;
+335.353376112353;
+332.435640327387;
+334.416599407795;
+331.958565119442;
+334.251190282621;
+334.505045791812;
+336.877058080887;
+345.205721414156;
+347.473860678568;
+359.184318258525;
+361.214501236657;
+370.349575686772;
+372.270454924171;
+377.877663414298;
+381.003013399507;
+382.274159698647;
+400.309786208429;
+398.458068607506;
+420.22926398552;
+406.995448188799;
+407.47264158678;
+417.506976548041;
+515.547596894588;
+429.246194043732;
+332.949054121226;
+334.117814193204;
+335.127190023524;
+330.950213234565;
+332.786221524837;
+328.875768584942;
+331.311736307199;
+330.029216714671;
+332.918071091127;
+339.815099294013;
+343.047976198664;
+353.822509376219;
+357.272765710999;
+366.09083579153;
+369.828775362844;
+375.108114704096;
+381.443258449048;
+380.940361592004;
+393.614273517987;
+387.938335180483;
+409.572112781832;
+398.53936556242;
+399.387857037484;
+410.944941056168;
+516.228565581265;
+429.015704023909;
+330.600676649748;
+332.257420199976;
+333.199447729475;
+329.56502840943;
+331.261320391877;
+327.933591869328;
+330.151543049957;
+329.459174617917;
+332.041305728398;
+339.469389382988;
+342.300423186546;
+353.447959889191;
+356.415590473279;
+365.469765870398;
+368.631641173813;
+374.269234303975;
+379.42910621707;
+379.888054906997;
+393.717488463033;
+390.107399573688;
+412.043631786925;
+409.403733276284;
+410.495802706209;
+388.804377803958;
+496.021362339334;
+391.879261558043;
+291.565740865544;
+287.826542457712;
+288.782785556854;
+284.746335102679;
+286.455701119179;
+282.883448697304;
+285.115069031375;
+282.313309791092;
+284.910600894035;
+282.983012128188;
+285.834066131462;
+284.776893936569;
+287.77616681605;
+287.239989705466;
+290.451101679738;
+289.416328186521;
+294.675547519055;
+290.630172598427;
+304.319162142012;
+297.5976564928;
+319.593398005942;
+297.550968577573;
+298.790380286918;
+267.874747801554;
+376.159402828995;
+268.141211606949;
+167.064711928645;
+162.798199973477;
+163.743017535778;
+159.952635255486;
+161.641123221057;
+158.115805089613;
+160.316594844414;
+156.976615717495;
+159.532941615661;
+156.439962099967;
+159.245772662463;
+156.517079387795;
+159.501998025376;
+156.993206178894;
+160.302563569505;
+157.360362083292;
+162.752650664259;
+157.230303531357;
+168.162086870916;
+159.934866053877;
+181.199133526129;
+162.896507178031;
+165.998581169434;
+137.336061871176;
+265.29760880579;
+149.77780247624;
+39.1358785402543;
+36.3871960983718;
+35.7243259282924;
+33.8691206900767;
+33.9175617993311;
+32.6292569545905;
+33.1302761718948;
+32.1643672549852;
+32.9466241894232;
+32.1266075187403;
+33.0939811850819;
+32.2909682572285;
+33.4092302270511;
+32.5143173967243;
+33.802725594502;
+32.6886250486315;
+34.2257623164832;
+32.690238761977;
+35.4469081277041;
+37.3396295741692;
+33.4839596090467;
+29.9266418196796;
+26.6820192004065;
+23.757192607972;
+21.1524910162787;
+18.8620844038741;
+16.8747047637851;
+15.1744418678326;
+13.7415823560752;
+12.5534632861826;
+11.5853143409176;
+10.8110663002871;
+10.2041070033784;
+9.73796973490284;
+9.38694264857907;
+9.12659140109675;
+8.93419051454881;
+8.78906206089395;
+8.67282300511221;
+8.56954492587686;
+8.46583182440614;
+8.35082333118465;
+8.21546008029483;];
+figure;semilogy (OBJ4(:,1));
+legend ('Limit = 23');
+
+
+OBJ5= [
+18.0628024021877;
+18.6181641833558;
+18.2982760558724;
+18.8878324305932;
+19.7151528642252;
+20.4420930680747;
+57.1557526175807;
+58.2614396312856;
+72.9390970115926;
+74.5246825505222;
+80.7170667623034;
+82.8669240518838;
+80.7702421353728;
+82.9372672775947;
+80.6373260298876;
+82.8163391152925;
+82.6028238802097;
+84.7877365108597;
+90.4076299448028;
+92.576624175112;
+102.137934372888;
+104.306052745836;
+112.197472101902;
+114.373363645799;
+119.839400859601;
+122.02319841252;
+125.451769886625;
+127.639403672249;
+129.589508151293;
+131.775312986135;
+139.948076049421;
+142.134850181915;
+181.005856453647;
+183.198267584046;
+198.775781340358;
+200.967577902961;
+204.512972951772;
+206.705778070403;
+204.874965142626;
+207.068194285235;
+205.262868173661;
+207.467710437487;
+208.109291469619;
+210.338472846309;
+219.022748309758;
+221.285015932182;
+233.147420525724;
+235.457434947972;
+244.814214022908;
+247.180107107768;
+253.486244271949;
+255.908571215694;
+259.642258848072;
+262.117614261717;
+263.822390500617;
+266.362167895912;
+275.023031430221;
+277.721641945783;
+4561.30570422609;
+5164583.0373425;
+10786892.6372221;
+10654967.1621864;
+17645244.2051213;
+17777134.9443235;
+20602045.2388171;
+4217908.90268967;
+7151075.9485776;
+3483427.03305753;
+6288056.89570605;
+6301696.07669389;
+8597095.73112968;
+8594365.10636753;
+14282860.9369378;
+14255033.0455532;
+23355955.6624694;
+23236809.1320903;
+37107831.3611139;
+36745533.9505064;
+57019295.5165169;
+3377329.95899061;
+5451118.17030588;
+1519.77953837125;
+1475.20937515139;
+1141.47395009557;
+1166.53702810169;
+1048.44989225382;
+1003.6086012436;
+786.888531613821;
+754.756441446299;
+765.166990100073;
+742.590670114247;
+741.129686250056;
+722.712921001649;
+724.321716480419;
+710.495474411988;
+713.579951749728;
+708.352840667498;
+711.939714860374;
+710.393276548143;
+713.890833731344;
+709.568262154633;
+709.282736311194;
+692.767518555426;
+692.934525623653;
+682.142120881901;
+757.986118245983;
+698.253544249956;
+838.348369035119;
+726.559372518756;
+938.097567084329;
+917.39193790558;
+3061676.51405909;
+3152846.60203888;
+3007993.12263723;
+4839918.91068144;
+4725388.09944081;
+3630976.61448044;
+3567076.47388337;
+786.049843107777;
+789.994928745353;
+778.374203233995;
+784.812067273795;
+784.416336794037;
+792.199141673836;
+795.215099602107;
+803.610276891095;
+804.039063739632;
+812.486574069446;
+809.489237747242;
+817.463730182491;
+811.154835136886;
+937.748874819585;
+920.621565551781;
+920.943981304262;
+762.099563565367;
+742.444263229407;
+639.420568534127;
+583.43049934999;
+536.015986370055;
+496.163492960039;
+466.143389016691;
+455.107258325215;
+449.174420191829;
+455.778191309518;
+445.853991015563;
+448.102558616829;
+442.296099161531;
+447.039421053247;
+450.695985921228;
+456.477590971969;
+461.65798524203;
+464.869737805929;
+468.441051645546;
+475.263765752781;
+477.499704686929;
+489.729090574856;
+485.969067692728;
+506.168701605924;
+490.26994684748;
+533.283016005278;
+512.110067019465;
+562.623317900725;
+492.801958901296;
+579.309526378272;
+462.135821751403;
+331.891286810737;
+334.371614923502;
+335.616882155414;
+333.002251981663;
+334.786426138378;
+332.58010891356;
+334.605821221296;
+335.066215110125;
+337.128525968809;
+345.617262352773;
+347.56160314603;
+359.381031935153;
+361.106763290967;
+370.357767590001;
+371.989519833834;
+377.840778837242;
+380.412746444719;
+382.364794971408;
+401.220827456155;
+400.15088530225;
+422.428906993177;
+417.776457385291;
+418.333679450554;
+395.081528665556;
+494.025230360844;
+391.545540809074;
+294.094986945491;
+289.795551421658;
+290.741803997839;
+286.113545383046;
+287.907278055658;
+283.718863784918;
+286.134173586416;
+282.726529407168;
+285.614528331326;
+283.163573115273;
+286.414529475401;
+285.002117433223;
+288.491920622072;
+287.743872762447;
+291.545074892059;
+290.178397889314;
+296.620848721826;
+291.678104523389;
+304.348233430189;
+295.436340428036;
+317.134839290729;
+295.338876608869;
+296.303565566492;
+265.818424650231;
+372.097146849413;
+266.071781222968;
+167.011545516384;
+162.744156892956;
+163.715271175551;
+159.931922749658;
+161.647870004817;
+158.134874569397;
+160.360488376839;
+157.035684815865;
+159.61100011331;
+156.53205162844;
+159.34809301827;
+156.62533935248;
+159.609572636976;
+157.092615446926;
+160.390341825503;
+157.429597348577;
+162.792471038182;
+157.254613861123;
+168.247026157191;
+160.021907137893;
+181.212461401671;
+162.854415860192;
+165.938843903727;
+137.300376898584;
+265.068469193043;
+149.662022593361;
+39.1409163653179;
+36.4001403631106;
+35.7406126075381;
+33.8921815726886;
+33.9424354284142;
+32.6599101897746;
+33.161333630347;
+32.2003883826334;
+32.9818517324299;
+32.1662075582976;
+33.1318963314225;
+32.3329259945952;
+33.4489991817748;
+32.5580768281577;
+33.8442326334244;
+32.734335593136;
+34.2696204843832;
+32.7387245355949;
+35.509296469329;
+37.416479145057;
+33.5517187719296;
+29.9856417566222;
+26.7326836376952;
+23.8000230599114;
+21.1880514531249;
+18.890985781186;
+16.8975898126189;
+15.1919705019592;
+13.7544179990568;
+12.5622603684172;
+11.5907071615248;
+10.8136593929547;
+10.2044670920909;
+9.73661931555385;
+9.38435518841049;
+9.12318810494909;
+8.93033857307228;
+8.78507426766696;
+8.6689586056561;
+8.56601154542519;
+8.46278831058985;
+8.34838334206524;
+8.21369579353619;];
+figure;semilogy (OBJ5(:,1));
+legend ('Limit = 22');
+
+
+OBJ6= [
+18.0628024021877;
+18.6181641833558;
+18.2982760558724;
+18.8878324305932;
+19.7151528642252;
+20.4420930680747;
+57.1557526175807;
+58.2614396312856;
+72.9390970115926;
+74.5246825505222;
+80.7170667623034;
+82.8669240518838;
+80.7702421353728;
+82.9372672775947;
+80.6373260298876;
+82.8163391152925;
+82.6028238802097;
+84.7877365108597;
+90.4076299448028;
+92.576624175112;
+102.137934372888;
+104.306052745836;
+112.197472101902;
+114.373363645799;
+119.839400859601;
+122.02319841252;
+125.451769886625;
+127.639403672249;
+129.589508151293;
+131.775312986135;
+139.948076049421;
+142.134850181915;
+181.005856453647;
+183.198267584046;
+198.775781340358;
+200.967577902961;
+204.512972951772;
+206.705778070403;
+204.874965142626;
+207.068194285235;
+205.262868173661;
+207.467710437487;
+208.109291469619;
+210.338472846309;
+219.022748309758;
+221.285015932182;
+233.147420525724;
+235.457434947972;
+244.814214022908;
+247.180107107768;
+253.486244271949;
+255.908571215694;
+259.642258848072;
+262.117614261717;
+263.822390500617;
+266.362167895912;
+275.023031430221;
+277.721641945783;
+4561.30570422609;
+76116898.7289478;
+144563388.612257;
+146788702.315927;
+172526763.320857;
+180072810.623151;
+282837320.414729;
+300641914.15425;
+530445823.742712;
+574726716.665696;
+1017530108.01013;
+1100631787.42022;
+1997854071.15318;
+2159934688.78514;
+3856424463.3909;
+4212412745.619;
+7615516345.63534;
+8592171789.2108;
+15705283316.7089;
+17753243079.336;
+31427589719.2196;
+32330610021.2369;
+59346329949.2188;
+59814845838.6048;
+107952050521.514;
+109220407236.031;
+193632478658.678;
+199384740313.038;
+342535601395.538;
+356508927011.511;
+602214940074.834;
+618945599345.346;
+1049106503427.92;
+1067726757651.77;
+1797242870967.66;
+1827970081188.59;
+3061754723100.49;
+3101017567896.78;
+5168731713884.17;
+5223381794276.84;
+8693085374018.58;
+8766737850370.27;
+14544813530511.4;
+14606346439044.3;
+24233263905864.5;
+24310796047889.4;
+40253807878893.2;
+40326157652900.5;
+66690356148294.3;
+66773261751189.4;
+110353242497128;
+110389277213581;
+182443479973609;
+182576316775305;
+301599845744235;
+301775354333797;
+498274710620222;
+498297287669736;
+822651912912224;
+822437317505223;
+1.35740889592461e+15;
+1.35696636622531e+15;
+2.23939228367687e+15;
+2.23850184380404e+15;
+3.69371361872277e+15;
+3.69159766571449e+15;
+6.09113382539547e+15;
+6.08736889492597e+15;
+1.00430976126188e+16;
+1.00354868977168e+16;
+1.65560792765165e+16;
+1.65428753023887e+16;
+2.72905778510362e+16;
+2.72662878076652e+16;
+4.49788280897067e+16;
+4.49380965695385e+16;
+7.4129027675178e+16;
+7.40597819065606e+16;
+1.22166683568886e+17;
+1.22053878166351e+17;
+2.01333403993454e+17;
+2.01148032527334e+17;
+3.31795803063957e+17;
+3.31484143185314e+17;
+5.46784086417965e+17;
+5.46263928053565e+17;
+9.01054474672552e+17;
+9.00195087298469e+17;
+1.48485242621436e+18;
+1.48343207117566e+18;
+2.44687741523965e+18;
+2.44451991830891e+18;
+4.03215563394318e+18;
+4.02826353343842e+18;
+6.64446225328854e+18;
+6.63801167734609e+18;
+1.09491221615033e+19;
+1.09384738730986e+19;
+1.804252809797e+19;
+1.8024927609607e+19;
+2.97312674971805e+19;
+2.97022425832688e+19;
+4.89924101715012e+19;
+4.89445214000872e+19;
+8.07315940547125e+19;
+8.06527550134807e+19;
+1.33032624670357e+20;
+1.32902676888498e+20;
+2.1921605458243e+20;
+2.19001752931338e+20;
+3.61231955885186e+20;
+3.60878642168522e+20;
+5.95250251197922e+20;
+5.94667975554565e+20;
+9.80873266163034e+20;
+9.79913636343597e+20;
+1.61631528280614e+21;
+1.61473347321327e+21;
+2.66341665481411e+21;
+2.66080974943328e+21;
+4.38886320685019e+21;
+4.38456608938266e+21;
+7.23210725695136e+21;
+7.22502470581442e+21;
+1.19172930392161e+22;
+1.19056205306803e+22;
+1.96376849598861e+22;
+1.96184501790546e+22;
+3.23595844217147e+22;
+3.23278873420849e+22;
+5.33231207569912e+22;
+5.32709214958923e+22;
+8.78674817416454e+22;
+8.77814601130217e+22;
+1.44790740368758e+23;
+1.44648980324349e+23;
+2.38590629239548e+23;
+2.38357020278715e+23;
+3.93156953775198e+23;
+3.92771992911946e+23;
+6.47856075537398e+23;
+6.47221702064481e+23;
+1.06755708049899e+24;
+1.06651168432784e+24;
+1.75915322534279e+24;
+1.75743047305695e+24;
+2.89878649073102e+24;
+2.89594736930028e+24;
+4.77670899116842e+24;
+4.77202980144173e+24;
+7.87120705511369e+24;
+7.86349650780473e+24;
+1.29704154418996e+25;
+1.29577097519282e+25;
+2.13730467480885e+25;
+2.13521098842318e+25;
+3.52191591929921e+25;
+3.51846794896423e+25;
+5.8035206140082e+25;
+5.79783851615379e+25;
+9.56321849753531e+25;
+9.55385489829109e+25;
+1.57585634633126e+26;
+1.5743133292959e+26;
+2.59674420449337e+26;
+2.5942014981739e+26;
+4.27899438713866e+26;
+4.27480430227155e+26;
+7.05105759945043e+26;
+7.04415274937083e+26;
+1.16189479912101e+27;
+1.16075692283262e+27;
+1.91460572401236e+27;
+1.91273050221121e+27;
+3.15494576605154e+27;
+3.15185519771585e+27;
+5.19881595377539e+27;
+5.19372322008344e+27;
+8.5667676459483e+27;
+8.55837568398971e+27;
+1.41165812655666e+28;
+1.41027527321134e+28;
+2.3261733577469e+28;
+2.32389601610861e+28;
+3.83313947506168e+28;
+3.82938652091155e+28;
+6.31636424968839e+28;
+6.31017971679364e+28;
+1.04082978434644e+29;
+1.03981064280342e+29;
+1.71511109412785e+29;
+1.713431671749e+29;
+2.82621242141379e+29;
+2.82344492871155e+29;
+4.65711910915222e+29;
+4.65255855372305e+29;
+7.6741430447492e+29;
+7.66662753416567e+29;
+1.2645687192109e+30;
+1.26333016234835e+30;
+2.08379494135864e+30;
+2.08175366599943e+30;
+3.43374092024129e+30;
+4.40781944402552e+30;
+5.65822311653067e+30;
+7.26333944549701e+30;
+9.32379279041704e+30;
+1.19687524796159e+31;
+1.5364030404609e+31;
+1.97224757279986e+31;
+2.53173183466662e+31;
+3.24992976087831e+31;
+4.17186500798185e+31;
+5.35533347653494e+31;
+6.87452652231505e+31;
+8.8246819947021e+31;
+1.13280546747211e+32;
+1.45415803980801e+32;
+1.8666714325247e+32;
+2.39620601173682e+32;
+3.07595817380522e+32;
+3.94854141950021e+32;
+5.06865778419218e+32;
+6.50652709539057e+32;
+8.3522890369676e+32;
+1.07216539844222e+33;
+1.37631568606976e+33;
+1.68212381781783e+33;];
+figure;semilogy (OBJ6(:,1));
+legend ('Limit = 21');
+
+
+OBJ7= [
+18.0628024021877;
+18.6181641833558;
+18.2982760558724;
+18.8878324305932;
+19.7151528642252;
+20.4420930680747;
+57.1557526175807;
+58.2614396312856;
+72.9390970115926;
+74.5246825505222;
+80.7170667623034;
+82.8669240518838;
+80.7702421353728;
+82.9372672775947;
+80.6373260298876;
+82.8163391152925;
+82.6028238802097;
+84.7877365108597;
+90.4076299448028;
+92.576624175112;
+102.137934372888;
+104.306052745836;
+112.197472101902;
+114.373363645799;
+119.839400859601;
+122.02319841252;
+125.451769886625;
+127.639403672249;
+129.589508151293;
+131.775312986135;
+139.948076049421;
+142.134850181915;
+181.005856453647;
+183.198267584046;
+198.775781340358;
+200.967577902961;
+204.512972951772;
+206.705778070403;
+204.874965142626;
+207.068194285235;
+205.262868173661;
+207.467710437487;
+208.109291469619;
+210.338472846309;
+219.022748309758;
+221.285015932182;
+233.147420525724;
+235.457434947972;
+244.814214022908;
+247.180107107768;
+253.486244271949;
+255.908571215694;
+259.642258848072;
+262.117614261717;
+263.822390500617;
+266.362167895912;
+275.023031430221;
+277.721641945783;
+4561.30570422609;
+101270063.892114;
+201312474.845655;
+142467706.43308;
+241522188.623407;
+241017974.823972;
+393325782.648471;
+419949455.986312;
+743365150.424885;
+807255368.572177;
+1440981068.99752;
+1562984109.4874;
+2801201420.57887;
+3042983802.80494;
+5403216514.25088;
+6116043687.89517;
+11252679800.8113;
+12525719872.5998;
+23366423757.2748;
+26631974288.3875;
+46395919999.227;
+48333652501.7023;
+85417280149.2433;
+88788811189.4669;
+156899794326.316;
+161822881344.976;
+282042897518.988;
+288689797522.375;
+491726633632.633;
+509520937943.164;
+858834616303.281;
+881224524715.75;
+1487884048283.24;
+1511044845444.4;
+2535505582765.52;
+2567255742623.57;
+4285696571297.17;
+4333006602782.23;
+7217978424911.21;
+7283483682676.45;
+12086696993292.4;
+12165657435396.3;
+20201148379741.2;
+20291119570224.9;
+33640121277775;
+33721835102639.2;
+55752718394777.6;
+55818275500172.2;
+92264967210010.8;
+92396258024975.2;
+152617150744069;
+152757483025033;
+252338584129549;
+252460207214474;
+416936159842852;
+417025143008311;
+688572954933684;
+688627377078552;
+1.136547927973e+15;
+1.13619617847769e+15;
+1.87520823515078e+15;
+1.87426467865061e+15;
+3.09285916838848e+15;
+3.09125255983647e+15;
+5.10068383167191e+15;
+5.0976338658251e+15;
+8.41009482126604e+15;
+8.40431706643446e+15;
+1.38660367876825e+16;
+1.38551435709453e+16;
+2.28579612218443e+16;
+2.28383801535468e+16;
+3.7674545877435e+16;
+3.76403013289838e+16;
+6.20906877285408e+16;
+6.20350461497559e+16;
+1.023290048223e+17;
+1.0223540126837e+17;
+1.6864155488822e+17;
+1.6848484879235e+17;
+2.77920561973016e+17;
+2.77660794341797e+17;
+4.58004177848737e+17;
+4.57574801143993e+17;
+7.54762644996009e+17;
+7.54043543558277e+17;
+1.2437825420027e+18;
+1.24258769098437e+18;
+2.04961601259823e+18;
+2.04764557494252e+18;
+3.37752737025599e+18;
+3.37427010029612e+18;
+5.56572237314328e+18;
+5.56033522017874e+18;
+9.1715638121339e+18;
+9.16265035120491e+18;
+1.51134167525723e+19;
+1.50986843778887e+19;
+2.49045682165494e+19;
+2.4880253558682e+19;
+4.10387721101417e+19;
+4.09987210406735e+19;
+6.76253314234713e+19;
+6.7559278184775e+19;
+1.11435651835747e+20;
+1.113268001572e+20;
+1.83627832307568e+20;
+1.83448362681004e+20;
+3.02588529228115e+20;
+3.0229274599878e+20;
+4.98615884599809e+20;
+4.98128170053752e+20;
+8.2163605888811e+20;
+8.20832111497463e+20;
+1.35391886069671e+21;
+1.35259401154741e+21;
+2.23103159417754e+21;
+2.22884811169146e+21;
+3.67636530155826e+21;
+3.67276656100324e+21;
+6.05803202764541e+21;
+6.05210038918392e+21;
+9.98261612578575e+21;
+9.97283906570472e+21;
+1.64496652220988e+22;
+1.64335529668637e+22;
+2.71062667670107e+22;
+2.70797170260346e+22;
+4.46665432057494e+22;
+4.46227924615213e+22;
+7.36029071482098e+22;
+7.35308548981853e+22;
+1.21285135857166e+23;
+1.21166396018802e+23;
+1.99857374800983e+23;
+1.99661701312495e+23;
+3.29331116227519e+23;
+3.29008660670735e+23;
+5.42681908096891e+23;
+5.42150533737947e+23;
+8.94247863933402e+23;
+8.933722198514e+23;
+1.47356900155323e+24;
+1.47212601961407e+24;
+2.42819207273082e+24;
+2.42581411581101e+24;
+4.00124915713788e+24;
+3.99733025847427e+24;
+6.59338066906059e+24;
+6.58692187344271e+24;
+1.08647740990979e+25;
+1.08541310732757e+25;
+1.79033066238503e+25;
+1.78857687311305e+25;
+2.9501615479292e+25;
+2.9472715967354e+25;
+4.86136630104992e+25;
+4.85660700134303e+25;
+8.01070785308014e+25;
+8.00286474073246e+25;
+1.32002890226117e+26;
+1.31873642732141e+26;
+2.17518393245336e+26;
+2.17305407704757e+26;
+3.58433450015422e+26;
+3.58082475369948e+26;
+5.90637582728612e+26;
+5.90059217325762e+26;
+9.73270642115802e+26;
+9.72317552717876e+26;
+1.6037850790869e+27;
+1.6022144469507e+27;
+2.6427660182321e+27;
+2.64017761435186e+27;
+4.35483052947848e+27;
+4.35056455993641e+27;
+7.17602269806585e+27;
+7.16899310287208e+27;
+1.18248692822158e+28;
+1.18132856998909e+28;
+1.94853806080585e+28;
+1.9466292825862e+28;
+3.21086050397576e+28;
+3.20771704672003e+28;
+5.29095396328772e+28;
+5.28577369049868e+28;
+8.71859546867456e+28;
+8.71005884252742e+28;
+1.43667677839338e+29;
+1.43527003829305e+29;
+2.36739985572614e+29;
+2.36508171766466e+29;
+3.90107375644789e+29;
+3.89725373462154e+29;
+6.4283084313666e+29;
+6.4220134115417e+29;
+1.05927628822187e+30;
+1.05823890826635e+30;
+1.74550780624306e+30;
+1.74379820308704e+30;
+2.87630105149039e+30;
+2.87348344100844e+30;
+4.73965668281334e+30;
+6.08419545031785e+30;
+7.81015097819732e+30;
+1.00257230064836e+31;
+1.28698052167326e+31;
+1.65206924437703e+31;
+2.12072579363259e+31;
+2.72233013663578e+31;
+3.49459670603533e+31;
+4.48593870871249e+31;
+5.75850313816321e+31;
+7.39206675468476e+31;
+9.48903727143451e+31;
+1.21808732695212e+32;
+1.56363253050726e+32;
+2.0072014841316e+32;
+2.5766014196395e+32;
+3.30752788306141e+32;
+4.24580247990322e+32;
+5.45024542065695e+32;
+6.996362945755e+32;
+8.98108079375807e+32;
+1.15288204527675e+33;
+1.47992991138125e+33;
+1.89975423034284e+33;
+2.32186690248756e+33;];
+figure;semilogy (OBJ7(:,1));
+legend ('Limit = 20');
+
+
+OBJ8= [
+18.0628024021877;
+18.6181641833558;
+18.2982760558724;
+18.8878324305932;
+19.7151528642252;
+20.4420930680747;
+57.1557526175807;
+58.2614396312856;
+72.9390970115926;
+74.5246825505222;
+80.7170667623034;
+82.8669240518838;
+80.7702421353728;
+82.9372672775947;
+80.6373260298876;
+82.8163391152925;
+82.6028238802097;
+84.7877365108597;
+90.4076299448028;
+92.576624175112;
+102.137934372888;
+104.306052745836;
+112.197472101902;
+114.373363645799;
+119.839400859601;
+122.02319841252;
+125.451769886625;
+127.639403672249;
+129.589508151293;
+131.775312986135;
+139.948076049421;
+142.134850181915;
+181.005856453647;
+183.198267584046;
+198.775781340358;
+200.967577902961;
+204.512972951772;
+206.705778070403;
+204.874965142626;
+207.068194285235;
+205.262868173661;
+207.467710437487;
+208.109291469619;
+210.338472846309;
+219.022748309758;
+221.285015932182;
+233.147420525724;
+235.457434947972;
+244.814214022908;
+247.180107107768;
+253.486244271949;
+255.908571215694;
+259.642258848072;
+262.117614261717;
+263.822390500617;
+266.362167895912;
+275.023031430221;
+277.721641945783;
+319208403.270405;
+809366695.022198;
+1280268859.53144;
+1324594478.95695;
+2380977748.47122;
+2616812972.73819;
+4677080441.79873;
+5149132501.02245;
+9306980473.3198;
+10193714795.0629;
+18266098183.3555;
+19671784374.115;
+34718162663.5924;
+36914261728.8651;
+64768893078.5904;
+69004278685.3285;
+119447074126.849;
+124144572413.43;
+214086859109.335;
+220938555059.291;
+378776224679.736;
+384803412673.233;
+657332700705.209;
+657317264053.686;
+1106449662841.57;
+1117083908186.02;
+1876476046053.06;
+1894294395332.82;
+3163508449831.01;
+3195315928176.44;
+5318022146040.55;
+5357613480567.85;
+8893179691312.26;
+8941628124040.45;
+14820149449008.8;
+14878801281021.9;
+24647732646747.7;
+24710763309262.7;
+40886802972303.1;
+40957298169007.9;
+67719469777990.3;
+67787845765739.5;
+112006236021796;
+112074004908430;
+185118758781960;
+185054480407076;
+305743849217201;
+305644190072957;
+504792224359659;
+504556050028932;
+833074935369025;
+832615841280431;
+1.37440729542143e+15;
+1.37381410612423e+15;
+2.2669017585874e+15;
+2.26566115796841e+15;
+3.73840464326375e+15;
+3.73592776475164e+15;
+6.16366441125593e+15;
+6.15913940347845e+15;
+1.01610206992528e+16;
+1.01529984290487e+16;
+1.67496018523948e+16;
+1.67355377963759e+16;
+2.76075574811909e+16;
+2.75834368612818e+16;
+4.55016146152576e+16;
+4.54605002349223e+16;
+7.49896524714176e+16;
+7.49208585651205e+16;
+1.23584807427433e+17;
+1.23466880905706e+17;
+2.0366495318597e+17;
+2.03468888911502e+17;
+3.35627653541183e+17;
+3.35303311146346e+17;
+5.53086183223451e+17;
+5.52550072293698e+17;
+9.1142914874775e+17;
+9.10552491197958e+17;
+1.50192919209652e+18;
+1.50048398123794e+18;
+2.47500040528323e+18;
+2.47260761116783e+18;
+4.07846912352634e+18;
+4.07451459072654e+18;
+6.72073797179051e+18;
+6.71420676426962e+18;
+1.10747907481526e+19;
+1.10640065517034e+19;
+1.8249559993501e+19;
+1.82317639192426e+19;
+3.00724148094039e+19;
+3.00430529575611e+19;
+4.95545189540351e+19;
+4.95061037412879e+19;
+8.16578245529264e+19;
+8.15779136477075e+19;
+1.34558722940897e+20;
+1.34427044433489e+20;
+2.21730621782399e+20;
+2.21513588202135e+20;
+3.65375321935759e+20;
+3.65017623611744e+20;
+6.02077680829489e+20;
+6.01488739752369e+20;
+9.92123383904905e+20;
+9.91152663473469e+20;
+1.63485314060918e+21;
+1.63325319256036e+21;
+2.69396317134163e+21;
+2.69132634251585e+21;
+4.4391976331815e+21;
+4.43485208245594e+21;
+7.31504932503215e+21;
+7.30788781071312e+21;
+1.20539662613018e+22;
+1.20421641545193e+22;
+1.98628995712498e+22;
+1.98434495365453e+22;
+3.27306993790893e+22;
+3.26986450141932e+22;
+5.393465529575e+22;
+5.38818232270518e+22;
+8.88751835243133e+22;
+8.87881240974884e+22;
+1.46451255416266e+23;
+1.46307795406702e+23;
+2.41326868624534e+23;
+2.41090469772824e+23;
+3.97665805899554e+23;
+3.97276498276514e+23;
+6.55285887204849e+23;
+6.54644325839187e+23;
+1.0798001399999e+24;
+1.0787428968774e+24;
+1.77932769377721e+24;
+1.77758546835049e+24;
+2.93203056859245e+24;
+2.92915958159926e+24;
+4.83148958379088e+24;
+4.82675851706578e+24;
+7.9614761558834e+24;
+7.95367980747051e+24;
+1.31191636178877e+25;
+1.31063156994423e+25;
+2.1618158504341e+25;
+2.15969851048436e+25;
+3.56230618083774e+25;
+3.55881656837786e+25;
+5.87007690863388e+25;
+5.86432661876228e+25;
+9.67289197954347e+25;
+9.66341647305903e+25;
+1.59392867610379e+26;
+1.59236727279629e+26;
+2.62652434032793e+26;
+2.62395295561615e+26;
+4.32806700194701e+26;
+4.32382947729487e+26;
+7.13192094942414e+26;
+7.12493788615296e+26;
+1.17521970845232e+27;
+1.17406897791109e+27;
+1.93656291556363e+27;
+1.93466665019582e+27;
+3.1911274958592e+27;
+3.18800267080785e+27;
+5.25843731212987e+27;
+5.25328790776466e+27;
+8.66501354078499e+27;
+8.65652764337669e+27;
+1.42784738498607e+28;
+1.42644890824409e+28;
+2.35285051211909e+28;
+2.35054567133613e+28;
+3.8770989039367e+28;
+3.8733009170523e+28;
+6.38880193812226e+28;
+6.38254349913046e+28;
+1.05276628774038e+29;
+1.05173500306018e+29;
+1.73478042881688e+29;
+1.73308206518758e+29;
+2.8586241516287e+29;
+2.85582532662617e+29;
+4.71052814779635e+29;
+4.70591593464566e+29;
+7.76215208917614e+29;
+7.75455168024662e+29;
+1.27907111824664e+30;
+1.27781866252776e+30;
+2.10769243724745e+30;
+2.10562853595143e+30;
+3.47311994355912e+30;
+3.46971883746548e+30;
+5.72311307338252e+30;
+5.71750826291119e+30;
+9.43072044236402e+30;
+9.42148370939166e+30;
+1.55402290539452e+31;
+1.55250059212546e+31;
+2.56076638602775e+31;
+3.2872007906516e+31;
+4.21970902812721e+31;
+5.41674981725706e+31;
+6.95336535935599e+31;
+8.92588571593956e+31;
+1.14579677172847e+32;
+1.47083469796004e+32;
+1.88807890029148e+32;
+2.42368631816293e+32;
+3.11123405274118e+32;
+3.99382430737631e+32;
+5.12678645444042e+32;
+6.58114562047345e+32;
+8.44807523441087e+32;
+1.0844612668079e+33;
+1.39209962810953e+33;
+1.78700838277685e+33;
+2.29394426636773e+33;
+2.94468696840921e+33;
+3.78003139354758e+33;
+4.85234508438214e+33;
+6.22885113020952e+33;
+7.9958423664444e+33;
+1.02640910518717e+34;
+1.25447033710022e+34;];
+figure;semilogy (OBJ8(:,1));
+legend ('Limit = 15');
@@ -0,0 +1,2037 @@
+
+
+OBJ0= [
+18.7660606082863;
+19.3838216717902;
+19.0278681244126;
+19.7167399597539;
+21.1920583204784;
+22.086945804222;
+58.3431226379782;
+59.5774708724757;
+75.0368812236363;
+76.7762170766638;
+82.8466365061635;
+85.0786194643877;
+82.8191799227582;
+85.1209792925728;
+82.6612054672077;
+84.8647640998151;
+84.5929145499492;
+86.8554121536731;
+93.3770831579163;
+95.607897784952;
+105.22807121206;
+107.415949946103;
+115.353456140782;
+117.543257321173;
+123.0349938614;
+125.236687038439;
+128.769581067049;
+130.992807744447;
+132.876120178142;
+135.087970436295;
+143.045334637749;
+145.276763128426;
+183.963521270568;
+186.208874706445;
+201.764621208144;
+203.99300688279;
+208.191097438495;
+210.435835637517;
+208.412555426888;
+210.660894476768;
+208.737738529116;
+211.018988025464;
+212.00678264918;
+214.331715198308;
+224.036435982137;
+226.393923741852;
+238.26842727804;
+240.811219703604;
+250.148335959756;
+252.7383753952;
+259.035710385856;
+261.599034805491;
+265.37276686081;
+268.218173095746;
+269.792304615668;
+272.724632674968;
+280.906380803732;
+284.063210124256;
+322.08610002834;
+322.123646580603;
+334.99185390609;
+335.683444656234;
+338.387854640343;
+339.628971420472;
+335.353311461545;
+337.012466499085;
+332.506463480446;
+334.540899218977;
+332.526567739832;
+334.925299889359;
+341.732625706161;
+344.481896831816;
+354.196377901522;
+357.612392572255;
+365.737803021984;
+370.519278317985;
+376.098741387026;
+383.64278145497;
+385.400723663424;
+399.161775413797;
+393.275947291605;
+418.409553449141;
+409.105111111213;
+410.504567822902;
+420.409213565446;
+523.689638985462;
+436.149375060431;
+337.596717122572;
+339.318013528965;
+340.169965980898;
+336.158422261202;
+337.867170950778;
+334.296761262088;
+336.755452237339;
+336.245709376135;
+339.072601962554;
+347.368557645142;
+350.468862754613;
+361.581911513685;
+364.851264508128;
+373.934345458373;
+377.624330611782;
+383.430665053579;
+389.638604125282;
+390.748849073917;
+406.935421179705;
+401.79897760493;
+425.489111201722;
+413.458536260167;
+414.893655358596;
+424.299344089749;
+518.247786662228;
+433.504442198095;
+339.070224360315;
+340.52486461917;
+341.776637388993;
+337.381767779058;
+339.552473705006;
+335.519400449913;
+338.197481994041;
+337.229728062115;
+340.410040073849;
+348.169674586761;
+351.711742370594;
+362.298095750828;
+366.048107104605;
+374.621432899607;
+379.056550523044;
+384.385927246163;
+391.826193201968;
+392.140669373422;
+407.506670713616;
+400.892885191671;
+424.557995465878;
+412.726513023053;
+414.083348317148;
+423.551169278606;
+517.087969889352;
+432.92553408454;
+538.71456763088;
+492.532985594364;
+472.901318507012;
+462.956528896094;
+470.184515352234;
+461.763785445784;
+465.982653735557;
+461.146161577075;
+467.161589125928;
+471.94115661002;
+478.522856140114;
+484.469005812524;
+487.479292536384;
+490.031157445184;
+494.766367332517;
+497.052475160021;
+507.777234778752;
+506.775721289154;
+528.297647906709;
+514.712941697149;
+563.250092682567;
+535.251957589626;
+602.970354610723;
+514.043130339542;
+584.932658023608;
+470.263375713857;
+339.873175527677;
+343.35387342783;
+344.272083964819;
+341.880375963312;
+343.173141362317;
+341.007258282245;
+342.537902630776;
+343.45971931536;
+344.936580978281;
+354.61515553467;
+356.094249722822;
+368.099703564301;
+369.561638886355;
+379.153671934251;
+380.545403984801;
+387.098158060433;
+389.136831874719;
+392.625560721632;
+413.995326830402;
+413.82829338655;
+438.779351856359;
+432.609842119473;
+434.376199176928;
+408.711540475708;
+497.028882720695;
+396.617816071994;
+302.495915055501;
+297.237743885968;
+298.197587268885;
+292.826751975797;
+294.833612760342;
+289.943790520458;
+292.803570599064;
+288.72369735925;
+292.04489619927;
+288.947485029077;
+292.688491781359;
+290.657876965743;
+294.910183509071;
+293.5885458924;
+298.775886297266;
+297.18103501507;
+305.572143626654;
+300.965125377075;
+316.20026281852;
+305.487162606209;
+329.695507377497;
+307.330845467812;
+308.451952212319;
+275.77110490455;
+369.543987965386;
+266.700846703083;
+172.456114302082;
+167.261591473223;
+168.457838826969;
+163.914772430398;
+166.03062330791;
+161.890649977613;
+164.589991643599;
+160.567310084354;
+163.73108141822;
+159.988014391496;
+163.472779840295;
+160.157502010494;
+163.938595550388;
+161.055346633599;
+165.461923117902;
+162.234907897164;
+169.414711424031;
+164.065803141464;
+176.979667525948;
+167.067597604337;
+188.698294549251;
+169.159265933533;
+170.572054413256;
+140.56828838973;
+255.495692365563;
+146.433846620621;
+42.5327790354386;
+39.507951740452;
+38.6228800009376;
+36.7369837184779;
+36.6879867390362;
+35.4497869085026;
+35.9021757743631;
+35.0227636018553;
+35.7753874939572;
+35.0572414342969;
+36.0046870714086;
+35.3102348460343;
+36.4238530018811;
+35.6412979577653;
+36.9564573501993;
+35.9519800391281;
+37.5694819433047;
+36.1168271743081;
+39.4706520590189;
+41.9107080348422;
+37.5523617354047;
+33.5182908086281;
+29.8264463398064;
+26.4866882367787;
+23.5012745472413;
+20.8655105874514;
+18.5685210110114;
+16.5941090285214;
+14.9216688063734;
+13.5271195611167;
+12.3838329291266;
+11.4635286724078;
+10.7371175556691;
+10.1754741542009;
+9.75012628190598;
+9.43385159030731;
+9.20117552486772;
+9.02876823725637;
+8.89574109688874;
+8.78384614555944;
+8.6775841242943;
+8.5642285777576;
+8.43308067808903;];
+figure;semilogy (OBJ0(:,1));
+legend ('Limit = 0');
+
+
+OBJ1= [
+18.7660606082863;
+19.3838216717902;
+19.0278681244126;
+19.7167399597539;
+21.1920583204784;
+22.086945804222;
+58.3431226379782;
+59.5774708724757;
+75.0368812236363;
+76.7762170766638;
+82.8466365061635;
+85.0786194643877;
+82.8191799227582;
+85.1209792925728;
+82.6612054672077;
+84.8647640998151;
+84.5929145499492;
+86.8554121536731;
+93.3770831579163;
+95.607897784952;
+105.22807121206;
+107.415949946103;
+115.353456140782;
+117.543257321173;
+123.0349938614;
+125.236687038439;
+128.769581067049;
+130.992807744447;
+132.876120178142;
+135.087970436295;
+143.045334637749;
+145.276763128426;
+183.963521270568;
+186.208874706445;
+201.764621208144;
+203.99300688279;
+208.191097438495;
+210.435835637517;
+208.412555426888;
+210.660894476768;
+208.737738529116;
+211.018988025464;
+212.00678264918;
+214.331715198308;
+224.036435982137;
+226.393923741852;
+238.26842727804;
+240.811219703604;
+250.148335959756;
+252.7383753952;
+259.035710385856;
+261.599034805491;
+265.37276686081;
+268.218173095746;
+269.792304615668;
+272.724632674968;
+280.906380803732;
+284.063210124256;
+322.08610002834;
+322.123646580603;
+334.99185390609;
+335.683444656234;
+338.387854640343;
+339.628971420472;
+335.353311461545;
+337.012466499085;
+332.506463480446;
+334.540899218977;
+332.526567739832;
+334.925299889359;
+341.732625706161;
+344.481896831816;
+354.196377901522;
+357.612392572255;
+365.737803021984;
+370.519278317985;
+376.098741387026;
+383.64278145497;
+385.400723663424;
+399.161775413797;
+393.275947291605;
+418.409553449141;
+409.105111111213;
+410.504567822902;
+420.409213565446;
+523.689638985462;
+436.149375060431;
+337.596717122572;
+339.318013528965;
+340.169965980898;
+336.158422261202;
+337.867170950778;
+334.296761262088;
+336.755452237339;
+336.245709376135;
+339.072601962554;
+347.368557645142;
+350.468862754613;
+361.581911513685;
+364.851264508128;
+373.934345458373;
+377.624330611782;
+383.430665053579;
+389.638604125282;
+390.748849073917;
+406.935421179705;
+401.79897760493;
+425.489111201722;
+413.458536260167;
+414.893655358596;
+424.299344089749;
+518.247786662228;
+433.504442198095;
+339.070224360315;
+340.52486461917;
+341.776637388993;
+337.381767779058;
+339.552473705006;
+335.519400449913;
+338.197481994041;
+337.229728062115;
+340.410040073849;
+348.169674586761;
+351.711742370594;
+362.298095750828;
+366.048107104605;
+374.621432899607;
+379.056550523044;
+384.385927246163;
+391.826193201968;
+392.140669373422;
+407.506670713616;
+400.892885191671;
+424.557995465878;
+412.726513023053;
+414.083348317148;
+423.551169278606;
+517.087969889352;
+432.92553408454;
+538.71456763088;
+492.532985594364;
+472.901318507012;
+462.956528896094;
+470.184515352234;
+461.763785445784;
+465.982653735557;
+461.146161577075;
+467.161589125928;
+471.94115661002;
+478.522856140114;
+484.469005812524;
+487.479292536384;
+490.031157445184;
+494.766367332517;
+497.052475160021;
+507.777234778752;
+506.775721289154;
+528.297647906709;
+514.712941697149;
+563.250092682567;
+535.251957589626;
+602.970354610723;
+514.043130339542;
+584.932658023608;
+470.263375713857;
+339.873175527677;
+343.35387342783;
+344.272083964819;
+341.880375963312;
+343.173141362317;
+341.007258282245;
+342.537902630776;
+343.45971931536;
+344.936580978281;
+354.61515553467;
+356.094249722822;
+368.099703564301;
+369.561638886355;
+379.153671934251;
+380.545403984801;
+387.098158060433;
+389.136831874719;
+392.625560721632;
+413.995326830402;
+413.82829338655;
+438.779351856359;
+432.609842119473;
+434.376199176928;
+408.711540475708;
+497.028882720695;
+396.617816071994;
+302.495915055501;
+297.237743885968;
+298.197587268885;
+292.826751975797;
+294.833612760342;
+289.943790520458;
+292.803570599064;
+288.72369735925;
+292.04489619927;
+288.947485029077;
+292.688491781359;
+290.657876965743;
+294.910183509071;
+293.5885458924;
+298.775886297266;
+297.18103501507;
+305.572143626654;
+300.965125377075;
+316.20026281852;
+305.487162606209;
+329.695507377497;
+307.330845467812;
+308.451952212319;
+275.77110490455;
+369.543987965386;
+266.700846703083;
+172.456114302082;
+167.261591473223;
+168.457838826969;
+163.914772430398;
+166.03062330791;
+161.890649977613;
+164.589991643599;
+160.567310084354;
+163.73108141822;
+159.988014391496;
+163.472779840295;
+160.157502010494;
+163.938595550388;
+161.055346633599;
+165.461923117902;
+162.234907897164;
+169.414711424031;
+164.065803141464;
+176.979667525948;
+167.067597604337;
+188.698294549251;
+169.159265933533;
+170.572054413256;
+140.56828838973;
+255.495692365563;
+146.433846620621;
+42.5327790354386;
+39.507951740452;
+38.6228800009376;
+36.7369837184779;
+36.6879867390362;
+35.4497869085026;
+35.9021757743631;
+35.0227636018553;
+35.7753874939572;
+35.0572414342969;
+36.0046870714086;
+35.3102348460343;
+36.4238530018811;
+35.6412979577653;
+36.9564573501993;
+35.9519800391281;
+37.5694819433047;
+36.1168271743081;
+39.4706520590189;
+41.9107080348422;
+37.5523617354047;
+33.5182908086281;
+29.8264463398064;
+26.4866882367787;
+23.5012745472413;
+20.8655105874514;
+18.5685210110114;
+16.5941090285214;
+14.9216688063734;
+13.5271195611167;
+12.3838329291266;
+11.4635286724078;
+10.7371175556691;
+10.1754741542009;
+9.75012628190598;
+9.43385159030731;
+9.20117552486772;
+9.02876823725637;
+8.89574109688874;
+8.78384614555944;
+8.6775841242943;
+8.5642285777576;
+8.43308067808903;];
+figure;semilogy (OBJ1(:,1));
+legend ('Limit = 20');
+
+
+OBJ2= [
+18.7660606082863;
+19.3838216717902;
+19.0278681244126;
+19.7167399597539;
+21.1920583204784;
+22.086945804222;
+58.3431226379782;
+59.5774708724757;
+75.0368812236363;
+76.7762170766638;
+82.8466365061635;
+85.0786194643877;
+82.8191799227582;
+85.1209792925728;
+82.6612054672077;
+84.8647640998151;
+84.5929145499492;
+86.8554121536731;
+93.3770831579163;
+95.607897784952;
+105.22807121206;
+107.415949946103;
+114.922190327914;
+117.54349209301;
+123.035243433311;
+125.236907933188;
+128.769829742933;
+130.993027084946;
+132.876332323376;
+135.088113856815;
+143.045552122616;
+144.647519843565;
+183.964065843251;
+186.209525031114;
+201.765437200761;
+203.993681407269;
+208.191703876946;
+210.436401987982;
+208.41312604568;
+210.661261107969;
+208.738212422531;
+211.019329067137;
+212.007309400283;
+214.332104757062;
+224.036722772134;
+226.393355167965;
+238.268875233547;
+240.811593419222;
+250.14887356432;
+252.738834870901;
+259.035746560303;
+261.599553703058;
+265.374699468202;
+268.218978795976;
+269.793409908004;
+272.725635745944;
+280.908832971753;
+284.064480223193;
+321.874550865164;
+322.106611201002;
+334.975987809396;
+335.654444331577;
+338.376566336314;
+339.609336997136;
+335.339161180795;
+336.99015619708;
+332.492901899343;
+334.526775401723;
+332.514459759233;
+334.913679019229;
+341.605034617399;
+344.476673748041;
+353.553595693115;
+357.606107564149;
+365.734662863041;
+370.511286399631;
+376.090823207682;
+383.632034231464;
+385.393230642256;
+399.151999266236;
+393.269000846898;
+418.402187751358;
+409.100067252835;
+409.471696333008;
+420.19393045731;
+523.558206614537;
+436.105466218451;
+337.585116473363;
+339.304649259826;
+339.676949868117;
+336.116921314637;
+337.828585714832;
+334.333245500025;
+336.72090589951;
+336.225835246558;
+339.043870261046;
+347.352435999368;
+350.446327533572;
+361.566625168208;
+364.825216000002;
+373.916469821686;
+377.594649912141;
+383.403451276365;
+389.521131104781;
+389.965288369327;
+406.810482214212;
+401.730110673493;
+425.418915665058;
+412.948180741924;
+414.813778629694;
+423.989282318435;
+518.087882107606;
+432.675182926236;
+339.033041959297;
+340.48977604384;
+341.724138812649;
+337.357876673881;
+339.468782884758;
+335.496522719455;
+338.168834341893;
+337.189210669238;
+340.384030900151;
+348.151770676307;
+351.687887843071;
+362.2754212781;
+366.008535579113;
+374.605331556585;
+379.027482075523;
+384.353315055442;
+391.78426438428;
+392.059502169508;
+407.472667322213;
+400.878564974728;
+424.542715781711;
+412.006714827248;
+414.040748785415;
+422.687412740169;
+517.068418434799;
+432.229494602991;
+538.024566581129;
+492.860215431585;
+473.080963575584;
+463.095663902912;
+470.171525462826;
+461.489867346225;
+465.714260575281;
+461.245687615338;
+467.173791696196;
+472.060305617271;
+478.636110920634;
+484.583775268885;
+487.592504937701;
+490.139698437297;
+494.867894035939;
+497.150771033655;
+507.8697530219;
+506.877246923948;
+528.406981552964;
+514.825736305545;
+563.26346096879;
+535.293984590788;
+602.227389989552;
+514.036248820335;
+584.966840341775;
+470.261640674413;
+339.895405896375;
+343.377477654492;
+344.350042708365;
+341.900035248224;
+343.143633316173;
+341.026304324067;
+342.558074215245;
+343.440935064058;
+344.955655808688;
+354.621901470282;
+356.102514407314;
+368.09830734095;
+369.55933298401;
+379.161871710834;
+380.545308432051;
+387.157728372349;
+389.041731185403;
+392.625624373168;
+413.899872525833;
+413.847127312762;
+438.800542448733;
+432.44788844864;
+434.396385025666;
+408.627250456422;
+496.590905001016;
+396.598054020407;
+302.494202541828;
+297.236528459036;
+298.1959697976;
+292.318303334432;
+294.746195664213;
+289.90700520359;
+292.726539609632;
+288.659784538208;
+292.036151540389;
+288.889356422193;
+292.644852444477;
+290.619397309203;
+294.863101743387;
+293.551431092083;
+298.724146289216;
+297.131490098373;
+305.507022086334;
+300.901251469078;
+316.14610055734;
+305.458471876938;
+329.65447646444;
+307.295280434731;
+308.415248240746;
+275.74258953408;
+369.481000521053;
+266.684255370026;
+172.452877827962;
+167.259846481656;
+168.350818879866;
+163.930753133072;
+165.99041648869;
+161.878662620795;
+164.572160241909;
+160.538389833087;
+163.686623471734;
+159.974629335255;
+163.430290067821;
+160.125075962149;
+163.344219318697;
+160.913150738343;
+165.426683801506;
+162.202578504606;
+169.368135549867;
+164.036057037672;
+176.949526521421;
+167.041430781126;
+188.605566152135;
+169.144338771037;
+170.569393450942;
+140.562690413231;
+255.671261238838;
+146.43202491605;
+42.5025256156714;
+39.4791880395951;
+38.5958118064482;
+36.7103866712478;
+36.6624153027133;
+35.4240805606951;
+35.8771430363577;
+34.997230010189;
+35.7503898440882;
+35.0315486951185;
+35.9795170338293;
+35.2842874241887;
+36.3984508127432;
+35.6150968143156;
+36.9307787114649;
+35.9255049645035;
+37.5433916645798;
+36.0899503845631;
+39.4391086541727;
+41.8743902982951;
+37.5197030845975;
+33.4891698756255;
+29.8007081968208;
+26.4641489822407;
+23.4817263013065;
+20.848726724882;
+18.5542614686346;
+16.5821255368155;
+14.9117099095984;
+13.5189353154165;
+12.3771791822819;
+11.4581708505393;
+10.7328339080705;
+10.1720584210962;
+9.74738977673587;
+9.43162469407253;
+9.19930862014735;
+9.02713210754882;
+8.89422683908379;
+8.78236464470683;
+8.67606515039006;
+8.56261956484559;
+8.43134554461903;];
+figure;semilogy (OBJ2(:,1));
+legend ('Limit = 10');
+
+
+OBJ3= [
+18.7660606082863;
+19.3838216717902;
+19.0278681244126;
+19.7167399597539;
+21.1920583204784;
+22.086945804222;
+58.3431226379782;
+59.5774708724757;
+75.0368812236363;
+76.7762170766638;
+82.8466365061635;
+85.0786194643877;
+82.8191799227582;
+85.1209792925728;
+82.6612054672077;
+84.8647640998151;
+84.5929145499492;
+86.4160416366439;
+93.3771687750653;
+95.6079740352305;
+104.812586790765;
+106.987839323898;
+114.495361303057;
+117.544226434459;
+122.815417537209;
+125.008020107206;
+128.770955142161;
+130.994015644008;
+132.877279383612;
+134.935093697197;
+142.881536407574;
+144.300714561458;
+183.774016492996;
+186.211006181867;
+201.767272883086;
+203.995177491615;
+208.193192184335;
+210.437700226517;
+208.41445351527;
+210.662112825115;
+208.739372981742;
+211.020173280698;
+211.908098615959;
+214.23327810333;
+223.691357397579;
+225.932952133483;
+238.269138149861;
+240.422894940662;
+250.003996647434;
+252.357942113089;
+258.183533762125;
+261.596901502676;
+264.642274488149;
+268.067150405969;
+269.592992132154;
+272.290123678011;
+280.29245785415;
+284.026943129716;
+321.378752044741;
+322.027569733011;
+334.904610239889;
+334.914942598663;
+338.234892028374;
+338.657664616011;
+335.007674707023;
+335.907004338807;
+331.825429670617;
+333.951483412461;
+332.146149082926;
+334.25864483651;
+341.073462463988;
+344.119247629767;
+352.900160892144;
+357.284457564094;
+365.069716207885;
+370.155771078013;
+375.761181923815;
+383.217232615058;
+384.945710967604;
+398.538529531249;
+392.624076050741;
+417.163991616714;
+407.277275638481;
+408.475141989177;
+419.052809641117;
+523.057896890537;
+435.235362296291;
+337.457968625525;
+338.55178406843;
+340.072634934356;
+335.551903968202;
+337.516471664053;
+334.251615069725;
+336.622942678854;
+336.030838790293;
+338.961648176756;
+347.304878549311;
+350.377066656202;
+361.333459763957;
+363.790456278375;
+373.719502112363;
+377.465542954996;
+383.276824082849;
+389.461019739861;
+389.973666788756;
+406.76479591207;
+401.72358095387;
+424.727344180131;
+411.695705635295;
+414.31230765732;
+423.132716602834;
+517.914001505691;
+431.979884707095;
+338.940725568898;
+340.394708492115;
+341.145028524945;
+336.796197640249;
+339.00095624245;
+335.300540159737;
+338.119057545156;
+337.103145715749;
+340.233607643199;
+348.056862184289;
+351.566618708658;
+361.405951322943;
+365.348462642168;
+374.021133891192;
+378.775784041759;
+383.482894370158;
+390.925686260309;
+391.558497880982;
+407.122612473002;
+400.659651226965;
+423.64696276031;
+410.812306526997;
+413.40622769941;
+422.325655582474;
+516.89963422882;
+431.579616920388;
+533.670957480362;
+489.902047179026;
+469.416194456394;
+460.508087985452;
+467.430774992588;
+457.959288525421;
+463.019307991393;
+458.079043214505;
+463.694987826693;
+467.994769872823;
+474.592145364583;
+480.555857265504;
+484.429380717246;
+487.231403022168;
+491.684692030316;
+493.491395134157;
+505.081501265966;
+503.734660909084;
+525.230661751932;
+510.556222127212;
+558.387351085392;
+532.069794213976;
+598.968647967511;
+512.493021701548;
+584.081468724329;
+469.215737516422;
+339.091209602397;
+342.720288358425;
+343.448665223739;
+340.625031559555;
+342.694911454962;
+340.530904507721;
+341.203009972203;
+342.283948259172;
+344.675069954894;
+353.437702953779;
+355.352928678869;
+367.959450904089;
+369.228020027249;
+379.011065939079;
+380.526287396828;
+387.06389423178;
+389.168426237899;
+392.529752981574;
+413.618049108411;
+413.493067542469;
+437.535364587226;
+430.407058319517;
+433.054993345297;
+406.841148959506;
+493.229267185574;
+394.690562752077;
+302.519245421787;
+297.253979629708;
+298.220241031486;
+292.155727301091;
+294.73406225856;
+289.90905964084;
+292.521886862321;
+288.662905254085;
+291.563550163315;
+288.779220083794;
+292.597543123578;
+290.493711594134;
+294.794926625036;
+293.546990529871;
+298.140028239839;
+296.682843024168;
+305.221852598994;
+300.172032975655;
+315.758576230717;
+305.224436707103;
+329.341898953548;
+307.023944184859;
+308.129925319354;
+275.518217193483;
+368.690008746502;
+266.039348560857;
+172.279884589778;
+167.262043442119;
+168.022114378085;
+163.935776666474;
+165.503202334063;
+161.843479336309;
+164.508581615606;
+159.339059990984;
+163.574826728065;
+159.736232399056;
+163.38219366774;
+159.402332590562;
+163.862321320337;
+161.013549205076;
+165.451573675373;
+162.079614216531;
+169.214041660522;
+163.890677362939;
+176.874898671749;
+167.000996573612;
+188.531084445029;
+168.962141341575;
+170.315882204131;
+140.298340365853;
+254.490211841321;
+146.035046523992;
+42.6565570006151;
+39.6244996543955;
+38.7308910104857;
+36.8422645957035;
+36.7876040845968;
+35.549421538306;
+35.9977711849315;
+35.1202182446978;
+35.8695570020664;
+35.1544340510154;
+36.0987843169878;
+35.408056503753;
+36.5185240096216;
+35.740152325423;
+37.0521600091597;
+36.0522874165163;
+37.6669378729021;
+36.2194398319116;
+39.5929122832858;
+42.0534899394261;
+37.6807301743938;
+33.6325799249917;
+29.9271374647942;
+26.574394806159;
+23.5767245253628;
+20.9295271119772;
+18.6220019534903;
+16.6380061367054;
+14.9569670333458;
+13.5548171319533;
+12.4049226140705;
+11.4789806552835;
+10.7478642060469;
+10.1823969233828;
+9.75404486671869;
+9.43551542473506;
+9.20125760112023;
+9.02786118377117;
+8.89435539492661;
+8.78241031939797;
+8.67644670353729;
+8.56366160489051;
+8.43328375414421;];
+figure;semilogy (OBJ3(:,1));
+legend ('Limit = 7');
+
+
+OBJ4= [
+18.7660606082863;
+19.3838216717902;
+19.0278681244126;
+19.7167399597539;
+21.1920583204784;
+22.086945804222;
+58.3431226379782;
+59.5774708724757;
+75.0368812236363;
+76.7762170766638;
+82.8466365061635;
+85.0786194643877;
+82.8191799227582;
+85.1209792925728;
+82.6612054672077;
+84.8647640998151;
+84.5929145499492;
+86.2841193461283;
+93.3771926600755;
+95.6079953073419;
+104.593978213447;
+106.761653523816;
+114.452179028015;
+117.344678999224;
+122.534547792494;
+124.723528440161;
+128.771768095829;
+130.994736703203;
+132.722743658308;
+134.678528295689;
+142.620407563873;
+144.271230196791;
+183.504376509542;
+186.212282617142;
+201.768860406255;
+203.99648298832;
+208.194431073456;
+210.438818398861;
+208.41558775956;
+210.662844342561;
+208.740343666261;
+211.020880289558;
+211.73263801026;
+214.057650741072;
+223.344491357245;
+225.618551824661;
+238.269561724071;
+240.111721111023;
+249.738567496771;
+252.107128701731;
+257.680151909646;
+261.096254292766;
+264.245960789716;
+267.743591657643;
+269.324967106447;
+272.051553201322;
+280.14046791843;
+283.82385134794;
+321.273252579759;
+321.776975496073;
+334.855951159718;
+334.536432020723;
+338.161461738837;
+338.159584282115;
+334.865603400714;
+336.559870360832;
+331.652537388939;
+333.819195815706;
+332.030744550347;
+333.978952313134;
+340.594261182675;
+343.947686444355;
+352.723177003987;
+357.022615876034;
+364.405485437305;
+369.996773541918;
+375.708206532959;
+382.887375964988;
+384.827190154291;
+397.989202115623;
+391.629650098879;
+416.171534376955;
+406.003635468197;
+406.896079758688;
+418.279511757713;
+522.789206336468;
+434.368537887027;
+336.458786039517;
+337.896346577829;
+339.728184032688;
+335.223193737184;
+336.690561887958;
+334.148304338934;
+336.104364429724;
+335.543380033846;
+338.597350644779;
+346.984822685536;
+349.937371571728;
+360.928921092547;
+363.920459582818;
+371.64964511127;
+376.490028330113;
+381.733865527551;
+388.241219674089;
+389.757734729215;
+404.101882590015;
+399.106158110981;
+421.901646785225;
+409.816678251147;
+411.639712951272;
+421.346817844666;
+518.954753910364;
+432.693783070632;
+337.178509829984;
+339.612870500547;
+339.956311751303;
+335.801677055582;
+337.672182447125;
+334.888955955019;
+337.549434633039;
+336.296846340515;
+339.763464568778;
+347.500810010614;
+350.832976108412;
+361.300434302212;
+364.572073082711;
+373.408575382008;
+377.804225749758;
+383.567000232099;
+389.128414711292;
+390.623654886661;
+406.283400582596;
+399.892128816892;
+422.541702923741;
+410.199755007189;
+412.168671820653;
+421.631377137119;
+517.653463493963;
+432.433849647527;
+527.439642037266;
+487.026320288849;
+1077497.4576657;
+459.561835661797;
+4132460.15723309;
+1768611.67165027;
+463.581533909743;
+458.01050547632;
+464.066559731388;
+467.643320798293;
+474.187949843893;
+479.692207045923;
+483.066855660722;
+484.794945810554;
+490.63285081462;
+492.594963523645;
+504.605261760196;
+502.571142151801;
+524.264928756924;
+509.161374275271;
+554.806681409998;
+529.400210317224;
+596.543692470115;
+510.603817545523;
+583.635653848072;
+468.884290741586;
+338.818661341409;
+341.91430425609;
+343.6941819739;
+341.026185063172;
+342.81278759264;
+340.054791631032;
+341.608266886173;
+343.19336483066;
+345.159729246703;
+353.312698562926;
+355.727453547488;
+368.403821551357;
+369.710435426794;
+379.151526859911;
+380.631390636743;
+387.372301320027;
+389.339516790427;
+392.597453511047;
+412.690346413205;
+411.860848087983;
+435.063666805816;
+427.877715106109;
+430.401632327603;
+404.623758821674;
+490.626553987979;
+394.013688375546;
+301.561544214188;
+296.699225730872;
+297.66303547805;
+292.554864572701;
+294.1583852411;
+289.696454496123;
+292.00901496724;
+288.477143324117;
+291.719560052676;
+288.704257587937;
+292.484072197045;
+290.140151119436;
+294.671991448649;
+293.081596005175;
+297.506462502328;
+296.443915084697;
+304.2591514997;
+300.038351231955;
+315.242225600392;
+305.003457245572;
+329.235205876128;
+307.107072334948;
+308.364977823498;
+275.609662472645;
+368.868965520085;
+266.191729000348;
+172.137649423479;
+167.108801246946;
+167.232044543758;
+163.73585839449;
+164.686035131104;
+161.53171405085;
+164.247222297778;
+159.586435354922;
+163.300842746141;
+158.906612087585;
+163.116553925433;
+159.616577670806;
+163.324781980864;
+160.270974224462;
+165.079756201365;
+161.837272044202;
+168.924588346177;
+163.639976269071;
+176.6170232939;
+166.859215918505;
+188.280603947236;
+168.680847252168;
+170.205518158453;
+140.197220801087;
+254.806972365934;
+146.039843566999;
+42.5262460373688;
+39.5053669850076;
+38.6254416699358;
+36.7435949703613;
+36.6990854967535;
+35.4644033039531;
+35.9202399132646;
+35.0436500065862;
+35.7985016871771;
+35.0824258794237;
+36.0308351908425;
+35.3377440499753;
+36.4511443483225;
+35.6694012238258;
+36.9833436980407;
+35.9794291294311;
+37.5949427760024;
+36.14306614821;
+39.5001358494428;
+41.9443832390989;
+37.5827293005259;
+33.5451151096422;
+29.8495786680887;
+26.5060635381524;
+23.5169062553432;
+20.8774838886566;
+18.5769848789441;
+16.59926736958;
+14.9237710409816;
+13.5264509501721;
+12.3807049278494;
+11.4582695624213;
+10.7300635733372;
+10.1669612954829;
+9.74048292876068;
+9.4233920609513;
+9.19019462159486;
+9.01753682427989;
+8.8845027157804;
+8.77281464244516;
+8.66694224425919;
+8.55412745682042;
+8.42364037557127;];
+figure;semilogy (OBJ4(:,1));
+legend ('Limit = 6');
+
+
+OBJ5= [
+18.7660606082863;
+19.3838216717902;
+19.0278681244126;
+19.7167399597539;
+21.1920583204784;
+22.086945804222;
+58.3431226379782;
+59.4521299298432;
+75.0368979153016;
+76.7762334454442;
+82.8466625252829;
+85.0786466407903;
+82.8191962836609;
+85.1209944576579;
+82.4962512485673;
+84.6584323643903;
+84.4538757760821;
+86.2069718025063;
+93.2190726839001;
+95.4975445357287;
+104.309090397996;
+106.45867447223;
+114.360521885721;
+116.999551185461;
+122.258999750667;
+124.421778012406;
+128.536008796287;
+130.804447407076;
+132.466011956153;
+134.441273291305;
+142.385201396915;
+144.257154416337;
+183.276669658783;
+186.213786191704;
+201.577580121241;
+203.998275267864;
+208.058203708619;
+210.440484331432;
+208.417253748448;
+210.48912897328;
+208.741741744485;
+211.021851353418;
+211.57245606948;
+213.889995999513;
+222.85228218566;
+225.172550860291;
+237.968402851302;
+239.639211298101;
+249.368070880764;
+251.849468765077;
+257.173309489731;
+260.324462884937;
+263.782006903;
+267.210827978808;
+269.061649719161;
+271.852297945078;
+279.932826862927;
+283.376331568973;
+321.111096020666;
+321.297026093232;
+334.496245523288;
+335.050728095171;
+337.982222146302;
+337.92149252378;
+334.495416678958;
+336.203454150894;
+331.08304399391;
+333.083305114658;
+330.974286898014;
+333.165655697726;
+339.59226737884;
+343.263336877756;
+352.027146586303;
+356.223201000091;
+362.953360026782;
+369.326483848159;
+375.15448941036;
+381.988739339005;
+383.869821199151;
+396.843223564703;
+390.202942157146;
+414.1005369143;
+404.504790716889;
+405.226690622282;
+415.914609581633;
+520.693418999223;
+433.777343780045;
+336.7825190476;
+337.427193325529;
+338.944187319016;
+334.516439467998;
+336.513927958228;
+333.751337882157;
+336.198236401364;
+334.509239736755;
+337.733886233679;
+346.273491402051;
+349.214284204455;
+360.347050760136;
+363.236612415265;
+370.79972583785;
+375.609827782667;
+382.335700837396;
+387.48389338019;
+388.947311778653;
+403.81095097737;
+399.248045735713;
+421.552283836739;
+409.380950003224;
+410.436709207926;
+420.828644205779;
+517.047689138831;
+432.004200015959;
+337.429764477492;
+339.53756492825;
+340.250359886538;
+335.562394238262;
+338.118876585925;
+334.724564427113;
+337.213579073592;
+335.817332258349;
+339.473477085287;
+347.065660869477;
+350.196349730147;
+360.766982971083;
+364.085202755053;
+372.942678455251;
+377.069994331999;
+382.506662104071;
+387.556607496762;
+389.476488391451;
+404.542026992598;
+397.430433787111;
+419.049976966509;
+407.430958374509;
+408.344596943826;
+418.694502554514;
+515.283348860715;
+430.683335678969;
+6011857.46409476;
+498.03326777541;
+4513884.85462874;
+36686452.6247414;
+18885704.3117513;
+67822376.0960224;
+507.732327190998;
+3140237.01202195;
+3500603.68951438;
+515.506244259889;
+2949022.53317789;
+528.032890266223;
+532.126249943979;
+531.495024896809;
+537.571626717257;
+535.805890518894;
+547.316674984713;
+545.705419349599;
+568.11082994338;
+27962046.4138643;
+31919494.1982844;
+39846992.5627302;
+638.360239678213;
+85448099.6791358;
+669.018370784324;
+549.34572765968;
+415.957855899718;
+414.591138998216;
+415.614037108795;
+406.989839295406;
+409.385262354881;
+402.176723061875;
+405.175275636888;
+399.455744662497;
+403.03767823007;
+407.166595457258;
+407.490458637538;
+415.183085950814;
+417.426210548045;
+420.689585851494;
+422.752208419473;
+421.923469036768;
+424.711246012614;
+420.713984279808;
+443.258321722969;
+436.882193971935;
+451.782669646866;
+436.218109748101;
+439.855444453258;
+414.187506400734;
+15424863.5065544;
+406.597473288572;
+305.905035877;
+301.12918838849;
+302.536814377116;
+297.493032990576;
+298.946377601735;
+294.063458585129;
+296.800398257974;
+292.625835906461;
+295.721585100388;
+292.064566778761;
+295.514375961486;
+293.303464890036;
+297.193428034469;
+295.042891283705;
+299.7827451139;
+297.750359375839;
+304.905999569288;
+300.046953884026;
+315.20428756987;
+304.707405953124;
+327.68193997629;
+305.129111808516;
+306.399697406365;
+274.400418581634;
+368.56150250467;
+265.966407720578;
+171.101319155869;
+167.114864468138;
+166.633330909324;
+163.709696780654;
+165.216061737776;
+161.056247893817;
+164.224830408935;
+159.372008205715;
+162.34712682875;
+158.380610056463;
+162.917039852049;
+158.530522395353;
+162.821675061261;
+160.736864359866;
+165.003803586;
+161.690268704515;
+168.781800158002;
+163.659378724304;
+176.741236475325;
+167.232600527725;
+188.67411311748;
+169.077471613244;
+170.663865839841;
+140.49315637244;
+254.477174480673;
+146.689139920285;
+43.0389750984923;
+39.9538732738529;
+39.0460888231828;
+37.1202727871587;
+37.0665012787122;
+35.8028510362219;
+36.2618782698719;
+35.3663594021582;
+36.1312785511927;
+35.4018708037293;
+36.3626568368672;
+35.6581920001991;
+36.7829762218589;
+35.989142553708;
+37.3115001207116;
+36.2930934890264;
+37.9133199477947;
+36.443740692308;
+39.7940161561255;
+42.2305851944056;
+37.8554068186186;
+33.8028397862254;
+30.0912102803359;
+26.7307703623119;
+23.7241724375035;
+21.0671053364877;
+18.7490552977852;
+16.7541561350936;
+15.0620946247836;
+13.6490395908586;
+12.4885661559711;
+11.5525500806707;
+10.8120108546645;
+10.2378860940316;
+9.80172372634297;
+9.47628228743088;
+9.23603330319565;
+9.05756313112579;
+8.91987471142602;
+8.80459237779178;
+8.69607519253623;
+8.58144616369646;
+8.44985015669772;];
+figure;semilogy (OBJ5(:,1));
+legend ('Limit = 5');
+
+
+OBJ6= [
+18.7660606082863;
+19.3838216717902;
+19.0278681244126;
+19.7167399597539;
+21.1920583204784;
+22.0109734203341;
+58.2835490617588;
+59.33040943394;
+75.0369341697977;
+76.7762690158438;
+82.8467165330613;
+85.0787026569102;
+82.8192327555146;
+84.8597940334761;
+82.2647791211256;
+84.4184035846247;
+84.2605201378314;
+86.1653568828007;
+92.9952031325628;
+95.2540032185188;
+103.84099878685;
+106.00494813246;
+114.03004272004;
+116.457873603128;
+121.840556018215;
+123.988627880955;
+127.858352902312;
+130.173360076866;
+132.175664822105;
+134.251172804782;
+142.219423046363;
+144.233037561062;
+183.114046397181;
+186.215870377358;
+201.301968400435;
+203.78654711085;
+207.783511196543;
+210.314174142315;
+208.171215773706;
+210.097100820775;
+208.484141851411;
+210.769226651815;
+211.386489430774;
+213.641198013563;
+222.16108655071;
+224.506778805554;
+237.280159096312;
+239.000085977482;
+248.757893137765;
+251.317954874622;
+256.590548953609;
+259.557568963526;
+263.309525022686;
+266.372026516045;
+268.704900914008;
+271.490105473869;
+279.452846041001;
+282.66685146619;
+320.69315282645;
+320.552062034963;
+333.711296326945;
+334.356663140522;
+337.227569166984;
+338.089315852147;
+333.909212378896;
+335.535895390188;
+330.45950225091;
+332.210765183171;
+329.644518172245;
+332.219660878261;
+338.326358012974;
+342.055554676812;
+350.835197646632;
+354.168404218474;
+361.972439485952;
+367.644323972409;
+373.780481207425;
+380.839710255284;
+382.165465765552;
+395.139679737608;
+387.546687887706;
+411.574704727554;
+401.724787834899;
+7657061.05005165;
+646389.303657124;
+17221219.3621556;
+35490041.9211559;
+343.297375985573;
+344.074371872943;
+345.831265837102;
+340.215144146825;
+341.635360741566;
+338.73015472438;
+340.70981544677;
+338.402114652631;
+342.651839324426;
+350.397937743048;
+353.446609299757;
+363.680548934404;
+367.293970089035;
+375.410526408839;
+379.161870126515;
+385.718445849024;
+390.191949330499;
+390.499478928388;
+1639167.31671958;
+401.609225855492;
+24948898.7214737;
+24315009.5217482;
+12985271.579573;
+439.874922646696;
+51761284.5555299;
+65936801.3824901;
+385.452529396776;
+382.722857405975;
+384.423082567262;
+375.427022771431;
+379.004579833874;
+372.329177111535;
+376.45295476826;
+371.108057240643;
+376.820403864471;
+380.757513903933;
+385.421346542376;
+392.51131281104;
+397.332303301622;
+402.211662280937;
+407.210833730292;
+408.567820294315;
+414.008662233031;
+411.067005641848;
+426.142047986071;
+412.156362359792;
+47714464.2369083;
+39871319.8203269;
+16272483.6397035;
+448.487850070964;
+80831901.7532947;
+97860163.8689355;
+201092047.653539;
+160700817.362009;
+383274224.06374;
+555932406.135266;
+1013573929.0816;
+3388388304.56481;
+2556346982.89207;
+4851781209.98215;
+8801421878.2409;
+17243771187.3156;
+21834968283.605;
+40048726426.8163;
+42576822767.1291;
+73541391452.7141;
+77414304739.9666;
+130441487011.057;
+146034560819.293;
+241093751377.935;
+255127756173.195;
+432285957592.092;
+448373320619.746;
+754549726131.291;
+767246488271.585;
+1297925805906.63;
+1314008640707.73;
+2224241160549.97;
+2256751055898;
+3771555860659.53;
+3810236299937.85;
+6344910285737.18;
+6371345007681.72;
+10586264205735;
+10642108558434.8;
+17612784963295.2;
+17680234477063.8;
+29238294285067.6;
+29277962292022.7;
+48453664857812.5;
+48493401700952.2;
+81643803137252;
+81563412768025.7;
+134534427789452;
+134401960444284;
+221688810192430;
+221426442966027;
+365231015751149;
+364815782160120;
+601744325347885;
+601081810816752;
+991451981370880;
+990387670794044;
+1.63359152292222e+15;
+1.63199313930649e+15;
+2.69188488370165e+15;
+2.68925019052275e+15;
+4.43577294928456e+15;
+4.43143057118654e+15;
+7.30940486101209e+15;
+7.30224844595499e+15;
+1.20446631079457e+16;
+1.2032869468954e+16;
+1.98475659574278e+16;
+1.98281305023441e+16;
+3.27054270600468e+16;
+3.26733979445988e+16;
+5.38930024063993e+16;
+5.3840217695044e+16;
+8.88065347056276e+16;
+8.87195391075982e+16;
+1.46338117127145e+17;
+1.46194582495022e+17;
+2.41140115860209e+17;
+2.40903663180482e+17;
+3.97357660333884e+17;
+3.96968113245811e+17;
+6.54777592945725e+17;
+6.54136176547258e+17;
+1.07896188104737e+18;
+1.07790548820965e+18;
+1.77794633156309e+18;
+1.77620548707157e+18;
+2.92975424055064e+18;
+2.9268855208392e+18;
+4.82773846354142e+18;
+4.82301115587806e+18;
+7.95529478833139e+18;
+7.94750473172733e+18;
+1.31089775461715e+19;
+1.30961402964678e+19;
+2.16013732730878e+19;
+2.15802182836869e+19;
+3.55954021202328e+19;
+3.55605386741403e+19;
+5.86551899199582e+19;
+5.85977311954621e+19;
+9.66538119876079e+19;
+9.65591006130508e+19;
+1.59269053015198e+20;
+1.59112995966341e+20;
+2.62448345407769e+20;
+2.6219120413531e+20;
+4.32470316380171e+20;
+4.32046862757402e+20;
+7.12637689181416e+20;
+7.11939959840238e+20;
+1.17430614249028e+21;
+1.17315634650009e+21;
+1.93505751410747e+21;
+1.93316277905507e+21;
+3.18864684920187e+21;
+3.18552455391381e+21;
+5.25434962634156e+21;
+5.24920444651875e+21;
+8.65827772625751e+21;
+8.6497989761361e+21;
+1.42673743676638e+22;
+1.42534019164785e+22;
+2.35102150532273e+22;
+2.34871884399601e+22;
+3.87408501091593e+22;
+3.8702899765361e+22;
+6.38383555296856e+22;
+8.19479262200161e+22;
+1.05194792201576e+23;
+1.35036294593702e+23;
+1.7334319005762e+23;
+2.22516928725373e+23;
+2.85640200535328e+23;
+3.66670188328517e+23;
+4.70686642696284e+23;
+6.04210330332223e+23;
+7.75611819339568e+23;
+9.9563622814737e+23;
+1.27807683441975e+24;
+1.64063977233993e+24;
+2.10605402593541e+24;
+2.70349630366079e+24;
+3.47042011928576e+24;
+4.45490374373243e+24;
+5.71866422040225e+24;
+7.34092639189381e+24;
+9.42338948647286e+24;
+1.20966026184147e+25;
+1.55281488808136e+25;
+1.99331510896834e+25;
+2.55877577819398e+25;
+3.12731862647352e+25;];
+figure;semilogy (OBJ6(:,1));
+legend ('Limit = 4');
@@ -0,0 +1,117 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Comparison of AS solver with and without warm start.
+ */
+
+
+#include "tests_common.h"
+
+///@addtogroup gTEST
+///@{
+
+/// Tolerance of comparison of the solutions with and without warm start.
+#define TEST_TOLERANCE 1e-8
+
+int main(int argc, char **argv)
+{
+    // Straight
+    init_10 cold_test("");
+    init_10 warm_test("");
+
+    //-----------------------------------------------------------
+
+    smpc::solver_as cold_solver(
+            cold_test.wmg->N, // size of the preview window
+            8000.0,         // gain_position
+            1.0,            // gain_velocity
+            0.02,           // gain_acceleration
+            1.0,            // gain_jerk
+            1e-7,           // tolerance
+            0,              // no limit on the number of activated constraints
+            true,           // enable constraint removal
+            false,          // obj
+            false);         // warm start
+
+    smpc::solver_as warm_solver(
+            warm_test.wmg->N, // size of the preview window
+            8000.0,         // gain_position
+            1.0,            // gain_velocity
+            0.02,           // gain_acceleration
+            1.0,            // gain_jerk
+            1e-7,           // tolerance
+            0,              // no limit on the number of activated constraints
+            true,           // enable constraint removal
+            false,          // obj
+            true);          // warm start
+
+
+    double max_diff = 0.0;
+    unsigned int cold_added = 0;
+    unsigned int warm_added = 0;
+    unsigned int warm_removed = 0;
+
+    for(int counter = 0; ; counter++)
+    {
+        //------------------------------------------------------
+        if (cold_test.wmg->formPreviewWindow(*cold_test.par) == WMG_HALT)
+        {
+            cout << "EXIT (halt = 1)" << endl;
+            break;
+        }
+        if (warm_test.wmg->formPreviewWindow(*warm_test.par) == WMG_HALT)
+        {
+            cout << "EXIT (halt = 1)" << endl;
+            break;
+        }
+        //------------------------------------------------------
+
+
+        cold_solver.set_parameters (cold_test.par->T, cold_test.par->h, cold_test.par->h0, cold_test.par->angle, cold_test.par->zref_x, cold_test.par->zref_y, cold_test.par->lb, cold_test.par->ub);
+        cold_solver.form_init_fp (cold_test.par->fp_x, cold_test.par->fp_y, cold_test.par->init_state, cold_test.par->X);
+        cold_solver.solve();
+        cold_solver.get_next_state(cold_test.par->init_state);
+
+        warm_solver.set_parameters (warm_test.par->T, warm_test.par->h, warm_test.par->h0, warm_test.par->angle, warm_test.par->zref_x, warm_test.par->zref_y, warm_test.par->lb, warm_test.par->ub);
+        warm_solver.form_init_fp (warm_test.par->fp_x, warm_test.par->fp_y, warm_test.par->init_state, warm_test.par->X);
+        warm_solver.solve();
+        warm_solver.get_next_state(warm_test.par->init_state);
+        //------------------------------------------------------
+
+
+        double diff = 0.0;
+        for (unsigned int i = 0; i < cold_test.wmg->N*SMPC_NUM_VAR; ++i)
+        {
+            const double err = abs(cold_test.par->X[i] - warm_test.par->X[i]);
+            if (err > diff)
+            {
+                diff = err;
+            }
+        }
+        if (diff > max_diff)
+        {
+            max_diff = diff;
+        }
+
+        cold_added += cold_solver.added_constraints_num;
+        warm_added += warm_solver.added_constraints_num;
+        warm_removed += warm_solver.removed_constraints_num;
+
+        printf("(%3i) cold: AS size = %2i, added = %2i | warm: AS size = %2i, added = %2i, removed = %2i | diff = % 8e\n",
+                counter,
+                cold_solver.active_set_size,
+                cold_solver.added_constraints_num,
+                warm_solver.active_set_size,
+                warm_solver.added_constraints_num,
+                warm_solver.removed_constraints_num,
+                diff);
+    }
+
+    cout << "Total number of added constraints (cold start): " << cold_added << endl;
+    cout << "Total number of added constraints (warm start): " << warm_added << endl;
+    cout << "Total number of removed constraints (warm start): " << warm_removed << endl;
+    cout << "Max. difference of solutions: " << max_diff << endl;
+
+    return ((max_diff < TEST_TOLERANCE) ? 0 : 1);
+}
+///@}
@@ -0,0 +1,110 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Comparison of AS solvers with different sizes of the cache
+ *  of Cholesky factors, the solutions must be identical.
+ */
+
+
+#include "tests_common.h"
+
+///@addtogroup gTEST
+///@{
+
+int main(int argc, char **argv)
+{
+    const int control_sampling_time_ms = 20;
+    const int cache_size_num = 3;
+    const unsigned int cache_size[cache_size_num] = {0, 1, 4};
+
+
+    init_08* tests[cache_size_num];
+    smpc::solver_as* solvers[cache_size_num];
+
+    for (int j = 0; j < cache_size_num; ++j)
+    {
+        tests[j] = new init_08("");
+        tests[j]->par->init_state.set (0.019978839010709938, -6.490507362468014e-05);
+        tests[j]->wmg->T_ms[0] = control_sampling_time_ms;
+        tests[j]->wmg->T_ms[1] = control_sampling_time_ms;
+
+        solvers[j] = new smpc::solver_as(
+                tests[j]->wmg->N, // size of the preview window
+                4000.0,         // gain_position
+                400.0,          // gain_velocity
+                0.02,           // gain_acceleration
+                1.0,            // gain_jerk
+                1e-7,           // tolerance
+                0,              // no limit on the number of activated constraints
+                true,           // enable constraint removal
+                false,          // obj
+                false,          // warm start
+                cache_size[j]); // the number of cached factors
+    }
+
+
+    double max_diff = 0.0;
+    for(int counter = 0; ; counter++)
+    {
+        bool halt = false;
+        for (int j = 0; j < cache_size_num; ++j)
+        {
+            //------------------------------------------------------
+            if (tests[j]->wmg->formPreviewWindow(*tests[j]->par) == WMG_HALT)
+            {
+                halt = true;
+                break;
+            }
+            //------------------------------------------------------
+
+            smpc_parameters *par = tests[j]->par;
+            solvers[j]->set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+            solvers[j]->form_init_fp (par->fp_x, par->fp_y, par->init_state, par->X);
+            solvers[j]->solve();
+            solvers[j]->get_next_state(par->init_state);
+        }
+        if (halt)
+        {
+            cout << "EXIT (halt = 1)" << endl;
+            break;
+        }
+
+
+        printf("(%3i) T =", counter);
+        for (unsigned int i = 0; i < tests[0]->wmg->N; ++i)
+        {
+            printf(" %4.2f", tests[0]->par->T[i]);
+        }
+        printf("\n     ");
+        for (int j = 1; j < cache_size_num; ++j)
+        {
+            double diff = 0.0;
+            for (unsigned int i = 0; i < tests[0]->wmg->N*SMPC_NUM_VAR; ++i)
+            {
+                const double err = abs(tests[0]->par->X[i] - tests[j]->par->X[i]);
+                // NaN is propagated
+                if (!(err <= diff))
+                {
+                    diff = err;
+                }
+            }
+            if (!(diff <= max_diff))
+            {
+                max_diff = diff;
+            }
+            printf(" cache size = %u: diff = % 8e |", cache_size[j], diff);
+        }
+        printf("\n");
+    }
+
+    cout << "Max. difference of solutions: " << max_diff << endl;
+
+    for (int j = 0; j < cache_size_num; ++j)
+    {
+        delete solvers[j];
+        delete tests[j];
+    }
+
+    return ((max_diff <= 0.0) ? 0 : 1);
+}
+///@}
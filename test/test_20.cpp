@@ -0,0 +1,115 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Comparison of solvers with fixed and variable lengths of the
+ *  preview window, the solutions must be identical.
+ */
+
+
+#include "tests_common.h"
+
+///@addtogroup gTEST
+///@{
+
+/// The length of the preview window used in #init_10.
+#define TEST_N 40
+
+int main(int argc, char **argv)
+{
+    // check the compile time bounds of the required memory
+    bool mem_bounds_ok = true;
+    const smpc::kktSolverType kkt_solvers[4] = {
+        smpc::SMPC_KKT_CHOLESKY,
+        smpc::SMPC_KKT_RICCATI,
+        smpc::SMPC_KKT_CONDENSED,
+        smpc::SMPC_KKT_AUTO};
+    for (int N = 1; N <= 200; ++N)
+    {
+        for (int k = 0; k < 4; ++k)
+        {
+            for (unsigned int K = 0; K <= 8; ++K)
+            {
+                if (smpc::solver_as::get_mem_size (N, K, kkt_solvers[k]) > (size_t) SMPC_AS_MEM_SIZE(N, K))
+                {
+                    cout << "AS memory bound is too small: N = " << N << ", K = " << K 
+                         << ", KKT solver = " << k << endl;
+                    mem_bounds_ok = false;
+                }
+            }
+            if (smpc::solver_ip::get_mem_size (N, kkt_solvers[k]) > (size_t) SMPC_IP_MEM_SIZE(N))
+            {
+                cout << "IP memory bound is too small: N = " << N 
+                     << ", KKT solver = " << k << endl;
+                mem_bounds_ok = false;
+            }
+        }
+    }
+    cout << "Memory bounds: " << (mem_bounds_ok ? "OK" : "FAILED") << endl;
+
+
+    init_10 as_test("");
+    init_10 as_fixed_test("");
+    init_10 ip_test("");
+    init_10 ip_fixed_test("");
+
+    //-----------------------------------------------------------
+
+    smpc::solver_as as_solver(TEST_N, 8000.0, 1.0, 0.02, 1.0, 1e-7, 0, true, false, false, 4);
+    static smpc::solver_as_fixed<TEST_N, 4> as_fixed_solver(8000.0, 1.0, 0.02, 1.0, 1e-7, 0, true, false, false);
+
+    smpc::solver_ip ip_solver(TEST_N, 2000, 150, 0.02, 1, 1e-3, 1e-2, 100, 15, 0.01, 0.5);
+    static smpc::solver_ip_fixed<TEST_N> ip_fixed_solver(2000, 150, 0.02, 1, 1e-3, 1e-2, 100, 15, 0.01, 0.5);
+
+    init_10 *tests[4] = {&as_test, &as_fixed_test, &ip_test, &ip_fixed_test};
+    smpc::solver *solvers[4] = {&as_solver, &as_fixed_solver, &ip_solver, &ip_fixed_solver};
+
+
+    double max_diff_as = 0.0;
+    double max_diff_ip = 0.0;
+    for(int counter = 0; ; counter++)
+    {
+        bool halt = false;
+        for (int j = 0; j < 4; ++j)
+        {
+            //------------------------------------------------------
+            if (tests[j]->wmg->formPreviewWindow(*tests[j]->par) == WMG_HALT)
+            {
+                halt = true;
+                break;
+            }
+            //------------------------------------------------------
+
+            smpc_parameters *par = tests[j]->par;
+            solvers[j]->set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+            solvers[j]->form_init_fp (par->fp_x, par->fp_y, par->init_state, par->X);
+            solvers[j]->solve();
+            solvers[j]->get_next_state(par->init_state);
+        }
+        if (halt)
+        {
+            cout << "EXIT (halt = 1)" << endl;
+            break;
+        }
+
+
+        double diff_as = 0.0;
+        double diff_ip = 0.0;
+        for (int i = 0; i < TEST_N*SMPC_NUM_VAR; ++i)
+        {
+            diff_as = max (diff_as, abs(as_test.par->X[i] - as_fixed_test.par->X[i]));
+            diff_ip = max (diff_ip, abs(ip_test.par->X[i] - ip_fixed_test.par->X[i]));
+        }
+        max_diff_as = max (max_diff_as, diff_as);
+        max_diff_ip = max (max_diff_ip, diff_ip);
+
+        printf("(%3i) AS diff = % 8e | IP diff = % 8e\n", counter, diff_as, diff_ip);
+    }
+
+    cout << "Max. difference of solutions (AS): " << max_diff_as << endl;
+    cout << "Max. difference of solutions (IP): " << max_diff_ip << endl;
+
+    // the solutions must be identical
+    const bool solutions_ok = !((max_diff_as > 0.0) || (max_diff_ip > 0.0));
+    return ((mem_bounds_ok && solutions_ok) ? 0 : 1);
+}
+///@}
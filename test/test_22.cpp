@@ -0,0 +1,124 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Places the solvers and their parameters in one memory arena and
+ *  compares the results with the solvers, which allocate memory themselves,
+ *  the solutions must be identical.
+ */
+
+
+#include "tests_common.h"
+
+///@addtogroup gTEST
+///@{
+
+int main(int argc, char **argv)
+{
+    init_10 as_test("");
+    init_10 as_arena_test("");
+    init_10 ip_test("");
+    init_10 ip_arena_test("");
+
+    const int N = as_test.wmg->N;
+
+    //-----------------------------------------------------------
+
+    const size_t arena_size =
+        smpc::solver_as::get_mem_size (N, 4)
+        + smpc::solver_ip::get_mem_size (N)
+        + 2*smpc_parameters::get_mem_size (N);
+
+    smpc::arena mem (arena_size, true);
+    cout << "Arena size [bytes]: " << arena_size << endl;
+    cout << "Huge pages: " << (mem.huge_pages_on() ? "ON" : "OFF") << endl;
+    cout << "Locked: " << (mem.lock() ? "YES" : "NO") << endl;
+
+
+    delete as_arena_test.par;
+    as_arena_test.par = new smpc_parameters (mem, N, 0.252007);
+    delete ip_arena_test.par;
+    ip_arena_test.par = new smpc_parameters (mem, N, 0.252007);
+
+    smpc::solver_as as_solver(N, 8000.0, 1.0, 0.02, 1.0, 1e-7, 0, true, false, false, 4);
+    smpc::solver_as as_arena_solver(mem, N, 8000.0, 1.0, 0.02, 1.0, 1e-7, 0, true, false, false, 4);
+
+    smpc::solver_ip ip_solver(N, 2000, 150, 0.02, 1, 1e-3, 1e-2, 100, 15, 0.01, 0.5);
+    smpc::solver_ip ip_arena_solver(mem, N, 2000, 150, 0.02, 1, 1e-3, 1e-2, 100, 15, 0.01, 0.5);
+
+    cout << "Used memory [bytes]: " << mem.used << endl;
+    if (mem.used > arena_size)
+    {
+        cout << "The arena is too small!" << endl;
+        return (1);
+    }
+
+
+    init_10 *tests[4] = {&as_test, &as_arena_test, &ip_test, &ip_arena_test};
+    smpc::solver *solvers[4] = {&as_solver, &as_arena_solver, &ip_solver, &ip_arena_solver};
+
+
+    double max_diff_as = 0.0;
+    double max_diff_ip = 0.0;
+    for(int counter = 0; ; counter++)
+    {
+        bool halt = false;
+        for (int j = 0; j < 4; ++j)
+        {
+            //------------------------------------------------------
+            if (tests[j]->wmg->formPreviewWindow(*tests[j]->par) == WMG_HALT)
+            {
+                halt = true;
+                break;
+            }
+            //------------------------------------------------------
+
+            smpc_parameters *par = tests[j]->par;
+            solvers[j]->set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+            solvers[j]->form_init_fp (par->fp_x, par->fp_y, par->init_state, par->X);
+            solvers[j]->solve();
+            solvers[j]->get_next_state(par->init_state);
+        }
+        if (halt)
+        {
+            cout << "EXIT (halt = 1)" << endl;
+            break;
+        }
+
+
+        double diff_as = 0.0;
+        double diff_ip = 0.0;
+        for (int i = 0; i < N*SMPC_NUM_VAR; ++i)
+        {
+            const double err_as = abs(as_test.par->X[i] - as_arena_test.par->X[i]);
+            const double err_ip = abs(ip_test.par->X[i] - ip_arena_test.par->X[i]);
+            // NaN is propagated
+            if (!(err_as <= diff_as))
+            {
+                diff_as = err_as;
+            }
+            if (!(err_ip <= diff_ip))
+            {
+                diff_ip = err_ip;
+            }
+        }
+        if (!(diff_as <= max_diff_as))
+        {
+            max_diff_as = diff_as;
+        }
+        if (!(diff_ip <= max_diff_ip))
+        {
+            max_diff_ip = diff_ip;
+        }
+
+        printf("(%3i) AS diff = % 8e | IP diff = % 8e\n", counter, diff_as, diff_ip);
+    }
+
+    cout << "Max. difference of solutions (AS): " << max_diff_as << endl;
+    cout << "Max. difference of solutions (IP): " << max_diff_ip << endl;
+
+    delete as_arena_test.par;
+    delete ip_arena_test.par;
+
+    return (((max_diff_as <= 0.0) && (max_diff_ip <= 0.0)) ? 0 : 1);
+}
+///@}
@@ -0,0 +1,294 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Checks, that the solvers do not allocate memory after
+ *  construction: the allocation functions are interposed and the
+ *  allocations made while the problem is formed and solved are counted.
+ *  The test fails (returns a non-zero value), if any allocations are
+ *  detected.
+ */
+
+
+#include <cstdlib>
+#include <new>
+#include "tests_common.h"
+
+///@addtogroup gTEST
+///@{
+
+
+/// The number of problems passed to smpc::solver#solve_multi.
+#define TEST_NUM_MULTI 3
+
+
+/// true if the allocations must be counted.
+static bool count_allocations = false;
+
+/// The number of detected allocations.
+static unsigned int num_allocations = 0;
+
+
+/// Counts an allocation if the counter is enabled.
+static void register_allocation()
+{
+    if (count_allocations)
+    {
+        ++num_allocations;
+    }
+}
+
+
+#ifdef __GLIBC__
+// operator new uses malloc, hence it is sufficient to interpose the C
+// allocation functions.
+extern "C"
+{
+    void *__libc_malloc (size_t);
+    void *__libc_calloc (size_t, size_t);
+    void *__libc_realloc (void *, size_t);
+
+    void *malloc (size_t size)
+    {
+        register_allocation();
+        return (__libc_malloc (size));
+    }
+
+    void *calloc (size_t num, size_t size)
+    {
+        register_allocation();
+        return (__libc_calloc (num, size));
+    }
+
+    void *realloc (void *ptr, size_t size)
+    {
+        register_allocation();
+        return (__libc_realloc (ptr, size));
+    }
+}
+#else
+// exception specifications of the replaced operators
+#if __cplusplus >= 201103L
+#define TEST_THROW_BAD_ALLOC
+#define TEST_NOTHROW noexcept
+#else
+#define TEST_THROW_BAD_ALLOC throw (std::bad_alloc)
+#define TEST_NOTHROW throw ()
+#endif
+
+void *operator new (size_t size) TEST_THROW_BAD_ALLOC
+{
+    register_allocation();
+    void *ptr = std::malloc (size == 0 ? 1 : size);
+    if (ptr == NULL)
+    {
+        throw std::bad_alloc();
+    }
+    return (ptr);
+}
+
+void *operator new[] (size_t size) TEST_THROW_BAD_ALLOC
+{
+    return (operator new (size));
+}
+
+void operator delete (void *ptr) TEST_NOTHROW
+{
+    std::free (ptr);
+}
+
+void operator delete[] (void *ptr) TEST_NOTHROW
+{
+    std::free (ptr);
+}
+#endif
+
+
+
+/**
+ * @brief Runs a simulation and counts the allocations made by the solver.
+ *
+ * @param[in] name name of the solver
+ * @param[in,out] solver solver
+ * @param[in] N size of the preview window, must match the solver
+ *
+ * @return the number of allocations.
+ */
+unsigned int run_test (const char *name, smpc::solver &solver, const int N = 40)
+{
+    init_10 test("", true, N);
+    unsigned int allocations = 0;
+
+    for(;;)
+    {
+        //------------------------------------------------------
+        if (test.wmg->formPreviewWindow(*test.par) == WMG_HALT)
+        {
+            break;
+        }
+        //------------------------------------------------------
+
+        smpc_parameters *par = test.par;
+
+        num_allocations = 0;
+        count_allocations = true;
+
+        solver.set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+        solver.form_init_fp (par->fp_x, par->fp_y, par->init_state, par->X);
+        solver.solve();
+        solver.get_next_state(par->init_state);
+
+        count_allocations = false;
+        allocations += num_allocations;
+    }
+
+    printf("%-40s allocations = %u\n", name, allocations);
+    return (allocations);
+}
+
+
+/**
+ * @brief Runs a simulation, in each preview window #TEST_NUM_MULTI problems
+ * with shifted reference ZMP positions are solved by
+ * smpc::solver#solve_multi, the allocations made by the solver are counted.
+ *
+ * @param[in] name name of the solver
+ * @param[in,out] solver solver
+ *
+ * @return the number of allocations.
+ */
+unsigned int run_multi_test (const char *name, smpc::solver &solver)
+{
+    init_10 test("");
+    const int N = test.wmg->N;
+    unsigned int allocations = 0;
+
+    vector<double> zref_x_mem (TEST_NUM_MULTI*N);
+    vector<double> zref_y_mem (TEST_NUM_MULTI*N);
+    vector<double> X_mem (TEST_NUM_MULTI*N*SMPC_NUM_VAR);
+    const double *zref_x[TEST_NUM_MULTI];
+    const double *zref_y[TEST_NUM_MULTI];
+    double *X[TEST_NUM_MULTI];
+    for (int m = 0; m < TEST_NUM_MULTI; ++m)
+    {
+        zref_x[m] = &zref_x_mem[m*N];
+        zref_y[m] = &zref_y_mem[m*N];
+        X[m] = &X_mem[m*N*SMPC_NUM_VAR];
+    }
+
+    for(;;)
+    {
+        //------------------------------------------------------
+        if (test.wmg->formPreviewWindow(*test.par) == WMG_HALT)
+        {
+            break;
+        }
+        //------------------------------------------------------
+
+        smpc_parameters *par = test.par;
+
+        for (int m = 0; m < TEST_NUM_MULTI; ++m)
+        {
+            const double shift = 0.004 * m;
+            for (int i = 0; i < N; ++i)
+            {
+                zref_x_mem[m*N + i] = par->zref_x[i] + shift;
+                zref_y_mem[m*N + i] = par->zref_y[i] - shift;
+            }
+        }
+
+        num_allocations = 0;
+        count_allocations = true;
+
+        solver.set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+        for (int m = 0; m < TEST_NUM_MULTI; ++m)
+        {
+            solver.form_init_fp (par->fp_x, par->fp_y, par->init_state, X[m]);
+        }
+        solver.solve_multi (TEST_NUM_MULTI, zref_x, zref_y, X);
+        solver.get_next_state(par->init_state);
+
+        count_allocations = false;
+        allocations += num_allocations;
+    }
+
+    printf("%-40s allocations = %u\n", name, allocations);
+    return (allocations);
+}
+
+
+int main(int argc, char **argv)
+{
+    // make sure that the interposed functions are actually used
+    num_allocations = 0;
+    count_allocations = true;
+    double *check = new double[10];
+    count_allocations = false;
+    delete [] check;
+    if (num_allocations == 0)
+    {
+        cout << "Allocations are not detected!" << endl;
+        return (1);
+    }
+
+
+    const int N = 40;
+    unsigned int allocations = 0;
+
+    smpc::solver_as as_solver(N, 8000.0, 1.0, 0.02, 1.0, 1e-7, 0, true, true, false, 4);
+    allocations += run_test ("AS", as_solver);
+
+    smpc::solver_as as_warm_solver(N, 8000.0, 1.0, 0.02, 1.0, 1e-7, 0, true, true, true, 4);
+    allocations += run_test ("AS (warm start)", as_warm_solver);
+
+    smpc::solver_ip ip_solver(N, 2000, 150, 0.02, 1, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+            smpc::SMPC_IP_BS_LOGBAR, true);
+    allocations += run_test ("IP", ip_solver);
+
+    smpc::solver_ip ip_orig_solver(N, 2000, 150, 0.02, 1, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+            smpc::SMPC_IP_BS_ORIGINAL, true);
+    allocations += run_test ("IP (original search)", ip_orig_solver);
+
+    smpc::solver_ip_parameters warm_par;
+    warm_par.warm_start_on = true;
+    smpc::solver_ip ip_warm_solver(N, 2000, 150, 0.02, 1, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+            smpc::SMPC_IP_BS_LOGBAR, true, warm_par);
+    allocations += run_test ("IP (warm start)", ip_warm_solver);
+
+    smpc::solver_ip_parameters pd_par;
+    pd_par.method = smpc::SMPC_IP_METHOD_PRIMAL_DUAL;
+    smpc::solver_ip ip_pd_solver(N, 2000, 150, 0.02, 1, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+            smpc::SMPC_IP_BS_LOGBAR, true, pd_par);
+    allocations += run_test ("IP (primal-dual)", ip_pd_solver);
+
+    smpc::solver_as as_ric_solver(N, 8000.0, 1.0, 0.02, 1.0, 1e-7, 0, true, true, false, 4,
+            smpc::SMPC_KKT_RICCATI);
+    allocations += run_test ("AS (Riccati)", as_ric_solver);
+
+    smpc::solver_ip_parameters ric_par;
+    ric_par.kkt_solver = smpc::SMPC_KKT_RICCATI;
+    smpc::solver_ip ip_ric_solver(N, 2000, 150, 0.02, 1, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+            smpc::SMPC_IP_BS_LOGBAR, true, ric_par);
+    allocations += run_test ("IP (Riccati)", ip_ric_solver);
+
+    smpc::solver_as as_cnd_solver(N, 8000.0, 1.0, 0.02, 1.0, 1e-7, 0, true, true, false, 4,
+            smpc::SMPC_KKT_CONDENSED);
+    allocations += run_test ("AS (condensed)", as_cnd_solver);
+
+    // the condensed formulation is selected for short preview windows
+    smpc::solver_as as_auto_solver(SMPC_AS_CONDENSED_MAX_N, 8000.0, 1.0, 0.02, 1.0, 1e-7, 0, true, true, false, 4,
+            smpc::SMPC_KKT_AUTO);
+    allocations += run_test ("AS (automatic selection)", as_auto_solver, SMPC_AS_CONDENSED_MAX_N);
+
+    smpc::solver_as as_multi_solver(N, 8000.0, 1.0, 0.02, 1.0, 1e-7, 0, true, true, false, 4);
+    as_multi_solver.reserve_multi (TEST_NUM_MULTI);
+    allocations += run_multi_test ("AS (multiple problems)", as_multi_solver);
+
+    smpc::solver_ip ip_multi_solver(N, 2000, 150, 0.02, 1, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+            smpc::SMPC_IP_BS_LOGBAR, true);
+    allocations += run_multi_test ("IP (multiple problems)", ip_multi_solver);
+
+    cout << "Allocations during solution: " << (allocations == 0 ? "NONE" : "FAILED") << endl;
+
+    return ((allocations == 0) ? 0 : 1);
+}
+///@}
@@ -0,0 +1,80 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Performs a full simulation with both solvers and reports the
+ *  time spent in the phases of the solution process (averaged over all
+ *  iterations). The solver library must be built with the
+ *  SMPC_INSTRUMENTATION option, otherwise the statistics are empty.
+ */
+
+
+#include "tests_common.h"
+
+///@addtogroup gTEST
+///@{
+
+/**
+ * @brief Runs a simulation and accumulates the statistics of the solver.
+ *
+ * @param[in] name name of the solver
+ * @param[in,out] solver solver
+ */
+void run_test (const char *name, smpc::solver &solver)
+{
+    init_10 test("");
+    smpc::solver_stats total;
+    int num_solves = 0;
+
+    for(;;)
+    {
+        //------------------------------------------------------
+        if (test.wmg->formPreviewWindow(*test.par) == WMG_HALT)
+        {
+            break;
+        }
+        //------------------------------------------------------
+
+        smpc_parameters *par = test.par;
+        solver.set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+        solver.form_init_fp (par->fp_x, par->fp_y, par->init_state, par->X);
+        solver.solve();
+        solver.get_next_state(par->init_state);
+
+        for (int i = 0; i < smpc::SMPC_PHASE_NUM; ++i)
+        {
+            total.ticks[i] += solver.stats.ticks[i];
+            total.calls[i] += solver.stats.calls[i];
+        }
+        ++num_solves;
+    }
+
+    printf("%s (%d solves)\n", name, num_solves);
+    printf("    %-28s %14s %10s %8s\n", "phase", "ticks/solve", "calls/solve", "share");
+    for (int i = 0; i < smpc::SMPC_PHASE_NUM; ++i)
+    {
+        const smpc::solverPhaseType phase = static_cast<smpc::solverPhaseType>(i);
+        printf("    %-28s %14.1f %10.2f %7.2f%%\n",
+                smpc::solver_stats::get_phase_name(phase),
+                total.ticks[i] / num_solves,
+                static_cast<double>(total.calls[i]) / num_solves,
+                total.ticks[smpc::SMPC_PHASE_SOLVE] > 0.0
+                    ? 100.0 * total.ticks[i] / total.ticks[smpc::SMPC_PHASE_SOLVE]
+                    : 0.0);
+    }
+}
+
+
+int main(int argc, char **argv)
+{
+    const int N = 40;
+
+    smpc::solver_as as_solver(N, 8000.0, 1.0, 0.02, 1.0, 1e-7, 0, true, true, false, 4);
+    run_test ("AS", as_solver);
+
+    smpc::solver_ip ip_solver(N, 2000, 150, 0.02, 1, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+            smpc::SMPC_IP_BS_LOGBAR, true);
+    run_test ("IP", ip_solver);
+
+    return 0;
+}
+///@}
@@ -0,0 +1,170 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Records the inputs of a solver during a simulation using
+ *  smpc::input_recorder, replays them with smpc::input_log_reader using
+ *  the solver created with the parameters stored in the log, and compares
+ *  the solutions: they must be identical.
+ */
+
+
+#include <cstdio>
+
+#include "tests_common.h"
+#include "smpc_input_log.h"
+
+///@addtogroup gTEST
+///@{
+
+/// Name of the temporary log file.
+#define TEST_LOG_FILE "test_25.log"
+
+
+/**
+ * @brief Replays the log and compares the solutions.
+ *
+ * @param[in] config parameters of the solver used during recording
+ * @param[in] N size of the preview window
+ * @param[in] solutions solutions obtained during recording
+ *
+ * @return maximal difference of the solutions.
+ */
+double replay (const smpc::input_log_config &config, const int N, const vector<double> &solutions)
+{
+    smpc::input_log_reader log;
+    if (!log.open (TEST_LOG_FILE) || (log.N != N))
+    {
+        cout << "Cannot read the log!" << endl;
+        return (1.0);
+    }
+
+    // the real parameters are checked implicitly: the solutions must be identical
+    if ((log.config.solver_type != config.solver_type)
+            || (log.config.warm_start_on != config.warm_start_on)
+            || (log.config.kkt_solver != config.kkt_solver)
+            || (log.config.ip_par.method != config.ip_par.method)
+            || (log.config.ip_par.kkt_solver != config.ip_par.kkt_solver))
+    {
+        cout << "Wrong parameters of the solver!" << endl;
+        return (1.0);
+    }
+
+    smpc::solver *replay_solver = log.config.create_solver (N);
+    vector<double> X (N*SMPC_NUM_VAR);
+
+    double max_diff = 0.0;
+    unsigned int num_ticks = 0;
+    for (; log.read(); ++num_ticks)
+    {
+        if ((num_ticks + 1)*N*SMPC_NUM_VAR > solutions.size())
+        {
+            // too many records
+            ++num_ticks;
+            break;
+        }
+
+        log.apply (*replay_solver, &X[0]);
+        replay_solver->solve();
+
+        for (int i = 0; i < N*SMPC_NUM_VAR; ++i)
+        {
+            max_diff = max (max_diff, abs(solutions[num_ticks*N*SMPC_NUM_VAR + i] - X[i]));
+        }
+    }
+    delete replay_solver;
+
+    if (num_ticks*N*SMPC_NUM_VAR != solutions.size())
+    {
+        cout << "Wrong number of records: " << num_ticks << endl;
+        return (1.0);
+    }
+
+    return (max_diff);
+}
+
+
+/**
+ * @brief Runs a simulation with recording and then replays the log.
+ *
+ * @param[in] name name of the solver
+ * @param[in] config parameters of the solver
+ *
+ * @return maximal difference of the solutions.
+ */
+double run_test (const char *name, const smpc::input_log_config &config)
+{
+    init_10 test("");
+    const int N = test.wmg->N;
+
+    vector<double> solutions;
+    smpc::solver *solver = config.create_solver (N);
+
+
+    smpc::input_recorder recorder;
+    if (!recorder.open (TEST_LOG_FILE, N, config))
+    {
+        cout << "Cannot create the log!" << endl;
+        delete solver;
+        return (1.0);
+    }
+
+    for(;;)
+    {
+        //------------------------------------------------------
+        if (test.wmg->formPreviewWindow(*test.par) == WMG_HALT)
+        {
+            break;
+        }
+        //------------------------------------------------------
+
+        smpc_parameters *par = test.par;
+
+        recorder.record (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub,
+                par->fp_x, par->fp_y, par->init_state);
+
+        solver->set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+        solver->form_init_fp (par->fp_x, par->fp_y, par->init_state, par->X);
+        solver->solve();
+        solver->get_next_state(par->init_state);
+
+        solutions.insert (solutions.end(), par->X, par->X + N*SMPC_NUM_VAR);
+    }
+    recorder.close();
+    delete solver;
+
+
+    const double max_diff = replay (config, N, solutions);
+    remove (TEST_LOG_FILE);
+
+    printf("%-25s ticks = %u, max. difference of solutions = % 8e\n",
+            name, static_cast<unsigned int> (solutions.size() / (N*SMPC_NUM_VAR)), max_diff);
+    return (max_diff);
+}
+
+
+int main(int argc, char **argv)
+{
+    double max_diff = 0.0;
+    smpc::input_log_config config;
+
+    config.set_as (8000.0, 1.0, 0.02, 1.0, 1e-7);
+    max_diff = max (max_diff, run_test ("AS", config));
+
+    config.set_as (8000.0, 1.0, 0.02, 1.0, 1e-7, 0, true, false, true, 4, smpc::SMPC_KKT_RICCATI);
+    max_diff = max (max_diff, run_test ("AS (warm start, Riccati)", config));
+
+    config.set_ip (8000.0, 1.0, 0.02, 1.0, 1e-3, 1e-2);
+    max_diff = max (max_diff, run_test ("IP", config));
+
+    smpc::solver_ip_parameters ip_par;
+    ip_par.method = smpc::SMPC_IP_METHOD_PRIMAL_DUAL;
+    ip_par.kkt_solver = smpc::SMPC_KKT_RICCATI;
+    config.set_ip (8000.0, 1.0, 0.02, 1.0, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+            smpc::SMPC_IP_BS_LOGBAR, false, ip_par);
+    max_diff = max (max_diff, run_test ("IP (primal-dual, Riccati)", config));
+
+    cout << "Replay: " << ((max_diff > 0.0) ? "FAILED" : "OK") << endl;
+
+    return ((max_diff > 0.0) ? 1 : 0);
+}
+///@}
@@ -0,0 +1,111 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Compares the interior-point solver with and without warm start:
+ *  the numbers of iterations and the difference of the solutions.
+ */
+
+
+#include "tests_common.h"
+
+///@addtogroup gTEST
+///@{
+
+/// Tolerance of comparison of the solutions with and without warm start
+/// (the solutions are not exact, the difference is about 6e-3).
+#define TEST_TOLERANCE 1e-2
+
+/**
+ * @brief Runs a simulation with cold and warm started solvers, the states
+ * of the simulations are updated independently.
+ *
+ * @param[in] cold_test test scenario for the cold started solver
+ * @param[in] warm_test the same scenario for the warm started solver
+ *
+ * @return true if the solutions are close and the warm start does not
+ *  increase the number of external iterations.
+ */
+template <class t_init>
+bool run_test (t_init &cold_test, t_init &warm_test)
+{
+    const int N = cold_test.wmg->N;
+
+    smpc::solver_ip_parameters warm_par;
+    warm_par.warm_start_on = true;
+
+    smpc::solver_ip cold_solver(N, 8000.0, 1.0, 0.02, 1.0, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+            smpc::SMPC_IP_BS_LOGBAR, false);
+    smpc::solver_ip warm_solver(N, 8000.0, 1.0, 0.02, 1.0, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+            smpc::SMPC_IP_BS_LOGBAR, false, warm_par);
+
+    t_init *tests[2] = {&cold_test, &warm_test};
+    smpc::solver_ip *solvers[2] = {&cold_solver, &warm_solver};
+
+    unsigned int ext_iterations[2] = {0, 0};
+    unsigned int int_iterations[2] = {0, 0};
+    double max_diff = 0.0;
+
+    for(int counter = 0; ; counter++)
+    {
+        bool halt = false;
+        for (int j = 0; j < 2; ++j)
+        {
+            //------------------------------------------------------
+            if (tests[j]->wmg->formPreviewWindow(*tests[j]->par) == WMG_HALT)
+            {
+                halt = true;
+                break;
+            }
+            //------------------------------------------------------
+
+            smpc_parameters *par = tests[j]->par;
+            solvers[j]->set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+            solvers[j]->form_init_fp (par->fp_x, par->fp_y, par->init_state, par->X);
+            solvers[j]->solve();
+            solvers[j]->get_next_state(par->init_state);
+
+            ext_iterations[j] += solvers[j]->ext_loop_iterations;
+            int_iterations[j] += solvers[j]->int_loop_iterations;
+        }
+        if (halt)
+        {
+            break;
+        }
+
+        double diff = 0.0;
+        for (int i = 0; i < N*SMPC_NUM_VAR; ++i)
+        {
+            diff = max (diff, abs(cold_test.par->X[i] - warm_test.par->X[i]));
+        }
+        max_diff = max (max_diff, diff);
+
+        printf("(%3i) cold: ext = %2d, int = %3d | warm: ext = %2d, int = %3d | diff = % 8e\n",
+                counter,
+                cold_solver.ext_loop_iterations, cold_solver.int_loop_iterations,
+                warm_solver.ext_loop_iterations, warm_solver.int_loop_iterations,
+                diff);
+    }
+
+    cout << "Total iterations (cold): ext = " << ext_iterations[0] << ", int = " << int_iterations[0] << endl;
+    cout << "Total iterations (warm): ext = " << ext_iterations[1] << ", int = " << int_iterations[1] << endl;
+    cout << "Max. difference of solutions: " << max_diff << endl;
+
+    return ((max_diff < TEST_TOLERANCE) && (ext_iterations[1] <= ext_iterations[0]));
+}
+
+
+int main(int argc, char **argv)
+{
+    cout << "Straight walk" << endl;
+    init_10 cold_straight("");
+    init_10 warm_straight("");
+    const bool straight_ok = run_test (cold_straight, warm_straight);
+
+    cout << "Circular walk" << endl;
+    init_11 cold_circular("");
+    init_11 warm_circular("");
+    const bool circular_ok = run_test (cold_circular, warm_circular);
+
+    return ((straight_ok && circular_ok) ? 0 : 1);
+}
+///@}
@@ -0,0 +1,135 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Compares the logarithmic barrier and the primal-dual methods of
+ *  the interior-point solver: the numbers of iterations and the difference
+ *  of the solutions from the solutions of the active set solver.
+ */
+
+
+#include <cfloat>
+
+#include "tests_common.h"
+
+///@addtogroup gTEST
+///@{
+
+/// Tolerance of comparison of the solutions of the interior-point solvers
+/// with the solutions of the active set solver (both interior-point methods
+/// differ from the active set solver by about 0.14 in the last states of the
+/// circular walk).
+#define TEST_TOLERANCE 2e-1
+
+/**
+ * @brief Runs a simulation, the states are updated using the solutions of
+ * the active set solver, the interior-point solvers get the same problems.
+ *
+ * @param[in] test test scenario
+ * @param[in] tolerance maximal acceptable difference of the solutions
+ *
+ * @return true if all solutions are finite and the differences do not
+ *  exceed the tolerance.
+ */
+template <class t_init>
+bool run_test (t_init &test, const double tolerance = TEST_TOLERANCE)
+{
+    const int N = test.wmg->N;
+
+    smpc::solver_as as_solver(N, 8000.0, 1.0, 0.02, 1.0, 1e-7);
+    smpc::solver_ip_parameters pd_par;
+    pd_par.method = smpc::SMPC_IP_METHOD_PRIMAL_DUAL;
+
+    smpc::solver_ip bar_solver(N, 8000.0, 1.0, 0.02, 1.0, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+            smpc::SMPC_IP_BS_LOGBAR, false);
+    smpc::solver_ip pd_solver(N, 8000.0, 1.0, 0.02, 1.0, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+            smpc::SMPC_IP_BS_LOGBAR, false, pd_par);
+
+    smpc::solver_ip *solvers[2] = {&bar_solver, &pd_solver};
+
+    vector<double> X_ip (N*SMPC_NUM_VAR);
+    unsigned int iterations[2] = {0, 0};
+    double max_diff[2] = {0.0, 0.0};
+    unsigned int nonfinite[2] = {0, 0};
+
+    for(int counter = 0; ; counter++)
+    {
+        //------------------------------------------------------
+        if (test.wmg->formPreviewWindow(*test.par) == WMG_HALT)
+        {
+            break;
+        }
+        //------------------------------------------------------
+
+        smpc_parameters *par = test.par;
+
+        as_solver.set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+        as_solver.form_init_fp (par->fp_x, par->fp_y, par->init_state, par->X);
+        as_solver.solve();
+
+        double diff[2] = {0.0, 0.0};
+        for (int j = 0; j < 2; ++j)
+        {
+            solvers[j]->set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+            solvers[j]->form_init_fp (par->fp_x, par->fp_y, par->init_state, &X_ip[0]);
+            solvers[j]->solve();
+
+            for (int i = 0; i < N*SMPC_NUM_VAR; ++i)
+            {
+                // false for NaN and infinity
+                if (!(abs(X_ip[i]) <= DBL_MAX))
+                {
+                    ++nonfinite[j];
+                }
+                diff[j] = max (diff[j], abs(par->X[i] - X_ip[i]));
+            }
+            max_diff[j] = max (max_diff[j], diff[j]);
+            iterations[j] += solvers[j]->int_loop_iterations;
+        }
+
+        as_solver.get_next_state(par->init_state);
+
+        printf("(%3i) barrier: int = %3d, diff = % 8e | primal-dual: int = %3d, diff = % 8e\n",
+                counter,
+                bar_solver.int_loop_iterations, diff[0],
+                pd_solver.int_loop_iterations, diff[1]);
+    }
+
+    cout << "Total iterations (barrier): " << iterations[0] << endl;
+    cout << "Total iterations (primal-dual): " << iterations[1] << endl;
+    cout << "Max. difference from AS (barrier): " << max_diff[0] << endl;
+    cout << "Max. difference from AS (primal-dual): " << max_diff[1] << endl;
+
+    cout << "Non-finite elements of solutions (barrier / primal-dual): "
+        << nonfinite[0] << " / " << nonfinite[1] << endl;
+
+    return ((nonfinite[0] == 0) && (nonfinite[1] == 0)
+            && (max_diff[0] <= tolerance) && (max_diff[1] <= tolerance));
+}
+
+
+int main(int argc, char **argv)
+{
+    bool result = true;
+
+    cout << "Straight walk" << endl;
+    init_10 straight("");
+    result = run_test (straight) && result;
+
+    cout << "Circular walk" << endl;
+    init_11 circular("");
+    result = run_test (circular) && result;
+
+    cout << "Straight walk (N = 100)" << endl;
+    init_10 straight_long("", true, 100);
+    result = run_test (straight_long) && result;
+
+    // The simulation diverges in the end of the walk, when the preview
+    // window is that short: the jerks reach 1e13 and the solutions of all
+    // solvers differ in absolute terms, only the finiteness is checked.
+    cout << "Straight walk (N = 10)" << endl;
+    init_10 straight_short("", true, 10);
+    result = run_test (straight_short, DBL_MAX) && result;
+
+    return (result ? 0 : 1);
+}
+///@}
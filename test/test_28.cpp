@@ -0,0 +1,136 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Compares the interior-point solver with and without reuse of the
+ *  Cholesky factor (see refactor_tol parameter of smpc::solver_ip): the time,
+ *  the numbers of iterations and the difference of the solutions.
+ */
+
+
+#include <sys/time.h>
+#include <time.h>
+
+#include "tests_common.h"
+
+///@addtogroup gTEST
+///@{
+
+/// The number of tested values of refactor_tol.
+#define TEST_NUM_REFACTOR_TOL 4
+
+/// Tolerance of comparison of the solutions of the barrier method with and
+/// without reuse of the factor (the difference is about 6e-3).
+#define TEST_TOLERANCE_BARRIER 1e-2
+
+
+/**
+ * @brief Runs a simulation, the states are updated using the solutions of
+ * the solver, which always forms the factor from scratch; the other solvers
+ * get the same problems.
+ *
+ * @param[in] test test scenario
+ * @param[in] method interior-point method
+ * @param[in] tolerance maximal acceptable difference of the solutions
+ *
+ * @return true if the differences do not exceed the tolerance.
+ */
+template <class t_init>
+bool run_test (t_init &test, const smpc::ipMethodType method, const double tolerance)
+{
+    bool result = true;
+    const int N = test.wmg->N;
+    const double refactor_tol[TEST_NUM_REFACTOR_TOL] = {0.0, 0.01, 0.1, 0.5};
+
+    smpc::solver_ip *solvers[TEST_NUM_REFACTOR_TOL];
+    vector<double> X[TEST_NUM_REFACTOR_TOL];
+    double time[TEST_NUM_REFACTOR_TOL];
+    unsigned int iterations[TEST_NUM_REFACTOR_TOL];
+    double max_diff[TEST_NUM_REFACTOR_TOL];
+
+    for (int j = 0; j < TEST_NUM_REFACTOR_TOL; ++j)
+    {
+        smpc::solver_ip_parameters ip_par;
+        ip_par.method = method;
+        ip_par.refactor_tol = refactor_tol[j];
+
+        solvers[j] = new smpc::solver_ip(N, 8000.0, 1.0, 0.02, 1.0, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+                smpc::SMPC_IP_BS_LOGBAR, false, ip_par);
+        X[j].resize (N*SMPC_NUM_VAR);
+        time[j] = 0.0;
+        iterations[j] = 0;
+        max_diff[j] = 0.0;
+    }
+
+
+    for(;;)
+    {
+        //------------------------------------------------------
+        if (test.wmg->formPreviewWindow(*test.par) == WMG_HALT)
+        {
+            break;
+        }
+        //------------------------------------------------------
+
+        smpc_parameters *par = test.par;
+
+        for (int j = 0; j < TEST_NUM_REFACTOR_TOL; ++j)
+        {
+            struct timeval start, end;
+
+            gettimeofday(&start,0);
+            solvers[j]->set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+            solvers[j]->form_init_fp (par->fp_x, par->fp_y, par->init_state, &X[j][0]);
+            solvers[j]->solve();
+            gettimeofday(&end,0);
+
+            time[j] += end.tv_sec - start.tv_sec + 0.000001 * (end.tv_usec - start.tv_usec);
+            iterations[j] += solvers[j]->int_loop_iterations;
+            for (int i = 0; i < N*SMPC_NUM_VAR; ++i)
+            {
+                max_diff[j] = max (max_diff[j], abs(X[0][i] - X[j][i]));
+            }
+        }
+
+        solvers[0]->get_next_state(par->init_state);
+    }
+
+
+    for (int j = 0; j < TEST_NUM_REFACTOR_TOL; ++j)
+    {
+        printf("refactor_tol = %4.2f: time = % f, iterations = %5u, max. difference = % 8e\n",
+                refactor_tol[j], time[j], iterations[j], max_diff[j]);
+        if (max_diff[j] > tolerance)
+        {
+            result = false;
+        }
+        delete solvers[j];
+    }
+    return (result);
+}
+
+
+int main(int argc, char **argv)
+{
+    bool result = true;
+
+    cout << "Straight walk (barrier)" << endl;
+    init_10 straight("");
+    result = run_test (straight, smpc::SMPC_IP_METHOD_BARRIER, TEST_TOLERANCE_BARRIER) && result;
+
+    cout << "Circular walk (barrier)" << endl;
+    init_11 circular("");
+    result = run_test (circular, smpc::SMPC_IP_METHOD_BARRIER, TEST_TOLERANCE_BARRIER) && result;
+
+    // the factor is always formed from scratch by the primal-dual method,
+    // the solutions must be identical
+    cout << "Straight walk (primal-dual)" << endl;
+    init_10 straight_pd("");
+    result = run_test (straight_pd, smpc::SMPC_IP_METHOD_PRIMAL_DUAL, 0.0) && result;
+
+    cout << "Circular walk (primal-dual)" << endl;
+    init_11 circular_pd("");
+    result = run_test (circular_pd, smpc::SMPC_IP_METHOD_PRIMAL_DUAL, 0.0) && result;
+
+    return (result ? 0 : 1);
+}
+///@}
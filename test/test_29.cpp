@@ -0,0 +1,113 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Compares the types of the line search of the interior-point
+ *  solver (see smpc::backtrackingSearchType): the time, the numbers of
+ *  iterations and the difference of the solutions.
+ */
+
+
+#include <sys/time.h>
+#include <time.h>
+
+#include "tests_common.h"
+
+///@addtogroup gTEST
+///@{
+
+/// The number of tested types of the line search.
+#define TEST_NUM_BS_TYPES 3
+
+
+/**
+ * @brief Runs a simulation, the states are updated using the solutions of
+ * the solver with the default backtracking search; the other solvers get
+ * the same problems.
+ *
+ * @param[in] test test scenario
+ */
+template <class t_init>
+void run_test (t_init &test)
+{
+    const int N = test.wmg->N;
+    const smpc::backtrackingSearchType bs_type[TEST_NUM_BS_TYPES] = {
+        smpc::SMPC_IP_BS_LOGBAR,
+        smpc::SMPC_IP_BS_ORIGINAL,
+        smpc::SMPC_IP_BS_LOGBAR_NEWTON};
+    const char *bs_name[TEST_NUM_BS_TYPES] = {"logbar", "original", "newton"};
+
+    smpc::solver_ip *solvers[TEST_NUM_BS_TYPES];
+    vector<double> X[TEST_NUM_BS_TYPES];
+    double time[TEST_NUM_BS_TYPES];
+    unsigned int iterations[TEST_NUM_BS_TYPES];
+    unsigned int bs_iterations[TEST_NUM_BS_TYPES];
+    double max_diff[TEST_NUM_BS_TYPES];
+
+    for (int j = 0; j < TEST_NUM_BS_TYPES; ++j)
+    {
+        solvers[j] = new smpc::solver_ip(N, 8000.0, 1.0, 0.02, 1.0, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+                bs_type[j]);
+        X[j].resize (N*SMPC_NUM_VAR);
+        time[j] = 0.0;
+        iterations[j] = 0;
+        bs_iterations[j] = 0;
+        max_diff[j] = 0.0;
+    }
+
+
+    for(;;)
+    {
+        //------------------------------------------------------
+        if (test.wmg->formPreviewWindow(*test.par) == WMG_HALT)
+        {
+            break;
+        }
+        //------------------------------------------------------
+
+        smpc_parameters *par = test.par;
+
+        for (int j = 0; j < TEST_NUM_BS_TYPES; ++j)
+        {
+            struct timeval start, end;
+
+            gettimeofday(&start,0);
+            solvers[j]->set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+            solvers[j]->form_init_fp (par->fp_x, par->fp_y, par->init_state, &X[j][0]);
+            solvers[j]->solve();
+            gettimeofday(&end,0);
+
+            time[j] += end.tv_sec - start.tv_sec + 0.000001 * (end.tv_usec - start.tv_usec);
+            iterations[j] += solvers[j]->int_loop_iterations;
+            bs_iterations[j] += solvers[j]->bt_search_iterations;
+            for (int i = 0; i < N*SMPC_NUM_VAR; ++i)
+            {
+                max_diff[j] = max (max_diff[j], abs(X[0][i] - X[j][i]));
+            }
+        }
+
+        solvers[0]->get_next_state(par->init_state);
+    }
+
+
+    for (int j = 0; j < TEST_NUM_BS_TYPES; ++j)
+    {
+        printf("%-8s: time = % f, iterations = %5u, search iterations = %5u, max. difference = % 8e\n",
+                bs_name[j], time[j], iterations[j], bs_iterations[j], max_diff[j]);
+        delete solvers[j];
+    }
+}
+
+
+int main(int argc, char **argv)
+{
+    cout << "Straight walk" << endl;
+    init_10 straight("");
+    run_test (straight);
+
+    cout << "Circular walk" << endl;
+    init_11 circular("");
+    run_test (circular);
+
+    return 0;
+}
+///@}
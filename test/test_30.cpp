@@ -0,0 +1,179 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Checks that the solutions of the interior-point solver do not
+ *  depend on the orientation of the problem: the problems of a simulation
+ *  are rotated by a constant angle and solved, the rotated back solutions
+ *  must match the solutions of the original problems. If the angle is the
+ *  same for the whole preview window (straight walk), the factorization
+ *  of the solver is decoupled for x and y and performed in the frame of
+ *  the footsteps.
+ */
+
+
+#include "tests_common.h"
+
+///@addtogroup gTEST
+///@{
+
+/// The number of tested solvers.
+#define TEST_NUM_SOLVERS 2
+
+/// The angle, by which the problems are rotated [rad.]
+#define TEST_ROTATION_ANGLE 0.5
+
+/// Maximal acceptable difference of the solutions.
+#define TEST_TOLERANCE 1e-8
+
+
+/**
+ * @brief Rotates a pair of coordinates.
+ *
+ * @param[in] sinA sin of the angle
+ * @param[in] cosA cos of the angle
+ * @param[in,out] x x coordinate
+ * @param[in,out] y y coordinate
+ */
+void rotate (const double sinA, const double cosA, double &x, double &y)
+{
+    const double x_copy = x;
+    x = cosA * x_copy - sinA * y;
+    y = sinA * x_copy + cosA * y;
+}
+
+
+/**
+ * @brief Runs a simulation, the states are updated using the solutions of
+ * the original problems.
+ *
+ * @param[in] test test scenario
+ *
+ * @return maximal difference of the solutions.
+ */
+template <class t_init>
+double run_test (t_init &test)
+{
+    const int N = test.wmg->N;
+    const double sinA = sin(TEST_ROTATION_ANGLE);
+    const double cosA = cos(TEST_ROTATION_ANGLE);
+    const char *names[TEST_NUM_SOLVERS] = {"barrier", "primal-dual"};
+
+    smpc::solver_ip *solvers[TEST_NUM_SOLVERS];
+    smpc::solver_ip *rot_solvers[TEST_NUM_SOLVERS];
+    double max_diff[TEST_NUM_SOLVERS];
+    smpc::solver_ip_parameters pd_par;
+    pd_par.method = smpc::SMPC_IP_METHOD_PRIMAL_DUAL;
+
+    for (int j = 0; j < 2; ++j)
+    {
+        smpc::solver_ip **s = (j == 0) ? solvers : rot_solvers;
+
+        s[0] = new smpc::solver_ip(N, 8000.0, 1.0, 0.02, 1.0, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+                smpc::SMPC_IP_BS_LOGBAR, false);
+        s[1] = new smpc::solver_ip(N, 8000.0, 1.0, 0.02, 1.0, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+                smpc::SMPC_IP_BS_LOGBAR, false, pd_par);
+    }
+    for (int j = 0; j < TEST_NUM_SOLVERS; ++j)
+    {
+        max_diff[j] = 0.0;
+    }
+
+    vector<double> X (N*SMPC_NUM_VAR);
+    vector<double> angle (N);
+    vector<double> zref_x (N);
+    vector<double> zref_y (N);
+    vector<double> fp_x (N);
+    vector<double> fp_y (N);
+
+
+    for(;;)
+    {
+        //------------------------------------------------------
+        if (test.wmg->formPreviewWindow(*test.par) == WMG_HALT)
+        {
+            break;
+        }
+        //------------------------------------------------------
+
+        smpc_parameters *par = test.par;
+
+        // the bounds are given in the frames of the footsteps and do
+        // not change
+        smpc::state_com init_state = par->init_state;
+        for (int k = 0; k < 3; ++k)
+        {
+            rotate (sinA, cosA, init_state.state_vector[k], init_state.state_vector[k+3]);
+        }
+        for (int i = 0; i < N; ++i)
+        {
+            angle[i] = par->angle[i] + TEST_ROTATION_ANGLE;
+            zref_x[i] = par->zref_x[i];
+            zref_y[i] = par->zref_y[i];
+            rotate (sinA, cosA, zref_x[i], zref_y[i]);
+            fp_x[i] = par->fp_x[i];
+            fp_y[i] = par->fp_y[i];
+            rotate (sinA, cosA, fp_x[i], fp_y[i]);
+        }
+
+
+        for (int j = 0; j < TEST_NUM_SOLVERS; ++j)
+        {
+            solvers[j]->set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+            solvers[j]->form_init_fp (par->fp_x, par->fp_y, par->init_state, par->X);
+            solvers[j]->solve();
+
+            rot_solvers[j]->set_parameters (par->T, par->h, par->h0, &angle[0], &zref_x[0], &zref_y[0], par->lb, par->ub);
+            rot_solvers[j]->form_init_fp (&fp_x[0], &fp_y[0], init_state, &X[0]);
+            rot_solvers[j]->solve();
+
+            for (int i = 0; i < N; ++i)
+            {
+                smpc::state_com state;
+                smpc::state_com rot_state;
+                solvers[j]->get_state (state, i);
+                rot_solvers[j]->get_state (rot_state, i);
+
+                for (int k = 0; k < 3; ++k)
+                {
+                    rotate (-sinA, cosA, rot_state.state_vector[k], rot_state.state_vector[k+3]);
+                }
+                for (int k = 0; k < SMPC_NUM_STATE_VAR; ++k)
+                {
+                    max_diff[j] = max (max_diff[j], abs(state.state_vector[k] - rot_state.state_vector[k]));
+                }
+            }
+        }
+
+        solvers[0]->get_next_state(par->init_state);
+    }
+
+
+    double result = 0.0;
+    for (int j = 0; j < TEST_NUM_SOLVERS; ++j)
+    {
+        printf("%-12s max. difference = % 8e\n", names[j], max_diff[j]);
+        result = max (result, max_diff[j]);
+        delete solvers[j];
+        delete rot_solvers[j];
+    }
+    return (result);
+}
+
+
+int main(int argc, char **argv)
+{
+    double max_diff = 0.0;
+
+    cout << "Straight walk" << endl;
+    init_10 straight("");
+    max_diff = max (max_diff, run_test (straight));
+
+    cout << "Circular walk" << endl;
+    init_11 circular("");
+    max_diff = max (max_diff, run_test (circular));
+
+    cout << "Rotation: " << ((max_diff > TEST_TOLERANCE) ? "FAILED" : "OK") << endl;
+
+    return ((max_diff > TEST_TOLERANCE) ? 1 : 0);
+}
+///@}
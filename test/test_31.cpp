@@ -0,0 +1,225 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Runs several simulations at once: the problems are solved by
+ *  smpc::solver_batch and by a separate set of solvers, which are called
+ *  sequentially. The solutions must be identical.
+ */
+
+
+#include "tests_common.h"
+#include "smpc_batch.h"
+
+///@addtogroup gTEST
+///@{
+
+/// The number of simulations.
+#define TEST_NUM_ROBOTS 4
+
+/// The number of threads used by the batch.
+#define TEST_NUM_THREADS 3
+
+
+/**
+ * @brief Creates the solvers for a simulation: active set and
+ * interior-point.
+ *
+ * @param[in] N preview window length
+ * @param[out] solvers the solvers
+ */
+void create_solvers (const int N, smpc::solver *solvers[2])
+{
+    smpc::solver_ip_parameters ip_par;
+    ip_par.warm_start_on = true;
+
+    solvers[0] = new smpc::solver_as(N);
+    solvers[1] = new smpc::solver_ip(N, 8000.0, 1.0, 0.02, 1.0, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+            smpc::SMPC_IP_BS_LOGBAR, false, ip_par);
+}
+
+
+/**
+ * @brief Copies the parameters of a problem to the buffers of the batch.
+ *
+ * @param[in] par parameters
+ * @param[in,out] p problem
+ */
+void copy_parameters (const smpc_parameters &par, smpc::batch_problem &p)
+{
+    const int N = p.N;
+
+    for (int i = 0; i < N; ++i)
+    {
+        p.T[i] = par.T[i];
+        p.h[i] = par.h[i];
+        p.angle[i] = par.angle[i];
+        p.zref_x[i] = par.zref_x[i];
+        p.zref_y[i] = par.zref_y[i];
+        p.fp_x[i] = par.fp_x[i];
+        p.fp_y[i] = par.fp_y[i];
+    }
+    for (int i = 0; i < 2*N; ++i)
+    {
+        p.lb[i] = par.lb[i];
+        p.ub[i] = par.ub[i];
+    }
+    p.h_initial = par.h0;
+    for (int i = 0; i < SMPC_NUM_STATE_VAR; ++i)
+    {
+        p.init_state.state_vector[i] = par.init_state.state_vector[i];
+    }
+    p.init_state_zmp = false;
+}
+
+
+/**
+ * @brief Compares the solutions of two solvers.
+ *
+ * @param[in] N preview window length
+ * @param[in] s1 solver
+ * @param[in] s2 solver
+ *
+ * @return true if the states and the controls are identical.
+ */
+bool compare (const int N, const smpc::solver &s1, const smpc::solver &s2)
+{
+    for (int i = 0; i < N; ++i)
+    {
+        smpc::state_zmp state1;
+        smpc::state_zmp state2;
+        smpc::control control1;
+        smpc::control control2;
+
+        s1.get_state (state1, i);
+        s2.get_state (state2, i);
+        s1.get_controls (control1, i);
+        s2.get_controls (control2, i);
+
+        for (int k = 0; k < SMPC_NUM_STATE_VAR; ++k)
+        {
+            if ((state1.state_vector[k] < state2.state_vector[k])
+                    || (state1.state_vector[k] > state2.state_vector[k]))
+            {
+                return (false);
+            }
+        }
+        for (int k = 0; k < SMPC_NUM_CONTROL_VAR; ++k)
+        {
+            if ((control1.control_vector[k] < control2.control_vector[k])
+                    || (control1.control_vector[k] > control2.control_vector[k]))
+            {
+                return (false);
+            }
+        }
+    }
+    return (true);
+}
+
+
+int main(int argc, char **argv)
+{
+    test_init_base *robots[TEST_NUM_ROBOTS] = {
+        new init_10 ("", false),
+        new init_11 ("", false),
+        new init_04 ("", false),
+        new init_08 ("", false)};
+
+    smpc::solver_batch batch (TEST_NUM_THREADS, true);
+    smpc::solver *serial[TEST_NUM_ROBOTS][2];
+    bool running[TEST_NUM_ROBOTS];
+
+    for (int r = 0; r < TEST_NUM_ROBOTS; ++r)
+    {
+        const int N = robots[r]->wmg->N;
+        smpc::solver *solvers[2];
+
+        create_solvers (N, solvers);
+        batch.add (solvers[0], N);
+        batch.add (solvers[1], N);
+
+        create_solvers (N, serial[r]);
+        running[r] = true;
+    }
+
+
+    bool result = true;
+    int running_num = TEST_NUM_ROBOTS;
+    int iter_num = 0;
+    unsigned int stolen_num = 0;
+    while ((running_num > 0) && result)
+    {
+        for (int r = 0; r < TEST_NUM_ROBOTS; ++r)
+        {
+            if (running[r] && (robots[r]->wmg->formPreviewWindow(*robots[r]->par) == WMG_HALT))
+            {
+                running[r] = false;
+                --running_num;
+            }
+
+            for (int j = 0; j < 2; ++j)
+            {
+                smpc::batch_problem &p = batch.problem(2*r + j);
+
+                p.enabled = running[r];
+                if (p.enabled)
+                {
+                    copy_parameters (*robots[r]->par, p);
+                }
+            }
+        }
+        if (running_num == 0)
+        {
+            break;
+        }
+
+
+        const unsigned int solved_num = batch.solve_all();
+        stolen_num += batch.stolen_num;
+        if (solved_num != 2*static_cast<unsigned int>(running_num))
+        {
+            result = false;
+        }
+
+
+        for (int r = 0; r < TEST_NUM_ROBOTS; ++r)
+        {
+            if (!running[r])
+            {
+                continue;
+            }
+
+            smpc_parameters *par = robots[r]->par;
+            const int N = robots[r]->wmg->N;
+            for (int j = 0; j < 2; ++j)
+            {
+                const smpc::batch_problem &p = batch.problem(2*r + j);
+
+                serial[r][j]->set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+                serial[r][j]->form_init_fp (par->fp_x, par->fp_y, par->init_state, par->X);
+                serial[r][j]->solve();
+
+                if ((p.status != smpc::SMPC_BATCH_SOLVED) || !compare (N, *p.sol, *serial[r][j]))
+                {
+                    result = false;
+                }
+            }
+
+            serial[r][0]->get_next_state(par->init_state);
+        }
+        ++iter_num;
+    }
+
+
+    printf("Iterations: %d, threads: %u, stolen problems: %u\n", iter_num, batch.get_threads_num(), stolen_num);
+    cout << "Batch: " << (result ? "OK" : "FAILED") << endl;
+
+    for (int r = 0; r < TEST_NUM_ROBOTS; ++r)
+    {
+        delete serial[r][0];
+        delete serial[r][1];
+        delete robots[r];
+    }
+
+    return (result ? 0 : 1);
+}
+///@}
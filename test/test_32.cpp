@@ -0,0 +1,178 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Runs several simulations at once: the problems are solved by
+ *  smpc::solver_ip_lockstep and by a separate set of interior-point
+ *  solvers. The solutions must be the same up to rounding errors.
+ */
+
+
+#include "tests_common.h"
+#include "smpc_lockstep.h"
+
+///@addtogroup gTEST
+///@{
+
+/// The number of simulations (lanes).
+#define TEST_NUM_ROBOTS 4
+
+/// Tolerance of comparison of the solutions.
+#define TEST_TOLERANCE 1e-8
+
+
+/**
+ * @brief Compares the solutions of the solvers.
+ *
+ * @param[in] N preview window length
+ * @param[in] lane index of the problem in the lockstep solver
+ * @param[in] s1 lockstep solver
+ * @param[in] s2 solver
+ * @param[in,out] max_diff maximal difference
+ *
+ * @return true if the states and the controls are identical.
+ */
+bool compare (
+        const int N,
+        const int lane,
+        const smpc::solver_ip_lockstep<TEST_NUM_ROBOTS> &s1,
+        const smpc::solver &s2,
+        double &max_diff)
+{
+    bool identical = true;
+
+    for (int i = 0; i < N; ++i)
+    {
+        smpc::state_zmp state1;
+        smpc::state_zmp state2;
+        smpc::control control1;
+        smpc::control control2;
+
+        s1.get_state (lane, state1, i);
+        s2.get_state (state2, i);
+        s1.get_controls (lane, control1, i);
+        s2.get_controls (control2, i);
+
+        for (int k = 0; k < SMPC_NUM_STATE_VAR; ++k)
+        {
+            const double diff = fabs (state1.state_vector[k] - state2.state_vector[k]);
+            max_diff = max (max_diff, diff);
+            identical = identical && !(diff > 0.0);
+        }
+        for (int k = 0; k < SMPC_NUM_CONTROL_VAR; ++k)
+        {
+            const double diff = fabs (control1.control_vector[k] - control2.control_vector[k]);
+            max_diff = max (max_diff, diff);
+            identical = identical && !(diff > 0.0);
+        }
+    }
+    return (identical);
+}
+
+
+int main(int argc, char **argv)
+{
+    test_init_base *robots[TEST_NUM_ROBOTS] = {
+        new init_01 ("", false),
+        new init_02 ("", false),
+        new init_03 ("", false),
+        new init_04 ("", false)};
+
+    const int N = robots[0]->wmg->N;
+    smpc::solver_ip_lockstep<TEST_NUM_ROBOTS> lockstep (N);
+    smpc::solver_ip *serial[TEST_NUM_ROBOTS];
+    double *X[TEST_NUM_ROBOTS];
+    bool running[TEST_NUM_ROBOTS];
+
+    for (int r = 0; r < TEST_NUM_ROBOTS; ++r)
+    {
+        serial[r] = new smpc::solver_ip(N);
+        X[r] = new double[SMPC_NUM_VAR*N];
+        running[r] = true;
+    }
+
+
+    bool result = true;
+    int running_num = TEST_NUM_ROBOTS;
+    int iter_num = 0;
+    int identical_num = 0;
+    int solved_num = 0;
+    double max_diff = 0.0;
+    unsigned int lockstep_iter_num = 0;
+    unsigned int int_iter_num = 0;
+    for (;;)
+    {
+        for (int r = 0; r < TEST_NUM_ROBOTS; ++r)
+        {
+            // The lane of a finished simulation solves its last problem
+            // again, the solution is not checked.
+            if (running[r] && (robots[r]->wmg->formPreviewWindow(*robots[r]->par) == WMG_HALT))
+            {
+                running[r] = false;
+                --running_num;
+            }
+        }
+        if (running_num == 0)
+        {
+            break;
+        }
+
+
+        for (int r = 0; r < TEST_NUM_ROBOTS; ++r)
+        {
+            smpc_parameters *par = robots[r]->par;
+
+            lockstep.set_parameters (r, par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+            lockstep.form_init_fp (r, par->fp_x, par->fp_y, par->init_state, X[r]);
+        }
+        lockstep.solve();
+        lockstep_iter_num += lockstep.lockstep_iterations;
+
+
+        for (int r = 0; r < TEST_NUM_ROBOTS; ++r)
+        {
+            if (!running[r])
+            {
+                continue;
+            }
+
+            smpc_parameters *par = robots[r]->par;
+
+            serial[r]->set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+            serial[r]->form_init_fp (par->fp_x, par->fp_y, par->init_state, par->X);
+            serial[r]->solve();
+            int_iter_num += serial[r]->int_loop_iterations;
+
+            double diff = 0.0;
+            if (compare (N, r, lockstep, *serial[r], diff))
+            {
+                ++identical_num;
+            }
+            max_diff = max (max_diff, diff);
+            if (diff > TEST_TOLERANCE)
+            {
+                result = false;
+            }
+            ++solved_num;
+
+            serial[r]->get_next_state(par->init_state);
+        }
+        ++iter_num;
+    }
+
+
+    printf("Iterations: %d, identical solutions: %d of %d, max difference: %e\n",
+            iter_num, identical_num, solved_num, max_diff);
+    printf("Internal loop iterations: serial %u, lockstep %u (x%d lanes)\n",
+            int_iter_num, lockstep_iter_num, TEST_NUM_ROBOTS);
+    cout << "Lockstep: " << (result ? "OK" : "FAILED") << endl;
+
+    for (int r = 0; r < TEST_NUM_ROBOTS; ++r)
+    {
+        delete serial[r];
+        delete [] X[r];
+        delete robots[r];
+    }
+
+    return (result ? 0 : 1);
+}
+///@}
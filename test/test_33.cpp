@@ -0,0 +1,162 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Solves several disturbance scenarios (perturbed reference ZMP
+ *  positions and initial states) with smpc::solver#solve_multi and
+ *  separately with smpc::solver#solve. The solutions must be identical.
+ */
+
+
+#include "tests_common.h"
+
+///@addtogroup gTEST
+///@{
+
+/// The number of scenarios.
+#define TEST_NUM_SCENARIOS 5
+
+
+/**
+ * @brief Compares two solutions.
+ *
+ * @param[in] len the number of elements
+ * @param[in] X1 solution
+ * @param[in] X2 solution
+ *
+ * @return true if the solutions are identical.
+ */
+bool compare (const int len, const double *X1, const double *X2)
+{
+    for (int i = 0; i < len; ++i)
+    {
+        if ((X1[i] < X2[i]) || (X1[i] > X2[i]))
+        {
+            return (false);
+        }
+    }
+    return (true);
+}
+
+
+/**
+ * @brief Runs a simulation, the scenarios are formed around the nominal
+ * problem in each preview window.
+ *
+ * @param[in] name name of the solvers
+ * @param[in] sol_multi solver, which is used to solve all scenarios at once.
+ * @param[in] sol solver, which is used to solve the scenarios separately.
+ *
+ * @return true if the solutions are identical.
+ */
+bool run (const char *name, smpc::solver &sol_multi, smpc::solver &sol)
+{
+    init_10 robot ("", false);
+    const int N = robot.wmg->N;
+
+    double *zref_x[TEST_NUM_SCENARIOS];
+    double *zref_y[TEST_NUM_SCENARIOS];
+    double *X_multi[TEST_NUM_SCENARIOS];
+    double *X = new double[SMPC_NUM_VAR*N];
+    smpc::state_com init_state[TEST_NUM_SCENARIOS];
+
+    for (int m = 0; m < TEST_NUM_SCENARIOS; ++m)
+    {
+        zref_x[m] = new double[N];
+        zref_y[m] = new double[N];
+        X_multi[m] = new double[SMPC_NUM_VAR*N];
+    }
+
+
+    bool result = true;
+    int iter_num = 0;
+    while (robot.wmg->formPreviewWindow(*robot.par) != WMG_HALT)
+    {
+        smpc_parameters *par = robot.par;
+
+        // scenarios: the reference ZMP is shifted, the velocity of the CoM
+        // is perturbed
+        for (int m = 0; m < TEST_NUM_SCENARIOS; ++m)
+        {
+            const double shift = 0.004 * (m - TEST_NUM_SCENARIOS/2);
+            for (int i = 0; i < N; ++i)
+            {
+                zref_x[m][i] = par->zref_x[i] + shift;
+                zref_y[m][i] = par->zref_y[i] - shift;
+            }
+
+            init_state[m] = par->init_state;
+            init_state[m].state_vector[1] += 0.01 * shift;
+            init_state[m].state_vector[4] -= 0.01 * shift;
+        }
+
+
+        sol_multi.set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+        for (int m = 0; m < TEST_NUM_SCENARIOS; ++m)
+        {
+            sol_multi.form_init_fp (par->fp_x, par->fp_y, init_state[m], X_multi[m]);
+        }
+        sol_multi.solve_multi (TEST_NUM_SCENARIOS, zref_x, zref_y, X_multi);
+
+
+        for (int m = 0; m < TEST_NUM_SCENARIOS; ++m)
+        {
+            sol.set_parameters (par->T, par->h, par->h0, par->angle, zref_x[m], zref_y[m], par->lb, par->ub);
+            sol.form_init_fp (par->fp_x, par->fp_y, init_state[m], X);
+            sol.solve();
+
+            if (!compare (SMPC_NUM_VAR*N, X, X_multi[m]))
+            {
+                result = false;
+            }
+        }
+
+
+        // the simulation continues from the state of the last scenario
+        sol.get_next_state(par->init_state);
+        ++iter_num;
+    }
+
+    printf("%s: preview windows: %d, scenarios: %d\n", name, iter_num, TEST_NUM_SCENARIOS);
+
+    for (int m = 0; m < TEST_NUM_SCENARIOS; ++m)
+    {
+        delete [] zref_x[m];
+        delete [] zref_y[m];
+        delete [] X_multi[m];
+    }
+    delete [] X;
+
+    return (result);
+}
+
+
+int main(int argc, char **argv)
+{
+    bool result = true;
+
+    {
+        const int N = 40;
+        smpc::solver_as sol_multi (N);
+        smpc::solver_as sol (N);
+        result = run ("AS", sol_multi, sol) && result;
+    }
+    {
+        // the scenarios are solved in groups
+        const int N = 40;
+        smpc::solver_as sol_multi (N);
+        smpc::solver_as sol (N);
+        sol_multi.reserve_multi (2);
+        result = run ("AS (groups)", sol_multi, sol) && result;
+    }
+    {
+        const int N = 40;
+        smpc::solver_ip sol_multi (N);
+        smpc::solver_ip sol (N);
+        result = run ("IP", sol_multi, sol) && result;
+    }
+
+    cout << "Multiple right-hand sides: " << (result ? "OK" : "FAILED") << endl;
+
+    return (result ? 0 : 1);
+}
+///@}
@@ -0,0 +1,144 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Runs simulations with the solvers, which use the Cholesky
+ *  factorization and the Riccati recursion to solve the KKT systems.
+ *  The solutions must be the same up to rounding errors.
+ */
+
+
+#include "tests_common.h"
+
+///@addtogroup gTEST
+///@{
+
+/// Tolerance of comparison of the solutions.
+#define TEST_TOLERANCE 1e-6
+
+
+/**
+ * @brief Runs a simulation with two solvers.
+ *
+ * @param[in] name name of the solvers
+ * @param[in] test_name name of the test scenario
+ * @param[in,out] robot test scenario
+ * @param[in] sol_chol solver, which uses the Cholesky factorization.
+ * @param[in] sol_ric solver, which uses the Riccati recursion.
+ *
+ * @return true if the difference between the solutions does not exceed
+ *  #TEST_TOLERANCE.
+ */
+bool run (
+        const char *name,
+        const char *test_name,
+        test_init_base &robot,
+        smpc::solver &sol_chol,
+        smpc::solver &sol_ric)
+{
+    const int N = robot.wmg->N;
+    double *X = new double[SMPC_NUM_VAR*N];
+
+    double max_diff = 0.0;
+    int iter_num = 0;
+    while (robot.wmg->formPreviewWindow(*robot.par) != WMG_HALT)
+    {
+        smpc_parameters *par = robot.par;
+
+        sol_chol.set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+        sol_chol.form_init_fp (par->fp_x, par->fp_y, par->init_state, par->X);
+        sol_chol.solve();
+
+        sol_ric.set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+        sol_ric.form_init_fp (par->fp_x, par->fp_y, par->init_state, X);
+        sol_ric.solve();
+
+        for (int i = 0; i < N; ++i)
+        {
+            smpc::state_zmp state1;
+            smpc::state_zmp state2;
+            smpc::control control1;
+            smpc::control control2;
+
+            sol_chol.get_state (state1, i);
+            sol_ric.get_state (state2, i);
+            sol_chol.get_controls (control1, i);
+            sol_ric.get_controls (control2, i);
+
+            for (int k = 0; k < SMPC_NUM_STATE_VAR; ++k)
+            {
+                max_diff = max (max_diff, fabs (state1.state_vector[k] - state2.state_vector[k]));
+            }
+            for (int k = 0; k < SMPC_NUM_CONTROL_VAR; ++k)
+            {
+                max_diff = max (max_diff, fabs (control1.control_vector[k] - control2.control_vector[k]));
+            }
+        }
+
+        sol_chol.get_next_state(par->init_state);
+        ++iter_num;
+    }
+    delete [] X;
+
+    printf("%-4s %s: iterations: %d, max difference: %e\n", name, test_name, iter_num, max_diff);
+
+    return (max_diff < TEST_TOLERANCE);
+}
+
+
+int main(int argc, char **argv)
+{
+    bool result = true;
+
+    {
+        init_03 robot ("", false);
+        const int N = robot.wmg->N;
+        smpc::solver_as sol_chol (N);
+        smpc::solver_as sol_ric (N, 2000.0, 150.0, 0.02, 1.0, 1e-7, 0, true, false, false, 1, smpc::SMPC_KKT_RICCATI);
+        result = run ("AS", "init_03", robot, sol_chol, sol_ric) && result;
+    }
+    {
+        init_10 robot ("", false);
+        const int N = robot.wmg->N;
+        smpc::solver_as sol_chol (N);
+        smpc::solver_as sol_ric (N, 2000.0, 150.0, 0.02, 1.0, 1e-7, 0, true, false, false, 1, smpc::SMPC_KKT_RICCATI);
+        result = run ("AS", "init_10", robot, sol_chol, sol_ric) && result;
+    }
+    {
+        init_03 robot ("", false);
+        const int N = robot.wmg->N;
+        smpc::solver_ip sol_chol (N);
+        smpc::solver_ip_parameters ric_par;
+        ric_par.kkt_solver = smpc::SMPC_KKT_RICCATI;
+        smpc::solver_ip sol_ric (N, 2000.0, 150.0, 0.01, 1.0, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+                smpc::SMPC_IP_BS_LOGBAR, false, ric_par);
+        result = run ("IP", "init_03", robot, sol_chol, sol_ric) && result;
+    }
+    {
+        init_11 robot ("", false);
+        const int N = robot.wmg->N;
+        smpc::solver_ip sol_chol (N);
+        smpc::solver_ip_parameters ric_par;
+        ric_par.kkt_solver = smpc::SMPC_KKT_RICCATI;
+        smpc::solver_ip sol_ric (N, 2000.0, 150.0, 0.01, 1.0, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+                smpc::SMPC_IP_BS_LOGBAR, false, ric_par);
+        result = run ("IP", "init_11", robot, sol_chol, sol_ric) && result;
+    }
+    {
+        init_03 robot ("", false);
+        const int N = robot.wmg->N;
+        smpc::solver_ip_parameters chol_par;
+        chol_par.method = smpc::SMPC_IP_METHOD_PRIMAL_DUAL;
+        smpc::solver_ip_parameters ric_par = chol_par;
+        ric_par.kkt_solver = smpc::SMPC_KKT_RICCATI;
+        smpc::solver_ip sol_chol (N, 2000.0, 150.0, 0.01, 1.0, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+                smpc::SMPC_IP_BS_LOGBAR, false, chol_par);
+        smpc::solver_ip sol_ric (N, 2000.0, 150.0, 0.01, 1.0, 1e-3, 1e-2, 100, 15, 0.01, 0.5, 0,
+                smpc::SMPC_IP_BS_LOGBAR, false, ric_par);
+        result = run ("IPD", "init_03", robot, sol_chol, sol_ric) && result;
+    }
+
+    cout << "Riccati recursion: " << (result ? "OK" : "FAILED") << endl;
+
+    return (result ? 0 : 1);
+}
+///@}
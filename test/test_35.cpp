@@ -0,0 +1,134 @@
+/**
+ * @file
+ * @author Alexander Sherikov
+ * @brief Runs simulations with the active set solvers, which use the sparse
+ *  and the condensed formulations of the problem. The solutions must be
+ *  the same up to rounding errors.
+ */
+
+
+#include <stdexcept>
+#include "tests_common.h"
+
+///@addtogroup gTEST
+///@{
+
+/// Tolerance of comparison of the solutions.
+#define TEST_TOLERANCE 1e-6
+
+
+/**
+ * @brief Runs a simulation with two solvers.
+ *
+ * @param[in] name name of the test case
+ * @param[in,out] robot test scenario
+ * @param[in] sol_sparse solver, which uses the sparse formulation.
+ * @param[in] sol_cnd solver, which uses the condensed formulation.
+ *
+ * @return true if the difference between the solutions does not exceed
+ *  #TEST_TOLERANCE.
+ */
+bool run (
+        const char *name,
+        test_init_base &robot,
+        smpc::solver &sol_sparse,
+        smpc::solver &sol_cnd)
+{
+    const int N = robot.wmg->N;
+    double *X = new double[SMPC_NUM_VAR*N];
+
+    double max_diff = 0.0;
+    int iter_num = 0;
+    while (robot.wmg->formPreviewWindow(*robot.par) != WMG_HALT)
+    {
+        smpc_parameters *par = robot.par;
+
+        sol_sparse.set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+        sol_sparse.form_init_fp (par->fp_x, par->fp_y, par->init_state, par->X);
+        sol_sparse.solve();
+
+        sol_cnd.set_parameters (par->T, par->h, par->h0, par->angle, par->zref_x, par->zref_y, par->lb, par->ub);
+        sol_cnd.form_init_fp (par->fp_x, par->fp_y, par->init_state, X);
+        sol_cnd.solve();
+
+        for (int i = 0; i < N; ++i)
+        {
+            smpc::state_zmp state1;
+            smpc::state_zmp state2;
+            smpc::control control1;
+            smpc::control control2;
+
+            sol_sparse.get_state (state1, i);
+            sol_cnd.get_state (state2, i);
+            sol_sparse.get_controls (control1, i);
+            sol_cnd.get_controls (control2, i);
+
+            for (int k = 0; k < SMPC_NUM_STATE_VAR; ++k)
+            {
+                max_diff = max (max_diff, fabs (state1.state_vector[k] - state2.state_vector[k]));
+            }
+            for (int k = 0; k < SMPC_NUM_CONTROL_VAR; ++k)
+            {
+                max_diff = max (max_diff, fabs (control1.control_vector[k] - control2.control_vector[k]));
+            }
+        }
+
+        sol_sparse.get_next_state(par->init_state);
+        ++iter_num;
+    }
+    delete [] X;
+
+    printf("%-22s N = %2d, iterations: %d, max difference: %e\n", name, N, iter_num, max_diff);
+
+    return (max_diff < TEST_TOLERANCE);
+}
+
+
+int main(int argc, char **argv)
+{
+    bool result = true;
+
+    {
+        init_03 robot ("", false);
+        const int N = robot.wmg->N;
+        smpc::solver_as sol_sparse (N);
+        smpc::solver_as sol_cnd (N, 2000.0, 150.0, 0.02, 1.0, 1e-7, 0, true, false, false, 1, smpc::SMPC_KKT_CONDENSED);
+        result = run ("init_03", robot, sol_sparse, sol_cnd) && result;
+    }
+    {
+        init_08 robot ("", false);
+        const int N = robot.wmg->N;
+        smpc::solver_as sol_sparse (N, 2000.0, 150.0, 0.02, 1.0, 1e-7, 0, true, false, true);
+        smpc::solver_as sol_cnd (N, 2000.0, 150.0, 0.02, 1.0, 1e-7, 0, true, false, true, 1, smpc::SMPC_KKT_CONDENSED);
+        result = run ("init_08 (warm start)", robot, sol_sparse, sol_cnd) && result;
+    }
+    {
+        init_10 robot ("", false, SMPC_AS_CONDENSED_MAX_N);
+        const int N = robot.wmg->N;
+        smpc::solver_as sol_sparse (N);
+        smpc::solver_as sol_cnd (N, 2000.0, 150.0, 0.02, 1.0, 1e-7, 0, true, false, false, 1, smpc::SMPC_KKT_AUTO);
+        result = run ("init_10 (auto)", robot, sol_sparse, sol_cnd) && result;
+    }
+    {
+        // the condensed formulation is not implemented for IP
+        smpc::solver_ip_parameters ip_par;
+        ip_par.kkt_solver = smpc::SMPC_KKT_CONDENSED;
+        bool rejected = false;
+        try
+        {
+            smpc::solver_ip sol_cnd (SMPC_AS_CONDENSED_MAX_N, 2000.0, 150.0, 0.01, 1.0, 1e-3, 1e-2,
+                    100, 15, 0.01, 0.5, 0, smpc::SMPC_IP_BS_LOGBAR, false, ip_par);
+        }
+        catch (const std::invalid_argument &)
+        {
+            rejected = true;
+        }
+        cout << "IP with condensed formulation: " << (rejected ? "rejected" : "FAILED") << endl;
+        result = rejected && result;
+    }
+
+    cout << "Condensed formulation: " << (result ? "OK" : "FAILED") << endl;
+
+    return (result ? 0 : 1);
+}
+///@}
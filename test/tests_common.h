@@ -29,7 +29,7 @@ class test_init_base
                 fs_out_filename = name + "_fs.m";
             }
         }
-        ~test_init_base()
+        virtual ~test_init_base()
         {
             if (!name.empty())
             {
@@ -571,11 +571,11 @@ class init_09 : public test_init_base
 class init_10 : public test_init_base
 {
     public:
-        init_10 (const string & test_name, const bool plot_ds_ = true) : 
+        init_10 (const string & test_name, const bool plot_ds_ = true, const int N = 40) : 
             test_init_base (test_name, plot_ds_)
         {
             int preview_sampling_time_ms = 40;
-            wmg = new WMG (40, preview_sampling_time_ms, 0.02);
+            wmg = new WMG (N, preview_sampling_time_ms, 0.02);
             par = new smpc_parameters (wmg->N, 0.252007);
             int ss_time_ms = 400;
             int ds_time_ms = 40;
@@ -631,11 +631,11 @@ class init_10 : public test_init_base
 class init_11 : public test_init_base
 {
     public:
-        init_11 (const string & test_name, const bool plot_ds_ = true) : 
+        init_11 (const string & test_name, const bool plot_ds_ = true, const int N = 40) : 
             test_init_base (test_name, plot_ds_)
         {
             int preview_sampling_time_ms = 40;
-            wmg = new WMG (40, preview_sampling_time_ms, 0.02);
+            wmg = new WMG (N, preview_sampling_time_ms, 0.02);
             par = new smpc_parameters (wmg->N, 0.252007);
             int ss_time_ms = 400;
             int ds_time_ms = 40;